@@ -0,0 +1,350 @@
+#include "graphics_blit.h"
+
+
+void read_solid_span(void *source_ctx, int x, int y, int width, uint16_t *span_buffer)
+{
+    uint16_t BGR_color = ((solid_source_t *)source_ctx)->BGR_color;
+
+    for (int i = 0; i < width; ++i)
+    {
+        span_buffer[i] = BGR_color;
+    }
+}
+
+
+void read_image_span(void *source_ctx, int x, int y, int width, uint16_t *span_buffer)
+{
+    image_source_t *source = (image_source_t *)source_ctx;
+    draw_t image = source->draw_params;
+
+    int image_x = x - image.draw_start_x;
+    int image_y = y - image.draw_start_y;
+
+    // Outside the image.
+    if ( (image_y < 0) || (image_y >= image.image_size_y) || (image_x >= image.image_size_x) || (image_x + width <= 0) )
+    {
+        memset(span_buffer, 0, width * sizeof(uint16_t));
+        return;
+    }
+
+    // Left of the image.
+    while ( (image_x < 0) && (width > 0) )
+    {
+        *span_buffer++ = 0;
+        ++image_x;
+        --width;
+    }
+
+    int copy_width = image.image_size_x - image_x < width ? image.image_size_x - image_x : width;
+    memcpy(span_buffer, source->image_buffer + image_y * image.image_size_x + image_x, copy_width * sizeof(uint16_t));
+
+    // Right of the image.
+    memset(span_buffer + copy_width, 0, (width - copy_width) * sizeof(uint16_t));
+}
+
+
+uint16_t blend_bgr565(uint16_t foreground, uint16_t background, uint32_t alpha)
+{
+    // Back to RGB565 to get the channels in one piece.
+    uint32_t fg = COLOR_SWAP(foreground) & 0xFFFF;
+    uint32_t bg = COLOR_SWAP(background) & 0xFFFF;
+
+    // Spread the channels out as 00000GGGGGG00000RRRRR000000BBBBB, so red, green and blue blend in a single multiply.
+    fg = (fg | (fg << 16)) & 0x07E0F81F;
+    bg = (bg | (bg << 16)) & 0x07E0F81F;
+
+    uint32_t result = ((((fg - bg) * alpha) >> 5) + bg) & 0x07E0F81F;
+    uint16_t RGB_result = (uint16_t)(result | (result >> 16));
+
+    return COLOR_SWAP(RGB_result);
+}
+
+
+uint16_t argb4444_to_bgr565(uint16_t argb_pixel)
+{
+    uint32_t red = (argb_pixel >> 8) & 0x0F;
+    uint32_t green = (argb_pixel >> 4) & 0x0F;
+    uint32_t blue = argb_pixel & 0x0F;
+
+    // Widen each channel to 8 bits by repeating it, built straight in the panel's order.
+    return BGR565_FROM_RGB888((red << 4) | red, (green << 4) | green, (blue << 4) | blue);
+}
+
+
+void blend_sprite_line(const sprite_t *sprite, int first_pixel, int width, uint16_t *line_buffer)
+{
+    const uint16_t *pixels = sprite->pixels + first_pixel;
+    int i = 0;
+
+    switch (sprite->format)
+    {
+        case SPRITE_FORMAT_COLOR_KEY:
+            while (i < width)
+            {
+                // Skip the transparent run.
+                while ( (i < width) && (pixels[i] == sprite->key_color) )
+                {
+                    ++i;
+                }
+
+                // Copy the opaque run.
+                int run_start = i;
+                while ( (i < width) && (pixels[i] != sprite->key_color) )
+                {
+                    ++i;
+                }
+                memcpy(line_buffer + run_start, pixels + run_start, (i - run_start) * sizeof(uint16_t));
+            }
+            break;
+
+        case SPRITE_FORMAT_A8:
+        {
+            const uint8_t *alpha = sprite->alpha + first_pixel;
+
+            for (; i < width; ++i)
+            {
+                if (alpha[i] == 0)
+                {
+                    continue;
+                }
+
+                if (alpha[i] == 255)
+                {
+                    line_buffer[i] = pixels[i];
+                    continue;
+                }
+
+                // 8 bit alpha to 0 - 32.
+                line_buffer[i] = blend_bgr565(pixels[i], line_buffer[i], (alpha[i] + 4) >> 3);
+            }
+            break;
+        }
+
+        case SPRITE_FORMAT_ARGB4444:
+            for (; i < width; ++i)
+            {
+                uint32_t alpha = pixels[i] >> 12;
+
+                if (alpha == 0)
+                {
+                    continue;
+                }
+
+                if (alpha == 15)
+                {
+                    line_buffer[i] = argb4444_to_bgr565(pixels[i]);
+                    continue;
+                }
+
+                // 4 bit alpha to 0 - 32.
+                line_buffer[i] = blend_bgr565(argb4444_to_bgr565(pixels[i]), line_buffer[i], (alpha << 1) + (alpha >> 3));
+            }
+            break;
+    }
+}
+
+
+void merge_overlapping_regions(draw_t *regions, int *region_amount)
+{
+    int merged = 1;
+
+    while (merged)
+    {
+        merged = 0;
+
+        for (int i = 0; i < *region_amount; ++i)
+        {
+            for (int j = i + 1; j < *region_amount; ++j)
+            {
+                draw_t *a = &regions[i];
+                draw_t *b = &regions[j];
+                int a_x_end = a->draw_start_x + a->image_size_x;
+                int a_y_end = a->draw_start_y + a->image_size_y;
+                int b_x_end = b->draw_start_x + b->image_size_x;
+                int b_y_end = b->draw_start_y + b->image_size_y;
+
+                if ( (a->draw_start_x >= b_x_end) || (b->draw_start_x >= a_x_end) || (a->draw_start_y >= b_y_end) || (b->draw_start_y >= a_y_end) )
+                {
+                    continue;
+                }
+
+                a->draw_start_x = a->draw_start_x < b->draw_start_x ? a->draw_start_x : b->draw_start_x;
+                a->draw_start_y = a->draw_start_y < b->draw_start_y ? a->draw_start_y : b->draw_start_y;
+                a->image_size_x = (a_x_end > b_x_end ? a_x_end : b_x_end) - a->draw_start_x;
+                a->image_size_y = (a_y_end > b_y_end ? a_y_end : b_y_end) - a->draw_start_y;
+
+                regions[j] = regions[*region_amount - 1];
+                *region_amount -= 1;
+                merged = 1;
+                --j;
+            }
+        }
+    }
+}
+
+
+// Without a background only the opaque runs of a color keyed sprite can be drawn, each run as its own window. The runs
+// are packed one after another into every free pool block and queued, so they are only waited for when the blocks run
+// out and once at the end.
+static int blit_opaque_runs(esp_lcd_panel_handle_t panel_handle, const sprite_t *sprite, int sprite_x, int sprite_y, draw_t clip)
+{
+    uint16_t *run_buffers[POOL_BLOCK_AMOUNT];
+    int run_buffer_amount = 0;
+
+    while (run_buffer_amount < POOL_BLOCK_AMOUNT)
+    {
+        run_buffers[run_buffer_amount] = pool_borrow();
+        if (run_buffers[run_buffer_amount] == NULL)
+        {
+            break;
+        }
+        run_buffer_amount += 1;
+    }
+
+    if (run_buffer_amount == 0)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for blitting.");
+        return DRAW_FAILURE;
+    }
+
+    int result = DRAW_SUCCESS;
+    int next_buffer = 0;
+    int used_pixels = 0;
+    draw_t run = clip;
+    run.image_size_y = 1;
+
+    for (int line = 0; line < clip.image_size_y; ++line)
+    {
+        const uint16_t *pixels = sprite->pixels + (clip.draw_start_y + line - sprite_y) * sprite->width + (clip.draw_start_x - sprite_x);
+        int i = 0;
+
+        while (i < clip.image_size_x)
+        {
+            // Skip the transparent run.
+            while ( (i < clip.image_size_x) && (pixels[i] == sprite->key_color) )
+            {
+                ++i;
+            }
+
+            int run_start = i;
+            while ( (i < clip.image_size_x) && (pixels[i] != sprite->key_color) )
+            {
+                ++i;
+            }
+
+            if (i > run_start)
+            {
+                // The run does not fit behind the runs already in this block, go on with the next one.
+                if (used_pixels + (i - run_start) > POOL_BLOCK_PIXELS)
+                {
+                    next_buffer += 1;
+                    used_pixels = 0;
+                }
+
+                // All blocks queued, wait for them before copying over them.
+                if (next_buffer == run_buffer_amount)
+                {
+                    wait_for_draws();
+                    next_buffer = 0;
+                }
+
+                uint16_t *run_buffer = run_buffers[next_buffer] + used_pixels;
+                used_pixels += i - run_start;
+
+                // Copied, since sprites usually live in flash, which DMA cannot read.
+                memcpy(run_buffer, pixels + run_start, (i - run_start) * sizeof(uint16_t));
+
+                run.draw_start_x = clip.draw_start_x + run_start;
+                run.draw_start_y = clip.draw_start_y + line;
+                run.image_size_x = i - run_start;
+
+                result |= queue_bgr_image(panel_handle, run, run_buffer);
+            }
+        }
+    }
+
+    wait_for_draws();
+
+    for (int i = 0; i < run_buffer_amount; ++i)
+    {
+        pool_return(run_buffers[i]);
+    }
+
+    return result;
+}
+
+
+int blit_sprite(esp_lcd_panel_handle_t panel_handle, const sprite_t *sprite, int x, int y, const pixel_source_t *background)
+{
+    // Sanity checks.
+    if ( (sprite == NULL) || (sprite->pixels == NULL) || ( (sprite->format == SPRITE_FORMAT_A8) && (sprite->alpha == NULL) ) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot blit, sprite or its buffers are NULL pointers.");
+        return DRAW_FAILURE;
+    }
+
+    if ( (background == NULL) && (sprite->format != SPRITE_FORMAT_COLOR_KEY) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Blending a sprite needs a background source.");
+        return DRAW_FAILURE;
+    }
+
+    // Clip the sprite to the screen.
+    int x_start = x < 0 ? 0 : x;
+    int y_start = y < 0 ? 0 : y;
+    int x_end = x + sprite->width > SCREEN_WIDTH ? SCREEN_WIDTH : x + sprite->width;
+    int y_end = y + sprite->height > SCREEN_HEIGHT ? SCREEN_HEIGHT : y + sprite->height;
+
+    // Nothing on screen.
+    if ( (x_start >= x_end) || (y_start >= y_end) )
+    {
+        return DRAW_SUCCESS;
+    }
+
+    draw_t clip = {
+        .draw_start_x = x_start,
+        .draw_start_y = y_start,
+        .image_size_x = x_end - x_start,
+        .image_size_y = y_end - y_start,
+        .scale_x = 1,
+        .scale_y = 1,
+    };
+
+    if (background == NULL)
+    {
+        return blit_opaque_runs(panel_handle, sprite, x, y, clip);
+    }
+
+    uint16_t *band_buffer = pool_borrow();
+    if (band_buffer == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for blitting.");
+        return DRAW_FAILURE;
+    }
+
+    int result = DRAW_SUCCESS;
+    int band_lines = POOL_BLOCK_PIXELS / clip.image_size_x;
+    draw_t band = clip;
+
+    // Composite band by band, background first then the sprite on top.
+    for (int line = 0; line < clip.image_size_y; line += band_lines)
+    {
+        band.draw_start_y = clip.draw_start_y + line;
+        band.image_size_y = clip.image_size_y - line < band_lines ? clip.image_size_y - line : band_lines;
+
+        for (int band_line = 0; band_line < band.image_size_y; ++band_line)
+        {
+            uint16_t *line_buffer = band_buffer + band_line * clip.image_size_x;
+            int screen_y = band.draw_start_y + band_line;
+
+            background->read_span(background->source_ctx, clip.draw_start_x, screen_y, clip.image_size_x, line_buffer);
+            blend_sprite_line(sprite, (screen_y - y) * sprite->width + (clip.draw_start_x - x), clip.image_size_x, line_buffer);
+        }
+
+        result |= draw_bgr_image(panel_handle, band, band_buffer);
+    }
+
+    pool_return(band_buffer);
+
+    return result;
+}
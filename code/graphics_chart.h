@@ -0,0 +1,83 @@
+#ifndef GRAPHICS_CHART_H
+#define GRAPHICS_CHART_H
+
+#include "graphics_font.h"
+
+
+// Autoscale hysteresis, the range shrinks once the samples shown span less than this fraction of it.
+#define CHART_SHRINK_FRACTION 0.25f
+
+// Headroom added above and below the samples when rescaling, as a fraction of their span.
+#define CHART_HEADROOM_FRACTION 0.1f
+
+
+// How a chart shows new samples.
+typedef enum {
+    CHART_SWEEP,                // Time runs to the right. Each sample is drawn in the next column, wrapping at the right edge,
+                                // with the column after it cleared to show where the sweep is.
+    CHART_HARDWARE_SCROLL,      // Time runs down. Each sample is drawn as a new line at the bottom and the plot is moved up
+                                // with the hardware scroll, so the plot must span the screen width.
+} chart_mode_t;
+
+// Chart configuration, get the defaults with get_default_chart_config().
+typedef struct {
+    chart_mode_t mode;
+    draw_t plot;                // Screen area of the plot, only start and size are used.
+
+    // RGB565 colors, like fill_rect().
+    uint16_t line_color;
+    uint16_t grid_color;
+    uint16_t background_color;
+    uint16_t label_color;
+
+    uint16_t time_grid;         // Samples between time gridlines, 0 for none.
+    uint8_t value_grid_lines;   // Value gridlines aimed for, the step is rounded to 1, 2 or 5 times a power of ten.
+    float min_span;             // Smallest value range shown, keeps noise on a steady signal from filling the plot.
+
+    // Gridline values are drawn in a strip next to the plot, left of it for CHART_SWEEP and above it for
+    // CHART_HARDWARE_SCROLL. NULL for no labels.
+    const aa_font_t *label_font;
+    uint16_t label_size;        // Width or height of the label strip.
+} chart_config_t;
+
+// Strip chart, a ring buffer of the last samples and what the screen shows.
+typedef struct {
+    chart_config_t config;
+    float *samples;
+    uint16_t slots;             // Pixels of the time axis, columns or frame memory lines.
+    uint16_t capacity;          // Samples kept.
+    uint32_t sample_amount;     // Samples appended since chart_init().
+
+    // Value range of the plot.
+    float range_min;
+    float range_max;
+    float grid_step;
+    uint8_t scaled;             // The range is set.
+    uint8_t drawn;              // The screen shows the chart, only new samples have to be drawn.
+
+    uint32_t rescales;
+    uint32_t full_redraws;
+    uint64_t pixel_bytes_sent;
+} chart_t;
+
+
+// Default configuration, a sweeping chart in the top half of the screen with labels in font_sans_12.
+void get_default_chart_config(chart_config_t *config);
+
+// Sets up a chart. sample_storage must hold the plot width in samples for CHART_SWEEP, or the plot height + 1 for
+// CHART_HARDWARE_SCROLL, where the top line still needs the sample before it. It is not copied and must stay valid.
+int chart_init(chart_t *chart, const chart_config_t *config, float *sample_storage);
+
+// Adds a sample and draws it. Only the new column or line is sent, unless the value range changes: samples outside
+// the range grow it right away, it shrinks with hysteresis. A new range redraws the plot and its labels.
+// Non finite samples, Ex: NAN for a missing reading, leave a gap in the line.
+int append_chart_sample(esp_lcd_panel_handle_t panel_handle, chart_t *chart, float value);
+
+// Redraws the whole chart and its labels.
+int draw_chart(esp_lcd_panel_handle_t panel_handle, chart_t *chart);
+
+// Turns the hardware scroll of a CHART_HARDWARE_SCROLL chart off, needed before drawing anything else over the plot.
+// The chart is redrawn at its next sample.
+int release_chart_scroll(esp_lcd_panel_handle_t panel_handle, chart_t *chart);
+
+#endif
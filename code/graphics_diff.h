@@ -0,0 +1,38 @@
+#ifndef GRAPHICS_DIFF_H
+#define GRAPHICS_DIFF_H
+
+#include "graphics.h"
+
+
+// Side of the square tiles a frame is compared in. A tile row is sent as one band, so it must fit in a pool block.
+#define FRAME_DIFF_TILE_SIZE 16
+#define FRAME_DIFF_COLUMNS ((SCREEN_WIDTH + FRAME_DIFF_TILE_SIZE - 1) / FRAME_DIFF_TILE_SIZE)
+#define FRAME_DIFF_ROWS ((SCREEN_HEIGHT + FRAME_DIFF_TILE_SIZE - 1) / FRAME_DIFF_TILE_SIZE)
+#define FRAME_DIFF_MAX_TILES (((SCREEN_MAX_WIDTH + FRAME_DIFF_TILE_SIZE - 1) / FRAME_DIFF_TILE_SIZE) * \
+    ((SCREEN_MAX_HEIGHT + FRAME_DIFF_TILE_SIZE - 1) / FRAME_DIFF_TILE_SIZE))
+
+
+// Frame differ, the tile hashes of the last frame sent and how much was sent.
+typedef struct {
+    uint32_t tile_hashes[FRAME_DIFF_MAX_TILES];
+    uint8_t valid;              // The hashes match the screen.
+
+    uint32_t frames;
+    uint32_t tiles_compared;
+    uint32_t tiles_sent;
+    uint32_t windows_sent;
+    uint64_t pixel_bytes_sent;
+} frame_differ_t;
+
+
+// Sets up a frame differ, the first frame submitted is sent whole.
+void frame_differ_init(frame_differ_t *differ);
+
+// Makes the next submit_frame() send the whole frame, Ex: after drawing over the screen with other calls.
+void invalidate_frame_differ(frame_differ_t *differ);
+
+// Sends a full screen BGR565 frame, SCREEN_WIDTH * SCREEN_HEIGHT pixels. Only the tiles whose hash changed since the
+// last frame are sent, changed tiles next to each other in a tile row go out as a single window.
+int submit_frame(esp_lcd_panel_handle_t panel_handle, frame_differ_t *differ, const uint16_t *frame_buffer);
+
+#endif
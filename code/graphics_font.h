@@ -0,0 +1,99 @@
+#ifndef GRAPHICS_FONT_H
+#define GRAPHICS_FONT_H
+
+#include "graphics.h"
+
+
+// Amount of (text color, background color) blend tables kept, the oldest is replaced when a new pair is used.
+#define AA_BLEND_CACHE_SIZE 4
+
+// Glyph cache for fonts read through a reader callback. Only the glyphs in use are kept in memory,
+// a glyph bitmap must fit in a single slot.
+#define AA_GLYPH_CACHE_SLOTS 8
+#define AA_GLYPH_CACHE_SLOT_SIZE 320
+
+// First bytes of a binary font blob, see tools/make_font.py for the layout.
+#define AA_FONT_BLOB_MAGIC "AAF1"
+
+
+// Anti-aliased glyph, the ink of a character cropped to its bounding box.
+typedef struct {
+    uint32_t bitmap_offset;     // Offset of the first glyph line in the font bitmap, in bytes.
+    uint8_t width;
+    uint8_t height;
+    int8_t x_offset;            // From the pen position to the left edge of the glyph.
+    int8_t y_offset;            // From the top of the line to the top edge of the glyph.
+    uint8_t advance;            // Pen movement after the glyph, padded to 12 bytes like the glyph table of a font blob.
+} aa_glyph_t;
+
+// Range of consecutive code points in a font.
+typedef struct {
+    uint32_t first_code_point;
+    uint16_t length;
+    uint16_t first_glyph;       // Index of the glyph of first_code_point.
+} aa_range_t;
+
+// Reads size bytes at offset of a font blob, for fonts that are not mapped into memory. Returns 0 on success.
+typedef int (*aa_font_reader_t)(void *reader_ctx, uint32_t offset, void *buffer, uint32_t size);
+
+// Anti-aliased font with 2 or 4 bit coverage per pixel, packed most significant bits first, every glyph line starting on a new byte.
+// Generate new fonts with tools/make_font.py.
+typedef struct {
+    uint8_t bpp;
+    uint8_t line_height;
+    uint8_t baseline;           // From the top of the line.
+    uint16_t first_char;
+    uint16_t glyph_amount;
+    const aa_glyph_t *glyphs;
+    const uint8_t *bitmap;
+
+    const aa_range_t *ranges;   // Sorted code point ranges, NULL for a single range starting at first_char.
+    uint16_t range_amount;
+
+    // Only used by fonts opened with open_aa_font_reader(), glyphs and bitmap are then NULL.
+    aa_font_reader_t reader;
+    void *reader_ctx;
+    uint32_t glyphs_offset;
+    uint32_t bitmap_offset;
+    uint32_t bitmap_size;
+} aa_font_t;
+
+
+// Built in fonts, DejaVu Sans at native sizes.
+extern const aa_font_t font_sans_12;          // 2 bpp, ASCII and Latin-1 (Ex: æøå, ß, ä).
+extern const aa_font_t font_sans_16;          // 4 bpp, ASCII and Latin-1.
+extern const aa_font_t font_sans_bold_24;     // 4 bpp, '+' to ':', digits and signs for large numbers.
+
+
+// Sets up font from a binary font blob in memory, Ex: embedded with EMBED_FILES or memory mapped flash.
+// The font points into the blob, so the blob must stay valid and 4 byte aligned. Nothing is copied.
+int load_aa_font_blob(aa_font_t *font, const void *blob, size_t blob_size);
+
+#ifndef GRAPHICS_HOST_BUILD
+// Sets up font from a binary font blob written to a data partition, by memory mapping it.
+// Only the parts of the font that are drawn are read from flash. Not in host builds.
+int load_aa_font_partition(aa_font_t *font, const char *partition_label);
+#endif
+
+// Sets up font from a binary font blob read through reader, Ex: a file. The range table is read into range_storage,
+// glyphs are read when drawn and kept in a small glyph cache.
+int open_aa_font_reader(aa_font_t *font, aa_range_t *range_storage, uint16_t max_ranges, aa_font_reader_t reader, void *reader_ctx);
+
+// Decodes the UTF-8 character at *text and moves *text past it. Invalid sequences decode as U+FFFD.
+uint32_t decode_utf8(const char **text, const char *text_end);
+
+// Returns the width of UTF-8 text in pixels, when drawn with font.
+int get_aa_text_width(const aa_font_t *font, const char *text_buffer, unsigned int buffer_size);
+
+// Renders one pixel line of anti-aliased UTF-8 text into a span, for drawing text line by line under other content.
+// text_line is counted from the top of the font line, the span holds width pixels starting first_x pixels from the
+// left edge of the text. Ink is blended against background_color, pixels without ink are left as they are.
+void render_aa_text_span(const aa_font_t *font, uint16_t text_color, uint16_t background_color, const char *text_buffer,
+    unsigned int buffer_size, int text_line, int first_x, int width, uint16_t *span_buffer);
+
+// Draws a single line of anti-aliased UTF-8 text with its top left corner at start_x, start_y, clipped to the screen.
+// buffer_size is in bytes. The line is drawn as one window on background_color, characters not in the font are skipped.
+int draw_aa_text(esp_lcd_panel_handle_t panel_handle, const aa_font_t *font, unsigned short start_x, unsigned short start_y,
+    uint16_t text_color, uint16_t background_color, const char *text_buffer, unsigned int buffer_size);
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef GRAPHICS_FRAME_H
+#define GRAPHICS_FRAME_H
+
+#include "graphics.h"
+
+
+// Maximum amount of render callbacks a single frame scheduler can run.
+#define FRAME_MAX_RENDER_CALLBACKS 8
+
+// Amount of recent frame times kept for the p99 calculation.
+#define FRAME_HISTORY_SIZE 128
+
+// Redefinitions for return readability.
+#define FRAME_SUCCESS 0
+#define FRAME_FAILURE 1
+
+
+// Render callback, draws the contents of a single frame.
+// frame_number counts frame slots, so it also advances past dropped frames and animations stay on time.
+typedef void (*frame_render_cb_t)(esp_lcd_panel_handle_t panel_handle, uint32_t frame_number, void *user_ctx);
+
+// Flush callback, called after all render callbacks to push out anything the renderers queued.
+typedef void (*frame_flush_cb_t)(esp_lcd_panel_handle_t panel_handle, void *user_ctx);
+
+
+// Frame time statistics, all times in microseconds.
+typedef struct {
+    uint32_t frames;            // Frames rendered.
+    uint32_t dropped;           // Frame slots skipped because the previous frame went over budget.
+
+    int64_t min_us;
+    int64_t avg_us;
+    int64_t p99_us;             // Taken over the last FRAME_HISTORY_SIZE frames.
+    int64_t max_us;
+
+    int64_t avg_render_us;      // Average time spent in the render callbacks, excluding transfers.
+    int64_t avg_transfer_us;    // Average time spent sending to the LCD.
+} frame_stats_t;
+
+
+// Frame scheduler structure, treat the fields as private and use the functions below.
+typedef struct {
+    esp_lcd_panel_handle_t panel_handle;
+
+    int64_t period_us;
+    int64_t next_deadline_us;
+    int64_t frame_start_us;
+    transfer_stats_t frame_start_transfers;
+    uint32_t frame_number;
+    int in_frame;
+
+    frame_render_cb_t render_cb[FRAME_MAX_RENDER_CALLBACKS];
+    void *render_ctx[FRAME_MAX_RENDER_CALLBACKS];
+    unsigned short render_cb_amount;
+
+    frame_flush_cb_t flush_cb;
+    void *flush_ctx;
+
+    // Statistics.
+    uint32_t frames;
+    uint32_t dropped;
+    int64_t min_us;
+    int64_t max_us;
+    int64_t total_us;
+    int64_t total_transfer_us;
+    int32_t history_us[FRAME_HISTORY_SIZE];
+    unsigned short history_index;
+} frame_scheduler_t;
+
+
+// Sets up a frame scheduler running at target_fps frames per second.
+int frame_scheduler_init(frame_scheduler_t *scheduler, esp_lcd_panel_handle_t panel_handle, unsigned short target_fps);
+
+// Changes the target frame rate, takes effect from the next frame.
+int set_target_fps(frame_scheduler_t *scheduler, unsigned short target_fps);
+
+// Registers a render callback, callbacks run in the order they were added.
+int add_render_callback(frame_scheduler_t *scheduler, frame_render_cb_t render_cb, void *user_ctx);
+
+// Sets the flush callback run at the end of every frame, NULL removes it.
+void set_flush_callback(frame_scheduler_t *scheduler, frame_flush_cb_t flush_cb, void *user_ctx);
+
+// Marks the start of a frame, use together with end_frame() when drawing without render callbacks.
+int begin_frame(frame_scheduler_t *scheduler);
+
+// Flushes, records the frame time and sleeps until the next frame is due. The part of the wait below a tick is spent
+// polling the timer, at most one tick of busy waiting per frame.
+// If the frame went over budget the missed frame slots are dropped instead of rendered late.
+int end_frame(frame_scheduler_t *scheduler);
+
+// Runs a whole frame: begin_frame(), all render callbacks, then end_frame().
+int run_frame(frame_scheduler_t *scheduler);
+
+// Calculates the frame statistics since init or the last reset.
+void get_frame_stats(const frame_scheduler_t *scheduler, frame_stats_t *stats);
+
+// Clears the frame statistics.
+void reset_frame_stats(frame_scheduler_t *scheduler);
+
+#endif
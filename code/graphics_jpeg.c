@@ -0,0 +1,1105 @@
+#include "graphics_jpeg.h"
+
+
+// Bytes read from the byte source at a time.
+#define JPEG_INPUT_BUFFER_SIZE 256
+
+// Bits looked up at once when decoding Huffman codes, longer codes are searched length by length.
+#define HUFFMAN_LOOKUP_BITS 8
+
+// Largest dequantized coefficient of 8 bit samples. Larger ones only come from broken files and would overflow the
+// integer IDCT, which holds up to about 2300.
+#define JPEG_COEFFICIENT_LIMIT 2047
+
+// Markers, the byte after 0xFF.
+#define MARKER_SOF0 0xC0
+#define MARKER_SOF1 0xC1
+#define MARKER_DHT 0xC4
+#define MARKER_RST0 0xD0
+#define MARKER_RST7 0xD7
+#define MARKER_SOI 0xD8
+#define MARKER_EOI 0xD9
+#define MARKER_SOS 0xDA
+#define MARKER_DQT 0xDB
+#define MARKER_DRI 0xDD
+
+
+// Huffman table, the codes are canonical so a value follows from the code length and its distance to the first code.
+typedef struct {
+    uint16_t lookup[1 << HUFFMAN_LOOKUP_BITS];   // (length << 8) | value for codes up to HUFFMAN_LOOKUP_BITS long, 0 if longer.
+    uint8_t values[256];
+    int32_t max_code[17];       // Largest code of each length, -1 if there are none.
+    int32_t value_offset[17];   // Index into values minus the first code of each length.
+    uint8_t defined;
+} huffman_table_t;
+
+typedef struct {
+    uint8_t id;
+    uint8_t h_sampling;
+    uint8_t v_sampling;
+    uint8_t quant_table;
+    uint8_t dc_table;
+    uint8_t ac_table;
+    int dc_prediction;
+
+    // Samples of the current MCU, after the IDCT or one per block at 1/8 scale.
+    int plane_width;
+    int plane_height;
+    uint8_t plane[JPEG_MAX_MCU_SIZE * JPEG_MAX_MCU_SIZE];
+
+    // Plane position and box size of every output pixel of an MCU.
+    uint8_t map_x[JPEG_MAX_MCU_SIZE];
+    uint8_t map_y[JPEG_MAX_MCU_SIZE];
+    uint8_t box_x;
+    uint8_t box_y;
+} jpeg_component_t;
+
+typedef struct {
+    stream_read_cb_t read_cb;
+    void *stream_ctx;
+    uint8_t input[JPEG_INPUT_BUFFER_SIZE];
+    int input_position;
+    int input_length;
+
+    // Entropy coded data, MSB first. A marker stops the bits, zeros are fed after it.
+    uint32_t bit_buffer;
+    int bit_count;
+    int marker;                 // Marker found in the entropy coded data, -1 if none.
+    uint8_t truncated;          // The stream ended inside the entropy coded data.
+
+    uint16_t quant_tables[4][64];   // Zigzag order.
+    huffman_table_t dc_tables[2];
+    huffman_table_t ac_tables[2];
+    jpeg_component_t components[3];
+    int component_amount;
+    int width;
+    int height;
+    int restart_interval;
+    int16_t coefficients[64];
+} jpeg_decoder_t;
+
+
+// Natural position of every zigzag index.
+static const uint8_t zigzag[64] = {
+    0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+// Static, the decoder is a few KB and would otherwise sit on the caller's stack.
+static jpeg_decoder_t decoder;
+
+
+// Reads one byte, -1 at the end of the stream.
+static int read_byte(jpeg_decoder_t *jpeg)
+{
+    if (jpeg->input_position == jpeg->input_length)
+    {
+        int length = jpeg->read_cb(jpeg->stream_ctx, jpeg->input, JPEG_INPUT_BUFFER_SIZE);
+        if (length <= 0)
+        {
+            return -1;
+        }
+
+        jpeg->input_position = 0;
+        jpeg->input_length = length;
+    }
+
+    return jpeg->input[jpeg->input_position++];
+}
+
+
+// Reads a big endian 16 bit value, -1 at the end of the stream.
+static int read_u16(jpeg_decoder_t *jpeg)
+{
+    int high = read_byte(jpeg);
+    int low = read_byte(jpeg);
+
+    if ( (high < 0) || (low < 0) )
+    {
+        return -1;
+    }
+
+    return (high << 8) | low;
+}
+
+
+static int skip_bytes(jpeg_decoder_t *jpeg, int amount)
+{
+    for (int i = 0; i < amount; ++i)
+    {
+        if (read_byte(jpeg) < 0)
+        {
+            return DRAW_FAILURE;
+        }
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+// Reads the next marker, skipping anything before it. -1 at the end of the stream.
+static int read_marker(jpeg_decoder_t *jpeg)
+{
+    int byte = read_byte(jpeg);
+
+    while (byte >= 0)
+    {
+        if (byte == 0xFF)
+        {
+            // 0xFF may be repeated as fill.
+            do
+            {
+                byte = read_byte(jpeg);
+            } while (byte == 0xFF);
+
+            if (byte > 0)
+            {
+                return byte;
+            }
+        }
+
+        byte = read_byte(jpeg);
+    }
+
+    return -1;
+}
+
+
+static int read_quant_tables(jpeg_decoder_t *jpeg, int length)
+{
+    while (length > 0)
+    {
+        int info = read_byte(jpeg);
+        int precision = info >> 4;
+        int table = info & 15;
+
+        if ( (info < 0) || (table > 3) || (precision > 1) )
+        {
+            ESP_LOGE(TAG_DISPLAY, "JPEG quantization table is invalid.");
+            return DRAW_FAILURE;
+        }
+
+        for (int i = 0; i < 64; ++i)
+        {
+            int value = precision ? read_u16(jpeg) : read_byte(jpeg);
+            if (value < 0)
+            {
+                return DRAW_FAILURE;
+            }
+            jpeg->quant_tables[table][i] = value;
+        }
+
+        length -= 1 + 64 * (precision + 1);
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+static int read_huffman_tables(jpeg_decoder_t *jpeg, int length)
+{
+    while (length > 0)
+    {
+        int info = read_byte(jpeg);
+        int table_class = info >> 4;
+        int table_id = info & 15;
+
+        if ( (info < 0) || (table_class > 1) || (table_id > 1) )
+        {
+            ESP_LOGE(TAG_DISPLAY, "JPEG Huffman table is invalid, only baseline tables are supported.");
+            return DRAW_FAILURE;
+        }
+
+        huffman_table_t *table = table_class ? &jpeg->ac_tables[table_id] : &jpeg->dc_tables[table_id];
+        uint8_t code_lengths[16];
+        int value_amount = 0;
+
+        for (int i = 0; i < 16; ++i)
+        {
+            int amount = read_byte(jpeg);
+            if (amount < 0)
+            {
+                return DRAW_FAILURE;
+            }
+            code_lengths[i] = amount;
+            value_amount += amount;
+        }
+
+        if (value_amount > 256)
+        {
+            ESP_LOGE(TAG_DISPLAY, "JPEG Huffman table has %d values.", value_amount);
+            return DRAW_FAILURE;
+        }
+
+        for (int i = 0; i < value_amount; ++i)
+        {
+            int value = read_byte(jpeg);
+            if (value < 0)
+            {
+                return DRAW_FAILURE;
+            }
+            table->values[i] = value;
+        }
+
+        // Canonical codes, each length continues from the codes of the previous one.
+        memset(table->lookup, 0, sizeof(table->lookup));
+        int code = 0;
+        int index = 0;
+
+        for (int bits = 1; bits <= 16; ++bits)
+        {
+            int amount = code_lengths[bits - 1];
+
+            table->value_offset[bits] = index - code;
+            table->max_code[bits] = amount ? code + amount - 1 : -1;
+
+            if (code + amount > (1 << bits))
+            {
+                ESP_LOGE(TAG_DISPLAY, "JPEG Huffman table has too many codes of length %d.", bits);
+                return DRAW_FAILURE;
+            }
+
+            for (int i = 0; i < amount; ++i, ++code, ++index)
+            {
+                if (bits <= HUFFMAN_LOOKUP_BITS)
+                {
+                    int shift = HUFFMAN_LOOKUP_BITS - bits;
+                    for (int fill = 0; fill < (1 << shift); ++fill)
+                    {
+                        table->lookup[(code << shift) | fill] = (bits << 8) | table->values[index];
+                    }
+                }
+            }
+
+            code <<= 1;
+        }
+
+        table->defined = 1;
+        length -= 17 + value_amount;
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+static int read_frame_header(jpeg_decoder_t *jpeg)
+{
+    int precision = read_byte(jpeg);
+    jpeg->height = read_u16(jpeg);
+    jpeg->width = read_u16(jpeg);
+    jpeg->component_amount = read_byte(jpeg);
+
+    if ( (precision != 8) || (jpeg->height <= 0) || (jpeg->width <= 0) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "JPEG frame must be 8 bit with a known height.");
+        return DRAW_FAILURE;
+    }
+
+    if ( (jpeg->component_amount != 1) && (jpeg->component_amount != 3) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "JPEG with %d components is not supported.", jpeg->component_amount);
+        return DRAW_FAILURE;
+    }
+
+    for (int i = 0; i < jpeg->component_amount; ++i)
+    {
+        jpeg_component_t *component = &jpeg->components[i];
+        int id = read_byte(jpeg);
+        int sampling = read_byte(jpeg);
+        int quant_table = read_byte(jpeg);
+
+        if ( (id < 0) || (sampling < 0) || (quant_table < 0) || (quant_table > 3) )
+        {
+            ESP_LOGE(TAG_DISPLAY, "JPEG frame header is invalid.");
+            return DRAW_FAILURE;
+        }
+
+        component->id = id;
+        component->h_sampling = sampling >> 4;
+        component->v_sampling = sampling & 15;
+        component->quant_table = quant_table;
+    }
+
+    // A single component is never interleaved, its MCU is one block whatever its sampling says.
+    if (jpeg->component_amount == 1)
+    {
+        jpeg->components[0].h_sampling = 1;
+        jpeg->components[0].v_sampling = 1;
+        return DRAW_SUCCESS;
+    }
+
+    jpeg_component_t *luma = &jpeg->components[0];
+    if ( (luma->h_sampling < 1) || (luma->h_sampling > 2) || (luma->v_sampling < 1) || (luma->v_sampling > 2) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "JPEG luma sampling %dx%d is not supported.", luma->h_sampling, luma->v_sampling);
+        return DRAW_FAILURE;
+    }
+
+    for (int i = 1; i < 3; ++i)
+    {
+        if ( (jpeg->components[i].h_sampling != 1) || (jpeg->components[i].v_sampling != 1) )
+        {
+            ESP_LOGE(TAG_DISPLAY, "JPEG chroma sampling must be 1x1.");
+            return DRAW_FAILURE;
+        }
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+static int read_scan_header(jpeg_decoder_t *jpeg)
+{
+    int scan_components = read_byte(jpeg);
+
+    if (scan_components != jpeg->component_amount)
+    {
+        ESP_LOGE(TAG_DISPLAY, "JPEG scans must hold every component.");
+        return DRAW_FAILURE;
+    }
+
+    for (int i = 0; i < scan_components; ++i)
+    {
+        int id = read_byte(jpeg);
+        int tables = read_byte(jpeg);
+        jpeg_component_t *component = NULL;
+
+        for (int c = 0; c < jpeg->component_amount; ++c)
+        {
+            if (jpeg->components[c].id == id)
+            {
+                component = &jpeg->components[c];
+            }
+        }
+
+        if ( (component == NULL) || (tables < 0) || ((tables >> 4) > 1) || ((tables & 15) > 1) )
+        {
+            ESP_LOGE(TAG_DISPLAY, "JPEG scan header is invalid.");
+            return DRAW_FAILURE;
+        }
+
+        component->dc_table = tables >> 4;
+        component->ac_table = tables & 15;
+
+        if (!jpeg->dc_tables[component->dc_table].defined || !jpeg->ac_tables[component->ac_table].defined)
+        {
+            ESP_LOGE(TAG_DISPLAY, "JPEG scan uses an undefined Huffman table.");
+            return DRAW_FAILURE;
+        }
+    }
+
+    // Spectral selection and successive approximation, fixed for baseline.
+    return skip_bytes(jpeg, 3);
+}
+
+
+// Reads markers up to the start of the scan.
+static int read_headers(jpeg_decoder_t *jpeg)
+{
+    int frame_read = 0;
+
+    if (read_marker(jpeg) != MARKER_SOI)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Not a JPEG, the start of image marker is missing.");
+        return DRAW_FAILURE;
+    }
+
+    while (1)
+    {
+        int marker = read_marker(jpeg);
+        if ( (marker < 0) || (marker == MARKER_EOI) )
+        {
+            ESP_LOGE(TAG_DISPLAY, "JPEG ended before its scan.");
+            return DRAW_FAILURE;
+        }
+
+        // Markers without a segment.
+        if ( (marker >= MARKER_RST0) && (marker <= MARKER_RST7) )
+        {
+            continue;
+        }
+
+        int length = read_u16(jpeg);
+        if (length < 2)
+        {
+            ESP_LOGE(TAG_DISPLAY, "JPEG segment is truncated.");
+            return DRAW_FAILURE;
+        }
+        length -= 2;
+
+        int result = DRAW_SUCCESS;
+
+        switch (marker)
+        {
+            case MARKER_DQT:
+                result = read_quant_tables(jpeg, length);
+                break;
+            case MARKER_DHT:
+                result = read_huffman_tables(jpeg, length);
+                break;
+            case MARKER_SOF0:
+            case MARKER_SOF1:
+                result = read_frame_header(jpeg);
+                frame_read = (result == DRAW_SUCCESS);
+                break;
+            case MARKER_DRI:
+                jpeg->restart_interval = read_u16(jpeg);
+                result = jpeg->restart_interval < 0 ? DRAW_FAILURE : DRAW_SUCCESS;
+                break;
+            case MARKER_SOS:
+                if (!frame_read)
+                {
+                    ESP_LOGE(TAG_DISPLAY, "JPEG scan before the frame header.");
+                    return DRAW_FAILURE;
+                }
+                return read_scan_header(jpeg);
+            default:
+                // Other frame types: progressive, lossless, arithmetic coding.
+                if ( (marker >= 0xC2) && (marker <= 0xCF) && (marker != 0xC8) && (marker != 0xCC) )
+                {
+                    ESP_LOGE(TAG_DISPLAY, "JPEG frame type 0x%02X is not supported, only baseline.", marker);
+                    return DRAW_FAILURE;
+                }
+                result = skip_bytes(jpeg, length);
+                break;
+        }
+
+        if (result != DRAW_SUCCESS)
+        {
+            return DRAW_FAILURE;
+        }
+    }
+}
+
+
+// Tops the bit buffer up to more than 24 bits.
+static void fill_bits(jpeg_decoder_t *jpeg)
+{
+    while (jpeg->bit_count <= 24)
+    {
+        int byte = 0;
+
+        if (jpeg->marker < 0)
+        {
+            byte = read_byte(jpeg);
+
+            if (byte < 0)
+            {
+                jpeg->marker = MARKER_EOI;
+                jpeg->truncated = 1;
+                byte = 0;
+            }
+            else if (byte == 0xFF)
+            {
+                // 0xFF 0x00 is a stuffed 0xFF, anything else is a marker.
+                int next = read_byte(jpeg);
+                while (next == 0xFF)
+                {
+                    next = read_byte(jpeg);
+                }
+
+                if (next < 0)
+                {
+                    jpeg->marker = MARKER_EOI;
+                    jpeg->truncated = 1;
+                    byte = 0;
+                }
+                else if (next != 0)
+                {
+                    jpeg->marker = next;
+                    byte = 0;
+                }
+            }
+        }
+
+        jpeg->bit_buffer |= (uint32_t)byte << (24 - jpeg->bit_count);
+        jpeg->bit_count += 8;
+    }
+}
+
+
+static int get_bits(jpeg_decoder_t *jpeg, int amount)
+{
+    if (jpeg->bit_count < amount)
+    {
+        fill_bits(jpeg);
+    }
+
+    int value = jpeg->bit_buffer >> (32 - amount);
+    jpeg->bit_buffer <<= amount;
+    jpeg->bit_count -= amount;
+
+    return value;
+}
+
+
+// Reads an amount bit coefficient, the upper half of the codes are positive and the lower half negative.
+static int receive_extend(jpeg_decoder_t *jpeg, int amount)
+{
+    if (amount == 0)
+    {
+        return 0;
+    }
+
+    int value = get_bits(jpeg, amount);
+
+    return value < (1 << (amount - 1)) ? value - (1 << amount) + 1 : value;
+}
+
+
+// Decodes one Huffman coded value, -1 for a code that is not in the table.
+static int decode_huffman(jpeg_decoder_t *jpeg, const huffman_table_t *table)
+{
+    if (jpeg->bit_count < 16)
+    {
+        fill_bits(jpeg);
+    }
+
+    int entry = table->lookup[jpeg->bit_buffer >> (32 - HUFFMAN_LOOKUP_BITS)];
+    if (entry != 0)
+    {
+        jpeg->bit_buffer <<= entry >> 8;
+        jpeg->bit_count -= entry >> 8;
+        return entry & 0xFF;
+    }
+
+    for (int bits = HUFFMAN_LOOKUP_BITS + 1; bits <= 16; ++bits)
+    {
+        int code = jpeg->bit_buffer >> (32 - bits);
+
+        if (code <= table->max_code[bits])
+        {
+            jpeg->bit_buffer <<= bits;
+            jpeg->bit_count -= bits;
+            return table->values[code + table->value_offset[bits]];
+        }
+    }
+
+    return -1;
+}
+
+
+static inline int clamp_coefficient(int value)
+{
+    return value < -JPEG_COEFFICIENT_LIMIT ? -JPEG_COEFFICIENT_LIMIT : (value > JPEG_COEFFICIENT_LIMIT ? JPEG_COEFFICIENT_LIMIT : value);
+}
+
+
+// Decodes the dequantized coefficients of one block into jpeg->coefficients, in natural order.
+static int decode_block(jpeg_decoder_t *jpeg, jpeg_component_t *component)
+{
+    const uint16_t *quant_table = jpeg->quant_tables[component->quant_table];
+    const huffman_table_t *ac_table = &jpeg->ac_tables[component->ac_table];
+    int16_t *coefficients = jpeg->coefficients;
+
+    memset(coefficients, 0, sizeof(jpeg->coefficients));
+
+    int size = decode_huffman(jpeg, &jpeg->dc_tables[component->dc_table]);
+    if ( (size < 0) || (size > 11) )
+    {
+        return DRAW_FAILURE;
+    }
+
+    // The prediction is clamped as well, broken files could otherwise grow it without end. AC values are at most 15 bits,
+    // times a 16 bit quantizer they still fit an int.
+    component->dc_prediction = clamp_coefficient(component->dc_prediction + receive_extend(jpeg, size));
+    coefficients[0] = clamp_coefficient(component->dc_prediction * quant_table[0]);
+
+    for (int k = 1; k < 64; )
+    {
+        int symbol = decode_huffman(jpeg, ac_table);
+        if (symbol < 0)
+        {
+            return DRAW_FAILURE;
+        }
+
+        int zeros = symbol >> 4;
+        size = symbol & 15;
+
+        if (size == 0)
+        {
+            // End of block, or 16 zeros.
+            if (zeros != 15)
+            {
+                break;
+            }
+            k += 16;
+            continue;
+        }
+
+        k += zeros;
+        if (k > 63)
+        {
+            return DRAW_FAILURE;
+        }
+
+        coefficients[zigzag[k]] = clamp_coefficient(receive_extend(jpeg, size) * quant_table[k]);
+        ++k;
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+static inline uint8_t clamp_sample(int value)
+{
+    return value < 0 ? 0 : (value > 255 ? 255 : value);
+}
+
+
+// One dimensional 8 point IDCT, integer version of the AAN factorization used by libjpeg's islow and stb_image.
+// Constants are scaled by 1 << 12, results are left unshifted for the caller to round.
+static inline void idct_1d(int s0, int s1, int s2, int s3, int s4, int s5, int s6, int s7, int *out)
+{
+    // Even part.
+    int p1 = (s2 + s6) * 2217;                  // 0.5411961
+    int t2 = p1 + s6 * -7567;                   // -1.847759065
+    int t3 = p1 + s2 * 3135;                    // 0.765366865
+    int t0 = (s0 + s4) * 4096;
+    int t1 = (s0 - s4) * 4096;
+    int x0 = t0 + t3;
+    int x3 = t0 - t3;
+    int x1 = t1 + t2;
+    int x2 = t1 - t2;
+
+    // Odd part.
+    t0 = s7;
+    t1 = s5;
+    t2 = s3;
+    t3 = s1;
+    int p3 = t0 + t2;
+    int p4 = t1 + t3;
+    p1 = t0 + t3;
+    int p2 = t1 + t2;
+    int p5 = (p3 + p4) * 4816;                  // 1.175875602
+    t0 = t0 * 1223;                             // 0.298631336
+    t1 = t1 * 8410;                             // 2.053119869
+    t2 = t2 * 12586;                            // 3.072711026
+    t3 = t3 * 6149;                             // 1.501321110
+    p1 = p5 + p1 * -3685;                       // -0.899976223
+    p2 = p5 + p2 * -10497;                      // -2.562915447
+    p3 = p3 * -8034;                            // -1.961570560
+    p4 = p4 * -1597;                            // -0.390180644
+    t3 += p1 + p4;
+    t2 += p2 + p3;
+    t1 += p2 + p4;
+    t0 += p1 + p3;
+
+    out[0] = x0 + t3;
+    out[7] = x0 - t3;
+    out[1] = x1 + t2;
+    out[6] = x1 - t2;
+    out[2] = x2 + t1;
+    out[5] = x2 - t1;
+    out[3] = x3 + t0;
+    out[4] = x3 - t0;
+}
+
+
+// Inverse DCT of jpeg->coefficients into 8x8 samples.
+static void idct_block(const int16_t *coefficients, uint8_t *samples, int stride)
+{
+    int columns[64];
+    int out[8];
+
+    // Columns, keeping 2 extra bits of precision.
+    for (int i = 0; i < 8; ++i)
+    {
+        const int16_t *d = coefficients + i;
+
+        if ( (d[8] | d[16] | d[24] | d[32] | d[40] | d[48] | d[56]) == 0 )
+        {
+            int dc = d[0] * 4;
+            for (int j = 0; j < 8; ++j)
+            {
+                columns[j * 8 + i] = dc;
+            }
+            continue;
+        }
+
+        idct_1d(d[0], d[8], d[16], d[24], d[32], d[40], d[48], d[56], out);
+        for (int j = 0; j < 8; ++j)
+        {
+            columns[j * 8 + i] = (out[j] + 512) >> 10;
+        }
+    }
+
+    // Rows, removing the 1 << 12 constant scale, the 2 extra bits and the 1 << 3 of the two passes, then level shifting.
+    for (int i = 0; i < 8; ++i)
+    {
+        const int *v = columns + i * 8;
+        uint8_t *row = samples + i * stride;
+
+        idct_1d(v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], out);
+        for (int j = 0; j < 8; ++j)
+        {
+            row[j] = clamp_sample((out[j] + 65536 + (128 << 17)) >> 17);
+        }
+    }
+}
+
+
+// Decodes every block of an MCU into the component planes.
+static int decode_mcu(jpeg_decoder_t *jpeg, jpeg_scale_t scale)
+{
+    for (int c = 0; c < jpeg->component_amount; ++c)
+    {
+        jpeg_component_t *component = &jpeg->components[c];
+
+        for (int block_y = 0; block_y < component->v_sampling; ++block_y)
+        {
+            for (int block_x = 0; block_x < component->h_sampling; ++block_x)
+            {
+                if (decode_block(jpeg, component) != DRAW_SUCCESS)
+                {
+                    return DRAW_FAILURE;
+                }
+
+                if (scale == JPEG_SCALE_1_8)
+                {
+                    // The DC coefficient is 8 times the block average.
+                    component->plane[block_y * component->plane_width + block_x] =
+                        clamp_sample(((jpeg->coefficients[0] + 4) >> 3) + 128);
+                }
+                else
+                {
+                    idct_block(jpeg->coefficients, component->plane + block_y * 8 * component->plane_width + block_x * 8,
+                        component->plane_width);
+                }
+            }
+        }
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+// Resyncs on a restart marker, the entropy coded data starts over on a byte boundary with DC predictions reset.
+static int process_restart(jpeg_decoder_t *jpeg)
+{
+    jpeg->bit_buffer = 0;
+    jpeg->bit_count = 0;
+
+    if (jpeg->marker < 0)
+    {
+        jpeg->marker = read_marker(jpeg);
+    }
+
+    if ( (jpeg->marker < MARKER_RST0) || (jpeg->marker > MARKER_RST7) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "JPEG restart marker is missing.");
+        return DRAW_FAILURE;
+    }
+
+    jpeg->marker = -1;
+    for (int c = 0; c < jpeg->component_amount; ++c)
+    {
+        jpeg->components[c].dc_prediction = 0;
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+// Plane sample for an output pixel, averaged over the box the pixel covers when the plane has more samples.
+static inline int component_sample(const jpeg_component_t *component, int x, int y)
+{
+    const uint8_t *samples = component->plane + component->map_y[y] * component->plane_width + component->map_x[x];
+
+    if ( (component->box_x == 1) && (component->box_y == 1) )
+    {
+        return samples[0];
+    }
+
+    int sum = 0;
+    for (int box_y = 0; box_y < component->box_y; ++box_y)
+    {
+        for (int box_x = 0; box_x < component->box_x; ++box_x)
+        {
+            sum += samples[box_y * component->plane_width + box_x];
+        }
+    }
+
+    int count = component->box_x * component->box_y;
+
+    return (sum + count / 2) / count;
+}
+
+
+// JFIF YCbCr to BGR565, 16 bit fixed point.
+static inline uint16_t ycbcr_to_bgr565(int luma, int cb, int cr)
+{
+    cb -= 128;
+    cr -= 128;
+
+    int red = clamp_sample(luma + ((91881 * cr + 32768) >> 16));
+    int green = clamp_sample(luma - ((22554 * cb + 46802 * cr + 32768) >> 16));
+    int blue = clamp_sample(luma + ((116130 * cb + 32768) >> 16));
+    return BGR565_FROM_RGB888(red, green, blue);
+}
+
+
+// Converts the output pixels of an MCU into the band.
+static void output_mcu(jpeg_decoder_t *jpeg, uint16_t *band_buffer, int band_width, int x_start, int width, int height)
+{
+    const jpeg_component_t *luma = &jpeg->components[0];
+
+    for (int y = 0; y < height; ++y)
+    {
+        uint16_t *pixels = band_buffer + y * band_width + x_start;
+
+        for (int x = 0; x < width; ++x)
+        {
+            int sample = component_sample(luma, x, y);
+
+            if (jpeg->component_amount == 1)
+            {
+                pixels[x] = BGR565_FROM_RGB888(sample, sample, sample);
+            }
+            else
+            {
+                pixels[x] = ycbcr_to_bgr565(sample, component_sample(&jpeg->components[1], x, y),
+                    component_sample(&jpeg->components[2], x, y));
+            }
+        }
+    }
+}
+
+
+// Sizes the planes and maps the output pixels of an MCU to plane samples.
+static void prepare_components(jpeg_decoder_t *jpeg, jpeg_scale_t scale, int mcu_width, int mcu_height)
+{
+    int block_size = scale == JPEG_SCALE_1_8 ? 1 : 8;
+
+    for (int c = 0; c < jpeg->component_amount; ++c)
+    {
+        jpeg_component_t *component = &jpeg->components[c];
+
+        component->plane_width = component->h_sampling * block_size;
+        component->plane_height = component->v_sampling * block_size;
+        component->box_x = component->plane_width > mcu_width ? component->plane_width / mcu_width : 1;
+        component->box_y = component->plane_height > mcu_height ? component->plane_height / mcu_height : 1;
+        component->dc_prediction = 0;
+
+        for (int x = 0; x < mcu_width; ++x)
+        {
+            component->map_x[x] = x * component->plane_width / mcu_width;
+        }
+        for (int y = 0; y < mcu_height; ++y)
+        {
+            component->map_y[y] = y * component->plane_height / mcu_height;
+        }
+    }
+}
+
+
+int decode_jpeg(stream_read_cb_t read_cb, void *stream_ctx, jpeg_scale_t scale, const jpeg_output_t *output, jpeg_info_t *info)
+{
+    // Sanity checks.
+    if ( (read_cb == NULL) || (output == NULL) || (output->get_band == NULL) || (output->put_band == NULL) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "JPEG read callback or output is a NULL pointer.");
+        return DRAW_FAILURE;
+    }
+
+    if ( (scale != JPEG_SCALE_1) && (scale != JPEG_SCALE_1_2) && (scale != JPEG_SCALE_1_4) && (scale != JPEG_SCALE_1_8) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "JPEG scale must be 1, 2, 4 or 8.");
+        return DRAW_FAILURE;
+    }
+
+    memset(&decoder, 0, sizeof(decoder));
+    decoder.read_cb = read_cb;
+    decoder.stream_ctx = stream_ctx;
+    decoder.marker = -1;
+
+    if (read_headers(&decoder) != DRAW_SUCCESS)
+    {
+        return DRAW_FAILURE;
+    }
+
+    if (info != NULL)
+    {
+        info->width = decoder.width;
+        info->height = decoder.height;
+        info->components = decoder.component_amount;
+        info->h_sampling = decoder.components[0].h_sampling;
+        info->v_sampling = decoder.components[0].v_sampling;
+    }
+
+    // Output sizes, after scaling and clipping.
+    int mcu_pixels_x = decoder.components[0].h_sampling * 8;
+    int mcu_pixels_y = decoder.components[0].v_sampling * 8;
+    int mcu_width = mcu_pixels_x / scale;
+    int mcu_height = mcu_pixels_y / scale;
+    int mcu_columns = (decoder.width + mcu_pixels_x - 1) / mcu_pixels_x;
+    int mcu_rows = (decoder.height + mcu_pixels_y - 1) / mcu_pixels_y;
+    int visible_width = (decoder.width + scale - 1) / scale;
+    int visible_height = (decoder.height + scale - 1) / scale;
+
+    visible_width = visible_width < output->max_width ? visible_width : output->max_width;
+    visible_height = visible_height < output->max_height ? visible_height : output->max_height;
+
+    prepare_components(&decoder, scale, mcu_width, mcu_height);
+
+    int result = DRAW_SUCCESS;
+    int restarts_left = decoder.restart_interval;
+
+    for (int row = 0; row < mcu_rows; ++row)
+    {
+        int band_y = row * mcu_height;
+
+        // The rest of the image is clipped.
+        if (band_y >= visible_height)
+        {
+            break;
+        }
+
+        int band_lines = visible_height - band_y < mcu_height ? visible_height - band_y : mcu_height;
+        uint16_t *band_buffer = output->get_band(output->band_ctx);
+        if (band_buffer == NULL)
+        {
+            return DRAW_FAILURE;
+        }
+
+        for (int column = 0; column < mcu_columns; ++column)
+        {
+            if (decoder.restart_interval != 0)
+            {
+                if (restarts_left == 0)
+                {
+                    if (process_restart(&decoder) != DRAW_SUCCESS)
+                    {
+                        return DRAW_FAILURE;
+                    }
+                    restarts_left = decoder.restart_interval;
+                }
+                restarts_left -= 1;
+            }
+
+            if (decode_mcu(&decoder, scale) != DRAW_SUCCESS)
+            {
+                ESP_LOGE(TAG_DISPLAY, "JPEG data is corrupt at MCU %d, %d.", column, row);
+                return DRAW_FAILURE;
+            }
+
+            // Clipped MCUs still have to be decoded, the data is one bit stream.
+            int x_start = column * mcu_width;
+            if (x_start < visible_width)
+            {
+                int width = visible_width - x_start < mcu_width ? visible_width - x_start : mcu_width;
+                output_mcu(&decoder, band_buffer, visible_width, x_start, width, band_lines);
+            }
+        }
+
+        result |= output->put_band(output->band_ctx, band_buffer, band_y, visible_width, band_lines);
+    }
+
+    // Missing data was decoded as zeros, the bottom of the image is not what was sent.
+    if (decoder.truncated)
+    {
+        ESP_LOGE(TAG_DISPLAY, "JPEG ended inside its scan.");
+        result = DRAW_FAILURE;
+    }
+
+    return result;
+}
+
+
+_Static_assert(POOL_BLOCK_PIXELS >= SCREEN_MAX_WIDTH * JPEG_MAX_MCU_SIZE, "A band must fit in a pool block.");
+
+// Pool blocks used in rotation as bands.
+typedef struct {
+    esp_lcd_panel_handle_t panel_handle;
+    unsigned short start_x;
+    unsigned short start_y;
+    uint16_t *band_buffers[POOL_BLOCK_AMOUNT];
+    int band_buffer_amount;
+    int next_buffer;
+} jpeg_panel_output_t;
+
+
+static uint16_t *get_panel_band(void *band_ctx)
+{
+    jpeg_panel_output_t *panel_output = (jpeg_panel_output_t *)band_ctx;
+
+    // The band queued band_buffer_amount bands ago used this block.
+    wait_for_draws_in_flight(panel_output->band_buffer_amount - 1);
+    uint16_t *band_buffer = panel_output->band_buffers[panel_output->next_buffer];
+    panel_output->next_buffer = (panel_output->next_buffer + 1) % panel_output->band_buffer_amount;
+
+    return band_buffer;
+}
+
+
+static int put_panel_band(void *band_ctx, uint16_t *pixels, unsigned short y, unsigned short width, unsigned short lines)
+{
+    jpeg_panel_output_t *panel_output = (jpeg_panel_output_t *)band_ctx;
+
+    draw_t band = {
+        .draw_start_x = panel_output->start_x,
+        .draw_start_y = panel_output->start_y + y,
+        .image_size_x = width,
+        .image_size_y = lines,
+        .scale_x = 1,
+        .scale_y = 1,
+    };
+
+    return queue_bgr_image(panel_output->panel_handle, band, pixels);
+}
+
+
+int draw_jpeg(esp_lcd_panel_handle_t panel_handle, stream_read_cb_t read_cb, void *stream_ctx,
+    unsigned short start_x, unsigned short start_y, jpeg_scale_t scale, jpeg_info_t *info)
+{
+    // Sanity check.
+    if ( (start_x >= SCREEN_WIDTH) || (start_y >= SCREEN_HEIGHT) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "JPEG start %d, %d is outside the screen.", start_x, start_y);
+        return DRAW_FAILURE;
+    }
+
+    jpeg_panel_output_t panel_output = {
+        .panel_handle = panel_handle,
+        .start_x = start_x,
+        .start_y = start_y,
+    };
+
+    // Every free pool block is used, a block is refilled once its band has been sent.
+    while (panel_output.band_buffer_amount < POOL_BLOCK_AMOUNT)
+    {
+        uint16_t *band_buffer = pool_borrow();
+        if (band_buffer == NULL)
+        {
+            break;
+        }
+        panel_output.band_buffers[panel_output.band_buffer_amount++] = band_buffer;
+    }
+
+    if (panel_output.band_buffer_amount == 0)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for the JPEG.");
+        return DRAW_FAILURE;
+    }
+
+    jpeg_output_t output = {
+        .get_band = get_panel_band,
+        .put_band = put_panel_band,
+        .band_ctx = &panel_output,
+        .max_width = SCREEN_WIDTH - start_x,
+        .max_height = SCREEN_HEIGHT - start_y,
+    };
+
+    int result = decode_jpeg(read_cb, stream_ctx, scale, &output, info);
+
+    wait_for_draws();
+
+    for (int i = 0; i < panel_output.band_buffer_amount; ++i)
+    {
+        pool_return(panel_output.band_buffers[i]);
+    }
+
+    return result;
+}
@@ -0,0 +1,415 @@
+#include "graphics_layer.h"
+
+
+// Grows a region to also cover the rectangle from x_start, y_start up to x_end, y_end.
+static void merge_region(draw_t *region, int x_start, int y_start, int x_end, int y_end)
+{
+    int region_x_end = region->draw_start_x + region->image_size_x;
+    int region_y_end = region->draw_start_y + region->image_size_y;
+
+    region->draw_start_x = region->draw_start_x < x_start ? region->draw_start_x : x_start;
+    region->draw_start_y = region->draw_start_y < y_start ? region->draw_start_y : y_start;
+    region->image_size_x = (region_x_end > x_end ? region_x_end : x_end) - region->draw_start_x;
+    region->image_size_y = (region_y_end > y_end ? region_y_end : y_end) - region->draw_start_y;
+}
+
+
+void add_damage_rect(damage_list_t *damage, int x, int y, int width, int height)
+{
+    int x_start = x < 0 ? 0 : x;
+    int y_start = y < 0 ? 0 : y;
+    int x_end = x + width > SCREEN_WIDTH ? SCREEN_WIDTH : x + width;
+    int y_end = y + height > SCREEN_HEIGHT ? SCREEN_HEIGHT : y + height;
+
+    // Nothing on screen.
+    if ( (x_start >= x_end) || (y_start >= y_end) )
+    {
+        return;
+    }
+
+    // Overlapping damage is merged, so no pixel is drawn twice.
+    if (damage->region_amount < COMPOSITOR_MAX_DAMAGE)
+    {
+        draw_t *region = &damage->regions[damage->region_amount];
+        damage->region_amount += 1;
+
+        region->draw_start_x = x_start;
+        region->draw_start_y = y_start;
+        region->image_size_x = x_end - x_start;
+        region->image_size_y = y_end - y_start;
+        region->scale_x = 1;
+        region->scale_y = 1;
+
+        merge_overlapping_regions(damage->regions, &damage->region_amount);
+        return;
+    }
+
+    // All regions taken, merge into the one that grows the least.
+    int best_region = 0;
+    int smallest_growth = INT32_MAX;
+
+    for (int i = 0; i < COMPOSITOR_MAX_DAMAGE; ++i)
+    {
+        draw_t merged = damage->regions[i];
+        merge_region(&merged, x_start, y_start, x_end, y_end);
+
+        int growth = merged.image_size_x * merged.image_size_y - damage->regions[i].image_size_x * damage->regions[i].image_size_y;
+        if (growth < smallest_growth)
+        {
+            smallest_growth = growth;
+            best_region = i;
+        }
+    }
+
+    merge_region(&damage->regions[best_region], x_start, y_start, x_end, y_end);
+    merge_overlapping_regions(damage->regions, &damage->region_amount);
+}
+
+
+static void damage_item(compositor_t *compositor, const layer_item_t *item)
+{
+    if (item->visible)
+    {
+        add_damage_rect(&compositor->damage, item->x, item->y, item->width, item->height);
+    }
+}
+
+
+// Returns an existing item, or NULL after logging an error.
+static layer_item_t *get_layer_item(compositor_t *compositor, layer_id_t layer, int item)
+{
+    if ( (layer >= LAYER_AMOUNT) || (item < 0) || (item >= compositor->layers[layer].item_amount) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Layer %d has no item %d.", layer, item);
+        return NULL;
+    }
+
+    return &compositor->layers[layer].items[item];
+}
+
+
+// Adds an item to the top of a layer and damages its area.
+static int add_layer_item(compositor_t *compositor, layer_id_t layer, const layer_item_t *item)
+{
+    if (layer >= LAYER_AMOUNT)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Layer %d does not exist.", layer);
+        return LAYER_NO_ITEM;
+    }
+
+    layer_t *target = &compositor->layers[layer];
+    if (target->item_amount >= LAYER_MAX_ITEMS)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot add more than %d items to a layer.", LAYER_MAX_ITEMS);
+        return LAYER_NO_ITEM;
+    }
+
+    target->items[target->item_amount] = *item;
+    target->items[target->item_amount].visible = 1;
+    damage_item(compositor, &target->items[target->item_amount]);
+    target->item_amount += 1;
+
+    return target->item_amount - 1;
+}
+
+
+void compositor_init(compositor_t *compositor, uint16_t BGR_color)
+{
+    memset(compositor, 0, sizeof(compositor_t));
+    compositor->BGR_color = BGR_color;
+
+    add_damage_rect(&compositor->damage, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+}
+
+
+int add_layer_rect(compositor_t *compositor, layer_id_t layer, draw_t bounds, uint16_t BGR_color)
+{
+    layer_item_t item = {
+        .type = LAYER_ITEM_RECT,
+        .x = bounds.draw_start_x,
+        .y = bounds.draw_start_y,
+        .width = bounds.image_size_x,
+        .height = bounds.image_size_y,
+        .BGR_color = BGR_color,
+    };
+
+    return add_layer_item(compositor, layer, &item);
+}
+
+
+int add_layer_image(compositor_t *compositor, layer_id_t layer, draw_t bounds, const uint16_t *image_buffer)
+{
+    if (image_buffer == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Layer image is a NULL pointer.");
+        return LAYER_NO_ITEM;
+    }
+
+    layer_item_t item = {
+        .type = LAYER_ITEM_IMAGE,
+        .x = bounds.draw_start_x,
+        .y = bounds.draw_start_y,
+        .width = bounds.image_size_x,
+        .height = bounds.image_size_y,
+        .image_buffer = image_buffer,
+    };
+
+    return add_layer_item(compositor, layer, &item);
+}
+
+
+int add_layer_sprite(compositor_t *compositor, layer_id_t layer, const sprite_t *sprite, int x, int y)
+{
+    if ( (sprite == NULL) || (sprite->pixels == NULL) || ( (sprite->format == SPRITE_FORMAT_A8) && (sprite->alpha == NULL) ) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Layer sprite or its buffers are NULL pointers.");
+        return LAYER_NO_ITEM;
+    }
+
+    layer_item_t item = {
+        .type = LAYER_ITEM_SPRITE,
+        .x = x,
+        .y = y,
+        .width = sprite->width,
+        .height = sprite->height,
+        .sprite = sprite,
+    };
+
+    return add_layer_item(compositor, layer, &item);
+}
+
+
+int add_layer_source(compositor_t *compositor, layer_id_t layer, draw_t bounds, const pixel_source_t *source)
+{
+    if ( (source == NULL) || (source->read_span == NULL) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Layer pixel source is a NULL pointer.");
+        return LAYER_NO_ITEM;
+    }
+
+    layer_item_t item = {
+        .type = LAYER_ITEM_SOURCE,
+        .x = bounds.draw_start_x,
+        .y = bounds.draw_start_y,
+        .width = bounds.image_size_x,
+        .height = bounds.image_size_y,
+        .source = source,
+    };
+
+    return add_layer_item(compositor, layer, &item);
+}
+
+
+int move_layer_item(compositor_t *compositor, layer_id_t layer, int item, int x, int y)
+{
+    layer_item_t *moved = get_layer_item(compositor, layer, item);
+    if (moved == NULL)
+    {
+        return DRAW_FAILURE;
+    }
+
+    if ( (moved->x == x) && (moved->y == y) )
+    {
+        return DRAW_SUCCESS;
+    }
+
+    // The old area shows what was under the item, the new area the item.
+    damage_item(compositor, moved);
+    moved->x = x;
+    moved->y = y;
+    damage_item(compositor, moved);
+
+    return DRAW_SUCCESS;
+}
+
+
+int set_layer_item_visible(compositor_t *compositor, layer_id_t layer, int item, uint8_t visible)
+{
+    layer_item_t *changed = get_layer_item(compositor, layer, item);
+    if (changed == NULL)
+    {
+        return DRAW_FAILURE;
+    }
+
+    if (changed->visible == (visible != 0))
+    {
+        return DRAW_SUCCESS;
+    }
+
+    // Damaged while visible, either before hiding or after showing.
+    damage_item(compositor, changed);
+    changed->visible = (visible != 0);
+    damage_item(compositor, changed);
+
+    return DRAW_SUCCESS;
+}
+
+
+int set_layer_rect_color(compositor_t *compositor, layer_id_t layer, int item, uint16_t BGR_color)
+{
+    layer_item_t *changed = get_layer_item(compositor, layer, item);
+    if (changed == NULL)
+    {
+        return DRAW_FAILURE;
+    }
+
+    if (changed->type != LAYER_ITEM_RECT)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Layer item %d is not a rect.", item);
+        return DRAW_FAILURE;
+    }
+
+    if (changed->BGR_color != BGR_color)
+    {
+        changed->BGR_color = BGR_color;
+        damage_item(compositor, changed);
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+void clear_layer(compositor_t *compositor, layer_id_t layer)
+{
+    if (layer >= LAYER_AMOUNT)
+    {
+        return;
+    }
+
+    for (int i = 0; i < compositor->layers[layer].item_amount; ++i)
+    {
+        damage_item(compositor, &compositor->layers[layer].items[i]);
+    }
+
+    compositor->layers[layer].item_amount = 0;
+}
+
+
+void damage_region(compositor_t *compositor, draw_t region)
+{
+    add_damage_rect(&compositor->damage, region.draw_start_x, region.draw_start_y, region.image_size_x, region.image_size_y);
+}
+
+
+// Composites a span of a screen line from the items below order, all layers counted as one list.
+// Going top down, the topmost item over the span is drawn first and only the parts it leaves uncovered go further down.
+// Opaque items end the descent for the pixels they cover, so hidden items are never read.
+static void compose_span(const compositor_t *compositor, int order, int x, int y, int width, uint16_t *span_buffer)
+{
+    const layer_item_t *item = NULL;
+
+    if (width <= 0)
+    {
+        return;
+    }
+
+    while (--order >= 0)
+    {
+        const layer_t *layer = &compositor->layers[order / LAYER_MAX_ITEMS];
+        int index = order % LAYER_MAX_ITEMS;
+
+        if (index >= layer->item_amount)
+        {
+            continue;
+        }
+
+        item = &layer->items[index];
+        if ( item->visible && (y >= item->y) && (y < item->y + item->height) && (x < item->x + item->width) && (x + width > item->x) )
+        {
+            break;
+        }
+    }
+
+    // Nothing covers the span.
+    if (order < 0)
+    {
+        for (int i = 0; i < width; ++i)
+        {
+            span_buffer[i] = compositor->BGR_color;
+        }
+        return;
+    }
+
+    int covered_start = x > item->x ? x : item->x;
+    int covered_end = x + width < item->x + item->width ? x + width : item->x + item->width;
+    int covered_width = covered_end - covered_start;
+    uint16_t *covered_buffer = span_buffer + (covered_start - x);
+
+    // The parts of the span left and right of the item.
+    compose_span(compositor, order, x, y, covered_start - x, span_buffer);
+    compose_span(compositor, order, covered_end, y, x + width - covered_end, span_buffer + (covered_end - x));
+
+    switch (item->type)
+    {
+        case LAYER_ITEM_RECT:
+            for (int i = 0; i < covered_width; ++i)
+            {
+                covered_buffer[i] = item->BGR_color;
+            }
+            break;
+
+        case LAYER_ITEM_IMAGE:
+            memcpy(covered_buffer, item->image_buffer + (y - item->y) * item->width + (covered_start - item->x), covered_width * sizeof(uint16_t));
+            break;
+
+        case LAYER_ITEM_SOURCE:
+            item->source->read_span(item->source->source_ctx, covered_start, y, covered_width, covered_buffer);
+            break;
+
+        case LAYER_ITEM_SPRITE:
+            // Transparent, the items below are needed to blend against.
+            compose_span(compositor, order, covered_start, y, covered_width, covered_buffer);
+            blend_sprite_line(item->sprite, (y - item->y) * item->sprite->width + (covered_start - item->x), covered_width, covered_buffer);
+            break;
+    }
+}
+
+
+void read_compositor_span(void *source_ctx, int x, int y, int width, uint16_t *span_buffer)
+{
+    compose_span((const compositor_t *)source_ctx, LAYER_AMOUNT * LAYER_MAX_ITEMS, x, y, width, span_buffer);
+}
+
+
+int compose_damage(esp_lcd_panel_handle_t panel_handle, compositor_t *compositor)
+{
+    if (compositor->damage.region_amount == 0)
+    {
+        return DRAW_SUCCESS;
+    }
+
+    uint16_t *band_buffer = pool_borrow();
+    if (band_buffer == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for compositing.");
+        return DRAW_FAILURE;
+    }
+
+    int result = DRAW_SUCCESS;
+
+    for (int i = 0; i < compositor->damage.region_amount; ++i)
+    {
+        draw_t region = compositor->damage.regions[i];
+        int band_lines = POOL_BLOCK_PIXELS / region.image_size_x;
+        draw_t band = region;
+
+        for (int line = 0; line < region.image_size_y; line += band_lines)
+        {
+            band.draw_start_y = region.draw_start_y + line;
+            band.image_size_y = region.image_size_y - line < band_lines ? region.image_size_y - line : band_lines;
+
+            for (int band_line = 0; band_line < band.image_size_y; ++band_line)
+            {
+                compose_span(compositor, LAYER_AMOUNT * LAYER_MAX_ITEMS, region.draw_start_x, band.draw_start_y + band_line,
+                    region.image_size_x, band_buffer + band_line * region.image_size_x);
+            }
+
+            result |= draw_bgr_image(panel_handle, band, band_buffer);
+        }
+    }
+
+    pool_return(band_buffer);
+    compositor->damage.region_amount = 0;
+
+    return result;
+}
@@ -0,0 +1,99 @@
+#ifndef GRAPHICS_LAYER_H
+#define GRAPHICS_LAYER_H
+
+#include "graphics_blit.h"
+
+
+// Amount of items a single layer can hold.
+#define LAYER_MAX_ITEMS 16
+
+// Amount of separate damaged regions kept, further damage is merged into the closest region.
+#define COMPOSITOR_MAX_DAMAGE 8
+
+// Returned instead of an item index when an item cannot be added.
+#define LAYER_NO_ITEM -1
+
+
+// Layers from bottom to top.
+typedef enum {
+    LAYER_BACKGROUND,
+    LAYER_CONTENT,
+    LAYER_OVERLAY,
+    LAYER_AMOUNT,
+} layer_id_t;
+
+// Layer item types. Rects, images and sources are opaque, sprites can be transparent.
+typedef enum {
+    LAYER_ITEM_RECT,
+    LAYER_ITEM_IMAGE,           // BGR565 image the size of the item.
+    LAYER_ITEM_SPRITE,
+    LAYER_ITEM_SOURCE,          // Pixel source, read in screen coordinates.
+} layer_item_type_t;
+
+// Retained layer item. The position is signed so items can move partly off screen.
+typedef struct {
+    layer_item_type_t type;
+    uint8_t visible;
+    int x;
+    int y;
+    unsigned short width;
+    unsigned short height;
+    uint16_t BGR_color;         // LAYER_ITEM_RECT only.
+    const uint16_t *image_buffer;       // LAYER_ITEM_IMAGE only.
+    const sprite_t *sprite;             // LAYER_ITEM_SPRITE only.
+    const pixel_source_t *source;       // LAYER_ITEM_SOURCE only.
+} layer_item_t;
+
+// Layer, items drawn in the order they were added.
+typedef struct {
+    layer_item_t items[LAYER_MAX_ITEMS];
+    int item_amount;
+} layer_t;
+
+// Screen regions that need to be redrawn. Overlapping damage is merged so no pixel is drawn twice,
+// once all regions are taken new damage is merged into the region that grows the least.
+typedef struct {
+    draw_t regions[COMPOSITOR_MAX_DAMAGE];
+    int region_amount;
+} damage_list_t;
+
+// Compositor, the layers and the screen regions that need to be redrawn.
+typedef struct {
+    layer_t layers[LAYER_AMOUNT];
+    uint16_t BGR_color;         // Shown where no item covers the screen.
+    damage_list_t damage;
+} compositor_t;
+
+
+// Adds a rectangle to a damage list, clipped to the screen.
+void add_damage_rect(damage_list_t *damage, int x, int y, int width, int height);
+
+// Empties all layers and damages the whole screen, so the first compose_damage() draws everything.
+void compositor_init(compositor_t *compositor, uint16_t BGR_color);
+
+// Add items to the top of a layer. Return the item index, or LAYER_NO_ITEM when the layer is full.
+// Images, sprites and sources are not copied and must stay valid while the item exists.
+int add_layer_rect(compositor_t *compositor, layer_id_t layer, draw_t bounds, uint16_t BGR_color);
+int add_layer_image(compositor_t *compositor, layer_id_t layer, draw_t bounds, const uint16_t *image_buffer);
+int add_layer_sprite(compositor_t *compositor, layer_id_t layer, const sprite_t *sprite, int x, int y);
+int add_layer_source(compositor_t *compositor, layer_id_t layer, draw_t bounds, const pixel_source_t *source);
+
+// Item changes, each damages only the screen area that changes.
+int move_layer_item(compositor_t *compositor, layer_id_t layer, int item, int x, int y);
+int set_layer_item_visible(compositor_t *compositor, layer_id_t layer, int item, uint8_t visible);
+int set_layer_rect_color(compositor_t *compositor, layer_id_t layer, int item, uint16_t BGR_color);
+
+// Removes all items of a layer.
+void clear_layer(compositor_t *compositor, layer_id_t layer);
+
+// Marks a screen region for redrawing, Ex: after changing the pixels of an image item. Only start and size are used.
+void damage_region(compositor_t *compositor, draw_t region);
+
+// Pixel source callback reading what all layers composite to, the context is the compositor. Once the damage is
+// drawn this is what the screen shows, Ex: to save the region under a popup with save_region().
+void read_compositor_span(void *source_ctx, int x, int y, int width, uint16_t *span_buffer);
+
+// Composites and draws the damaged regions band by band, then clears the damage.
+int compose_damage(esp_lcd_panel_handle_t panel_handle, compositor_t *compositor);
+
+#endif
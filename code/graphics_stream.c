@@ -0,0 +1,416 @@
+#include "graphics_stream.h"
+
+
+// Decoder state, kept across bands since runs and QOI state carry over from one band to the next.
+typedef struct {
+    stream_read_cb_t read_cb;
+    void *stream_ctx;
+    uint8_t input[STREAM_INPUT_BUFFER_SIZE];
+    int input_position;
+    int input_length;
+    uint8_t ended;
+    uint64_t bytes_read;
+
+    // RLE packet in progress.
+    int literal_pixels;
+    int run_pixels;
+    uint16_t run_pixel;
+
+    // QOI state, RGBA.
+    uint8_t qoi_index[64][4];
+    uint8_t qoi_pixel[4];
+    int qoi_run;
+} stream_decoder_t;
+
+
+int read_memory_stream(void *stream_ctx, uint8_t *buffer, int size)
+{
+    memory_stream_t *stream = (memory_stream_t *)stream_ctx;
+    size_t remaining = stream->size - stream->position;
+    int length = remaining < (size_t)size ? (int)remaining : size;
+
+    memcpy(buffer, stream->data + stream->position, length);
+    stream->position += length;
+
+    return length;
+}
+
+
+// Refills the input buffer, returns 0 once the stream has ended.
+static int refill_input(stream_decoder_t *decoder)
+{
+    if (decoder->ended)
+    {
+        return 0;
+    }
+
+    int length = decoder->read_cb(decoder->stream_ctx, decoder->input, STREAM_INPUT_BUFFER_SIZE);
+    if (length <= 0)
+    {
+        decoder->ended = 1;
+        return 0;
+    }
+
+    decoder->input_position = 0;
+    decoder->input_length = length;
+    decoder->bytes_read += length;
+
+    return 1;
+}
+
+
+// Reads size bytes, returns DRAW_FAILURE if the stream ends first.
+static int read_bytes(stream_decoder_t *decoder, uint8_t *buffer, int size)
+{
+    while (size > 0)
+    {
+        if ( (decoder->input_position == decoder->input_length) && !refill_input(decoder) )
+        {
+            return DRAW_FAILURE;
+        }
+
+        int available = decoder->input_length - decoder->input_position;
+        int length = available < size ? available : size;
+
+        memcpy(buffer, decoder->input + decoder->input_position, length);
+        decoder->input_position += length;
+        buffer += length;
+        size -= length;
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+static int read_header(stream_decoder_t *decoder, stream_header_t *header)
+{
+    uint8_t bytes[20];
+
+    if (read_bytes(decoder, bytes, sizeof(bytes)) != DRAW_SUCCESS)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Image stream ended inside the header.");
+        return DRAW_FAILURE;
+    }
+
+    if ( (memcmp(bytes, STREAM_MAGIC, 4) != 0) || (bytes[4] != STREAM_VERSION) || (bytes[5] > STREAM_ENCODING_QOI) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Not an image stream, or an unknown version or encoding.");
+        return DRAW_FAILURE;
+    }
+
+    header->encoding = bytes[5];
+    header->window.draw_start_x = bytes[6] | (bytes[7] << 8);
+    header->window.draw_start_y = bytes[8] | (bytes[9] << 8);
+    header->window.image_size_x = bytes[10] | (bytes[11] << 8);
+    header->window.image_size_y = bytes[12] | (bytes[13] << 8);
+    header->window.scale_x = 1;
+    header->window.scale_y = 1;
+    header->lines = bytes[16] | (bytes[17] << 8) | (bytes[18] << 16) | ((uint32_t)bytes[19] << 24);
+
+    if ( (header->window.image_size_x == 0) || (header->window.image_size_y == 0) ||
+         (header->window.draw_start_x + header->window.image_size_x > SCREEN_WIDTH) ||
+         (header->window.draw_start_y + header->window.image_size_y > SCREEN_HEIGHT) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Image stream window out of bounds.");
+        return DRAW_FAILURE;
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+static int decode_raw(stream_decoder_t *decoder, uint16_t *pixels, int pixel_amount)
+{
+    // The stream bytes are the pixel buffer bytes.
+    return read_bytes(decoder, (uint8_t *)pixels, pixel_amount * sizeof(uint16_t));
+}
+
+
+static int decode_rle(stream_decoder_t *decoder, uint16_t *pixels, int pixel_amount)
+{
+    while (pixel_amount > 0)
+    {
+        if (decoder->run_pixels > 0)
+        {
+            int length = decoder->run_pixels < pixel_amount ? decoder->run_pixels : pixel_amount;
+
+            for (int i = 0; i < length; ++i)
+            {
+                pixels[i] = decoder->run_pixel;
+            }
+
+            decoder->run_pixels -= length;
+            pixels += length;
+            pixel_amount -= length;
+        }
+        else if (decoder->literal_pixels > 0)
+        {
+            int length = decoder->literal_pixels < pixel_amount ? decoder->literal_pixels : pixel_amount;
+
+            if (read_bytes(decoder, (uint8_t *)pixels, length * sizeof(uint16_t)) != DRAW_SUCCESS)
+            {
+                return DRAW_FAILURE;
+            }
+
+            decoder->literal_pixels -= length;
+            pixels += length;
+            pixel_amount -= length;
+        }
+        else
+        {
+            uint8_t count;
+
+            if (read_bytes(decoder, &count, 1) != DRAW_SUCCESS)
+            {
+                return DRAW_FAILURE;
+            }
+
+            if (count < 128)
+            {
+                decoder->literal_pixels = count + 1;
+            }
+            else if (read_bytes(decoder, (uint8_t *)&decoder->run_pixel, sizeof(uint16_t)) == DRAW_SUCCESS)
+            {
+                decoder->run_pixels = count - 127;
+            }
+            else
+            {
+                return DRAW_FAILURE;
+            }
+        }
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+// QOI chunk tags, see https://qoiformat.org/qoi-specification.pdf
+#define QOI_OP_INDEX 0x00
+#define QOI_OP_DIFF 0x40
+#define QOI_OP_LUMA 0x80
+#define QOI_OP_RUN 0xC0
+#define QOI_OP_RGB 0xFE
+#define QOI_OP_RGBA 0xFF
+#define QOI_MASK 0xC0
+
+static int decode_qoi(stream_decoder_t *decoder, uint16_t *pixels, int pixel_amount)
+{
+    uint8_t *pixel = decoder->qoi_pixel;
+
+    for (int i = 0; i < pixel_amount; ++i)
+    {
+        if (decoder->qoi_run > 0)
+        {
+            decoder->qoi_run -= 1;
+        }
+        else
+        {
+            uint8_t chunk[4];
+
+            if (read_bytes(decoder, chunk, 1) != DRAW_SUCCESS)
+            {
+                return DRAW_FAILURE;
+            }
+
+            if (chunk[0] == QOI_OP_RGB)
+            {
+                if (read_bytes(decoder, pixel, 3) != DRAW_SUCCESS)
+                {
+                    return DRAW_FAILURE;
+                }
+            }
+            else if (chunk[0] == QOI_OP_RGBA)
+            {
+                if (read_bytes(decoder, pixel, 4) != DRAW_SUCCESS)
+                {
+                    return DRAW_FAILURE;
+                }
+            }
+            else if ((chunk[0] & QOI_MASK) == QOI_OP_INDEX)
+            {
+                memcpy(pixel, decoder->qoi_index[chunk[0]], 4);
+            }
+            else if ((chunk[0] & QOI_MASK) == QOI_OP_DIFF)
+            {
+                pixel[0] += ((chunk[0] >> 4) & 0x03) - 2;
+                pixel[1] += ((chunk[0] >> 2) & 0x03) - 2;
+                pixel[2] += (chunk[0] & 0x03) - 2;
+            }
+            else if ((chunk[0] & QOI_MASK) == QOI_OP_LUMA)
+            {
+                if (read_bytes(decoder, &chunk[1], 1) != DRAW_SUCCESS)
+                {
+                    return DRAW_FAILURE;
+                }
+
+                int green_difference = (chunk[0] & 0x3F) - 32;
+                pixel[0] += green_difference - 8 + ((chunk[1] >> 4) & 0x0F);
+                pixel[1] += green_difference;
+                pixel[2] += green_difference - 8 + (chunk[1] & 0x0F);
+            }
+            else
+            {
+                // QOI_OP_RUN, this pixel and the run of pixels after it repeat the previous pixel.
+                decoder->qoi_run = chunk[0] & 0x3F;
+            }
+
+            memcpy(decoder->qoi_index[(pixel[0] * 3 + pixel[1] * 5 + pixel[2] * 7 + pixel[3] * 11) % 64], pixel, 4);
+        }
+
+        pixels[i] = BGR565_FROM_RGB888(pixel[0], pixel[1], pixel[2]);
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+static int decode_pixels(stream_decoder_t *decoder, stream_encoding_t encoding, uint16_t *pixels, int pixel_amount)
+{
+    switch (encoding)
+    {
+        case STREAM_ENCODING_RAW:
+            return decode_raw(decoder, pixels, pixel_amount);
+
+        case STREAM_ENCODING_RLE:
+            return decode_rle(decoder, pixels, pixel_amount);
+
+        case STREAM_ENCODING_QOI:
+            return decode_qoi(decoder, pixels, pixel_amount);
+    }
+
+    return DRAW_FAILURE;
+}
+
+
+// Returns if there are pixels left to decode, reading more input when needed.
+static int has_input(stream_decoder_t *decoder)
+{
+    return (decoder->run_pixels > 0) || (decoder->qoi_run > 0) || (decoder->input_position < decoder->input_length) ||
+           refill_input(decoder);
+}
+
+
+int draw_image_stream(esp_lcd_panel_handle_t panel_handle, stream_read_cb_t read_cb, void *stream_ctx, stream_stats_t *stats)
+{
+    int64_t start_us = esp_timer_get_time();
+    stream_decoder_t decoder;
+    stream_header_t header;
+
+    if (read_cb == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Stream read callback is a NULL pointer.");
+        return DRAW_FAILURE;
+    }
+
+    memset(&decoder, 0, sizeof(decoder));
+    decoder.read_cb = read_cb;
+    decoder.stream_ctx = stream_ctx;
+    decoder.qoi_pixel[3] = 255;
+
+    if (read_header(&decoder, &header) != DRAW_SUCCESS)
+    {
+        return DRAW_FAILURE;
+    }
+
+    // Every free pool block is used, a block is refilled once its band has been sent.
+    uint16_t *band_buffers[POOL_BLOCK_AMOUNT];
+    int band_buffer_amount = 0;
+
+    while (band_buffer_amount < POOL_BLOCK_AMOUNT)
+    {
+        band_buffers[band_buffer_amount] = pool_borrow();
+        if (band_buffers[band_buffer_amount] == NULL)
+        {
+            break;
+        }
+        band_buffer_amount += 1;
+    }
+
+    if (band_buffer_amount == 0)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for the image stream.");
+        return DRAW_FAILURE;
+    }
+
+    int result = DRAW_SUCCESS;
+    int next_buffer = 0;
+    int max_band_lines = POOL_BLOCK_PIXELS / header.window.image_size_x;
+    int window_line = 0;
+    int stream_ended = 0;
+    uint32_t bands = 0;
+    uint64_t pixels_drawn = 0;
+    draw_t band = header.window;
+
+    for (uint32_t line = 0; (header.lines == 0) || (line < header.lines); line += band.image_size_y)
+    {
+        // Bands stop at the bottom of the window, the next one starts at the top again.
+        int band_lines = header.window.image_size_y - window_line;
+        band_lines = band_lines < max_band_lines ? band_lines : max_band_lines;
+        if ( (header.lines != 0) && (header.lines - line < band_lines) )
+        {
+            band_lines = header.lines - line;
+        }
+
+        // The band queued band_buffer_amount bands ago used this block.
+        wait_for_draws_in_flight(band_buffer_amount - 1);
+        uint16_t *band_buffer = band_buffers[next_buffer];
+        next_buffer = (next_buffer + 1) % band_buffer_amount;
+
+        int width = header.window.image_size_x;
+        int decoded_lines = 0;
+
+        while (decoded_lines < band_lines)
+        {
+            // An endless stream may end between lines.
+            if ( (header.lines == 0) && !has_input(&decoder) )
+            {
+                stream_ended = 1;
+                break;
+            }
+
+            if (decode_pixels(&decoder, header.encoding, band_buffer + decoded_lines * width, width) != DRAW_SUCCESS)
+            {
+                ESP_LOGE(TAG_DISPLAY, "Image stream ended after %lu lines.", (unsigned long)(line + decoded_lines));
+                result = DRAW_FAILURE;
+                stream_ended = 1;
+                break;
+            }
+
+            decoded_lines += 1;
+        }
+
+        if (decoded_lines > 0)
+        {
+            band.draw_start_y = header.window.draw_start_y + window_line;
+            band.image_size_y = decoded_lines;
+
+            result |= queue_bgr_image(panel_handle, band, band_buffer);
+
+            bands += 1;
+            pixels_drawn += decoded_lines * width;
+            window_line = (window_line + decoded_lines) % header.window.image_size_y;
+        }
+
+        if (stream_ended)
+        {
+            break;
+        }
+    }
+
+    wait_for_draws();
+
+    for (int i = 0; i < band_buffer_amount; ++i)
+    {
+        pool_return(band_buffers[i]);
+    }
+
+    if (stats != NULL)
+    {
+        stats->bytes_read = decoder.bytes_read;
+        stats->pixels_drawn = pixels_drawn;
+        stats->bands = bands;
+        stats->total_us = esp_timer_get_time() - start_us;
+    }
+
+    return result;
+}
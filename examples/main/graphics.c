@@ -1,259 +1,1901 @@
 #include "graphics.h"
 
+#ifdef GRAPHICS_TRACE
+#include <stdatomic.h>
+#endif
+
+// Supported boards.
+const panel_descriptor_t panel_t_display = {
+    .name = "LILYGO T-Display",
+    .width = T_DISPLAY_WIDTH,
+    .height = T_DISPLAY_HEIGHT,
+    .x_offset = T_DISPLAY_X_OFFSET,
+    .y_offset = T_DISPLAY_Y_OFFSET,
+    .default_config = {
+        .bus = PANEL_BUS_SPI,
+        .pin_mosi = T_DISPLAY_PIN_NUM_MOSI,
+        .pin_sclk = T_DISPLAY_PIN_NUM_SCLK,
+        .pin_rd = -1,
+        .pin_power = -1,
+        .pin_cs = T_DISPLAY_PIN_NUM_CS,
+        .pin_dc = T_DISPLAY_PIN_NUM_DC,
+        .pin_rst = T_DISPLAY_PIN_NUM_RST,
+        .pin_bk_light = T_DISPLAY_PIN_NUM_BK_LIGHT,
+        .pixel_clock_hz = LCD_PIXEL_CLOCK_HZ,
+        .trans_queue_depth = LCD_TRANS_QUEUE_DEPTH,
+        .max_transfer_sz = T_DISPLAY_WIDTH * T_DISPLAY_HEIGHT * sizeof(uint16_t),
+        .dma_channel = SPI_DMA_CH_AUTO,
+        .bits_per_pixel = 16,
+    },
+};
+
+const panel_descriptor_t panel_t_display_s3 = {
+    .name = "LILYGO T-Display-S3",
+    .width = T_DISPLAY_S3_WIDTH,
+    .height = T_DISPLAY_S3_HEIGHT,
+    .x_offset = T_DISPLAY_S3_X_OFFSET,
+    .y_offset = T_DISPLAY_S3_Y_OFFSET,
+    .default_config = {
+        .bus = PANEL_BUS_I80,
+        .pin_mosi = -1,
+        .pin_sclk = -1,
+        .pin_data = T_DISPLAY_S3_PIN_NUM_DATA,
+        .pin_wr = T_DISPLAY_S3_PIN_NUM_WR,
+        .pin_rd = T_DISPLAY_S3_PIN_NUM_RD,
+        .pin_power = T_DISPLAY_S3_PIN_NUM_POWER,
+        .pin_cs = T_DISPLAY_S3_PIN_NUM_CS,
+        .pin_dc = T_DISPLAY_S3_PIN_NUM_DC,
+        .pin_rst = T_DISPLAY_S3_PIN_NUM_RST,
+        .pin_bk_light = T_DISPLAY_S3_PIN_NUM_BK_LIGHT,
+        .pixel_clock_hz = T_DISPLAY_S3_PIXEL_CLOCK_HZ,
+        .trans_queue_depth = LCD_TRANS_QUEUE_DEPTH,
+        .max_transfer_sz = T_DISPLAY_S3_WIDTH * T_DISPLAY_S3_HEIGHT * sizeof(uint16_t),
+        .dma_channel = SPI_DMA_CH_AUTO,
+        .bits_per_pixel = 16,
+    },
+};
+
+#if GRAPHICS_BOARD == BOARD_T_DISPLAY_S3
+const panel_descriptor_t *active_panel = &panel_t_display_s3;
+#else
+const panel_descriptor_t *active_panel = &panel_t_display;
+#endif
+
+// Accumulated transfer statistics, see get_transfer_stats().
+static transfer_stats_t transfer_stats;
+
+// The configuration the display was set up with.
+static display_config_t display_config;
+
+// Panel IO handle, for sending commands directly to the LCD.
+static esp_lcd_panel_io_handle_t display_io = NULL;
+
+// Ping-pong buffers for packing pixels in 12 bit bus mode.
+static uint8_t *packed_buffers[2] = { NULL, NULL };
+
+// Transfer completion tracking, the color data of a draw call is sent by DMA after the call returns.
+static volatile uint32_t transfers_submitted = 0;
+static volatile uint32_t transfers_done = 0;
+static SemaphoreHandle_t transfer_done_semaphore = NULL;
+static StaticSemaphore_t transfer_done_semaphore_storage;
+
+
+// Block pool for transient draw buffers, carved once from DMA capable memory when the display is set up.
+static uint8_t *pool_memory = NULL;
+static uint32_t pool_free_mask = 0;
+static pool_stats_t pool_stats;
+static portMUX_TYPE pool_lock = portMUX_INITIALIZER_UNLOCKED;
+
+
+// Fences waiting for their callback or to give back a pool block, oldest first.
+typedef struct {
+    draw_fence_t fence;
+    fence_callback_t callback;
+    void *user_ctx;
+    void *block;                // Pool block to return once done, or NULL.
+} pending_fence_t;
+
+static pending_fence_t pending_fences[FENCE_MAX_PENDING];
+static int pending_fence_amount = 0;
+
+
+// Window batch, see begin_batch(). The collected windows keep their pixels one after another in a pool block.
+typedef struct {
+    draw_t window;
+    int offset;                 // First pixel in the batch block.
+} batch_window_t;
+
+static uint16_t *batch_pixels = NULL;
+static int batch_pixels_used = 0;
+static batch_window_t batch_windows[BATCH_MAX_WINDOWS];
+static int batch_window_amount = 0;
+static unsigned short batch_max_gap = 0;
+static uint16_t batch_gap_color = 0;
+static esp_lcd_panel_handle_t batch_panel = NULL;
+
+
+#ifdef GRAPHICS_NO_HEAP
+// Static storage for the block pool and the 12 bit packing buffers, word aligned for DMA.
+static DMA_ATTR uint32_t pool_storage[(POOL_BLOCK_SIZE * POOL_BLOCK_AMOUNT + 3) / 4];
+static DMA_ATTR uint32_t packed_storage[2][(LCD_PACK_BUFFER_PIXELS * 3 / 2 + 3) / 4];
+#endif
+
+
+#ifdef GRAPHICS_RECORDER
+// Call recorder, a ring of records from recorder_first on. Records are 4 byte multiples, so their first word never wraps.
+static uint32_t recorder_storage[RECORDER_BUFFER_SIZE / 4];
+static uint32_t recorder_first = 0;
+static uint32_t recorder_used = 0;
+static uint32_t recorder_dropped = 0;
+static uint8_t recorder_paused = 0;
+static portMUX_TYPE recorder_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Recorded calls running per task, only the outermost one of each task is kept. A slot is free while its depth is 0.
+static struct {
+    TaskHandle_t task;
+    uint8_t depth;
+} recorder_tasks[RECORDER_TASKS];
+
+_Static_assert( (RECORDER_BUFFER_SIZE % 4 == 0) && (RECORDER_BUFFER_SIZE >= 2 * (sizeof(draw_record_t) + RECORDER_INLINE_BYTES)),
+    "RECORDER_BUFFER_SIZE must be a multiple of 4 and hold at least two records.");
+_Static_assert(RECORDER_INLINE_BYTES <= 255, "Inline payloads are counted in a byte.");
+
+// A record being made, kept on the stack of the recorded call until it returns.
+typedef struct {
+    draw_record_t record;
+    uint8_t inline_payload[(RECORDER_INLINE_BYTES + 3) & ~3];
+    uint8_t outermost;
+    uint8_t task_slot;                      // Index in recorder_tasks, RECORDER_TASKS when no slot was free.
+} recorder_scope_t;
+
+
+uint32_t hash_record_payload(const void *payload, uint32_t size)
+{
+    const uint8_t *bytes = (const uint8_t *)payload;
+    uint32_t hash = 2166136261UL ^ size;
+    uint32_t hashed_bytes = size < RECORDER_HASH_BYTES ? size : RECORDER_HASH_BYTES;
+
+    for (uint32_t i = 0; i < hashed_bytes; ++i)
+    {
+        hash = (hash ^ bytes[i]) * 16777619UL;
+    }
+
+    return hash;
+}
+
+
+// Starts a record, the payload is hashed and copied before the call can change it. text is copied instead of the
+// payload when given.
+static recorder_scope_t recorder_enter(uint8_t call, const uint16_t *args, const void *payload, uint32_t payload_bytes,
+    const char *text, uint32_t text_bytes)
+{
+    recorder_scope_t scope;
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    uint8_t free_slot = RECORDER_TASKS;
+
+    // Finds the slot of the calling task, or takes a free one for its outermost call.
+    portENTER_CRITICAL(&recorder_lock);
+    for (scope.task_slot = 0; scope.task_slot < RECORDER_TASKS; ++scope.task_slot)
+    {
+        if ( (recorder_tasks[scope.task_slot].depth > 0) && (recorder_tasks[scope.task_slot].task == task) )
+        {
+            break;
+        }
+
+        if ( (recorder_tasks[scope.task_slot].depth == 0) && (free_slot == RECORDER_TASKS) )
+        {
+            free_slot = scope.task_slot;
+        }
+    }
+
+    if (scope.task_slot == RECORDER_TASKS)
+    {
+        scope.task_slot = free_slot;
+    }
+
+    if (scope.task_slot == RECORDER_TASKS)
+    {
+        recorder_dropped += 1;
+        scope.outermost = 0;
+    }
+    else
+    {
+        scope.outermost = recorder_tasks[scope.task_slot].depth == 0;
+        recorder_tasks[scope.task_slot].task = task;
+        recorder_tasks[scope.task_slot].depth += 1;
+    }
+    portEXIT_CRITICAL(&recorder_lock);
+
+    if (!scope.outermost)
+    {
+        return scope;
+    }
+
+    const void *inline_data = text;
+    uint32_t inline_bytes = text_bytes;
+
+    if (payload == NULL)
+    {
+        payload_bytes = 0;
+    }
+
+    if ( (text == NULL) && (payload_bytes <= RECORDER_INLINE_BYTES) )
+    {
+        inline_data = payload;
+        inline_bytes = payload_bytes;
+    }
+
+    if ( (inline_data == NULL) || (inline_bytes > RECORDER_INLINE_BYTES) )
+    {
+        inline_bytes = inline_data == NULL ? 0 : RECORDER_INLINE_BYTES;
+    }
+
+    scope.record.call = call;
+    scope.record.inline_bytes = inline_bytes;
+    scope.record.length = sizeof(draw_record_t) + ((inline_bytes + 3) & ~3);
+    scope.record.start_us = (uint32_t)esp_timer_get_time();
+    scope.record.duration_us = 0;
+    scope.record.payload = (uint32_t)(uintptr_t)payload;
+    scope.record.payload_hash = payload_bytes > 0 ? hash_record_payload(payload, payload_bytes) : 0;
+    memcpy(scope.record.args, args, sizeof(scope.record.args));
+    if (inline_bytes > 0)
+    {
+        memcpy(scope.inline_payload, inline_data, inline_bytes);
+    }
+
+    return scope;
+}
+
+
+// Copies bytes into the ring at offset, wrapping at its end.
+static void recorder_write(uint32_t offset, const void *data, uint32_t size)
+{
+    uint8_t *ring = (uint8_t *)recorder_storage;
+    uint32_t first_part = RECORDER_BUFFER_SIZE - offset < size ? RECORDER_BUFFER_SIZE - offset : size;
+
+    memcpy(ring + offset, data, first_part);
+    memcpy(ring, (const uint8_t *)data + first_part, size - first_part);
+}
+
+
+// Finishes the record when the recorded call returns, dropping the oldest records to make room.
+static void recorder_leave(recorder_scope_t *scope)
+{
+    if (scope->task_slot < RECORDER_TASKS)
+    {
+        portENTER_CRITICAL(&recorder_lock);
+        recorder_tasks[scope->task_slot].depth -= 1;
+        portEXIT_CRITICAL(&recorder_lock);
+    }
+
+    if (!scope->outermost)
+    {
+        return;
+    }
+
+    scope->record.duration_us = (uint32_t)esp_timer_get_time() - scope->record.start_us;
+
+    portENTER_CRITICAL(&recorder_lock);
+
+    if (recorder_paused)
+    {
+        recorder_dropped += 1;
+        portEXIT_CRITICAL(&recorder_lock);
+        return;
+    }
+
+    while (recorder_used + scope->record.length > RECORDER_BUFFER_SIZE)
+    {
+        const draw_record_t *oldest = (const draw_record_t *)((uint8_t *)recorder_storage + recorder_first);
+
+        recorder_first = (recorder_first + oldest->length) % RECORDER_BUFFER_SIZE;
+        recorder_used -= oldest->length;
+        recorder_dropped += 1;
+    }
+
+    uint32_t end = (recorder_first + recorder_used) % RECORDER_BUFFER_SIZE;
+    recorder_write(end, &scope->record, sizeof(draw_record_t));
+    recorder_write((end + sizeof(draw_record_t)) % RECORDER_BUFFER_SIZE, scope->inline_payload, scope->record.length - sizeof(draw_record_t));
+    recorder_used += scope->record.length;
+
+    portEXIT_CRITICAL(&recorder_lock);
+}
+
+
+// Records the call of the function it starts once that returns, through GCC's cleanup attribute, which ESP-IDF builds
+// have. The arguments after text_bytes fill draw_record_t args.
+#define RECORD_CALL(call, payload, payload_bytes, text, text_bytes, ...) \
+    recorder_scope_t record_scope __attribute__((cleanup(recorder_leave))) = \
+        recorder_enter(call, (const uint16_t[RECORD_ARGS]){ __VA_ARGS__ }, payload, payload_bytes, text, text_bytes)
+#else
+#define RECORD_CALL(call, payload, payload_bytes, text, text_bytes, ...)
+#endif
+
+
+#ifdef GRAPHICS_TRACE
+// Names of the traced spans, with what their argument counts.
+typedef enum {
+    TRACE_FILL_RECT,                // Pixels.
+    TRACE_FILL_RECT_ASYNC,          // Pixels.
+    TRACE_DRAW_BGR_IMAGE,           // Pixels.
+    TRACE_QUEUE_BGR_IMAGE,          // Pixels.
+    TRACE_DRAW_BGR_IMAGE_ASYNC,     // Pixels.
+    TRACE_DRAW_IMAGE,               // Pixels.
+    TRACE_DRAW_GLYPHS,              // Characters.
+    TRACE_SUBMIT,                   // Pixels of a window queued for sending.
+    TRACE_RASTERIZE,                // Pixels written into a band.
+    TRACE_DMA,                      // Bytes of a transfer, from queued to sent.
+    TRACE_WAIT,                     // Transfers in flight when the wait started.
+    TRACE_FLUSH,                    // Windows of a batch.
+    TRACE_NAME_AMOUNT,
+} trace_name_t;
+
+static const char *trace_names[TRACE_NAME_AMOUNT][2] = {
+    { "fill_rect", "pixels" },
+    { "fill_rect_async", "pixels" },
+    { "draw_bgr_image", "pixels" },
+    { "queue_bgr_image", "pixels" },
+    { "draw_bgr_image_async", "pixels" },
+    { "draw_image", "pixels" },
+    { "draw_glyphs", "characters" },
+    { "submit", "pixels" },
+    { "rasterize", "pixels" },
+    { "dma", "bytes" },
+    { "wait", "in_flight" },
+    { "flush", "windows" },
+};
+
+// Spans are written when they end, DMA transfers as a begin and an end event matched by transfer number.
+#define TRACE_PHASE_SPAN 0
+#define TRACE_PHASE_BEGIN 1
+#define TRACE_PHASE_END 2
+
+typedef struct {
+    _Atomic uint32_t sequence;      // Event number plus 1, written last. 0 while the event is being written.
+    uint32_t start_us;              // Low bits of esp_timer_get_time().
+    uint32_t duration_us;
+    uint32_t arg;
+    uint16_t transfer;              // DMA events only.
+    uint8_t name;
+    uint8_t phase;
+} trace_event_t;
+
+// Events of a core, from its tasks and interrupts. Slots are taken with an atomic add, so writers never wait and
+// the oldest events are overwritten.
+typedef struct {
+    _Atomic uint32_t next;
+    uint32_t dumped;                // Events up to here were written by dump_draw_trace().
+    trace_event_t events[TRACE_RING_EVENTS];
+} trace_ring_t;
+
+static trace_ring_t trace_rings[portNUM_PROCESSORS];
+
+typedef struct {
+    uint32_t start_us;
+    uint32_t arg;
+    uint8_t name;
+} trace_span_t;
+
+
+static IRAM_ATTR void trace_event(uint8_t name, uint8_t phase, uint32_t start_us, uint32_t duration_us, uint32_t arg, uint32_t transfer)
+{
+    trace_ring_t *ring = &trace_rings[xPortGetCoreID()];
+    uint32_t number = atomic_fetch_add_explicit(&ring->next, 1, memory_order_relaxed);
+    trace_event_t *event = &ring->events[number % TRACE_RING_EVENTS];
+
+    atomic_store_explicit(&event->sequence, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    event->start_us = start_us;
+    event->duration_us = duration_us;
+    event->arg = arg;
+    event->transfer = transfer;
+    event->name = name;
+    event->phase = phase;
+
+    atomic_store_explicit(&event->sequence, number + 1, memory_order_release);
+}
+
+
+static trace_span_t trace_begin(uint8_t name, uint32_t arg)
+{
+    trace_span_t span = { .start_us = (uint32_t)esp_timer_get_time(), .arg = arg, .name = name };
+    return span;
+}
+
+
+static void trace_end(trace_span_t *span)
+{
+    trace_event(span->name, TRACE_PHASE_SPAN, span->start_us, (uint32_t)esp_timer_get_time() - span->start_us, span->arg, 0);
+}
+
+
+// Traces the rest of the enclosing block as a span, through GCC's cleanup attribute like RECORD_CALL.
+#define TRACE_SPAN(name, arg) \
+    trace_span_t trace_span __attribute__((cleanup(trace_end))) = trace_begin(name, arg)
+
+// A transfer is in flight from being queued until on_transfer_done() runs for it.
+#define TRACE_DMA_BEGIN(transfer, bytes) \
+    trace_event(TRACE_DMA, TRACE_PHASE_BEGIN, (uint32_t)esp_timer_get_time(), 0, bytes, transfer)
+#define TRACE_DMA_END(transfer) \
+    trace_event(TRACE_DMA, TRACE_PHASE_END, (uint32_t)esp_timer_get_time(), 0, 0, transfer)
+#else
+#define TRACE_SPAN(name, arg)
+#define TRACE_DMA_BEGIN(transfer, bytes)
+#define TRACE_DMA_END(transfer)
+#endif
+
+
+static int pool_init(void)
+{
+    // Already carved by an earlier setup.
+    if (pool_memory != NULL)
+    {
+        return DRAW_SUCCESS;
+    }
+
+#ifdef GRAPHICS_NO_HEAP
+    pool_memory = (uint8_t *)pool_storage;
+#else
+    pool_memory = (uint8_t *)heap_caps_malloc(POOL_BLOCK_SIZE * POOL_BLOCK_AMOUNT, MALLOC_CAP_DMA);
+    if (pool_memory == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Memory could not be allocated to the block pool.");
+        return DRAW_FAILURE;
+    }
+#endif
+
+    pool_free_mask = (POOL_BLOCK_AMOUNT == 32) ? 0xFFFFFFFF : ((1UL << POOL_BLOCK_AMOUNT) - 1);
+
+    memset(&pool_stats, 0, sizeof(pool_stats_t));
+    pool_stats.blocks = POOL_BLOCK_AMOUNT;
+    pool_stats.block_size = POOL_BLOCK_SIZE;
+
+    return DRAW_SUCCESS;
+}
+
+
+uint16_t *pool_borrow(void)
+{
+    uint16_t *block = NULL;
+
+    portENTER_CRITICAL(&pool_lock);
+
+    if (pool_free_mask != 0)
+    {
+        int index = __builtin_ctz(pool_free_mask);
+        pool_free_mask &= ~(1UL << index);
+        block = (uint16_t *)(pool_memory + index * POOL_BLOCK_SIZE);
+
+        pool_stats.borrowed += 1;
+        pool_stats.in_use += 1;
+        if (pool_stats.in_use > pool_stats.high_water)
+        {
+            pool_stats.high_water = pool_stats.in_use;
+        }
+    }
+    else
+    {
+        pool_stats.exhausted += 1;
+    }
+
+    portEXIT_CRITICAL(&pool_lock);
+
+    return block;
+}
+
+
+void pool_return(void *block)
+{
+    if (block == NULL)
+    {
+        return;
+    }
+
+    int index = ((uint8_t *)block - pool_memory) / POOL_BLOCK_SIZE;
+
+    portENTER_CRITICAL(&pool_lock);
+    pool_free_mask |= 1UL << index;
+    pool_stats.in_use -= 1;
+    portEXIT_CRITICAL(&pool_lock);
+}
+
+
+void get_pool_stats(pool_stats_t *stats)
+{
+    portENTER_CRITICAL(&pool_lock);
+    *stats = pool_stats;
+    portEXIT_CRITICAL(&pool_lock);
+}
+
+
+// Called from the SPI interrupt when the color data of a draw call has been sent.
+static IRAM_ATTR bool on_transfer_done(esp_lcd_panel_io_handle_t io_handle, esp_lcd_panel_io_event_data_t *event_data, void *user_ctx)
+{
+    BaseType_t high_task_woken = pdFALSE;
+
+    transfers_done += 1;
+    TRACE_DMA_END(transfers_done);
+    xSemaphoreGiveFromISR(transfer_done_semaphore, &high_task_woken);
+
+    return high_task_woken == pdTRUE;
+}
+
+
+// Blocks until at most max_in_flight transfers are still being sent.
+static void wait_for_in_flight(uint32_t max_in_flight)
+{
+    // Only waits that block are traced.
+    if ((uint32_t)(transfers_submitted - transfers_done) <= max_in_flight)
+    {
+        return;
+    }
+
+    TRACE_SPAN(TRACE_WAIT, transfers_submitted - transfers_done);
+
+    while ((uint32_t)(transfers_submitted - transfers_done) > max_in_flight)
+    {
+        xSemaphoreTake(transfer_done_semaphore, portMAX_DELAY);
+    }
+}
+
+
+// Blocks until every submitted transfer has been sent, after which the pixel buffers may be reused or freed.
+static void wait_for_transfers(void)
+{
+    int64_t start_us = esp_timer_get_time();
+
+    wait_for_in_flight(0);
+
+    transfer_stats.busy_us += esp_timer_get_time() - start_us;
+}
+
+
+// Fences count submitted transfers, so a fence is done once as many transfers are done. Wraps around safely.
+static int fence_done(draw_fence_t fence)
+{
+    return (int32_t)(transfers_done - fence) >= 0;
+}
+
+
+// Runs the callbacks and returns the pool blocks of done fences, oldest first. An entry is taken out of the table
+// before its callback runs, so callbacks may draw and wait themselves.
+static void reap_fences(void)
+{
+    while ( (pending_fence_amount > 0) && fence_done(pending_fences[0].fence) )
+    {
+        pending_fence_t done = pending_fences[0];
+
+        pending_fence_amount -= 1;
+        memmove(&pending_fences[0], &pending_fences[1], pending_fence_amount * sizeof(pending_fence_t));
+
+        if (done.block != NULL)
+        {
+            pool_return(done.block);
+        }
+
+        if (done.callback != NULL)
+        {
+            done.callback(done.fence, done.user_ctx);
+        }
+    }
+}
+
+
+// Packs BGR565 pixels into RGB444, two pixels into three bytes. An odd last pixel is padded with a zero nibble.
+static void pack_rgb444(const uint16_t *bgr_buffer, uint8_t *packed_buffer, int pixels)
+{
+    // The BGR565 buffer is in bus order, first byte RRRRRGGG, second byte GGGBBBBB.
+    const uint8_t *in = (const uint8_t *)bgr_buffer;
+    uint32_t color_0;
+    uint32_t color_1;
+
+    for (; pixels >= 2; pixels -= 2)
+    {
+        color_0 = ((in[0] & 0xF0) << 4) | ((in[0] & 0x07) << 5) | ((in[1] & 0x80) >> 3) | ((in[1] >> 1) & 0x0F);
+        color_1 = ((in[2] & 0xF0) << 4) | ((in[2] & 0x07) << 5) | ((in[3] & 0x80) >> 3) | ((in[3] >> 1) & 0x0F);
+
+        packed_buffer[0] = color_0 >> 4;
+        packed_buffer[1] = (color_0 << 4) | (color_1 >> 8);
+        packed_buffer[2] = color_1;
+
+        in += 4;
+        packed_buffer += 3;
+    }
+
+    if (pixels == 1)
+    {
+        color_0 = ((in[0] & 0xF0) << 4) | ((in[0] & 0x07) << 5) | ((in[1] & 0x80) >> 3) | ((in[1] >> 1) & 0x0F);
+
+        packed_buffer[0] = color_0 >> 4;
+        packed_buffer[1] = color_0 << 4;
+    }
+}
+
+
+// Sets the address window for the next memory write, end coordinates are exclusive.
+static void send_address_window(int x_start, int y_start, int x_end, int y_end)
+{
+    x_start += SCREEN_WIDTH_PIXEL_MISALIGNMENT;
+    x_end += SCREEN_WIDTH_PIXEL_MISALIGNMENT - 1;
+    y_start += SCREEN_HEIGHT_PIXEL_MISALIGNMENT;
+    y_end += SCREEN_HEIGHT_PIXEL_MISALIGNMENT - 1;
+
+    uint8_t column[4] = { x_start >> 8, x_start & 0xFF, x_end >> 8, x_end & 0xFF };
+    uint8_t row[4] = { y_start >> 8, y_start & 0xFF, y_end >> 8, y_end & 0xFF };
+
+    esp_lcd_panel_io_tx_param(display_io, LCD_CMD_CASET, column, 4);
+    esp_lcd_panel_io_tx_param(display_io, LCD_CMD_RASET, row, 4);
+}
+
+
+// 12 bit bus mode: packs and sends the window in chunks, packing the next chunk while the previous one is being sent.
+static void submit_window_rgb444(draw_t draw_params, const uint16_t *pixel_buffer)
+{
+    int pixels = draw_params.image_size_x * draw_params.image_size_y;
+    int packed_buffer_index = 0;
+    int command = LCD_CMD_RAMWR;
+
+    send_address_window(draw_params.draw_start_x, draw_params.draw_start_y, 
+        draw_params.draw_start_x + draw_params.image_size_x, 
+        draw_params.draw_start_y + draw_params.image_size_y
+    );
+
+    for (int offset = 0; offset < pixels; offset += LCD_PACK_BUFFER_PIXELS)
+    {
+        int chunk_pixels = pixels - offset < LCD_PACK_BUFFER_PIXELS ? pixels - offset : LCD_PACK_BUFFER_PIXELS;
+
+        // The packed buffer about to be filled may still be in flight from two chunks ago.
+        wait_for_in_flight(1);
+
+        pack_rgb444(pixel_buffer + offset, packed_buffers[packed_buffer_index], chunk_pixels);
+
+        transfers_submitted += 1;
+        TRACE_DMA_BEGIN(transfers_submitted, (chunk_pixels * 3 + 1) / 2);
+        esp_lcd_panel_io_tx_color(display_io, command, packed_buffers[packed_buffer_index], (chunk_pixels * 3 + 1) / 2);
+
+        // Continue writing where the previous chunk stopped.
+        command = LCD_CMD_RAMWRC;
+        packed_buffer_index ^= 1;
+    }
+}
+
+
+// Every window sent to the LCD goes through here, so transfers can be counted and timed in one place.
+// Returns once the window is queued, call wait_for_transfers() before reusing the pixel buffer.
+static void send_window(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, const uint16_t *pixel_buffer)
+{
+    int64_t start_us = esp_timer_get_time();
+    int pixels = draw_params.image_size_x * draw_params.image_size_y;
+    TRACE_SPAN(TRACE_SUBMIT, pixels);
+
+    // CASET and RASET with 4 parameter bytes each, then a memory write command per chunk of pixels.
+    if (display_config.bits_per_pixel == 12)
+    {
+        submit_window_rgb444(draw_params, pixel_buffer);
+        transfer_stats.command_bytes += 10 + (pixels + LCD_PACK_BUFFER_PIXELS - 1) / LCD_PACK_BUFFER_PIXELS;
+        transfer_stats.pixel_bytes += (pixels * 3 + 1) / 2;
+    }
+    else
+    {
+        transfers_submitted += 1;
+        TRACE_DMA_BEGIN(transfers_submitted, pixels * sizeof(uint16_t));
+        esp_lcd_panel_draw_bitmap(panel_handle, 
+            draw_params.draw_start_x + SCREEN_WIDTH_PIXEL_MISALIGNMENT, 
+            draw_params.draw_start_y + SCREEN_HEIGHT_PIXEL_MISALIGNMENT, 
+            draw_params.draw_start_x + draw_params.image_size_x + SCREEN_WIDTH_PIXEL_MISALIGNMENT, 
+            draw_params.draw_start_y + draw_params.image_size_y + SCREEN_HEIGHT_PIXEL_MISALIGNMENT, 
+            pixel_buffer
+        );
+        transfer_stats.command_bytes += 11;
+        transfer_stats.pixel_bytes += pixels * sizeof(uint16_t);
+    }
+
+    transfer_stats.transfers += 1;
+    transfer_stats.busy_us += esp_timer_get_time() - start_us;
+}
+
+
+// Sends the windows collected in the batch so far and waits for them, after which the batch block is free again.
+static void flush_batch(void)
+{
+    TRACE_SPAN(TRACE_FLUSH, batch_window_amount);
+
+    for (int i = 0; i < batch_window_amount; ++i)
+    {
+        send_window(batch_panel, batch_windows[i].window, batch_pixels + batch_windows[i].offset);
+    }
+
+    if (batch_window_amount > 0)
+    {
+        wait_for_transfers();
+    }
+
+    batch_window_amount = 0;
+    batch_pixels_used = 0;
+}
+
+
+// Merges a draw into the last collected window if they share lines or columns and the gap between them is small
+// enough. The last window is the last to be sent, so the draw still covers everything collected before it.
+static int merge_batch_window(draw_t draw_params, const uint16_t *pixel_buffer)
+{
+    batch_window_t *last = &batch_windows[batch_window_amount - 1];
+    draw_t merged = last->window;
+    draw_t gap = last->window;
+    int horizontal;
+
+    int last_x_end = last->window.draw_start_x + last->window.image_size_x;
+    int last_y_end = last->window.draw_start_y + last->window.image_size_y;
+    int x_end = draw_params.draw_start_x + draw_params.image_size_x;
+    int y_end = draw_params.draw_start_y + draw_params.image_size_y;
+
+    if ( (draw_params.draw_start_y == last->window.draw_start_y) && (draw_params.image_size_y == last->window.image_size_y) )
+    {
+        horizontal = 1;
+        merged.draw_start_x = draw_params.draw_start_x < last->window.draw_start_x ? draw_params.draw_start_x : last->window.draw_start_x;
+        merged.image_size_x = (x_end > last_x_end ? x_end : last_x_end) - merged.draw_start_x;
+
+        // Columns between the two, none if they touch or overlap.
+        gap.draw_start_x = draw_params.draw_start_x >= last_x_end ? last_x_end : x_end;
+        gap.image_size_x = draw_params.draw_start_x >= last_x_end ? draw_params.draw_start_x - last_x_end : 
+            (last->window.draw_start_x >= x_end ? last->window.draw_start_x - x_end : 0);
+    }
+    else if ( (draw_params.draw_start_x == last->window.draw_start_x) && (draw_params.image_size_x == last->window.image_size_x) )
+    {
+        horizontal = 0;
+        merged.draw_start_y = draw_params.draw_start_y < last->window.draw_start_y ? draw_params.draw_start_y : last->window.draw_start_y;
+        merged.image_size_y = (y_end > last_y_end ? y_end : last_y_end) - merged.draw_start_y;
+
+        gap.draw_start_y = draw_params.draw_start_y >= last_y_end ? last_y_end : y_end;
+        gap.image_size_y = draw_params.draw_start_y >= last_y_end ? draw_params.draw_start_y - last_y_end : 
+            (last->window.draw_start_y >= y_end ? last->window.draw_start_y - y_end : 0);
+    }
+    else
+    {
+        return 0;
+    }
+
+    int gap_size = horizontal ? gap.image_size_x : gap.image_size_y;
+    if ( (gap_size > batch_max_gap) || (last->offset + merged.image_size_x * merged.image_size_y > POOL_BLOCK_PIXELS) )
+    {
+        return 0;
+    }
+
+    // Filling the gap must not paint over a window collected earlier.
+    for (int i = 0; (i < batch_window_amount - 1) && (gap_size > 0); ++i)
+    {
+        draw_t *other = &batch_windows[i].window;
+
+        if ( (gap.draw_start_x < other->draw_start_x + other->image_size_x) && (other->draw_start_x < gap.draw_start_x + gap.image_size_x) &&
+            (gap.draw_start_y < other->draw_start_y + other->image_size_y) && (other->draw_start_y < gap.draw_start_y + gap.image_size_y) )
+        {
+            return 0;
+        }
+    }
+
+    // Move the pixels of the last window to their place in the merged window, last line first as lines only move up
+    // in memory.
+    uint16_t *base = batch_pixels + last->offset;
+    int last_x = last->window.draw_start_x - merged.draw_start_x;
+    int last_y = last->window.draw_start_y - merged.draw_start_y;
+
+    for (int line = last->window.image_size_y - 1; line >= 0; --line)
+    {
+        memmove(base + (last_y + line) * merged.image_size_x + last_x, base + line * last->window.image_size_x, 
+            last->window.image_size_x * sizeof(uint16_t));
+    }
+
+    for (int line = 0; line < gap.image_size_y; ++line)
+    {
+        uint16_t *gap_line = base + (gap.draw_start_y - merged.draw_start_y + line) * merged.image_size_x + (gap.draw_start_x - merged.draw_start_x);
+        for (int i = 0; i < gap.image_size_x; ++i)
+        {
+            gap_line[i] = batch_gap_color;
+        }
+    }
+
+    // The new draw goes on top, where they overlap.
+    for (int line = 0; line < draw_params.image_size_y; ++line)
+    {
+        memcpy(base + (draw_params.draw_start_y - merged.draw_start_y + line) * merged.image_size_x + (draw_params.draw_start_x - merged.draw_start_x),
+            pixel_buffer + line * draw_params.image_size_x, draw_params.image_size_x * sizeof(uint16_t));
+    }
+
+    last->window = merged;
+    batch_pixels_used = last->offset + merged.image_size_x * merged.image_size_y;
+
+    return 1;
+}
+
+
+// Draws go through here, collected while a batch is open and sent right away otherwise.
+static void submit_window(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, const uint16_t *pixel_buffer)
+{
+    if (batch_pixels == NULL)
+    {
+        send_window(panel_handle, draw_params, pixel_buffer);
+        return;
+    }
+
+    int pixels = draw_params.image_size_x * draw_params.image_size_y;
+    batch_panel = panel_handle;
+
+    if ( (batch_window_amount > 0) && merge_batch_window(draw_params, pixel_buffer) )
+    {
+        transfer_stats.merged_draws += 1;
+        return;
+    }
+
+    if ( (batch_pixels_used + pixels > POOL_BLOCK_PIXELS) || (batch_window_amount == BATCH_MAX_WINDOWS) )
+    {
+        flush_batch();
+    }
+
+    // Too large to collect, it is sent now and the caller waits for it as without a batch.
+    if (pixels > POOL_BLOCK_PIXELS)
+    {
+        send_window(panel_handle, draw_params, pixel_buffer);
+        return;
+    }
+
+    batch_windows[batch_window_amount].window = draw_params;
+    batch_windows[batch_window_amount].offset = batch_pixels_used;
+    memcpy(batch_pixels + batch_pixels_used, pixel_buffer, pixels * sizeof(uint16_t));
+
+    batch_window_amount += 1;
+    batch_pixels_used += pixels;
+}
+
+
+// Sanity check, if the draw area exceeds screen bounds.
+static int check_draw_bounds(draw_t draw_params)
+{
+    if ( (draw_params.draw_start_x >= SCREEN_WIDTH) || (draw_params.draw_start_y >= SCREEN_HEIGHT) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Draw starting position out of bounds.");
+        return DRAW_FAILURE;
+    }
+
+    if( ((draw_params.image_size_x + draw_params.draw_start_x) > SCREEN_WIDTH) || ((draw_params.image_size_y + draw_params.draw_start_y) > SCREEN_HEIGHT) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Draw starting postion + image_size, is out of bounds.");
+        return DRAW_FAILURE;
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+// Draws a source image with the given line stride, scaled by scale_x and scale_y.
+// The scaled image is built and sent one band at a time in a pool block, so no full size copy is ever made.
+static int draw_scaled(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, const uint16_t *source_buffer, int source_stride)
+{
+    int scaled_width = draw_params.image_size_x * draw_params.scale_x;
+
+    draw_t band = draw_params;
+    band.image_size_x = scaled_width;
+    band.image_size_y = draw_params.image_size_y * draw_params.scale_y;
+
+    if (check_draw_bounds(band) != DRAW_SUCCESS)
+    {
+        return DRAW_FAILURE;
+    }
+
+    // Amount of source lines that fit in a band once scaled.
+    int band_source_lines = POOL_BLOCK_PIXELS / (scaled_width * draw_params.scale_y);
+    if (band_source_lines == 0)
+    {
+        ESP_LOGE(TAG_DISPLAY, "A scaled line does not fit in a pool block.");
+        return DRAW_FAILURE;
+    }
+
+    uint16_t *band_buffer = pool_borrow();
+    if (band_buffer == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for drawing.");
+        return DRAW_FAILURE;
+    }
+
+    for (int line = 0; line < draw_params.image_size_y; line += band_source_lines)
+    {
+        int lines = draw_params.image_size_y - line < band_source_lines ? draw_params.image_size_y - line : band_source_lines;
+        uint16_t *out = band_buffer;
+
+        // The band is built in its own block so its rasterize span ends before the band is sent.
+        {
+            TRACE_SPAN(TRACE_RASTERIZE, lines * scaled_width * draw_params.scale_y);
+
+            for (int band_line = 0; band_line < lines; ++band_line)
+            {
+                const uint16_t *in = source_buffer + (line + band_line) * source_stride;
+
+                // Create a single line of scale * pixels.
+                for (int pixel_offset = 0; pixel_offset < draw_params.image_size_x; ++pixel_offset)
+                {
+                    for (int scale_offset = 0; scale_offset < draw_params.scale_x; ++scale_offset)
+                    {
+                        *out++ = in[pixel_offset];
+                    }
+                }
+
+                // Now memcpy this line of scaled pixels to the line(s) just underneath.
+                for (int line_offset = 1; line_offset < draw_params.scale_y; ++line_offset)
+                {
+                    memcpy(out, out - scaled_width, scaled_width * sizeof(uint16_t));
+                    out += scaled_width;
+                }
+            }
+        }
+
+        band.draw_start_y = draw_params.draw_start_y + line * draw_params.scale_y;
+        band.image_size_y = lines * draw_params.scale_y;
+
+        // The band buffer is refilled for the next band, so wait for it to be sent.
+        submit_window(panel_handle, band, band_buffer);
+        wait_for_transfers();
+    }
+
+    pool_return(band_buffer);
+
+    return DRAW_SUCCESS;
+}
+
+
+int set_vertical_scroll(unsigned short first_line, unsigned short scroll_lines, unsigned short scroll_offset)
+{
+    // Sanity checks.
+    if ( (scroll_lines == 0) || (first_line + scroll_lines > SCREEN_HEIGHT) || (scroll_offset >= scroll_lines) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Scroll area or offset out of bounds.");
+        return DRAW_FAILURE;
+    }
+
+    RECORD_CALL(RECORD_SET_VERTICAL_SCROLL, NULL, 0, NULL, 0, first_line, scroll_lines, scroll_offset);
+
+    // The scroll area is set in frame memory lines, the fixed areas include the lines outside the screen.
+    int top_fixed_lines = first_line + SCREEN_HEIGHT_PIXEL_MISALIGNMENT;
+    int bottom_fixed_lines = LCD_MEMORY_LINES - top_fixed_lines - scroll_lines;
+    int start_line = top_fixed_lines + scroll_offset;
+
+    uint8_t scroll_area[6] = { top_fixed_lines >> 8, top_fixed_lines & 0xFF, scroll_lines >> 8, scroll_lines & 0xFF,
+        bottom_fixed_lines >> 8, bottom_fixed_lines & 0xFF };
+    uint8_t scroll_start[2] = { start_line >> 8, start_line & 0xFF };
+
+    // Queued windows still go to the old layout.
+    wait_for_transfers();
+
+    esp_lcd_panel_io_tx_param(display_io, LCD_CMD_VSCRDEF, scroll_area, 6);
+    esp_lcd_panel_io_tx_param(display_io, LCD_CMD_VSCSAD, scroll_start, 2);
+
+    return DRAW_SUCCESS;
+}
+
+
+void get_transfer_stats(transfer_stats_t *stats)
+{
+    *stats = transfer_stats;
+}
+
+
+int select_panel(const panel_descriptor_t *panel)
+{
+    // Sanity checks.
+    if (panel == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Panel descriptor is a NULL pointer.");
+        return DRAW_FAILURE;
+    }
+
+    if (display_io != NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "The panel must be selected before the display is set up.");
+        return DRAW_FAILURE;
+    }
+
+#if GRAPHICS_BOARD == BOARD_RUNTIME
+    if ( (panel->width > SCREEN_MAX_WIDTH) || (panel->height > SCREEN_MAX_HEIGHT) || 
+         (panel->x_offset + panel->width > LCD_MEMORY_COLUMNS) || (panel->y_offset + panel->height > LCD_MEMORY_LINES) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Panel %s does not fit the buffers or the frame memory.", panel->name);
+        return DRAW_FAILURE;
+    }
+#else
+    // The geometry is compiled in.
+    if ( (panel->width != SCREEN_WIDTH) || (panel->height != SCREEN_HEIGHT) || 
+         (panel->x_offset != SCREEN_WIDTH_PIXEL_MISALIGNMENT) || (panel->y_offset != SCREEN_HEIGHT_PIXEL_MISALIGNMENT) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Panel %s needs a build for its board, or GRAPHICS_BOARD set to BOARD_RUNTIME.", panel->name);
+        return DRAW_FAILURE;
+    }
+#endif
+
+    active_panel = panel;
+
+    return DRAW_SUCCESS;
+}
+
+
+void get_default_display_config(display_config_t *config)
+{
+    *config = active_panel->default_config;
+}
+
+
+// Sanity checks for a display configuration.
+static int validate_display_config(const display_config_t *config)
+{
+    if ( (config->pixel_clock_hz == 0) || (config->pixel_clock_hz > LCD_MAX_PIXEL_CLOCK_HZ) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Pixel clock must be between 1 and %d Hz.", LCD_MAX_PIXEL_CLOCK_HZ);
+        return DRAW_FAILURE;
+    }
+
+    if ( (config->trans_queue_depth < 1) || (config->trans_queue_depth > LCD_MAX_TRANS_QUEUE_DEPTH) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Transaction queue depth must be between 1 and %d.", LCD_MAX_TRANS_QUEUE_DEPTH);
+        return DRAW_FAILURE;
+    }
+
+    // A transfer smaller than a line would split every draw call into tiny transactions.
+    if ( (config->max_transfer_sz < (int)(SCREEN_WIDTH * sizeof(uint16_t))) || (config->max_transfer_sz % sizeof(uint16_t) != 0) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Max transfer size must be an even amount of bytes, and at least a line (%d bytes).", (int)(SCREEN_WIDTH * sizeof(uint16_t)));
+        return DRAW_FAILURE;
+    }
+
+    // Without DMA the SPI driver can only send 64 bytes at a time.
+    if ( (config->bus == PANEL_BUS_SPI) && (config->dma_channel == SPI_DMA_DISABLED) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "The display needs a DMA channel.");
+        return DRAW_FAILURE;
+    }
+
+    if ( (config->bits_per_pixel != 16) && (config->bits_per_pixel != 12) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Bits per pixel must be 16 or 12.");
+        return DRAW_FAILURE;
+    }
+
+    if (config->bus == PANEL_BUS_SPI)
+    {
+        if ( (config->pin_mosi < 0) || (config->pin_sclk < 0) || (config->pin_dc < 0) )
+        {
+            ESP_LOGE(TAG_DISPLAY, "MOSI, SCLK and DC pins must be set.");
+            return DRAW_FAILURE;
+        }
+
+        return DRAW_SUCCESS;
+    }
+
+#if SOC_LCD_I80_SUPPORTED
+    if (config->bus == PANEL_BUS_I80)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            if (config->pin_data[i] < 0)
+            {
+                ESP_LOGE(TAG_DISPLAY, "All 8 data pins must be set.");
+                return DRAW_FAILURE;
+            }
+        }
+
+        if ( (config->pin_wr < 0) || (config->pin_dc < 0) )
+        {
+            ESP_LOGE(TAG_DISPLAY, "WR and DC pins must be set.");
+            return DRAW_FAILURE;
+        }
+
+        return DRAW_SUCCESS;
+    }
+#endif
+
+    ESP_LOGE(TAG_DISPLAY, "The bus is not supported on this chip.");
+    return DRAW_FAILURE;
+}
+
+
 void setup_display(esp_lcd_panel_handle_t *panel_handle)
 {
-    gpio_config_t bk_gpio_config = {
-        .mode = GPIO_MODE_OUTPUT,
-        .pin_bit_mask = 1ULL << PIN_NUM_BK_LIGHT
-    };
+    display_config_t config;
+    get_default_display_config(&config);
+
+    // Nothing can be drawn without the display, so a failure aborts like the ESP_ERROR_CHECK()s setting it up.
+    if (setup_display_with_config(panel_handle, &config) != DRAW_SUCCESS)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Display could not be set up.");
+        abort();
+    }
+}
+
+
+int setup_display_with_config(esp_lcd_panel_handle_t *panel_handle, const display_config_t *config)
+{
+    if (validate_display_config(config) != DRAW_SUCCESS)
+    {
+        return DRAW_FAILURE;
+    }
+
+    display_config = *config;
+
+    if (pool_init() != DRAW_SUCCESS)
+    {
+        return DRAW_FAILURE;
+    }
+
+    transfer_done_semaphore = xSemaphoreCreateBinaryStatic(&transfer_done_semaphore_storage);
+    if (transfer_done_semaphore == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Transfer semaphore could not be created.");
+        return DRAW_FAILURE;
+    }
+
+    // The backlight is optional.
+    if (config->pin_bk_light >= 0)
+    {
+        gpio_config_t bk_gpio_config = {
+            .mode = GPIO_MODE_OUTPUT,
+            .pin_bit_mask = 1ULL << config->pin_bk_light
+        };
+
+        // Initialize the GPIO of backlight
+        ESP_ERROR_CHECK(gpio_config(&bk_gpio_config));
+    }
+
+    esp_lcd_panel_io_handle_t io_handle = NULL;
+
+    if (config->bus == PANEL_BUS_SPI)
+    {
+        // Configure the bus for sending data to the screen.
+        spi_bus_config_t bus_config = {
+            .sclk_io_num = config->pin_sclk,
+            .mosi_io_num = config->pin_mosi,
+            .miso_io_num = -1,
+            .quadwp_io_num = -1,
+            .quadhd_io_num = -1,
+            .max_transfer_sz = config->max_transfer_sz
+        };
+
+        // Initialize the SPI bus
+        ESP_ERROR_CHECK(spi_bus_initialize(LCD_HOST, &bus_config, config->dma_channel));
+
+        esp_lcd_panel_io_spi_config_t io_config = {
+            .dc_gpio_num = config->pin_dc,
+            .cs_gpio_num = config->pin_cs,
+            .pclk_hz = config->pixel_clock_hz,
+            .lcd_cmd_bits = LCD_CMD_BITS,
+            .lcd_param_bits = LCD_PARAM_BITS,
+            .spi_mode = 0,
+            .trans_queue_depth = config->trans_queue_depth,
+            .on_color_trans_done = on_transfer_done,
+        };
+
+        // Attach the LCD to the SPI bus
+        ESP_ERROR_CHECK(esp_lcd_new_panel_io_spi((esp_lcd_spi_bus_handle_t)LCD_HOST, &io_config, &io_handle));
+    }
+#if SOC_LCD_I80_SUPPORTED
+    else
+    {
+        // The panel is powered and the read strobe held high before the bus starts.
+        uint64_t pin_mask = 0;
+        pin_mask |= config->pin_power >= 0 ? 1ULL << config->pin_power : 0;
+        pin_mask |= config->pin_rd >= 0 ? 1ULL << config->pin_rd : 0;
+
+        if (pin_mask != 0)
+        {
+            gpio_config_t power_gpio_config = {
+                .mode = GPIO_MODE_OUTPUT,
+                .pin_bit_mask = pin_mask
+            };
+            ESP_ERROR_CHECK(gpio_config(&power_gpio_config));
+
+            if (config->pin_power >= 0)
+            {
+                ESP_ERROR_CHECK(gpio_set_level(config->pin_power, 1));
+            }
+            if (config->pin_rd >= 0)
+            {
+                ESP_ERROR_CHECK(gpio_set_level(config->pin_rd, 1));
+            }
+        }
+
+        esp_lcd_i80_bus_handle_t i80_bus = NULL;
+        esp_lcd_i80_bus_config_t bus_config = {
+            .clk_src = LCD_CLK_SRC_DEFAULT,
+            .dc_gpio_num = config->pin_dc,
+            .wr_gpio_num = config->pin_wr,
+            .bus_width = 8,
+            .max_transfer_bytes = config->max_transfer_sz,
+        };
+        for (int i = 0; i < 8; ++i)
+        {
+            bus_config.data_gpio_nums[i] = config->pin_data[i];
+        }
+
+        ESP_ERROR_CHECK(esp_lcd_new_i80_bus(&bus_config, &i80_bus));
+
+        esp_lcd_panel_io_i80_config_t io_config = {
+            .cs_gpio_num = config->pin_cs,
+            .pclk_hz = config->pixel_clock_hz,
+            .trans_queue_depth = config->trans_queue_depth,
+            .on_color_trans_done = on_transfer_done,
+            .lcd_cmd_bits = LCD_CMD_BITS,
+            .lcd_param_bits = LCD_PARAM_BITS,
+            .dc_levels = {
+                .dc_idle_level = 0,
+                .dc_cmd_level = 0,
+                .dc_dummy_level = 0,
+                .dc_data_level = 1,
+            },
+        };
+
+        ESP_ERROR_CHECK(esp_lcd_new_panel_io_i80(i80_bus, &io_config, &io_handle));
+    }
+#endif
+
+    display_io = io_handle;
+
+    esp_lcd_panel_dev_config_t panel_config = {
+        .reset_gpio_num = config->pin_rst,
+        .rgb_endian = LCD_RGB_ENDIAN_RGB,   // The endian of the color, e.i. RGB or BGR
+        .bits_per_pixel = 16,
+    };
+
+    // Initialize the LCD configuration on the lily TTGO t-display
+    ESP_ERROR_CHECK(esp_lcd_new_panel_st7789(io_handle, &panel_config, panel_handle));
+
+    // Turn off backlight to avoid unpredictable display on the LCD screen while initializing
+    // the LCD panel driver. (Different LCD screens may need different levels)
+    if (config->pin_bk_light >= 0)
+    {
+        ESP_ERROR_CHECK(gpio_set_level(config->pin_bk_light, LCD_BK_LIGHT_OFF_LEVEL));
+    }
+
+    // Reset the display
+    ESP_ERROR_CHECK(esp_lcd_panel_reset(*panel_handle));
+
+    // Initialize LCD panel
+    ESP_ERROR_CHECK(esp_lcd_panel_init(*panel_handle));
+
+    // Turn on the screen
+    ESP_ERROR_CHECK(esp_lcd_panel_disp_on_off(*panel_handle, true));
+
+    ESP_ERROR_CHECK(esp_lcd_panel_invert_color(*panel_handle, true));
+
+    // The panel driver only knows 16 and 18 bit pixels, so 12 bit mode is set here and the packing is done by us.
+    if (config->bits_per_pixel == 12)
+    {
+        for (int i = 0; (i < 2) && (packed_buffers[i] == NULL); ++i)
+        {
+#ifdef GRAPHICS_NO_HEAP
+            packed_buffers[i] = (uint8_t *)packed_storage[i];
+#else
+            packed_buffers[i] = (uint8_t *)heap_caps_malloc(LCD_PACK_BUFFER_PIXELS * 3 / 2, MALLOC_CAP_DMA);
+            if (packed_buffers[i] == NULL)
+            {
+                ESP_LOGE(TAG_DISPLAY, "Memory could not be allocated to the 12 bit packing buffers.");
+                return DRAW_FAILURE;
+            }
+#endif
+        }
+
+        uint8_t color_mode = LCD_COLMOD_12_BIT;
+        ESP_ERROR_CHECK(esp_lcd_panel_io_tx_param(io_handle, LCD_CMD_COLMOD, &color_mode, 1));
+    }
+
+    // Turn on backlight (Different LCD screens may need different levels)
+    if (config->pin_bk_light >= 0)
+    {
+        ESP_ERROR_CHECK(gpio_set_level(config->pin_bk_light, LCD_BK_LIGHT_ON_LEVEL));
+    }
+
+    ESP_LOGI(TAG_DISPLAY, "Display set up! Pixel clock: %lu Hz, queue depth: %d, max transfer size: %d bytes, %d bits per pixel.",
+        (unsigned long)config->pixel_clock_hz, config->trans_queue_depth, config->max_transfer_sz, config->bits_per_pixel
+    );
+
+    return DRAW_SUCCESS;
+}
+
+
+// Sets every pixel of a band to the same color.
+static void fill_band(uint16_t *band_buffer, uint16_t BGR_color, int pixels)
+{
+    TRACE_SPAN(TRACE_RASTERIZE, pixels);
+
+    // NOTE: Cannot be done with memset, as it only sets a single byte and not two bytes, which is the size of the uint16_t color buffer.
+    for (int i = 0; i < pixels; ++i)
+    {
+        band_buffer[i] = BGR_color;
+    }
+}
+
+
+int fill_rect(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, uint16_t RGB_color)
+{
+    // Sanity checks.
+    if (check_draw_bounds(draw_params) != DRAW_SUCCESS)
+    {
+        return DRAW_FAILURE;
+    }
+
+    RECORD_CALL(RECORD_FILL_RECT, NULL, 0, NULL, 0, draw_params.draw_start_x, draw_params.draw_start_y, draw_params.image_size_x, draw_params.image_size_y, RGB_color);
+    TRACE_SPAN(TRACE_FILL_RECT, draw_params.image_size_x * draw_params.image_size_y);
+
+    // Nothing to draw.
+    if ( (draw_params.image_size_x == 0) || (draw_params.image_size_y == 0) )
+    {
+        return DRAW_SUCCESS;
+    }
+
+    // Foreground color
+    uint16_t BGR_color = COLOR_SWAP(RGB_color);  
+
+    // Every pixel has the same color, so a single band buffer is filled once and sent for every band of the rectangle.
+    uint16_t *color_buffer = pool_borrow();
+    if (color_buffer == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for filling.");
+        return DRAW_FAILURE;
+    }
+
+    int band_lines = POOL_BLOCK_PIXELS / draw_params.image_size_x;
+    if (band_lines > draw_params.image_size_y)
+    {
+        band_lines = draw_params.image_size_y;
+    }
+
+    fill_band(color_buffer, BGR_color, draw_params.image_size_x * band_lines);
+
+    // Draw calls to the LCD, the buffer does not change so the bands can be queued back to back.
+    draw_t band = draw_params;
+    for (int line = 0; line < draw_params.image_size_y; line += band_lines)
+    {
+        band.draw_start_y = draw_params.draw_start_y + line;
+        band.image_size_y = draw_params.image_size_y - line < band_lines ? draw_params.image_size_y - line : band_lines;
+
+        submit_window(panel_handle, band, color_buffer);
+    }
+
+    wait_for_transfers();
+
+    pool_return(color_buffer);
+    
+    return DRAW_SUCCESS;
+}
+
+
+int fill_display(esp_lcd_panel_handle_t panel_handle, uint16_t RGB_color)
+{
+    draw_t params;
+    params.draw_start_x = 0;
+    params.draw_start_y = 0;
+    params.image_size_x = SCREEN_WIDTH;
+    params.image_size_y = SCREEN_HEIGHT;
 
-    // Initialize the GPIO of backlight
-    ESP_ERROR_CHECK(gpio_config(&bk_gpio_config));
+    // Fill.
+    if (fill_rect(panel_handle, params, RGB_color) != 0)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Fill failed.");
+        return DRAW_FAILURE;
+    }
 
-    // Configure the bus for sending data to the screen.
-    spi_bus_config_t bus_config = {
-        .sclk_io_num = PIN_NUM_SCLK,
-        .mosi_io_num = PIN_NUM_MOSI,
-        .max_transfer_sz = SCREEN_WIDTH * sizeof(uint16_t)
-    };
+    return DRAW_SUCCESS;
+}
 
-    // Initialize the SPI bus
-    ESP_ERROR_CHECK(spi_bus_initialize(LCD_HOST, &bus_config, SPI_DMA_CH_AUTO));
+void int_to_color_array(color_def_t colors, uint16_t *int_buffer, int buffer_size)
+{
+    // Based on the 8 selected colors, convert the integers to colors.
+    for(int i = 0; i < buffer_size; ++i )
+    {
+        if (int_buffer[i] == colors.COLOR_ID_0)
+        {
+            int_buffer[i] = colors.COLOR_0;
+            continue;
+        }
 
-    esp_lcd_panel_io_handle_t io_handle = NULL;
-    esp_lcd_panel_io_spi_config_t io_config = {
-        .dc_gpio_num = PIN_NUM_DC,
-        .cs_gpio_num = PIN_NUM_CS,
-        .pclk_hz = LCD_PIXEL_CLOCK_HZ,
-        .lcd_cmd_bits = LCD_CMD_BITS,
-        .lcd_param_bits = LCD_PARAM_BITS,
-        .spi_mode = 0,
-        .trans_queue_depth = 10,
-    };
+        if (int_buffer[i] == colors.COLOR_ID_1)
+        {
+            int_buffer[i] = colors.COLOR_1;
+            continue;
+        }
 
-    // Attach the LCD to the SPI bus
-    ESP_ERROR_CHECK(esp_lcd_new_panel_io_spi((esp_lcd_spi_bus_handle_t)LCD_HOST, &io_config, &io_handle));
+        if (int_buffer[i] == colors.COLOR_ID_2)
+        {
+            int_buffer[i] = colors.COLOR_2;
+            continue;
+        }
 
-    esp_lcd_panel_dev_config_t panel_config = {
-        .reset_gpio_num = PIN_NUM_RST,
-        .rgb_endian = LCD_RGB_ENDIAN_RGB,   // The endian of the color, e.i. RGB or BGR
-        .bits_per_pixel = 16,
-    };
+        if (int_buffer[i] == colors.COLOR_ID_3)
+        {
+            int_buffer[i] = colors.COLOR_3;
+            continue;
+        }
 
-    // Initialize the LCD configuration on the lily TTGO t-display
-    ESP_ERROR_CHECK(esp_lcd_new_panel_st7789(io_handle, &panel_config, panel_handle));
+        if (int_buffer[i] == colors.COLOR_ID_4)
+        {
+            int_buffer[i] = colors.COLOR_4;
+            continue;
+        }
 
-    // Turn off backlight to avoid unpredictable display on the LCD screen while initializing
-    // the LCD panel driver. (Different LCD screens may need different levels)
-    ESP_ERROR_CHECK(gpio_set_level(PIN_NUM_BK_LIGHT, LCD_BK_LIGHT_OFF_LEVEL));
+        if (int_buffer[i] == colors.COLOR_ID_5)
+        {
+            int_buffer[i] = colors.COLOR_5;
+            continue;
+        }
 
-    // Reset the display
-    ESP_ERROR_CHECK(esp_lcd_panel_reset(*panel_handle));
+        if (int_buffer[i] == colors.COLOR_ID_6)
+        {
+            int_buffer[i] = colors.COLOR_6;
+            continue;
+        }
 
-    // Initialize LCD panel
-    ESP_ERROR_CHECK(esp_lcd_panel_init(*panel_handle));
+        if (int_buffer[i] == colors.COLOR_ID_7)
+        {
+            int_buffer[i] = colors.COLOR_7;
+            continue;
+        }
+    }
+}
 
-    // Turn on the screen
-    ESP_ERROR_CHECK(esp_lcd_panel_disp_on_off(*panel_handle, true));
+#ifndef GRAPHICS_NO_HEAP
 
-    ESP_ERROR_CHECK(esp_lcd_panel_invert_color(*panel_handle, true));
+char *int_to_char_array(int number, int *str_size)
+{       
+    short arbitrary_size = 32;
 
-    // Turn on backlight (Different LCD screens may need different levels)
-    ESP_ERROR_CHECK(gpio_set_level(PIN_NUM_BK_LIGHT, LCD_BK_LIGHT_ON_LEVEL));
+    // Create null ptr.
+    char *number_str = NULL;
+    
+    // Allocate memory and set it to 0.
+    number_str = (char *)calloc(arbitrary_size, sizeof(char));
+
+    // Put number into char array.
+    sprintf(number_str, "%d", number);
+
+    // Find out how many characters the number consists of.
+    for (int i = 0; i < arbitrary_size; ++i)
+    {
+        if (number_str[i] == 0)
+        {
+            *str_size = i;
+            break;
+        }
+    }
 
-    ESP_LOGI(TAG_DISPLAY, "Display set up!");
+    return number_str;
 }
 
+#endif
 
-int fill_rect(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, uint16_t RGB_color)
+
+int draw_bgr_image(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, const uint16_t *image_buffer)
 {
-    // Sanity check, if pixel position parameters exceeds screen bounds.
     // Sanity checks.
-    if ( ( (draw_params.draw_start_x-1) > SCREEN_WIDTH) || ( (draw_params.draw_start_y-1) > SCREEN_HEIGHT) )
+    if (image_buffer == NULL)
     {
-        ESP_LOGE(TAG_DISPLAY, "Draw starting position out of bounds.");
+        ESP_LOGE(TAG_DISPLAY, "Cannot draw, image buffer is a NULL pointer.");
         return DRAW_FAILURE;
     }
 
-    if( (((draw_params.image_size_x + draw_params.draw_start_x)-1) > SCREEN_WIDTH) || (((draw_params.image_size_y + draw_params.draw_start_y)-1) > SCREEN_HEIGHT) )
+    if (check_draw_bounds(draw_params) != DRAW_SUCCESS)
     {
-        ESP_LOGE(TAG_DISPLAY, "Draw starting postion + image_size, is out of bounds.");
         return DRAW_FAILURE;
     }
 
-    // Foreground color
-    uint16_t BGR_color = COLOR_SWAP(RGB_color);  
+    RECORD_CALL(RECORD_DRAW_BGR_IMAGE, image_buffer, draw_params.image_size_x * draw_params.image_size_y * sizeof(uint16_t), NULL, 0,
+        draw_params.draw_start_x, draw_params.draw_start_y, draw_params.image_size_x, draw_params.image_size_y, draw_params.scale_x, draw_params.scale_y);
+    TRACE_SPAN(TRACE_DRAW_BGR_IMAGE, draw_params.image_size_x * draw_params.image_size_y);
+
+    // Draw call to the LCD.
+    submit_window(panel_handle, draw_params, image_buffer);
+
+    // The image buffer belongs to the caller, so it must be sent before returning.
+    wait_for_transfers();
+
+    return DRAW_SUCCESS;
+}
+
+
+int queue_bgr_image(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, const uint16_t *image_buffer)
+{
+    // Sanity checks.
+    if (image_buffer == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot queue, image buffer is a NULL pointer.");
+        return DRAW_FAILURE;
+    }
+
+    if (check_draw_bounds(draw_params) != DRAW_SUCCESS)
+    {
+        return DRAW_FAILURE;
+    }
+
+    RECORD_CALL(RECORD_QUEUE_BGR_IMAGE, image_buffer, draw_params.image_size_x * draw_params.image_size_y * sizeof(uint16_t), NULL, 0,
+        draw_params.draw_start_x, draw_params.draw_start_y, draw_params.image_size_x, draw_params.image_size_y, draw_params.scale_x, draw_params.scale_y);
+    TRACE_SPAN(TRACE_QUEUE_BGR_IMAGE, draw_params.image_size_x * draw_params.image_size_y);
+
+    submit_window(panel_handle, draw_params, image_buffer);
 
-    int color_buffer_size = draw_params.image_size_x * draw_params.image_size_y * sizeof(uint16_t);
+    return DRAW_SUCCESS;
+}
+
+
+void wait_for_draws(void)
+{
+    RECORD_CALL(RECORD_WAIT_FOR_DRAWS, NULL, 0, NULL, 0, 0);
+
+    wait_for_transfers();
+
+    reap_fences();
+}
+
+
+void wait_for_draws_in_flight(uint32_t max_in_flight)
+{
+    int64_t start_us = esp_timer_get_time();
+
+    wait_for_in_flight(max_in_flight);
+
+    transfer_stats.busy_us += esp_timer_get_time() - start_us;
+}
+
+
+int begin_batch(unsigned short max_gap, uint16_t gap_RGB_color)
+{
+    // Sanity check.
+    if (batch_pixels != NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "A batch is already open.");
+        return DRAW_FAILURE;
+    }
+
+    RECORD_CALL(RECORD_BEGIN_BATCH, NULL, 0, NULL, 0, max_gap, gap_RGB_color);
+
+    batch_pixels = pool_borrow();
+    if (batch_pixels == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for a batch.");
+        return DRAW_FAILURE;
+    }
+
+    batch_max_gap = max_gap;
+    batch_gap_color = COLOR_SWAP(gap_RGB_color);
+    batch_window_amount = 0;
+    batch_pixels_used = 0;
+
+    return DRAW_SUCCESS;
+}
+
+
+int end_batch(void)
+{
+    // Sanity check.
+    if (batch_pixels == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No batch is open.");
+        return DRAW_FAILURE;
+    }
+
+    RECORD_CALL(RECORD_END_BATCH, NULL, 0, NULL, 0, 0);
+
+    flush_batch();
+
+    pool_return(batch_pixels);
+    batch_pixels = NULL;
+
+    return DRAW_SUCCESS;
+}
+
+
+// Adds a pending fence, after waiting for the oldest one if there is no room. Transfers finish in order, so the
+// table is kept sorted oldest first.
+static void add_pending_fence(draw_fence_t fence, fence_callback_t callback, void *user_ctx, void *block)
+{
+    while (pending_fence_amount == FENCE_MAX_PENDING)
+    {
+        wait_for_fence(pending_fences[0].fence);
+    }
+
+    int index = pending_fence_amount;
+    while ( (index > 0) && ((int32_t)(fence - pending_fences[index - 1].fence) < 0) )
+    {
+        pending_fences[index] = pending_fences[index - 1];
+        --index;
+    }
+
+    pending_fences[index].fence = fence;
+    pending_fences[index].callback = callback;
+    pending_fences[index].user_ctx = user_ctx;
+    pending_fences[index].block = block;
+    pending_fence_amount += 1;
+}
+
+
+// Checks what the async draws share, a batch would only copy the pixels and has no fence for them.
+static int check_async_draw(draw_t draw_params)
+{
+    if (batch_pixels != NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Async draws cannot be used in a batch.");
+        return DRAW_FAILURE;
+    }
+
+    return check_draw_bounds(draw_params);
+}
+
+
+int fill_rect_async(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, uint16_t RGB_color, draw_fence_t *fence)
+{
+    // Sanity checks.
+    if (check_async_draw(draw_params) != DRAW_SUCCESS)
+    {
+        return DRAW_FAILURE;
+    }
+
+    RECORD_CALL(RECORD_FILL_RECT_ASYNC, NULL, 0, NULL, 0, draw_params.draw_start_x, draw_params.draw_start_y, draw_params.image_size_x, draw_params.image_size_y, RGB_color);
+    TRACE_SPAN(TRACE_FILL_RECT_ASYNC, draw_params.image_size_x * draw_params.image_size_y);
+
+    reap_fences();
+
+    if (fence != NULL)
+    {
+        *fence = transfers_submitted;
+    }
+
+    // Nothing to draw.
+    if ( (draw_params.image_size_x == 0) || (draw_params.image_size_y == 0) )
+    {
+        return DRAW_SUCCESS;
+    }
 
-    // Since we do not know the size of the color buffer, before execution we allocate memory for it.
-    uint16_t *color_buffer = NULL;
+    // Blocks held by earlier async fills come back as their fences are done.
+    uint16_t *color_buffer = pool_borrow();
+    while ( (color_buffer == NULL) && (pending_fence_amount > 0) )
+    {
+        wait_for_fence(pending_fences[0].fence);
+        color_buffer = pool_borrow();
+    }
 
-    color_buffer = (uint16_t *)malloc(color_buffer_size);
     if (color_buffer == NULL)
     {
-        ESP_LOGE(TAG_DISPLAY, "Memory could not be allocated to buffer.");
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for filling.");
         return DRAW_FAILURE;
     }
 
-    // Set the correct color:
-    // NOTE: Cannot be done with memset, as it only sets a single byte and not two bytes, which is the size of the uint16_t color buffer.
-    for (int i = 0; i < draw_params.image_size_x * draw_params.image_size_y; ++i)
+    int band_lines = POOL_BLOCK_PIXELS / draw_params.image_size_x;
+    if (band_lines > draw_params.image_size_y)
     {
-        color_buffer[i] = BGR_color;
+        band_lines = draw_params.image_size_y;
     }
 
-    // Draw call to the LCD.
-    esp_lcd_panel_draw_bitmap(panel_handle, 
-        draw_params.draw_start_x + SCREEN_WIDTH_PIXEL_MISALIGNMENT, 
-        draw_params.draw_start_y + SCREEN_HEIGHT_PIXEL_MISALIGNMENT, 
-        draw_params.draw_start_x + draw_params.image_size_x + SCREEN_WIDTH_PIXEL_MISALIGNMENT, 
-        draw_params.draw_start_y + draw_params.image_size_y + SCREEN_HEIGHT_PIXEL_MISALIGNMENT, 
-        color_buffer
-    );
+    fill_band(color_buffer, COLOR_SWAP(RGB_color), draw_params.image_size_x * band_lines);
+
+    draw_t band = draw_params;
+    for (int line = 0; line < draw_params.image_size_y; line += band_lines)
+    {
+        band.draw_start_y = draw_params.draw_start_y + line;
+        band.image_size_y = draw_params.image_size_y - line < band_lines ? draw_params.image_size_y - line : band_lines;
+
+        wait_for_draws_in_flight(display_config.trans_queue_depth - 1);
+        submit_window(panel_handle, band, color_buffer);
+    }
 
-    // Free allocated memory color_buffer.
-    free(color_buffer);
+    add_pending_fence(transfers_submitted, NULL, NULL, color_buffer);
+
+    if (fence != NULL)
+    {
+        *fence = transfers_submitted;
+    }
 
-    // Read somewhere this is needed to prevent visual artifacts, turns out it is true.
-    vTaskDelay(10 / portTICK_PERIOD_MS);
-    
     return DRAW_SUCCESS;
 }
 
 
-int fill_display(esp_lcd_panel_handle_t panel_handle, uint16_t RGB_color)
+int draw_bgr_image_async(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, const uint16_t *image_buffer, draw_fence_t *fence)
 {
-    draw_t params;
-    params.draw_start_x = 0;
-    params.draw_start_y = 0;
-    params.image_size_x = 135;
-    params.image_size_y = 240;
+    // Sanity checks.
+    if (image_buffer == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot draw, image buffer is a NULL pointer.");
+        return DRAW_FAILURE;
+    }
+
+    if (check_async_draw(draw_params) != DRAW_SUCCESS)
+    {
+        return DRAW_FAILURE;
+    }
+
+    RECORD_CALL(RECORD_DRAW_BGR_IMAGE_ASYNC, image_buffer, draw_params.image_size_x * draw_params.image_size_y * sizeof(uint16_t), NULL, 0,
+        draw_params.draw_start_x, draw_params.draw_start_y, draw_params.image_size_x, draw_params.image_size_y, draw_params.scale_x, draw_params.scale_y);
+    TRACE_SPAN(TRACE_DRAW_BGR_IMAGE_ASYNC, draw_params.image_size_x * draw_params.image_size_y);
+
+    reap_fences();
+
+    wait_for_draws_in_flight(display_config.trans_queue_depth - 1);
+    submit_window(panel_handle, draw_params, image_buffer);
+
+    if (fence != NULL)
+    {
+        *fence = transfers_submitted;
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+draw_fence_t get_draw_fence(void)
+{
+    return transfers_submitted;
+}
+
+
+int is_fence_done(draw_fence_t fence)
+{
+    reap_fences();
+
+    return fence_done(fence);
+}
+
+
+void wait_for_fence(draw_fence_t fence)
+{
+    int64_t start_us = esp_timer_get_time();
+
+    while (!fence_done(fence))
+    {
+        xSemaphoreTake(transfer_done_semaphore, portMAX_DELAY);
+    }
+
+    transfer_stats.busy_us += esp_timer_get_time() - start_us;
+
+    reap_fences();
+}
 
-    // Fill.
-    if (fill_rect(panel_handle, params, RGB_color) != 0)
+
+int on_fence_done(draw_fence_t fence, fence_callback_t callback, void *user_ctx)
+{
+    // Sanity check.
+    if (callback == NULL)
     {
-        ESP_LOGE(TAG_DISPLAY, "Fill failed.");
+        ESP_LOGE(TAG_DISPLAY, "Fence callback is a NULL pointer.");
         return DRAW_FAILURE;
     }
 
+    // Every done fence before it has been reaped, so calling it now keeps the order.
+    reap_fences();
+
+    if (fence_done(fence))
+    {
+        callback(fence, user_ctx);
+        return DRAW_SUCCESS;
+    }
+
+    add_pending_fence(fence, callback, user_ctx, NULL);
+
     return DRAW_SUCCESS;
 }
 
-void int_to_color_array(color_def_t colors, uint16_t *int_buffer, int buffer_size)
+
+// Converts pixels of an image into BGR565.
+static void convert_pixels(pixel_format_t format, const void *pixels, int first_pixel, int pixel_amount, uint16_t *out)
 {
-    // Based on the 8 selected colors, convert the integers to colors.
-    for(int i = 0; i < buffer_size; ++i )
+    TRACE_SPAN(TRACE_RASTERIZE, pixel_amount);
+
+    if (format == PIXEL_FORMAT_RGB565)
     {
-        if (int_buffer[i] == colors.COLOR_ID_0)
-        {
-            int_buffer[i] = colors.COLOR_0;
-            continue;
-        }
+        const uint16_t *in = (const uint16_t *)pixels + first_pixel;
 
-        if (int_buffer[i] == colors.COLOR_ID_1)
+        for (int i = 0; i < pixel_amount; ++i)
         {
-            int_buffer[i] = colors.COLOR_1;
-            continue;
+            out[i] = COLOR_SWAP(in[i]);
         }
+    }
+    else
+    {
+        const uint8_t *in = (const uint8_t *)pixels + first_pixel * 3;
 
-        if (int_buffer[i] == colors.COLOR_ID_2)
+        for (int i = 0; i < pixel_amount; ++i)
         {
-            int_buffer[i] = colors.COLOR_2;
-            continue;
+            out[i] = BGR565_FROM_RGB888(in[0], in[1], in[2]);
+            in += 3;
         }
+    }
+}
 
-        if (int_buffer[i] == colors.COLOR_ID_3)
-        {
-            int_buffer[i] = colors.COLOR_3;
-            continue;
-        }
 
-        if (int_buffer[i] == colors.COLOR_ID_4)
-        {
-            int_buffer[i] = colors.COLOR_4;
-            continue;
-        }
+int draw_image(esp_lcd_panel_handle_t panel_handle, unsigned short x, unsigned short y, const image_t *image)
+{
+    // Sanity checks.
+    if ( (image == NULL) || (image->pixels == NULL) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot draw, image is a NULL pointer.");
+        return DRAW_FAILURE;
+    }
 
-        if (int_buffer[i] == colors.COLOR_ID_5)
-        {
-            int_buffer[i] = colors.COLOR_5;
-            continue;
-        }
+    if ( (image->format != PIXEL_FORMAT_BGR565) && (image->format != PIXEL_FORMAT_RGB565) && (image->format != PIXEL_FORMAT_RGB888) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Unknown pixel format %d.", image->format);
+        return DRAW_FAILURE;
+    }
 
-        if (int_buffer[i] == colors.COLOR_ID_6)
-        {
-            int_buffer[i] = colors.COLOR_6;
-            continue;
-        }
+    draw_t draw_params = {
+        .scale_x = 1,
+        .scale_y = 1,
+        .draw_start_x = x,
+        .draw_start_y = y,
+        .image_size_x = image->width,
+        .image_size_y = image->height,
+    };
 
-        if (int_buffer[i] == colors.COLOR_ID_7)
-        {
-            int_buffer[i] = colors.COLOR_7;
-            continue;
-        }
+    if (check_draw_bounds(draw_params) != DRAW_SUCCESS)
+    {
+        return DRAW_FAILURE;
     }
-}
 
-char *int_to_char_array(int number, int *str_size)
-{       
-    short arbitrary_size = 32;
+    RECORD_CALL(RECORD_DRAW_IMAGE, image->pixels, image->width * image->height * (image->format == PIXEL_FORMAT_RGB888 ? 3 : 2), NULL, 0,
+        x, y, image->width, image->height, image->format);
+    TRACE_SPAN(TRACE_DRAW_IMAGE, image->width * image->height);
 
-    // Create null ptr.
-    char *number_str = NULL;
-    
-    // Allocate memory and set it to 0.
-    number_str = (char *)calloc(arbitrary_size, sizeof(char));
+    // Already in the panel's order.
+    if (image->format == PIXEL_FORMAT_BGR565)
+    {
+        submit_window(panel_handle, draw_params, (const uint16_t *)image->pixels);
+        wait_for_transfers();
 
-    // Put number into char array.
-    sprintf(number_str, "%d", number);
+        return DRAW_SUCCESS;
+    }
 
-    // Find out how many characters the number consists of.
-    for (int i = 0; i < arbitrary_size; ++i)
+    if ( (image->width == 0) || (image->height == 0) )
     {
-        if (number_str[i] == 0)
-        {
-            *str_size = i;
-            break;
-        }
+        return DRAW_SUCCESS;
     }
 
-    return number_str;
-}
-
+    // Every free pool block is used, so bands are only waited for when the blocks run out.
+    uint16_t *band_buffers[POOL_BLOCK_AMOUNT];
+    int band_buffer_amount = 0;
 
-int draw_bgr_image(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, uint16_t *image_buffer)
-{
-    // Sanity checks.
-    if (image_buffer == NULL)
+    while (band_buffer_amount < POOL_BLOCK_AMOUNT)
     {
-        ESP_LOGE(TAG_DISPLAY, "Cannot draw, image buffer is a NULL pointer.");
-        return DRAW_FAILURE;
+        band_buffers[band_buffer_amount] = pool_borrow();
+        if (band_buffers[band_buffer_amount] == NULL)
+        {
+            break;
+        }
+        band_buffer_amount += 1;
     }
 
-    if ( ( (draw_params.draw_start_x-1) > SCREEN_WIDTH) || ( (draw_params.draw_start_y-1) > SCREEN_HEIGHT) )
+    if (band_buffer_amount == 0)
     {
-        ESP_LOGE(TAG_DISPLAY, "Draw starting position out of bounds.");
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for converting.");
         return DRAW_FAILURE;
     }
 
-    if( (((draw_params.image_size_x + draw_params.draw_start_x)-1) > SCREEN_WIDTH) || (((draw_params.image_size_y + draw_params.draw_start_y)-1) > SCREEN_HEIGHT) )
+    int band_lines = POOL_BLOCK_PIXELS / image->width;
+    int next_buffer = 0;
+    draw_t band = draw_params;
+
+    for (int line = 0; line < image->height; line += band_lines)
     {
-        ESP_LOGE(TAG_DISPLAY, "Draw starting postion + image_size, is out of bounds.");
-        return DRAW_FAILURE;
+        band.draw_start_y = y + line;
+        band.image_size_y = image->height - line < band_lines ? image->height - line : band_lines;
+
+        if (next_buffer == band_buffer_amount)
+        {
+            wait_for_transfers();
+            next_buffer = 0;
+        }
+
+        convert_pixels(image->format, image->pixels, line * image->width, band.image_size_y * image->width, band_buffers[next_buffer]);
+        submit_window(panel_handle, band, band_buffers[next_buffer]);
+        next_buffer += 1;
     }
 
-    // Draw call to the LCD.
-    esp_lcd_panel_draw_bitmap(panel_handle, 
-        draw_params.draw_start_x + SCREEN_WIDTH_PIXEL_MISALIGNMENT, 
-        draw_params.draw_start_y + SCREEN_HEIGHT_PIXEL_MISALIGNMENT, 
-        draw_params.draw_start_x + draw_params.image_size_x + SCREEN_WIDTH_PIXEL_MISALIGNMENT, 
-        draw_params.draw_start_y + draw_params.image_size_y + SCREEN_HEIGHT_PIXEL_MISALIGNMENT, 
-        image_buffer
-    );
+    wait_for_transfers();
 
-    // Read somewhere this is needed to prevent visual artifacts, turns out it is true.
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    for (int i = 0; i < band_buffer_amount; ++i)
+    {
+        pool_return(band_buffers[i]);
+    }
 
     return DRAW_SUCCESS;
 }
@@ -272,6 +1914,8 @@ void RGB_TO_BGR(uint16_t *image_buffer, int buffer_size)
 }
 
 
+#ifndef GRAPHICS_NO_HEAP
+
 uint16_t *scale_image(draw_t draw_params, uint16_t *image_buffer)
 {
     // Sanity check, we cannot scale with 0.
@@ -319,79 +1963,141 @@ uint16_t *scale_image(draw_t draw_params, uint16_t *image_buffer)
     return scaled_image_buffer_ptr;
 }
 
+#endif
 
-uint16_t *get_bitmap_letter_font(glyph_t *glyph_params, uint16_t letter_color, uint16_t background_color)
+
+/* Glyph bitmap, containing all letters in the english alphabet, 1 is the letter and 0 is the background.
+   It is formatted so each letter is contained in a 5 * 6 indices buffer.
+   It is made this way so each letter can be drawn straight out of the font and onto the LCD display.
+*/
+static const uint8_t letter_bitmap[LETTER_FONT_PIXELS] = 
 {
+    0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,1,1,0,1,0,0,1,0,0,1,1,0,1,
+    1,0,0,0,0,1,0,0,0,0,1,1,1,0,0,1,0,0,1,0,1,0,0,1,0,1,1,1,0,0,
+    0,0,0,0,0,0,1,1,0,0,1,0,0,1,0,1,0,0,0,0,1,0,0,1,0,0,1,1,0,0,
+    0,0,0,1,0,0,0,0,1,0,0,1,1,1,0,1,0,0,1,0,1,0,0,1,0,0,1,1,0,1,
+    0,0,0,0,0,0,1,1,0,0,1,0,0,1,0,1,1,1,1,0,1,0,0,0,0,0,1,1,1,0,
+    0,1,1,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,0,1,0,0,0,
+    0,0,0,0,0,0,1,1,1,0,1,0,0,1,0,0,1,1,1,0,0,0,0,1,0,1,1,1,0,0,
+    1,0,0,0,0,1,0,0,0,0,1,1,1,0,0,1,0,0,1,0,1,0,0,1,0,1,0,0,1,0,
+    1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,
+    0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,1,0,0,0,0,
+    1,0,0,0,0,1,0,0,0,0,1,0,1,0,0,1,1,0,0,0,1,0,1,0,0,1,0,1,0,0,
+    1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,0,
+    0,0,0,0,0,0,1,0,1,0,1,0,1,0,1,1,0,0,0,1,1,0,0,0,1,1,0,0,0,1,
+    0,0,0,0,0,1,1,1,0,0,1,0,0,1,0,1,0,0,1,0,1,0,0,1,0,1,0,0,1,0,
+    0,0,0,0,0,0,1,1,0,0,1,0,0,1,0,1,0,0,1,0,1,0,0,1,0,0,1,1,0,0,
+    0,1,1,0,0,1,0,0,1,0,1,0,0,1,0,1,1,1,0,0,1,0,0,0,0,1,0,0,0,0,
+    0,1,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,1,1,0,0,0,0,1,0,0,0,0,1,0,
+    0,0,0,0,0,1,0,1,1,0,1,1,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,
+    0,0,0,0,0,0,1,1,1,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,1,1,1,0,0,
+    0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,
+    0,0,0,0,0,1,0,0,1,0,1,0,0,1,0,1,0,0,1,0,1,0,0,1,0,0,1,1,0,0,
+    0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,0,1,0,1,0,1,0,0,0,1,0,0,
+    0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,1,0,1,0,1,1,0,1,0,1,0,1,0,1,0,
+    0,0,0,0,0,1,0,0,0,1,0,1,0,1,0,0,0,1,0,0,0,1,0,1,0,1,0,0,0,1,
+    0,0,0,0,0,1,0,0,1,0,1,0,0,1,0,0,1,1,1,0,0,0,0,1,0,0,1,1,0,0,
+    0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,1,0,0,0,1,1,1,1,0,
+    0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+
+};
+
+// Glyph bitmap, containing the numbers 0 - 9 and a few signs, each in a 3 * 5 indices buffer.
+static const uint8_t number_bitmap[NUMBER_FONT_PIXELS] = 
+{
+    0,1,0,1,0,0,1,0,0,1,0,0,0,1,0,
+    0,1,0,0,0,1,0,0,1,0,0,1,0,1,0,
+    0,0,0,0,1,0,1,1,1,0,1,0,1,0,1,
+    0,0,0,0,1,0,1,1,1,0,1,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
+    0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+    0,0,0,0,1,0,0,1,0,1,0,0,1,0,0,
+    1,1,1,1,0,1,1,0,1,1,0,1,1,1,1,
+    0,1,0,1,1,0,0,1,0,0,1,0,1,1,1,
+    1,1,0,0,0,1,0,1,0,1,0,0,1,1,1,
+    1,1,0,0,0,1,0,1,0,0,0,1,1,1,0,
+    1,0,1,1,0,1,1,1,1,0,0,1,0,0,1,
+    1,1,1,1,0,0,1,1,1,0,0,1,1,1,1,
+    1,1,1,1,0,0,1,1,1,1,0,1,1,1,1,
+    1,1,1,0,0,1,0,0,1,0,1,0,0,1,0,
+    1,1,1,1,0,1,1,1,1,1,0,1,1,1,1,
+    1,1,1,1,0,1,1,1,1,0,0,1,0,0,1
+
+};
+
+
+// Colors a 0/1 bitmap into a BGR font, so no conversion passes are needed afterwards.
+static void bitmap_to_font(const uint8_t *bitmap, uint16_t *font, int pixels, uint16_t glyph_color, uint16_t background_color)
+{
+    uint16_t BGR_glyph_color = COLOR_SWAP(glyph_color);
+    uint16_t BGR_background_color = COLOR_SWAP(background_color);
+
+    for (int i = 0; i < pixels; ++i)
+    {
+        font[i] = bitmap[i] ? BGR_glyph_color : BGR_background_color;
+    }
+}
+
+
+int load_bitmap_letter_font(glyph_t *glyph_params, uint16_t *font, uint16_t letter_color, uint16_t background_color)
+{
+    if (font == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot load font, font storage is a NULL pointer.");
+        return DRAW_FAILURE;
+    }
+
+    RECORD_CALL(RECORD_LOAD_LETTER_FONT, font, 0, NULL, 0, letter_color, background_color);
+
     // Set relvant glyph parameters.
     glyph_params->glyph_size_x = 5;
     glyph_params->glyph_size_y = 6;
     glyph_params->glyph_amount = 28;
     glyph_params->ASCII_offset = 97;
 
-    // Allocate memory for bitmap font.
-    uint16_t *font = NULL;
-    font = (uint16_t *)malloc( (glyph_params->glyph_size_x * glyph_params->glyph_size_y) * glyph_params->glyph_amount * sizeof(uint16_t) );
+    bitmap_to_font(letter_bitmap, font, LETTER_FONT_PIXELS, letter_color, background_color);
+
+    return DRAW_SUCCESS;
+}
+
+
+int load_bitmap_numbers_font(glyph_t *glyph_params, uint16_t *font, uint16_t number_color, uint16_t background_color)
+{
     if (font == NULL)
     {
-        ESP_LOGE(TAG_DISPLAY, "Memory could not be allocated in get_bitmap_letter_font().");
-        return NULL;
+        ESP_LOGE(TAG_DISPLAY, "Cannot load font, font storage is a NULL pointer.");
+        return DRAW_FAILURE;
     }
 
-    /* Glyph buffer, containing all letters in the english alphabet, in the array format.
-       It is formatted so each letter is contained in a 5 * 6 indices buffer.
-       It is made this way so each letter can be individually memcpy'd out of the buffer and onto the LCD display.
-    */
-    uint16_t letter_buffer[] = 
-    {
-        0,0,0,0,0,0,1,1,0,0,0,0,0,1,0,0,1,1,1,0,1,0,0,1,0,0,1,1,0,1,
-        1,0,0,0,0,1,0,0,0,0,1,1,1,0,0,1,0,0,1,0,1,0,0,1,0,1,1,1,0,0,
-        0,0,0,0,0,0,1,1,0,0,1,0,0,1,0,1,0,0,0,0,1,0,0,1,0,0,1,1,0,0,
-        0,0,0,1,0,0,0,0,1,0,0,1,1,1,0,1,0,0,1,0,1,0,0,1,0,0,1,1,0,1,
-        0,0,0,0,0,0,1,1,0,0,1,0,0,1,0,1,1,1,1,0,1,0,0,0,0,0,1,1,1,0,
-        0,1,1,0,0,0,1,0,0,0,0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,0,1,0,0,0,
-        0,0,0,0,0,0,1,1,1,0,1,0,0,1,0,0,1,1,1,0,0,0,0,1,0,1,1,1,0,0,
-        1,0,0,0,0,1,0,0,0,0,1,1,1,0,0,1,0,0,1,0,1,0,0,1,0,1,0,0,1,0,
-        1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,
-        0,1,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,1,0,0,0,0,
-        1,0,0,0,0,1,0,0,0,0,1,0,1,0,0,1,1,0,0,0,1,0,1,0,0,1,0,1,0,0,
-        1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,0,
-        0,0,0,0,0,0,1,0,1,0,1,0,1,0,1,1,0,0,0,1,1,0,0,0,1,1,0,0,0,1,
-        0,0,0,0,0,1,1,1,0,0,1,0,0,1,0,1,0,0,1,0,1,0,0,1,0,1,0,0,1,0,
-        0,0,0,0,0,0,1,1,0,0,1,0,0,1,0,1,0,0,1,0,1,0,0,1,0,0,1,1,0,0,
-        0,1,1,0,0,1,0,0,1,0,1,0,0,1,0,1,1,1,0,0,1,0,0,0,0,1,0,0,0,0,
-        0,1,1,0,0,1,0,0,1,0,1,0,0,1,0,0,1,1,1,0,0,0,0,1,0,0,0,0,1,0,
-        0,0,0,0,0,1,0,1,1,0,1,1,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,
-        0,0,0,0,0,0,1,1,1,0,1,0,0,0,0,0,1,1,0,0,0,0,0,1,0,1,1,1,0,0,
-        0,1,0,0,0,1,1,1,0,0,0,1,0,0,0,0,1,0,0,0,0,1,0,0,0,0,0,1,0,0,
-        0,0,0,0,0,1,0,0,1,0,1,0,0,1,0,1,0,0,1,0,1,0,0,1,0,0,1,1,0,0,
-        0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,1,0,0,0,1,0,1,0,1,0,0,0,1,0,0,
-        0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,1,0,1,0,1,1,0,1,0,1,0,1,0,1,0,
-        0,0,0,0,0,1,0,0,0,1,0,1,0,1,0,0,0,1,0,0,0,1,0,1,0,1,0,0,0,1,
-        0,0,0,0,0,1,0,0,1,0,1,0,0,1,0,0,1,1,1,0,0,0,0,1,0,0,1,1,0,0,
-        0,0,0,0,0,0,0,0,0,0,1,1,1,1,0,0,0,1,0,0,0,1,0,0,0,1,1,1,1,0,
-        0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
-    };
+    RECORD_CALL(RECORD_LOAD_NUMBER_FONT, font, 0, NULL, 0, number_color, background_color);
 
-    // memcpy the glyphs into the ptr.
-    memcpy(font, 
-        letter_buffer, 
-        glyph_params->glyph_size_x * glyph_params->glyph_size_y * glyph_params->glyph_amount * sizeof(uint16_t)
-    );
+    glyph_params->glyph_size_x = 3;
+    glyph_params->glyph_size_y = 5;
+    glyph_params->glyph_amount = 18;
+    glyph_params->ASCII_offset = 40;
 
-    // Set color of glyphs.
-    color_def_t colors;
-    colors.COLOR_0 = background_color;
-    colors.COLOR_ID_0 = 0;
-    colors.COLOR_1 = letter_color;
-    colors.COLOR_ID_1 = 1;
-    
-    // Convert int array to uint16_t color array.
-    int_to_color_array(colors, font, glyph_params->glyph_size_x * glyph_params->glyph_size_y * glyph_params->glyph_amount);
+    bitmap_to_font(number_bitmap, font, NUMBER_FONT_PIXELS, number_color, background_color);
+
+    return DRAW_SUCCESS;
+}
 
-    // Convert from RGB to BGR.
-    RGB_TO_BGR(font, glyph_params->glyph_size_x * glyph_params->glyph_size_y * glyph_params->glyph_amount);
 
+#ifndef GRAPHICS_NO_HEAP
+
+uint16_t *get_bitmap_letter_font(glyph_t *glyph_params, uint16_t letter_color, uint16_t background_color)
+{
+    // Allocate memory for bitmap font.
+    uint16_t *font = NULL;
+    font = (uint16_t *)malloc(LETTER_FONT_PIXELS * sizeof(uint16_t));
+    if (font == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Memory could not be allocated in get_bitmap_letter_font().");
+        return NULL;
+    }
+
+    load_bitmap_letter_font(glyph_params, font, letter_color, background_color);
 
     // Since we cannot return arrays, we allocate memory for an array on the heap and return the pointer to that array.
     return font;
@@ -399,161 +2105,306 @@ uint16_t *get_bitmap_letter_font(glyph_t *glyph_params, uint16_t letter_color, u
 
 uint16_t *get_bitmap_numbers_font(glyph_t *glyph_params, uint16_t number_color, uint16_t background_color)
 {
-    glyph_params->glyph_size_x = 3;
-    glyph_params->glyph_size_y = 5;
-    glyph_params->glyph_amount = 18;
-    glyph_params->ASCII_offset = 40;
-
     uint16_t *font = NULL;
-    font = (uint16_t *)malloc( (glyph_params->glyph_size_x * glyph_params->glyph_size_y) * glyph_params->glyph_amount * sizeof(uint16_t) );
+    font = (uint16_t *)malloc(NUMBER_FONT_PIXELS * sizeof(uint16_t));
     if (font == NULL)
     {
-        ESP_LOGE(TAG_DISPLAY, "Memory could not be allocated in get_bitmap_letter_font().");
+        ESP_LOGE(TAG_DISPLAY, "Memory could not be allocated in get_bitmap_numbers_font().");
         return NULL;
     }
 
-    uint16_t number_buffer[] = 
-    {
-        0,1,0,1,0,0,1,0,0,1,0,0,0,1,0,
-        0,1,0,0,0,1,0,0,1,0,0,1,0,1,0,
-        0,0,0,0,1,0,1,1,1,0,1,0,1,0,1,
-        0,0,0,0,1,0,1,1,1,0,1,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,
-        0,0,0,0,0,0,1,1,1,0,0,0,0,0,0,
-        0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
-        0,0,0,0,1,0,0,1,0,1,0,0,1,0,0,
-        1,1,1,1,0,1,1,0,1,1,0,1,1,1,1, 
-        0,1,0,1,1,0,0,1,0,0,1,0,1,1,1,
-        1,1,0,0,0,1,0,1,0,1,0,0,1,1,1,
-        1,1,0,0,0,1,0,1,0,0,0,1,1,1,0,
-        1,0,1,1,0,1,1,1,1,0,0,1,0,0,1,
-        1,1,1,1,0,0,1,1,1,0,0,1,1,1,1,
-        1,1,1,1,0,0,1,1,1,1,0,1,1,1,1,
-        1,1,1,0,0,1,0,0,1,0,1,0,0,1,0,
-        1,1,1,1,0,1,1,1,1,1,0,1,1,1,1,
-        1,1,1,1,0,1,1,1,1,0,0,1,0,0,1
-    };
+    load_bitmap_numbers_font(glyph_params, font, number_color, background_color);
 
-    // memcpy the glyphs into the ptr.
-    memcpy(font, 
-        number_buffer, 
-        glyph_params->glyph_size_x * glyph_params->glyph_size_y * glyph_params->glyph_amount * sizeof(uint16_t)
-    );
+    return font;
+}
 
-    // Set color of glyphs.
-    color_def_t colors;
-    colors.COLOR_0 = background_color;
-    colors.COLOR_ID_0 = 0;
-    colors.COLOR_1 = number_color;
-    colors.COLOR_ID_1 = 1;
-    
-    // Convert int array to uint16_t color array.
-    int_to_color_array(colors, font, glyph_params->glyph_size_x * glyph_params->glyph_size_y * glyph_params->glyph_amount);
+#endif
 
-    // Convert from RGB to BGR.
-    RGB_TO_BGR(font, glyph_params->glyph_size_x * glyph_params->glyph_size_y * glyph_params->glyph_amount);
 
-    return font;
+int get_glyph_view(glyph_t text_params, const uint16_t *glyph_font, char glyph, glyph_view_t *view)
+{
+    // Get selected glyph from char. Subtracted by ASCII_offset. Ex. 'a' in ASCII is 97, and if a is the first letter in a buffer, the ASCII_offset is 97.
+    int glyph_number = (unsigned char)glyph - text_params.ASCII_offset;
+
+    // Sanity check, characters outside the font would read past the end of it.
+    if ( (glyph_number < 0) || (glyph_number >= text_params.glyph_amount) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Character %d is not in the font.", (unsigned char)glyph);
+        return DRAW_FAILURE;
+    }
+
+    // Glyphs are stored one after another, so a glyph is a contiguous part of the font.
+    view->pixels = glyph_font + (text_params.glyph_size_x * text_params.glyph_size_y) * glyph_number;
+    view->width = text_params.glyph_size_x;
+    view->height = text_params.glyph_size_y;
+    view->stride = text_params.glyph_size_x;
+
+    return DRAW_SUCCESS;
 }
 
 
 int draw_glyphs(esp_lcd_panel_handle_t panel_handle, glyph_t text_params, uint16_t *glyph_font , char *text_buffer, unsigned int buffer_size)
 {
-    // Create NULL pointer.
-    uint16_t *selected_glyph = NULL;
-    uint16_t *scaled_glyph = NULL;
+    RECORD_CALL(RECORD_DRAW_GLYPHS, glyph_font, 0, text_buffer, buffer_size,
+        text_params.glyph_start_x, text_params.glyph_start_y, text_params.glyph_amount, text_params.glyph_size_x, text_params.glyph_size_y,
+        text_params.glyph_spacing, text_params.glyph_scale, (uint16_t)text_params.ASCII_offset, buffer_size);
+    TRACE_SPAN(TRACE_DRAW_GLYPHS, buffer_size);
+
+    unsigned short scale = text_params.glyph_scale <= 1 ? 1 : text_params.glyph_scale;
+    int result = DRAW_SUCCESS;
+    glyph_view_t glyph;
 
     // Create structure for drawing.
     draw_t draw;
     draw.draw_start_x = text_params.glyph_start_x;
     draw.draw_start_y = text_params.glyph_start_y;
-    draw.image_size_x = text_params.glyph_size_x;
-    draw.image_size_y = text_params.glyph_size_y;
+    draw.scale_x = scale;
+    draw.scale_y = scale;
 
-    unsigned short x_aux = text_params.glyph_size_x;
-    unsigned short y_aux = text_params.glyph_size_y;
-
-    // Read each letter in the char buffer and display them.
+    // Read each letter in the char buffer and display them, straight out of the font.
     for (int i = 0; i < buffer_size; ++i)
     {
-        selected_glyph = select_glyph(text_params, glyph_font, text_buffer[i]);
-
-        // Scale glyph
-        if (text_params.glyph_scale <= 1)
+        // Characters not in the font are left blank.
+        if (get_glyph_view(text_params, glyph_font, text_buffer[i], &glyph) == DRAW_SUCCESS)
         {
-            // Draw letter on LCD
-            draw_bgr_image(panel_handle, draw, selected_glyph);
+            draw.image_size_x = glyph.width;
+            draw.image_size_y = glyph.height;
+
+            if ( (scale == 1) && (glyph.stride == glyph.width) )
+            {
+                // Draw letter on LCD, the glyph is only read.
+                result |= draw_bgr_image(panel_handle, draw, glyph.pixels);
+            }
+            else
+            {
+                // Scale and draw letter on LCD
+                result |= draw_scaled(panel_handle, draw, glyph.pixels, glyph.stride);
+            }
         }
         else
         {
-            draw.scale_x = text_params.glyph_scale;
-            draw.scale_y = text_params.glyph_scale;
-            
-            // Scale image
-            scaled_glyph = scale_image(draw, selected_glyph);
-
-            draw.image_size_x *= text_params.glyph_scale;
-            draw.image_size_y *= text_params.glyph_scale;
-
-            // Draw letter on LCD
-            draw_bgr_image(panel_handle, draw, scaled_glyph);
-
-            draw.image_size_x = x_aux;
-            draw.image_size_y = y_aux;
+            result = DRAW_FAILURE;
         }
 
-        // Free allocated memory.
-        free(scaled_glyph);
-        free(selected_glyph);
-
         // Move where to draw.
-        draw.draw_start_x += (text_params.glyph_spacing + text_params.glyph_size_x) * text_params.glyph_scale;
+        draw.draw_start_x += (text_params.glyph_spacing + text_params.glyph_size_x) * scale;
     }
-    return DRAW_SUCCESS;
+
+    return result;
 }
 
 
+#ifndef GRAPHICS_NO_HEAP
+
 uint16_t *select_glyph(glyph_t text_params, uint16_t *glyph_buffer, char glyph)
 {
+    glyph_view_t view;
+    if (get_glyph_view(text_params, glyph_buffer, glyph, &view) != DRAW_SUCCESS)
+    {
+        return NULL;
+    }
+
     // Create void ptr.
     uint16_t *glyph_ptr = NULL;
 
     // Allocate memory to glyph.
-    glyph_ptr = (uint16_t *)malloc(text_params.glyph_size_x * text_params.glyph_size_y * sizeof(uint16_t) );
+    glyph_ptr = (uint16_t *)malloc(view.width * view.height * sizeof(uint16_t) );
     if (glyph_ptr == NULL)
     {
         ESP_LOGE(TAG_DISPLAY, "Memory could not be allocated in select_glyph().");
         return NULL;
     }
-    
-    // Get selected glyph from char. Subtracted by glyph_ASCII_offset. Ex. 'a' in ASCII is 97, and if a is the first letter in a buffer, the glyph_ASCII_offset is 97.
-    unsigned int glyph_number = glyph - text_params.ASCII_offset;
 
     // Copy the selected glyph into the buffer with allocated memory.
-    memcpy(glyph_ptr, 
-        glyph_buffer + (text_params.glyph_size_x * text_params.glyph_size_y) * glyph_number, 
-        text_params.glyph_size_x * text_params.glyph_size_y * sizeof(uint16_t)
-    );
+    for (int line = 0; line < view.height; ++line)
+    {
+        memcpy(glyph_ptr + line * view.width, view.pixels + line * view.stride, view.width * sizeof(uint16_t));
+    }
 
     // Return the glyph as a pointer.
     return glyph_ptr;
 }
 
+#endif
+
 
 int draw_number(esp_lcd_panel_handle_t panel_handle, glyph_t number_params, uint16_t *number_font, int number)
 {   
-    // Get size of string from the integer
-    char* int_str = NULL;
-    int str_size;
-    int_str = int_to_char_array(number, &str_size);
+    RECORD_CALL(RECORD_DRAW_NUMBER, number_font, 0, NULL, 0,
+        number_params.glyph_start_x, number_params.glyph_start_y, number_params.glyph_amount, number_params.glyph_size_x, number_params.glyph_size_y,
+        number_params.glyph_spacing, number_params.glyph_scale, (uint16_t)number_params.ASCII_offset, (uint32_t)number & 0xFFFF, (uint32_t)number >> 16);
+
+    // Put number into char array, large enough for any int with sign.
+    char number_str[12];
+    int str_size = snprintf(number_str, sizeof(number_str), "%d", number);
 
-    if (draw_glyphs(panel_handle, number_params, number_font, int_str, str_size) != 0)
+    if (draw_glyphs(panel_handle, number_params, number_font, number_str, str_size) != 0)
     {
         return DRAW_FAILURE;
     }
 
-    // Free allocated memory.
-    free(int_str);
-
     return DRAW_SUCCESS;
 }
+
+
+#ifdef GRAPHICS_RECORDER
+int dump_draw_record(record_write_cb_t write, void *write_ctx)
+{
+    // Sanity checks.
+    if (write == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot dump the recording, write callback is a NULL pointer.");
+        return DRAW_FAILURE;
+    }
+
+    // Calls made while writing are dropped rather than changing the ring being written.
+    portENTER_CRITICAL(&recorder_lock);
+    recorder_paused = 1;
+    uint32_t first = recorder_first;
+    uint32_t used = recorder_used;
+    uint32_t dropped = recorder_dropped;
+    portEXIT_CRITICAL(&recorder_lock);
+
+    draw_record_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.magic = RECORDER_MAGIC;
+    header.version = RECORDER_VERSION;
+    header.record_size = sizeof(draw_record_t);
+    header.screen_width = SCREEN_WIDTH;
+    header.screen_height = SCREEN_HEIGHT;
+    header.bits_per_pixel = display_config.bits_per_pixel;
+    header.pixel_clock_hz = display_config.pixel_clock_hz;
+    header.record_bytes = used;
+    header.dropped = dropped;
+
+    // The ring is written in at most two parts, up to its end and from its start.
+    const uint8_t *ring = (const uint8_t *)recorder_storage;
+    uint32_t first_part = RECORDER_BUFFER_SIZE - first < used ? RECORDER_BUFFER_SIZE - first : used;
+    int result = DRAW_SUCCESS;
+
+    if ( (write(write_ctx, (const uint8_t *)&header, sizeof(header)) != sizeof(header)) ||
+        (write(write_ctx, ring + first, first_part) != (int)first_part) ||
+        ( (used > first_part) && (write(write_ctx, ring, used - first_part) != (int)(used - first_part)) ) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Recording could not be written.");
+        result = DRAW_FAILURE;
+    }
+
+    portENTER_CRITICAL(&recorder_lock);
+    recorder_first = 0;
+    recorder_used = 0;
+    recorder_dropped -= dropped;
+    recorder_paused = 0;
+    portEXIT_CRITICAL(&recorder_lock);
+
+    return result;
+}
+#endif
+
+
+#ifdef GRAPHICS_TRACE
+// Writes text through write, a failure is kept in result.
+static void write_trace_text(record_write_cb_t write, void *write_ctx, const char *text, int *result)
+{
+    int size = strlen(text);
+
+    if ( (*result == DRAW_SUCCESS) && (write(write_ctx, (const uint8_t *)text, size) != size) )
+    {
+        *result = DRAW_FAILURE;
+    }
+}
+
+
+int dump_draw_trace(record_write_cb_t write, void *write_ctx)
+{
+    // Sanity checks.
+    if (write == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot dump the trace, write callback is a NULL pointer.");
+        return DRAW_FAILURE;
+    }
+
+    // Events keep the low 32 bits of their time, which are put back on the full clock relative to now.
+    int64_t now_us = esp_timer_get_time();
+    int result = DRAW_SUCCESS;
+    uint32_t dropped = 0;
+    const char *separator = "";
+    char text[224];
+
+    write_trace_text(write, write_ctx, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", &result);
+
+    for (int core = 0; core < portNUM_PROCESSORS; ++core)
+    {
+        trace_ring_t *ring = &trace_rings[core];
+        uint32_t next = atomic_load_explicit(&ring->next, memory_order_acquire);
+        uint32_t first = next - ring->dumped > TRACE_RING_EVENTS ? next - TRACE_RING_EVENTS : ring->dumped;
+
+        dropped += first - ring->dumped;
+
+        snprintf(text, sizeof(text), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"Core %d\"}}",
+            separator, core, core);
+        write_trace_text(write, write_ctx, text, &result);
+        separator = ",\n";
+
+        for (uint32_t number = first; number != next; ++number)
+        {
+            trace_event_t *event = &ring->events[number % TRACE_RING_EVENTS];
+
+            // Events still being written, or overwritten while being read, are left out.
+            if (atomic_load_explicit(&event->sequence, memory_order_acquire) != number + 1)
+            {
+                dropped += 1;
+                continue;
+            }
+
+            uint32_t start_us = event->start_us;
+            uint32_t duration_us = event->duration_us;
+            uint32_t arg = event->arg;
+            uint32_t transfer = event->transfer;
+            uint8_t name = event->name < TRACE_NAME_AMOUNT ? event->name : TRACE_SUBMIT;
+            uint8_t phase = event->phase;
+
+            atomic_thread_fence(memory_order_acquire);
+            if (atomic_load_explicit(&event->sequence, memory_order_relaxed) != number + 1)
+            {
+                dropped += 1;
+                continue;
+            }
+
+            long long timestamp_us = now_us + (int32_t)(start_us - (uint32_t)now_us);
+
+            if (phase == TRACE_PHASE_SPAN)
+            {
+                snprintf(text, sizeof(text),
+                    ",\n{\"name\":\"%s\",\"cat\":\"draw\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lu,\"pid\":1,\"tid\":%d,\"args\":{\"%s\":%lu}}",
+                    trace_names[name][0], timestamp_us, (unsigned long)duration_us, core, trace_names[name][1], (unsigned long)arg);
+            }
+            else if (phase == TRACE_PHASE_BEGIN)
+            {
+                snprintf(text, sizeof(text),
+                    ",\n{\"name\":\"%s\",\"cat\":\"dma\",\"ph\":\"b\",\"id\":%lu,\"ts\":%lld,\"pid\":1,\"tid\":%d,\"args\":{\"%s\":%lu}}",
+                    trace_names[name][0], (unsigned long)transfer, timestamp_us, core, trace_names[name][1], (unsigned long)arg);
+            }
+            else
+            {
+                snprintf(text, sizeof(text), ",\n{\"name\":\"%s\",\"cat\":\"dma\",\"ph\":\"e\",\"id\":%lu,\"ts\":%lld,\"pid\":1,\"tid\":%d}",
+                    trace_names[name][0], (unsigned long)transfer, timestamp_us, core);
+            }
+
+            write_trace_text(write, write_ctx, text, &result);
+        }
+
+        ring->dumped = next;
+    }
+
+    snprintf(text, sizeof(text), "\n],\"otherData\":{\"dropped_events\":%lu}}\n", (unsigned long)dropped);
+    write_trace_text(write, write_ctx, text, &result);
+
+    if (result != DRAW_SUCCESS)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Trace could not be written.");
+    }
+
+    return result;
+}
+#endif
@@ -1,23 +1,69 @@
 #ifndef GRAPHICS_H 
 #define GRAPHICS_H
 
+#include <string.h>
+
+#ifdef GRAPHICS_HOST_BUILD
+// Host builds run against a stand-in panel, see tools/host/graphics_host.h.
+#include "graphics_host.h"
+#else
 // ESP system headers
 #include "esp_system.h"
 #include "esp_log.h"
 
-#include <string.h>
-
 // LCD headers
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_panel_vendor.h"
 #include "esp_lcd_panel_ops.h"
+#include "esp_lcd_panel_commands.h"
 #include "esp_heap_caps.h"
 #include "driver/spi_master.h"
 #include "driver/gpio.h"
+#include "soc/soc_caps.h"
 
 // For vTaskDelay();
 #include <freertos/semphr.h>
 
+// For esp_timer_get_time();
+#include "esp_timer.h"
+
+// For IRAM_ATTR
+#include "esp_attr.h"
+#endif
+
+
+// Static, no heap build: define GRAPHICS_NO_HEAP in the build (Ex: target_compile_definitions) to place every buffer
+// in static memory, sized from SCREEN_MAX_WIDTH, SCREEN_MAX_HEIGHT and PARALLEL_LINES. Functions returning allocated memory are then left out.
+// #define GRAPHICS_NO_HEAP
+
+// Call recorder: define GRAPHICS_RECORDER in the build to log every public draw call of graphics.c into a ring buffer
+// of RECORDER_BUFFER_SIZE bytes, the oldest calls are dropped when it is full. Calls failing their sanity checks are
+// not logged. dump_draw_record() writes it out and tools/replay_draws.c replays it on a PC.
+// #define GRAPHICS_RECORDER
+#ifndef RECORDER_BUFFER_SIZE
+#define RECORDER_BUFFER_SIZE 8192
+#endif
+
+// Payloads up to this many bytes are copied into the record, Ex: the text of draw_glyphs() or a glyph sized image.
+// Larger ones are recorded by address and a hash of their first RECORDER_HASH_BYTES bytes.
+#ifndef RECORDER_INLINE_BYTES
+#define RECORDER_INLINE_BYTES 64
+#endif
+#define RECORDER_HASH_BYTES 128
+
+// Tasks that can be inside recorded calls at the same time, each keeps its own nesting depth. Calls of further tasks
+// are dropped.
+#ifndef RECORDER_TASKS
+#define RECORDER_TASKS 4
+#endif
+
+// Draw tracing: define GRAPHICS_TRACE in the build to keep timestamped spans of the draw calls of graphics.c and the
+// submit, rasterize, DMA, wait and flush steps inside them, in a lock-free ring of TRACE_RING_EVENTS events per core.
+// dump_draw_trace() writes them as Chrome trace JSON for Perfetto or chrome://tracing.
+// #define GRAPHICS_TRACE
+#ifndef TRACE_RING_EVENTS
+#define TRACE_RING_EVENTS 512
+#endif
 
 #define LCD_HOST 1
 
@@ -26,33 +72,122 @@
 // is dividable by this.
 #define PARALLEL_LINES 16
 
-// define pin headers, see pinouts on Lily TTGO t-display datasheet.
+// Default SPI settings, can be changed at runtime through display_config_t.
 #define LCD_PIXEL_CLOCK_HZ (20 * 1000 * 1000)
+#define LCD_TRANS_QUEUE_DEPTH 10
+#define LCD_MAX_TRANSFER_SIZE (SCREEN_MAX_WIDTH * SCREEN_MAX_HEIGHT * sizeof(uint16_t))
+
+// Limits for display_config_t. The ST7789 handles 40 - 80 MHz writes in practice, 80 MHz is the ESP32 SPI maximum.
+#define LCD_MAX_PIXEL_CLOCK_HZ (80 * 1000 * 1000)
+#define LCD_MAX_TRANS_QUEUE_DEPTH 64
+
+// 12 bit bus mode. COLMOD value for 12 bit pixels, and the memory write continue command used to send a window in chunks.
+#define LCD_COLMOD_12_BIT 0x53
+#define LCD_CMD_RAMWRC 0x3C
+
+// Columns and lines in the ST7789 frame memory, the screen shows SCREEN_HEIGHT lines from SCREEN_HEIGHT_PIXEL_MISALIGNMENT on.
+#define LCD_MEMORY_COLUMNS 240
+#define LCD_MEMORY_LINES 320
+
+// Pixels packed per chunk in 12 bit bus mode.
+#define LCD_PACK_BUFFER_PIXELS (SCREEN_MAX_WIDTH * PARALLEL_LINES)
+
+// Block pool for transient draw buffers. Every block holds a band of PARALLEL_LINES full screen lines.
+#define POOL_BLOCK_AMOUNT 4
+#define POOL_BLOCK_PIXELS (SCREEN_MAX_WIDTH * PARALLEL_LINES)
+#define POOL_BLOCK_SIZE (POOL_BLOCK_PIXELS * sizeof(uint16_t))
+
+// Most fences with a pending callback or pool block at the same time.
+#define FENCE_MAX_PENDING 8
+
+// Most windows a batch holds before it is sent, a batch keeps their pixels in a single pool block.
+#define BATCH_MAX_WINDOWS 32
+
+// Boards, select one with GRAPHICS_BOARD in the build (Ex: target_compile_definitions). The geometry of the selected
+// board is a set of constants, so bounds checks and band sizes fold to constants and adding boards costs nothing.
+// BOARD_RUNTIME reads the geometry from the panel given to select_panel() instead, with buffers sized for the
+// largest board.
+#define BOARD_RUNTIME 0
+#define BOARD_T_DISPLAY 1           // LILYGO T-Display, ST7789 135x240 over SPI.
+#define BOARD_T_DISPLAY_S3 2        // LILYGO T-Display-S3, ST7789 170x320 over an 8 bit parallel bus.
+
+#ifndef GRAPHICS_BOARD
+#define GRAPHICS_BOARD BOARD_T_DISPLAY
+#endif
+
 #define LCD_BK_LIGHT_ON_LEVEL  1
 #define LCD_BK_LIGHT_OFF_LEVEL !LCD_BK_LIGHT_ON_LEVEL
 
-#define PIN_NUM_MOSI 19
-#define PIN_NUM_SCLK 18
-#define PIN_NUM_CS 5
-#define PIN_NUM_DC 16
-#define PIN_NUM_RST 23
-#define PIN_NUM_BK_LIGHT 4
+// define pin headers, see pinouts on Lily TTGO t-display datasheet.
+#define T_DISPLAY_PIN_NUM_MOSI 19
+#define T_DISPLAY_PIN_NUM_SCLK 18
+#define T_DISPLAY_PIN_NUM_CS 5
+#define T_DISPLAY_PIN_NUM_DC 16
+#define T_DISPLAY_PIN_NUM_RST 23
+#define T_DISPLAY_PIN_NUM_BK_LIGHT 4
+
+// T-Display-S3 pins, the panel is powered through PIN_NUM_POWER and the read strobe is held high.
+#define T_DISPLAY_S3_PIN_NUM_DATA { 39, 40, 41, 42, 45, 46, 47, 48 }
+#define T_DISPLAY_S3_PIN_NUM_WR 8
+#define T_DISPLAY_S3_PIN_NUM_RD 9
+#define T_DISPLAY_S3_PIN_NUM_CS 6
+#define T_DISPLAY_S3_PIN_NUM_DC 7
+#define T_DISPLAY_S3_PIN_NUM_RST 5
+#define T_DISPLAY_S3_PIN_NUM_BK_LIGHT 38
+#define T_DISPLAY_S3_PIN_NUM_POWER 15
+
+// Parallel bus clock of the T-Display-S3, as in the LILYGO examples.
+#define T_DISPLAY_S3_PIXEL_CLOCK_HZ (6528 * 1000)
+
+// Geometry of the boards, the frame memory column and line of the top left pixel are the offsets.
+#define T_DISPLAY_WIDTH 135
+#define T_DISPLAY_HEIGHT 240
+#define T_DISPLAY_X_OFFSET 52
+#define T_DISPLAY_Y_OFFSET 40
+
+#define T_DISPLAY_S3_WIDTH 170
+#define T_DISPLAY_S3_HEIGHT 320
+#define T_DISPLAY_S3_X_OFFSET 35
+#define T_DISPLAY_S3_Y_OFFSET 0
 
 // bits
 #define LCD_CMD_BITS 8
 #define LCD_PARAM_BITS 8
 
 
-// Screen resolution
-#define SCREEN_WIDTH 135
-#define SCREEN_HEIGHT 240
-
-// Possible due to compatibility wiht other displays, the pixels are misaligned.
-#define SCREEN_WIDTH_PIXEL_MISALIGNMENT 52
-#define SCREEN_HEIGHT_PIXEL_MISALIGNMENT 40
-
-
-// Define colors, still needs COLOR_SWAP() macro to work, since we're going from RGB -> BGR.
+// Screen resolution, and the frame memory position of the top left pixel. Possible due to compatibility with other
+// displays, the pixels are misaligned.
+#if GRAPHICS_BOARD == BOARD_T_DISPLAY
+#define SCREEN_WIDTH T_DISPLAY_WIDTH
+#define SCREEN_HEIGHT T_DISPLAY_HEIGHT
+#define SCREEN_WIDTH_PIXEL_MISALIGNMENT T_DISPLAY_X_OFFSET
+#define SCREEN_HEIGHT_PIXEL_MISALIGNMENT T_DISPLAY_Y_OFFSET
+#elif GRAPHICS_BOARD == BOARD_T_DISPLAY_S3
+#define SCREEN_WIDTH T_DISPLAY_S3_WIDTH
+#define SCREEN_HEIGHT T_DISPLAY_S3_HEIGHT
+#define SCREEN_WIDTH_PIXEL_MISALIGNMENT T_DISPLAY_S3_X_OFFSET
+#define SCREEN_HEIGHT_PIXEL_MISALIGNMENT T_DISPLAY_S3_Y_OFFSET
+#elif GRAPHICS_BOARD == BOARD_RUNTIME
+#define SCREEN_WIDTH (active_panel->width)
+#define SCREEN_HEIGHT (active_panel->height)
+#define SCREEN_WIDTH_PIXEL_MISALIGNMENT (active_panel->x_offset)
+#define SCREEN_HEIGHT_PIXEL_MISALIGNMENT (active_panel->y_offset)
+#else
+#error "Unknown GRAPHICS_BOARD."
+#endif
+
+// Largest screen the buffers are sized for, the selected board or every board for BOARD_RUNTIME.
+#if GRAPHICS_BOARD == BOARD_RUNTIME
+#define SCREEN_MAX_WIDTH T_DISPLAY_S3_WIDTH
+#define SCREEN_MAX_HEIGHT T_DISPLAY_S3_HEIGHT
+#else
+#define SCREEN_MAX_WIDTH SCREEN_WIDTH
+#define SCREEN_MAX_HEIGHT SCREEN_HEIGHT
+#endif
+
+
+// Define colors, still needs COLOR_SWAP() macro to work, since we're going from RGB -> BGR. The BGR_ versions below are
+// already swapped.
 #define LCD_RED 0xF800
 #define LCD_GREEN 0x07E0
 #define LCD_BLUE 0x001F
@@ -65,6 +200,11 @@
 #define LCD_LIGHT_PURPLE 0xC39E
 
 
+// Storage needed for the built in fonts, in pixels. See load_bitmap_letter_font() and load_bitmap_numbers_font().
+#define LETTER_FONT_PIXELS (5 * 6 * 28)
+#define NUMBER_FONT_PIXELS (3 * 5 * 18)
+
+
 // Want to choose your own color?
 // https://rgbcolorpicker.com/565
 
@@ -76,8 +216,25 @@
 #define DRAW_FAILURE 1
 
 
-// Byte swap macro for going from RGB to BGR
-#define COLOR_SWAP(x) ((x >> 8) | (x << 8))
+// Byte swap macro for going from RGB to BGR, a constant for constant arguments.
+#define COLOR_SWAP(x) ((uint16_t)((((uint16_t)(x)) >> 8) | (((uint16_t)(x)) << 8)))
+
+// Colors in the order the panel receives them, the BGR565 the draw calls send. Built at compile time from RGB565 or
+// RGB888 literals, Ex: BGR565_FROM_RGB888(255, 128, 0), so buffers filled with them need no swap pass.
+typedef uint16_t bgr565_t;
+#define BGR565_FROM_RGB565(RGB_color) COLOR_SWAP(RGB_color)
+#define BGR565_FROM_RGB888(red, green, blue) ((uint16_t)(((red) & 0xF8) | (((green) & 0xFF) >> 5) | \
+    (((green) & 0x1C) << 11) | (((blue) & 0xF8) << 5)))
+
+#define BGR_RED BGR565_FROM_RGB565(LCD_RED)
+#define BGR_GREEN BGR565_FROM_RGB565(LCD_GREEN)
+#define BGR_BLUE BGR565_FROM_RGB565(LCD_BLUE)
+#define BGR_BLACK BGR565_FROM_RGB565(LCD_BLACK)
+#define BGR_WHITE BGR565_FROM_RGB565(LCD_WHITE)
+#define BGR_YELLOW BGR565_FROM_RGB565(LCD_YELLOW)
+#define BGR_PINK BGR565_FROM_RGB565(LCD_PINK)
+#define BGR_PURPLE BGR565_FROM_RGB565(LCD_PURPLE)
+#define BGR_LIGHT_PURPLE BGR565_FROM_RGB565(LCD_LIGHT_PURPLE)
 
 
 // LCD draw structure.
@@ -134,13 +291,176 @@ typedef struct {
 } glyph_t;
 
 
+// Marks a point in the stream of queued transfers, done once everything queued up to it has been sent.
+typedef uint32_t draw_fence_t;
+
+// Called once a fence is done, from the drawing task, see on_fence_done().
+typedef void (*fence_callback_t)(draw_fence_t fence, void *user_ctx);
+
+
+// Bus between the ESP32 and the panel.
+typedef enum {
+    PANEL_BUS_SPI,
+    PANEL_BUS_I80,                  // 8 bit parallel, Intel 8080 style.
+} panel_bus_t;
+
+// Pixel formats of images, draw_image() sends BGR565 as is and converts the others while sending.
+typedef enum {
+    PIXEL_FORMAT_BGR565,            // The panel's order, Ex: filled with BGR_ colors.
+    PIXEL_FORMAT_RGB565,            // uint16_t RGB565, as most image converters write.
+    PIXEL_FORMAT_RGB888,            // 3 bytes per pixel, red first.
+} pixel_format_t;
+
+// Image tagged with its pixel format.
+typedef struct {
+    pixel_format_t format;
+    unsigned short width;
+    unsigned short height;
+    const void *pixels;
+} image_t;
+
+
+// Display configuration structure, get the defaults with get_default_display_config().
+typedef struct {
+    panel_bus_t bus;
+    int pin_mosi;                   // SPI only.
+    int pin_sclk;
+    int pin_data[8];                // Parallel only.
+    int pin_wr;
+    int pin_rd;                     // -1 if not connected, held high.
+    int pin_power;                  // -1 if not connected, driven high to power the panel.
+    int pin_cs;
+    int pin_dc;
+    int pin_rst;                    // -1 if not connected.
+    int pin_bk_light;               // -1 if not connected.
+
+    uint32_t pixel_clock_hz;        // 1 to LCD_MAX_PIXEL_CLOCK_HZ.
+    int trans_queue_depth;          // 1 to LCD_MAX_TRANS_QUEUE_DEPTH.
+    int max_transfer_sz;            // Largest single SPI transaction in bytes, at least a line.
+    spi_dma_chan_t dma_channel;     // SPI only, must not be SPI_DMA_DISABLED.
+    int bits_per_pixel;             // 16 (RGB565) or 12 (RGB444, a quarter less to send, colors are reduced when sent).
+} display_config_t;
+
+// Panel of a board, its geometry and the default configuration of its bus.
+typedef struct {
+    const char *name;
+    unsigned short width;
+    unsigned short height;
+    unsigned short x_offset;        // Frame memory column and line of the top left pixel.
+    unsigned short y_offset;
+    display_config_t default_config;
+} panel_descriptor_t;
+
+// Transfer statistics, accumulated over every window sent to the LCD.
+typedef struct {
+    uint32_t transfers;         // Amount of address windows sent.
+    uint64_t command_bytes;     // Command and parameter bytes setting up the windows, 11 per window.
+    uint64_t pixel_bytes;       // Pixel payload in bytes, as sent on the bus.
+    uint32_t merged_draws;      // Draws merged into the window of an earlier draw in a batch.
+    int64_t busy_us;            // Time from submitting until the transfer was done.
+} transfer_stats_t;
+
+
+// Block pool statistics.
+typedef struct {
+    unsigned short blocks;
+    unsigned short block_size;  // In bytes.
+    unsigned short in_use;
+    unsigned short high_water;  // Most blocks in use at the same time.
+    uint32_t borrowed;          // Total amount of blocks handed out.
+    uint32_t exhausted;         // Times a block was asked for while none were free.
+} pool_stats_t;
+
+
+// Calls in a recording. The arguments of each, in draw_record_t args:
+typedef enum {
+    RECORD_FILL_RECT,               // x, y, width, height, RGB color.
+    RECORD_FILL_RECT_ASYNC,         // Same as RECORD_FILL_RECT.
+    RECORD_DRAW_BGR_IMAGE,          // x, y, width, height, scale x, scale y. The payload is the image.
+    RECORD_QUEUE_BGR_IMAGE,         // Same as RECORD_DRAW_BGR_IMAGE.
+    RECORD_DRAW_BGR_IMAGE_ASYNC,    // Same as RECORD_DRAW_BGR_IMAGE.
+    RECORD_DRAW_IMAGE,              // x, y, width, height, pixel format. The payload is the image.
+    RECORD_WAIT_FOR_DRAWS,
+    RECORD_BEGIN_BATCH,             // Max gap, RGB gap color.
+    RECORD_END_BATCH,
+    RECORD_LOAD_LETTER_FONT,        // RGB letter color, RGB background color. The payload address is the font.
+    RECORD_LOAD_NUMBER_FONT,        // Same as RECORD_LOAD_LETTER_FONT.
+    RECORD_DRAW_GLYPHS,             // The glyph_t fields in order, then the text length. The payload address is the font, the text is inline.
+    RECORD_DRAW_NUMBER,             // The glyph_t fields in order, then the number, low half first. The payload address is the font.
+    RECORD_SET_VERTICAL_SCROLL,     // First line, scroll lines, scroll offset.
+    RECORD_CALL_AMOUNT,
+} record_call_t;
+
+#define RECORD_ARGS 10
+
+// Recorded call, followed by inline_bytes of payload padded to 4 bytes. Recorded when the call returns, calls made
+// by another recorded call are left out.
+typedef struct {
+    uint8_t call;                   // record_call_t.
+    uint8_t inline_bytes;
+    uint16_t length;                // Of the record and its inline payload.
+    uint32_t start_us;              // Low bits of esp_timer_get_time().
+    uint32_t duration_us;
+    uint32_t payload;               // Address of the caller's buffer, 0 if none.
+    uint32_t payload_hash;          // hash_record_payload() of it, 0 if none.
+    uint16_t args[RECORD_ARGS];
+} draw_record_t;
+
+#define RECORDER_MAGIC 0x43455247   // "GREC" in the little endian byte order of the ESP32.
+#define RECORDER_VERSION 1
+
+// Start of a dump, followed by record_bytes of records from the oldest to the newest.
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;           // sizeof(draw_record_t).
+    uint16_t screen_width;
+    uint16_t screen_height;
+    uint8_t bits_per_pixel;
+    uint8_t reserved[3];
+    uint32_t pixel_clock_hz;
+    uint32_t record_bytes;
+    uint32_t dropped;               // Records lost since the previous dump, overwritten or made while dumping.
+} draw_record_header_t;
+
+// Writes size bytes of a recording or trace dump, Ex: to a UART, socket or file. Returns the amount written.
+typedef int (*record_write_cb_t)(void *write_ctx, const uint8_t *data, int size);
+
+
+// Read only view of a single glyph inside a font.
+typedef struct {
+    const uint16_t *pixels;
+    unsigned short width;
+    unsigned short height;
+    unsigned short stride;      // Pixels from the start of one glyph line to the next.
+} glyph_view_t;
+
+
+// Descriptors of the supported boards.
+extern const panel_descriptor_t panel_t_display;
+extern const panel_descriptor_t panel_t_display_s3;
+
+// The panel drawn to, the one of GRAPHICS_BOARD unless a BOARD_RUNTIME build selected another one.
+extern const panel_descriptor_t *active_panel;
+
+
 // INFO: Graphics related functions, definitions, beware the screen retains some pixels when reset using the button.
 // This can be prevented by cutting all power to the ESP32 for a few seconds.
 
 
-// Setups the functionality for writing to the display, such as pin outs.
+// Setups the functionality for writing to the display, such as pin outs. Aborts if the display cannot be set up.
 void setup_display(esp_lcd_panel_handle_t *panel_handle);
 
+// Selects the panel to draw to, before the display is set up. Builds for a single board can only select that board,
+// BOARD_RUNTIME builds any panel up to SCREEN_MAX_WIDTH x SCREEN_MAX_HEIGHT.
+int select_panel(const panel_descriptor_t *panel);
+
+// Fills config with the default display configuration of the selected panel.
+void get_default_display_config(display_config_t *config);
+
+// Same as setup_display(), but with a custom configuration. Fails if the configuration is invalid.
+int setup_display_with_config(esp_lcd_panel_handle_t *panel_handle, const display_config_t *config);
+
 
 // Draws a rectangle given the draw_t specifications.
 int fill_rect(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, uint16_t RGB_color);
@@ -151,16 +471,68 @@ int fill_display(esp_lcd_panel_handle_t panel_handle, uint16_t RGB_color);
 // Draw using indices in an array, using 8 configurable colors.
 void int_to_color_array(color_def_t colors, uint16_t *int_buffer, int buffer_size);
 
-// Takes an integer and turns it into a char array. Ex: -427 -> "-427"
+#ifndef GRAPHICS_NO_HEAP
+// Takes an integer and turns it into a char array. Ex: -427 -> "-427". The char array is allocated and must be freed.
 char *int_to_char_array(int number, int *str_size);
+#endif
 
 // Optimized version of arr_draw_color
-int draw_bgr_image(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, uint16_t *image_buffer);
+int draw_bgr_image(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, const uint16_t *image_buffer);
+
+// Like draw_bgr_image(), but returns once the image is queued. Draws queued back to back are sent without waiting
+// in between, the image buffer must stay unchanged until wait_for_draws().
+int queue_bgr_image(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, const uint16_t *image_buffer);
+
+// Blocks until every queued draw has been sent.
+void wait_for_draws(void);
+
+// Blocks until at most max_in_flight queued transfers are still being sent. Transfers finish in order, so with
+// N buffers used in rotation, waiting for N - 1 in flight frees the oldest one.
+void wait_for_draws_in_flight(uint32_t max_in_flight);
+
+// Like fill_rect(), but returns once the rectangle is queued. The color buffer is a pool block, given back once
+// the fence is done. fence may be NULL. At most trans_queue_depth transfers are kept in flight, deeper queues wait.
+int fill_rect_async(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, uint16_t RGB_color, draw_fence_t *fence);
+
+// Like queue_bgr_image(), but the image buffer only has to stay unchanged until the returned fence is done.
+// At most trans_queue_depth transfers are kept in flight, deeper queues wait.
+int draw_bgr_image_async(esp_lcd_panel_handle_t panel_handle, draw_t draw_params, const uint16_t *image_buffer, draw_fence_t *fence);
+
+// Fence of everything queued so far, Ex: after a few queue_bgr_image() calls.
+draw_fence_t get_draw_fence(void);
 
-// Go from RGB color to BGR color, using pointer.
+// Returns 1 if the fence is done, 0 if it is still being sent. Runs the callbacks of done fences.
+int is_fence_done(draw_fence_t fence);
+
+// Blocks until the fence is done, then runs the callbacks of done fences.
+void wait_for_fence(draw_fence_t fence);
+
+// Calls callback once the fence is done, right away if it already is. Callbacks run in the drawing task, from the
+// next async draw, is_fence_done(), wait_for_fence() or wait_for_draws() call after the fence is done, so they may
+// draw. With FENCE_MAX_PENDING fences already pending, it first waits for the oldest one.
+int on_fence_done(draw_fence_t fence, fence_callback_t callback, void *user_ctx);
+
+// Starts a batch, the draws until end_batch() are collected instead of sent. A draw on the same lines as the draw
+// before it, or on the same columns, is merged into its window when they touch or overlap, or when at most max_gap
+// pixels lie between them, which are then filled with gap_RGB_color. Use a max_gap of 0 unless the gaps are known to
+// hold that color, Ex: glyph spacing on the text background. Pixels are copied, so buffers can be reused right away.
+// Draws too large for the batch are sent as usual, after the ones collected before them.
+int begin_batch(unsigned short max_gap, uint16_t gap_RGB_color);
+
+// Sends the collected windows back to back and waits for them once.
+int end_batch(void);
+
+// Draws an image with its top left corner at x, y. BGR565 images are sent straight from their buffer, other formats
+// are converted into pool blocks band by band, so no swap pass over the image is needed. Returns once it is sent.
+int draw_image(esp_lcd_panel_handle_t panel_handle, unsigned short x, unsigned short y, const image_t *image);
+
+// Go from RGB color to BGR color, using pointer. Swaps the whole buffer in place, draw_image() with
+// PIXEL_FORMAT_RGB565 converts while sending instead.
 void RGB_TO_BGR(uint16_t *image_buffer, int buffer_size);
 
+#ifndef GRAPHICS_NO_HEAP
 // Scale an image 1 to n, on x and y axis. Returns a pointer to the new scaled image buffer, else returns NULL ptr.
+// The buffer is allocated and must be freed. Drawing text scales through the block pool instead.
 uint16_t *scale_image(draw_t draw_params, uint16_t *image_buffer);
 
 // Return a pointer to the bitmap font, containing the english alphabet.
@@ -168,15 +540,59 @@ uint16_t *get_bitmap_letter_font(glyph_t *glyph_params, uint16_t letter_color, u
 
 // Return a pointer to the bitmap numbers font, containing numbers from 0 - 9.
 uint16_t *get_bitmap_numbers_font(glyph_t *glyph_params, uint16_t number_color, uint16_t background_color);
+#endif
+
+// Loads the bitmap letter font into font, which must hold LETTER_FONT_PIXELS pixels.
+int load_bitmap_letter_font(glyph_t *glyph_params, uint16_t *font, uint16_t letter_color, uint16_t background_color);
+
+// Loads the bitmap numbers font into font, which must hold NUMBER_FONT_PIXELS pixels.
+int load_bitmap_numbers_font(glyph_t *glyph_params, uint16_t *font, uint16_t number_color, uint16_t background_color);
+
+// Looks up a glyph in a font without copying it. Fails if the character is not in the font.
+int get_glyph_view(glyph_t text_params, const uint16_t *glyph_font, char glyph, glyph_view_t *view);
 
-// Draws text from a char buffer, only letters!
+// Draws text from a char buffer, only letters! Characters not in the font are left blank and make it return DRAW_FAILURE.
 int draw_glyphs(esp_lcd_panel_handle_t panel_handle, glyph_t text_params, uint16_t *glyph_font , char *text_buffer, unsigned int buffer_size);
 
+#ifndef GRAPHICS_NO_HEAP
 // Internal call, but can be used. 
-// Selects a glyph from a glyph buffer. Uses a single char and returns a pointer to that glyph.
+// Selects a glyph from a glyph buffer. Uses a single char and returns a pointer to an allocated copy of that glyph,
+// or NULL if the character is not in the font. Use get_glyph_view() to avoid the copy.
 uint16_t *select_glyph(glyph_t text_params, uint16_t *glyph_buffer, char glyph);
+#endif
 
 // Draws a number from an integer.
 int draw_number(esp_lcd_panel_handle_t panel_handle, glyph_t number_params, uint16_t *number_font, int number);
 
+// Hardware vertical scroll of the screen lines from first_line up to first_line + scroll_lines, over the full screen width.
+// The area shows frame memory rotated by scroll_offset lines, so screen line first_line shows what was drawn at
+// first_line + scroll_offset. Drawing functions still address frame memory, a scroll_offset of 0 turns the rotation off.
+int set_vertical_scroll(unsigned short first_line, unsigned short scroll_lines, unsigned short scroll_offset);
+
+// Copies the transfer statistics accumulated since boot into stats.
+void get_transfer_stats(transfer_stats_t *stats);
+
+// Borrows a POOL_BLOCK_SIZE bytes DMA capable block from the pool, returns NULL if all blocks are in use.
+// The draw functions use these for their transient buffers, so they never touch the heap.
+uint16_t *pool_borrow(void);
+
+// Returns a block borrowed with pool_borrow().
+void pool_return(void *block);
+
+// Copies the block pool statistics into stats.
+void get_pool_stats(pool_stats_t *stats);
+
+#ifdef GRAPHICS_RECORDER
+// Writes the recording from the oldest call on, through write, and empties it. Calls made meanwhile are dropped.
+int dump_draw_record(record_write_cb_t write, void *write_ctx);
+
+// FNV-1a hash of the size and first RECORDER_HASH_BYTES bytes of a payload, as kept in draw_record_t.
+uint32_t hash_record_payload(const void *payload, uint32_t size);
+#endif
+
+#ifdef GRAPHICS_TRACE
+// Writes the trace events since the previous dump as Chrome trace JSON through write. Tracing goes on meanwhile.
+int dump_draw_trace(record_write_cb_t write, void *write_ctx);
+#endif
+
 #endif
\ No newline at end of file
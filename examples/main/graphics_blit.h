@@ -0,0 +1,68 @@
+#ifndef GRAPHICS_BLIT_H
+#define GRAPHICS_BLIT_H
+
+#include "graphics.h"
+
+
+// Sprite pixel formats.
+typedef enum {
+    SPRITE_FORMAT_COLOR_KEY,    // BGR565 pixels, pixels equal to key_color are transparent.
+    SPRITE_FORMAT_A8,           // BGR565 pixels, with an 8 bit alpha value per pixel in alpha.
+    SPRITE_FORMAT_ARGB4444,     // 4 bits per channel, alpha in the top 4 bits.
+} sprite_format_t;
+
+// Sprite structure.
+typedef struct {
+    sprite_format_t format;
+    unsigned short width;
+    unsigned short height;
+    const uint16_t *pixels;
+    const uint8_t *alpha;       // SPRITE_FORMAT_A8 only.
+    uint16_t key_color;         // SPRITE_FORMAT_COLOR_KEY only, in BGR565.
+} sprite_t;
+
+
+// Reads a horizontal span of the pixels under a sprite, in BGR565. x and y are screen coordinates.
+typedef void (*pixel_source_cb_t)(void *source_ctx, int x, int y, int width, uint16_t *span_buffer);
+
+// Pixel source, what the sprite is blended against.
+typedef struct {
+    pixel_source_cb_t read_span;
+    void *source_ctx;
+} pixel_source_t;
+
+// Context for read_solid_span(), a single color.
+typedef struct {
+    uint16_t BGR_color;
+} solid_source_t;
+
+// Context for read_image_span(), a BGR565 image placed on the screen by draw_params. Pixels outside it read as black.
+typedef struct {
+    const uint16_t *image_buffer;
+    draw_t draw_params;
+} image_source_t;
+
+
+// Pixel source callbacks for a single color and for an image.
+void read_solid_span(void *source_ctx, int x, int y, int width, uint16_t *span_buffer);
+void read_image_span(void *source_ctx, int x, int y, int width, uint16_t *span_buffer);
+
+// Blends a BGR565 foreground pixel over a background pixel, alpha from 0 (background) to 32 (foreground).
+uint16_t blend_bgr565(uint16_t foreground, uint16_t background, uint32_t alpha);
+
+// Converts an ARGB4444 pixel to BGR565, dropping the alpha.
+uint16_t argb4444_to_bgr565(uint16_t argb_pixel);
+
+// Blends a line of sprite pixels over a line of background pixels, in place. first_pixel is the offset into the sprite.
+void blend_sprite_line(const sprite_t *sprite, int first_pixel, int width, uint16_t *line_buffer);
+
+// Merges overlapping screen regions into their bounding box until none overlap, so every pixel is drawn once.
+// A region grown by a merge can reach others, so merging goes on until a pass merges nothing.
+void merge_overlapping_regions(draw_t *regions, int *region_amount);
+
+// Draws a sprite with its top left corner at x, y, clipped to the screen.
+// With a background source the sprite is blended against it. Without one, only color keyed sprites can be drawn,
+// and only their opaque runs are sent.
+int blit_sprite(esp_lcd_panel_handle_t panel_handle, const sprite_t *sprite, int x, int y, const pixel_source_t *background);
+
+#endif
@@ -0,0 +1,608 @@
+#include "graphics_chart.h"
+
+#include <math.h>
+#include <stdio.h>
+
+
+void get_default_chart_config(chart_config_t *config)
+{
+    memset(config, 0, sizeof(chart_config_t));
+
+    config->mode = CHART_SWEEP;
+    config->plot.draw_start_x = 32;
+    config->plot.draw_start_y = 0;
+    config->plot.image_size_x = SCREEN_WIDTH - 32;
+    config->plot.image_size_y = SCREEN_HEIGHT / 2;
+    config->plot.scale_x = 1;
+    config->plot.scale_y = 1;
+
+    config->line_color = LCD_YELLOW;
+    config->grid_color = 0x4208;
+    config->background_color = LCD_BLACK;
+    config->label_color = LCD_WHITE;
+
+    config->time_grid = 25;
+    config->value_grid_lines = 4;
+    config->min_span = 1.0f;
+
+    config->label_font = &font_sans_12;
+    config->label_size = 32;
+}
+
+
+// Pixels along the time and value axes of the plot.
+static int time_axis_length(const chart_t *chart)
+{
+    return chart->config.mode == CHART_SWEEP ? chart->config.plot.image_size_x : chart->config.plot.image_size_y;
+}
+
+static int value_axis_length(const chart_t *chart)
+{
+    return chart->config.mode == CHART_SWEEP ? chart->config.plot.image_size_y : chart->config.plot.image_size_x;
+}
+
+
+int chart_init(chart_t *chart, const chart_config_t *config, float *sample_storage)
+{
+    // Sanity checks.
+    if ( (config == NULL) || (sample_storage == NULL) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Chart config or sample storage is a NULL pointer.");
+        return DRAW_FAILURE;
+    }
+
+    const draw_t *plot = &config->plot;
+    if ( (plot->image_size_x < 2) || (plot->image_size_y < 2) ||
+        (plot->draw_start_x + plot->image_size_x > SCREEN_WIDTH) || (plot->draw_start_y + plot->image_size_y > SCREEN_HEIGHT) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Chart plot out of bounds.");
+        return DRAW_FAILURE;
+    }
+
+    // The hardware scroll moves whole screen lines.
+    if ( (config->mode == CHART_HARDWARE_SCROLL) && ((plot->draw_start_x != 0) || (plot->image_size_x != SCREEN_WIDTH)) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "A hardware scrolled chart must span the screen width.");
+        return DRAW_FAILURE;
+    }
+
+    if ( (config->label_font != NULL) &&
+        (config->label_size > (config->mode == CHART_SWEEP ? plot->draw_start_x : plot->draw_start_y)) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Chart label strip does not fit next to the plot.");
+        return DRAW_FAILURE;
+    }
+
+    if (config->value_grid_lines == 0)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Chart needs at least one value gridline.");
+        return DRAW_FAILURE;
+    }
+
+    memset(chart, 0, sizeof(chart_t));
+    chart->config = *config;
+    chart->samples = sample_storage;
+    chart->slots = time_axis_length(chart);
+    chart->capacity = chart->slots + (config->mode == CHART_HARDWARE_SCROLL ? 1 : 0);
+
+    return DRAW_SUCCESS;
+}
+
+
+// Rounds a gridline step up to 1, 2 or 5 times a power of ten.
+static float nice_step(float raw_step)
+{
+    float base = powf(10.0f, floorf(log10f(raw_step)));
+    float fraction = raw_step / base;
+
+    if (fraction <= 1.0f)
+    {
+        return base;
+    }
+    if (fraction <= 2.0f)
+    {
+        return 2.0f * base;
+    }
+    if (fraction <= 5.0f)
+    {
+        return 5.0f * base;
+    }
+
+    return 10.0f * base;
+}
+
+
+// Range with headroom around low and high, starting and ending on a gridline.
+static void compute_range(const chart_t *chart, float low, float high, float *range_min, float *range_max, float *grid_step)
+{
+    float span = high - low;
+
+    if (span < chart->config.min_span)
+    {
+        float center = (low + high) / 2.0f;
+        span = chart->config.min_span;
+        low = center - span / 2.0f;
+        high = center + span / 2.0f;
+    }
+
+    // A steady signal without min_span still needs a range.
+    if (span <= 0.0f)
+    {
+        span = low != 0.0f ? fabsf(low) * 0.2f : 1.0f;
+        low -= span / 2.0f;
+        high += span / 2.0f;
+    }
+
+    low -= span * CHART_HEADROOM_FRACTION;
+    high += span * CHART_HEADROOM_FRACTION;
+
+    *grid_step = nice_step((high - low) / chart->config.value_grid_lines);
+    *range_min = floorf(low / *grid_step) * *grid_step;
+    *range_max = ceilf(high / *grid_step) * *grid_step;
+}
+
+
+// Samples that can be seen, a sweeping chart hides the oldest under the cleared column.
+static int visible_samples(const chart_t *chart)
+{
+    int visible = chart->slots - (chart->config.mode == CHART_SWEEP ? 1 : 0);
+
+    return (int)chart->sample_amount < visible ? (int)chart->sample_amount : visible;
+}
+
+
+// Fits the range to the samples shown, returns 1 if it changed. Grows right away, shrinks with hysteresis.
+static int update_range(chart_t *chart)
+{
+    float low = INFINITY;
+    float high = -INFINITY;
+    int visible = visible_samples(chart);
+
+    for (int i = 0; i < visible; ++i)
+    {
+        float value = chart->samples[(chart->sample_amount - 1 - i) % chart->capacity];
+
+        if (isfinite(value))
+        {
+            low = value < low ? value : low;
+            high = value > high ? value : high;
+        }
+    }
+
+    // Nothing to fit yet.
+    if (low > high)
+    {
+        if (chart->scaled)
+        {
+            return 0;
+        }
+        low = 0.0f;
+        high = 0.0f;
+    }
+
+    float range_min;
+    float range_max;
+    float grid_step;
+
+    if (chart->scaled && (low >= chart->range_min) && (high <= chart->range_max))
+    {
+        float span = chart->range_max - chart->range_min;
+        if (high - low >= span * CHART_SHRINK_FRACTION)
+        {
+            return 0;
+        }
+
+        // Only shrink, a range held up by min_span would otherwise follow every move of the samples.
+        compute_range(chart, low, high, &range_min, &range_max, &grid_step);
+        if (range_max - range_min >= span)
+        {
+            return 0;
+        }
+    }
+    else
+    {
+        compute_range(chart, low, high, &range_min, &range_max, &grid_step);
+    }
+
+    chart->range_min = range_min;
+    chart->range_max = range_max;
+    chart->grid_step = grid_step;
+    chart->scaled = 1;
+    chart->rescales += 1;
+
+    return 1;
+}
+
+
+// Pixel of a value along the value axis, counted from the top for CHART_SWEEP and from the left otherwise.
+static int value_pixel(const chart_t *chart, float value)
+{
+    int length = value_axis_length(chart);
+    int position = lroundf((value - chart->range_min) * (length - 1) / (chart->range_max - chart->range_min));
+
+    position = position < 0 ? 0 : (position >= length ? length - 1 : position);
+
+    return chart->config.mode == CHART_SWEEP ? length - 1 - position : position;
+}
+
+
+// Sample shown in a column of a sweeping chart or a frame memory line of a scrolled chart, -1 for none.
+static long slot_sample(const chart_t *chart, int slot)
+{
+    long newest = (long)chart->sample_amount - 1;
+
+    if ( (newest < 0) || ((chart->config.mode == CHART_SWEEP) && (slot == chart->sample_amount % chart->slots)) )
+    {
+        return -1;
+    }
+
+    long sample = newest - (((newest - slot) % chart->slots) + chart->slots) % chart->slots;
+
+    return sample < 0 ? -1 : sample;
+}
+
+
+// Renders count pixels from first along the value axis of the slot showing sample, pixels stride apart.
+static void render_slot(const chart_t *chart, long sample, int first, int count, uint16_t *pixels, int stride)
+{
+    uint16_t background = COLOR_SWAP(chart->config.background_color);
+    uint16_t grid = COLOR_SWAP(chart->config.grid_color);
+    uint16_t line = COLOR_SWAP(chart->config.line_color);
+    int time_gridline = (sample >= 0) && (chart->config.time_grid != 0) && (sample % chart->config.time_grid == 0);
+
+    for (int i = 0; i < count; ++i)
+    {
+        pixels[i * stride] = time_gridline ? grid : background;
+    }
+
+    if (!time_gridline)
+    {
+        int gridlines = lroundf((chart->range_max - chart->range_min) / chart->grid_step);
+
+        for (int i = 0; i <= gridlines; ++i)
+        {
+            int pixel = value_pixel(chart, chart->range_min + i * chart->grid_step) - first;
+            if ( (pixel >= 0) && (pixel < count) )
+            {
+                pixels[pixel * stride] = grid;
+            }
+        }
+    }
+
+    if (sample < 0)
+    {
+        return;
+    }
+
+    float value = chart->samples[sample % chart->capacity];
+    if (!isfinite(value))
+    {
+        return;
+    }
+
+    // The line runs from the previous sample, if it is still kept.
+    int low = value_pixel(chart, value);
+    int high = low;
+
+    if ( (sample > 0) && (sample > (long)chart->sample_amount - chart->capacity) )
+    {
+        float previous = chart->samples[(sample - 1) % chart->capacity];
+        if (isfinite(previous))
+        {
+            int pixel = value_pixel(chart, previous);
+            low = pixel < low ? pixel : low;
+            high = pixel > high ? pixel : high;
+        }
+    }
+
+    low = low > first ? low : first;
+    high = high < first + count - 1 ? high : first + count - 1;
+
+    for (int pixel = low; pixel <= high; ++pixel)
+    {
+        pixels[(pixel - first) * stride] = line;
+    }
+}
+
+
+// Draws the gridline values in the label strip.
+static int draw_chart_labels(esp_lcd_panel_handle_t panel_handle, chart_t *chart)
+{
+    const chart_config_t *config = &chart->config;
+    const aa_font_t *font = config->label_font;
+
+    if ( (font == NULL) || (config->label_size == 0) )
+    {
+        return DRAW_SUCCESS;
+    }
+
+    draw_t strip = config->plot;
+    if (config->mode == CHART_SWEEP)
+    {
+        strip.draw_start_x -= config->label_size;
+        strip.image_size_x = config->label_size;
+    }
+    else
+    {
+        strip.draw_start_y -= config->label_size;
+        strip.image_size_y = config->label_size;
+    }
+
+    int result = fill_rect(panel_handle, strip, config->background_color);
+    chart->pixel_bytes_sent += strip.image_size_x * strip.image_size_y * sizeof(uint16_t);
+
+    int decimals = chart->grid_step >= 1.0f ? 0 : (int)ceilf(-log10f(chart->grid_step) - 0.001f);
+    int gridlines = lroundf((chart->range_max - chart->range_min) / chart->grid_step);
+    int next_free = -1;
+
+    // In screen order, so a label overlapping the one before it is skipped.
+    for (int i = 0; i <= gridlines; ++i)
+    {
+        float value = config->mode == CHART_SWEEP ? chart->range_max - i * chart->grid_step : chart->range_min + i * chart->grid_step;
+        if (fabsf(value) < chart->grid_step / 1000.0f)
+        {
+            value = 0.0f;
+        }
+
+        char text[16];
+        int length = snprintf(text, sizeof(text), "%.*f", decimals, value);
+        int width = get_aa_text_width(font, text, length);
+        int pixel = value_pixel(chart, value);
+        int x;
+        int y;
+
+        if (config->mode == CHART_SWEEP)
+        {
+            y = pixel - font->line_height / 2;
+            y = y < 0 ? 0 : y;
+            y = y > config->plot.image_size_y - font->line_height ? config->plot.image_size_y - font->line_height : y;
+
+            if ( (width > config->label_size - 2) || (y < next_free) || (y < 0) )
+            {
+                continue;
+            }
+
+            next_free = y + font->line_height;
+            x = config->plot.draw_start_x - 2 - width;
+            y += config->plot.draw_start_y;
+        }
+        else
+        {
+            x = pixel - width / 2;
+            x = x < 0 ? 0 : x;
+            x = x > config->plot.image_size_x - width ? config->plot.image_size_x - width : x;
+
+            if ( (font->line_height > config->label_size) || (x < next_free) || (x < 0) )
+            {
+                continue;
+            }
+
+            next_free = x + width + 4;
+            y = strip.draw_start_y;
+        }
+
+        result |= draw_aa_text(panel_handle, font, x, y, config->label_color, config->background_color, text, length);
+        chart->pixel_bytes_sent += width * font->line_height * sizeof(uint16_t);
+    }
+
+    return result;
+}
+
+
+int draw_chart(esp_lcd_panel_handle_t panel_handle, chart_t *chart)
+{
+    // Sanity check.
+    if ( (chart == NULL) || (chart->samples == NULL) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot draw chart, it is not set up.");
+        return DRAW_FAILURE;
+    }
+
+    if (!chart->scaled)
+    {
+        update_range(chart);
+    }
+
+    int result = draw_chart_labels(panel_handle, chart);
+
+    // Every free pool block is used, so bands are only waited for when the blocks run out.
+    uint16_t *band_buffers[POOL_BLOCK_AMOUNT];
+    int band_buffer_amount = 0;
+
+    while (band_buffer_amount < POOL_BLOCK_AMOUNT)
+    {
+        band_buffers[band_buffer_amount] = pool_borrow();
+        if (band_buffers[band_buffer_amount] == NULL)
+        {
+            break;
+        }
+        band_buffer_amount += 1;
+    }
+
+    if (band_buffer_amount == 0)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for drawing a chart.");
+        return DRAW_FAILURE;
+    }
+
+    const draw_t *plot = &chart->config.plot;
+    int width = plot->image_size_x;
+    int band_lines = POOL_BLOCK_PIXELS / width;
+    int next_buffer = 0;
+
+    draw_t band = *plot;
+    band.scale_x = 1;
+    band.scale_y = 1;
+
+    // A scrolled chart is drawn in frame memory order, every line keeps its place and the scroll offset does the rest.
+    for (int line = 0; line < plot->image_size_y; line += band_lines)
+    {
+        int lines = plot->image_size_y - line < band_lines ? plot->image_size_y - line : band_lines;
+
+        if (next_buffer == band_buffer_amount)
+        {
+            wait_for_draws();
+            next_buffer = 0;
+        }
+
+        uint16_t *band_buffer = band_buffers[next_buffer];
+        next_buffer += 1;
+
+        if (chart->config.mode == CHART_SWEEP)
+        {
+            for (int column = 0; column < width; ++column)
+            {
+                render_slot(chart, slot_sample(chart, column), line, lines, band_buffer + column, width);
+            }
+        }
+        else
+        {
+            for (int i = 0; i < lines; ++i)
+            {
+                render_slot(chart, slot_sample(chart, line + i), 0, width, band_buffer + i * width, 1);
+            }
+        }
+
+        band.draw_start_y = plot->draw_start_y + line;
+        band.image_size_y = lines;
+        result |= queue_bgr_image(panel_handle, band, band_buffer);
+    }
+
+    wait_for_draws();
+
+    for (int i = 0; i < band_buffer_amount; ++i)
+    {
+        pool_return(band_buffers[i]);
+    }
+
+    chart->pixel_bytes_sent += plot->image_size_x * plot->image_size_y * sizeof(uint16_t);
+
+    if (chart->config.mode == CHART_HARDWARE_SCROLL)
+    {
+        result |= set_vertical_scroll(plot->draw_start_y, plot->image_size_y, chart->sample_amount % chart->slots);
+    }
+
+    chart->drawn = (result == DRAW_SUCCESS);
+    chart->full_redraws += 1;
+
+    return result;
+}
+
+
+// Sends the slot of the newest sample, and for a sweeping chart the cleared column after it.
+static int draw_newest_sample(esp_lcd_panel_handle_t panel_handle, chart_t *chart)
+{
+    uint16_t *slot_buffer = pool_borrow();
+    if (slot_buffer == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for drawing a chart sample.");
+        return DRAW_FAILURE;
+    }
+
+    const draw_t *plot = &chart->config.plot;
+    long newest = (long)chart->sample_amount - 1;
+    int slot = newest % chart->slots;
+    int result = DRAW_SUCCESS;
+
+    draw_t window = {
+        .scale_x = 1,
+        .scale_y = 1,
+    };
+
+    if (chart->config.mode == CHART_SWEEP)
+    {
+        int height = plot->image_size_y;
+        int cleared = (slot + 1) % chart->slots;
+
+        window.draw_start_y = plot->draw_start_y;
+        window.image_size_y = height;
+
+        if (cleared == slot + 1)
+        {
+            // Both columns in one window.
+            render_slot(chart, newest, 0, height, slot_buffer, 2);
+            render_slot(chart, -1, 0, height, slot_buffer + 1, 2);
+
+            window.draw_start_x = plot->draw_start_x + slot;
+            window.image_size_x = 2;
+            result |= queue_bgr_image(panel_handle, window, slot_buffer);
+        }
+        else
+        {
+            // The sweep wraps, the cleared column is the first one.
+            render_slot(chart, newest, 0, height, slot_buffer, 1);
+            render_slot(chart, -1, 0, height, slot_buffer + height, 1);
+
+            window.draw_start_x = plot->draw_start_x + slot;
+            window.image_size_x = 1;
+            result |= queue_bgr_image(panel_handle, window, slot_buffer);
+
+            window.draw_start_x = plot->draw_start_x;
+            result |= queue_bgr_image(panel_handle, window, slot_buffer + height);
+        }
+
+        chart->pixel_bytes_sent += 2 * height * sizeof(uint16_t);
+    }
+    else
+    {
+        render_slot(chart, newest, 0, plot->image_size_x, slot_buffer, 1);
+
+        window.draw_start_x = plot->draw_start_x;
+        window.draw_start_y = plot->draw_start_y + slot;
+        window.image_size_x = plot->image_size_x;
+        window.image_size_y = 1;
+        result |= queue_bgr_image(panel_handle, window, slot_buffer);
+
+        chart->pixel_bytes_sent += plot->image_size_x * sizeof(uint16_t);
+    }
+
+    wait_for_draws();
+    pool_return(slot_buffer);
+
+    // The new line goes to the bottom.
+    if (chart->config.mode == CHART_HARDWARE_SCROLL)
+    {
+        result |= set_vertical_scroll(plot->draw_start_y, plot->image_size_y, chart->sample_amount % chart->slots);
+    }
+
+    return result;
+}
+
+
+int append_chart_sample(esp_lcd_panel_handle_t panel_handle, chart_t *chart, float value)
+{
+    // Sanity check.
+    if ( (chart == NULL) || (chart->samples == NULL) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot append to chart, it is not set up.");
+        return DRAW_FAILURE;
+    }
+
+    chart->samples[chart->sample_amount % chart->capacity] = value;
+    chart->sample_amount += 1;
+
+    if (update_range(chart) || !chart->drawn)
+    {
+        return draw_chart(panel_handle, chart);
+    }
+
+    return draw_newest_sample(panel_handle, chart);
+}
+
+
+int release_chart_scroll(esp_lcd_panel_handle_t panel_handle, chart_t *chart)
+{
+    if (chart->config.mode != CHART_HARDWARE_SCROLL)
+    {
+        return DRAW_SUCCESS;
+    }
+
+    if (set_vertical_scroll(chart->config.plot.draw_start_y, chart->config.plot.image_size_y, 0) != DRAW_SUCCESS)
+    {
+        return DRAW_FAILURE;
+    }
+
+    chart->drawn = 0;
+
+    return DRAW_SUCCESS;
+}
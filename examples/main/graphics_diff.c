@@ -0,0 +1,152 @@
+#include "graphics_diff.h"
+
+
+_Static_assert(FRAME_DIFF_TILE_SIZE <= PARALLEL_LINES, "A tile row must fit in a pool block.");
+
+
+void frame_differ_init(frame_differ_t *differ)
+{
+    memset(differ, 0, sizeof(frame_differ_t));
+}
+
+
+void invalidate_frame_differ(frame_differ_t *differ)
+{
+    differ->valid = 0;
+}
+
+
+// FNV-1a over the pixels of a tile. A changed tile keeping its 32 bit hash is rare enough to ignore for display use.
+static uint32_t hash_tile(const uint16_t *frame_buffer, int x_start, int y_start, int width, int height)
+{
+    uint32_t hash = 2166136261u;
+
+    for (int y = y_start; y < y_start + height; ++y)
+    {
+        const uint16_t *pixels = frame_buffer + y * SCREEN_WIDTH + x_start;
+
+        for (int x = 0; x < width; ++x)
+        {
+            hash = (hash ^ pixels[x]) * 16777619u;
+        }
+    }
+
+    return hash;
+}
+
+
+int submit_frame(esp_lcd_panel_handle_t panel_handle, frame_differ_t *differ, const uint16_t *frame_buffer)
+{
+    // Sanity check.
+    if (frame_buffer == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot submit, frame buffer is a NULL pointer.");
+        return DRAW_FAILURE;
+    }
+
+    // Every free pool block is used, so runs are only waited for when the blocks run out.
+    uint16_t *run_buffers[POOL_BLOCK_AMOUNT];
+    int run_buffer_amount = 0;
+
+    while (run_buffer_amount < POOL_BLOCK_AMOUNT)
+    {
+        run_buffers[run_buffer_amount] = pool_borrow();
+        if (run_buffers[run_buffer_amount] == NULL)
+        {
+            break;
+        }
+        run_buffer_amount += 1;
+    }
+
+    if (run_buffer_amount == 0)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for submitting a frame.");
+        return DRAW_FAILURE;
+    }
+
+    int result = DRAW_SUCCESS;
+    int next_buffer = 0;
+
+    for (int row = 0; row < FRAME_DIFF_ROWS; ++row)
+    {
+        int y_start = row * FRAME_DIFF_TILE_SIZE;
+        int height = SCREEN_HEIGHT - y_start < FRAME_DIFF_TILE_SIZE ? SCREEN_HEIGHT - y_start : FRAME_DIFF_TILE_SIZE;
+        int column = 0;
+
+        while (column < FRAME_DIFF_COLUMNS)
+        {
+            // Find the next run of changed tiles.
+            int run_start = column;
+            while (column < FRAME_DIFF_COLUMNS)
+            {
+                int x_start = column * FRAME_DIFF_TILE_SIZE;
+                int width = SCREEN_WIDTH - x_start < FRAME_DIFF_TILE_SIZE ? SCREEN_WIDTH - x_start : FRAME_DIFF_TILE_SIZE;
+                uint32_t hash = hash_tile(frame_buffer, x_start, y_start, width, height);
+                uint32_t *stored_hash = &differ->tile_hashes[row * FRAME_DIFF_COLUMNS + column];
+
+                differ->tiles_compared += 1;
+
+                if (differ->valid && (hash == *stored_hash))
+                {
+                    break;
+                }
+
+                *stored_hash = hash;
+                ++column;
+            }
+
+            if (column > run_start)
+            {
+                // All blocks queued, wait for them before copying over them.
+                if (next_buffer == run_buffer_amount)
+                {
+                    wait_for_draws();
+                    next_buffer = 0;
+                }
+
+                uint16_t *run_buffer = run_buffers[next_buffer];
+                next_buffer += 1;
+
+                draw_t run = {
+                    .draw_start_x = run_start * FRAME_DIFF_TILE_SIZE,
+                    .draw_start_y = y_start,
+                    .image_size_y = height,
+                    .scale_x = 1,
+                    .scale_y = 1,
+                };
+                run.image_size_x = (column * FRAME_DIFF_TILE_SIZE < SCREEN_WIDTH ? column * FRAME_DIFF_TILE_SIZE : SCREEN_WIDTH) - run.draw_start_x;
+
+                // Copied, the frame lines are longer than the run and the frame may not be DMA capable.
+                for (int line = 0; line < height; ++line)
+                {
+                    memcpy(run_buffer + line * run.image_size_x, frame_buffer + (y_start + line) * SCREEN_WIDTH + run.draw_start_x,
+                        run.image_size_x * sizeof(uint16_t));
+                }
+
+                result |= queue_bgr_image(panel_handle, run, run_buffer);
+
+                differ->tiles_sent += column - run_start;
+                differ->windows_sent += 1;
+                differ->pixel_bytes_sent += run.image_size_x * run.image_size_y * sizeof(uint16_t);
+            }
+
+            // Skip the unchanged tile that ended the run, it has been compared already.
+            if (column < FRAME_DIFF_COLUMNS)
+            {
+                ++column;
+            }
+        }
+    }
+
+    wait_for_draws();
+
+    for (int i = 0; i < run_buffer_amount; ++i)
+    {
+        pool_return(run_buffers[i]);
+    }
+
+    differ->valid = (result == DRAW_SUCCESS);
+    differ->frames += 1;
+
+    return result;
+}
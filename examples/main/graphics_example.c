@@ -1,10 +1,49 @@
 // Graphics headerfile.
 #include "graphics.h"
+#include "graphics_frame.h"
+#include "graphics_blit.h"
+#include "graphics_font.h"
+#include "graphics_snapshot.h"
+
+#include <stdio.h>
 
 // For tasks
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
+// State for the counter example.
+typedef struct {
+    glyph_t number_params;
+    uint16_t *number_font;
+    int value;
+} counter_t;
+
+// Render callback for the counter example, draws the next number each frame.
+static void draw_counter(esp_lcd_panel_handle_t panel_handle, uint32_t frame_number, void *user_ctx)
+{
+    counter_t *counter = (counter_t *)user_ctx;
+
+    counter->value += 1;
+    draw_number(panel_handle, counter->number_params, counter->number_font, counter->value);
+}
+
+
+// Fence callback of the non-blocking draw example.
+static void log_fence_done(draw_fence_t fence, void *user_ctx)
+{
+    ESP_LOGI(TAG_DISPLAY, "%s sent, fence %lu.", (const char *)user_ctx, (unsigned long)fence);
+}
+
+
+#if defined(GRAPHICS_RECORDER) || defined(GRAPHICS_TRACE)
+// Writes a call recording or a trace to the console UART.
+static int write_to_console(void *write_ctx, const uint8_t *data, int size)
+{
+    return fwrite(data, 1, size, stdout);
+}
+#endif
+
+
 // Graphics task.
 void graphics_examples(void *Params)
 {
@@ -81,13 +120,31 @@ void graphics_examples(void *Params)
     // Set new y start pos.
     number_parameters.glyph_start_y = 100;
 
-    // Draw the numbers 1 - 100 very fast:
+    // Draw the numbers 1 - 100 at a steady 30 frames per second, using the frame scheduler.
+    counter_t counter = {
+        .number_params = number_parameters,
+        .number_font = number_font,
+    };
+
+    frame_scheduler_t scheduler;
+    frame_scheduler_init(&scheduler, panel_handle, 30);
+    add_render_callback(&scheduler, draw_counter, &counter);
+
     for(int i = 1; i <= 100; ++i)
     {
-        draw_number(panel_handle, number_parameters, number_font, i);
-        vTaskDelay(20 / portTICK_PERIOD_MS);
+        run_frame(&scheduler);
     }
 
+    // Print how well the frame rate was kept.
+    frame_stats_t frame_stats;
+    get_frame_stats(&scheduler, &frame_stats);
+
+    ESP_LOGI(TAG_DISPLAY, "Frames: %lu, dropped: %lu, frame time min/avg/p99/max: %lld/%lld/%lld/%lld us, render: %lld us, transfer: %lld us",
+        (unsigned long)frame_stats.frames, (unsigned long)frame_stats.dropped,
+        (long long)frame_stats.min_us, (long long)frame_stats.avg_us, (long long)frame_stats.p99_us, (long long)frame_stats.max_us,
+        (long long)frame_stats.avg_render_us, (long long)frame_stats.avg_transfer_us
+    );
+
 
     // Example: Drawing text. --------------------------------------
 
@@ -97,7 +154,62 @@ void graphics_examples(void *Params)
     text_parameters.glyph_scale = 2;
 
     // Due to not implementing a full ASCII bitmap for the font, '|' is space.
+    transfer_stats_t before_text;
+    transfer_stats_t after_text;
+    get_transfer_stats(&before_text);
+
+    draw_glyphs(panel_handle, text_parameters, text_font, "what|is|up", 10);
+
+    get_transfer_stats(&after_text);
+    ESP_LOGI(TAG_DISPLAY, "Text: %lu windows, %llu command bytes, %llu pixel bytes",
+        (unsigned long)(after_text.transfers - before_text.transfers),
+        (unsigned long long)(after_text.command_bytes - before_text.command_bytes),
+        (unsigned long long)(after_text.pixel_bytes - before_text.pixel_bytes)
+    );
+
+
+    // Example: Batching small draws. --------------------------------------
+
+    // Every glyph above set up its own address window. Drawn again in a batch, the glyphs share one window and the
+    // spacing between them is filled with the white font background.
+    get_transfer_stats(&before_text);
+
+    begin_batch(text_parameters.glyph_spacing * text_parameters.glyph_scale, LCD_WHITE);
     draw_glyphs(panel_handle, text_parameters, text_font, "what|is|up", 10);
+    end_batch();
+
+    get_transfer_stats(&after_text);
+    ESP_LOGI(TAG_DISPLAY, "Batched text: %lu windows, %llu command bytes, %llu pixel bytes",
+        (unsigned long)(after_text.transfers - before_text.transfers),
+        (unsigned long long)(after_text.command_bytes - before_text.command_bytes),
+        (unsigned long long)(after_text.pixel_bytes - before_text.pixel_bytes)
+    );
+
+
+    // Example: Drawing without blocking. --------------------------------------
+
+    // The fill is queued and the call returns right away, the fence tells when it has been sent.
+    draw_t status_rect = {
+        .draw_start_x = 0,
+        .draw_start_y = 230,
+        .image_size_x = 135,
+        .image_size_y = 10,
+        .scale_x = 1,
+        .scale_y = 1,
+    };
+    draw_fence_t status_fence;
+
+    fill_rect_async(panel_handle, status_rect, LCD_PURPLE, &status_fence);
+    on_fence_done(status_fence, log_fence_done, "Status bar");
+
+    // Other work can be done here while the rectangle is being sent.
+    wait_for_fence(status_fence);
+
+
+    // Example: Drawing anti-aliased text. --------------------------------------
+
+    // The whole line is drawn at once, on the given background color.
+    draw_aa_text(panel_handle, &font_sans_16, 10, 205, LCD_BLACK, LCD_PINK, "Hello world!", 12);
 
 
     // Example: Drawing an image.
@@ -181,12 +293,18 @@ void graphics_examples(void *Params)
       0xa2b4, 0x9ad1, 0xa2d2, 0xc216, 0xe2bb, 0xaad4, 0x92d1, 0xa2b3, 0x9ab2, 0x9ab2, 0x9ab2, 0x9ab2, 0x9ab2, 0x9ab2, 0x9ab2, 0x9ab2, 0xa2d3, 0xa2b2, 0x92d2, 0xa293, 0xc9d7, 0xeabb, 0xc317, 0xa2d3, 0xaad4, 0xa2d4, 0xa2d3, 0xa2b3, 0xaad4, 0xa2b2, 0xaab3, 0xaa94, 0xc9f7, 0xda7a, 0xe31b, 0xaab5, 0xa2f3, 0xa2f3, 0xa2b3, 0xa2d4, 0xa2d4, 0xa2b4, 0xa2b3, 0xaab4, 0xb275, 0xc216, 0xda19, 0xf29c, 0xc338, 0xaa95, 0xaab4, 0xa2d4, 0xa2d3, 0xa2b3, 0xa2d3, 0xa2d3, 0xa2d3, 0xb274, 0xc217, 0xd9d9, 0xe23a, 0xeb1b, 0xcb38, 0xaab4
     };
 
-    // Since the display only works with BGR we now convert the image.
-    RGB_TO_BGR(test_image, 4096);
+    // The display works with BGR, tagging the image as RGB565 converts it while it is sent.
+    image_t rgb_image = {
+        .format = PIXEL_FORMAT_RGB565,
+        .width = 64,
+        .height = 64,
+        .pixels = test_image,
+    };
 
-    // It is possible to scale the image, however remember not to scale it too much, since it may become out of bounds.
-    // Draw image:
+    draw_image(panel_handle, 64, 10, &rgb_image);
 
+    // An image converted once with RGB_TO_BGR() can be drawn with draw_bgr_image(), which can also scale it. Remember
+    // not to scale it too much, since it may become out of bounds.
     draw_t test_image_parameters = {
         .draw_start_x = 64,
         .draw_start_y = 10,
@@ -196,7 +314,128 @@ void graphics_examples(void *Params)
         .scale_y = 1,
     };
 
-    draw_bgr_image(panel_handle, test_image_parameters, test_image);
+
+    // Example: Drawing a sprite. --------------------------------------
+
+    // A small ARGB4444 sprite, a red square with a half transparent green border, fading in from the left.
+    uint16_t sprite_pixels[16 * 16];
+    for (int i = 0; i < 16 * 16; ++i)
+    {
+        int x = i % 16;
+        int y = i / 16;
+        uint16_t alpha = x < 15 ? x : 15;
+
+        if ( (x < 3) || (x > 12) || (y < 3) || (y > 12) )
+        {
+            sprite_pixels[i] = (alpha / 2) << 12 | 0x00F0;
+        }
+        else
+        {
+            sprite_pixels[i] = alpha << 12 | 0x0F00;
+        }
+    }
+
+    sprite_t sprite = {
+        .format = SPRITE_FORMAT_ARGB4444,
+        .width = 16,
+        .height = 16,
+        .pixels = sprite_pixels,
+    };
+
+    // The sprite is blended against the image drawn above, which is read as BGR565.
+    RGB_TO_BGR(test_image, 4096);
+
+    image_source_t image_source = {
+        .image_buffer = test_image,
+        .draw_params = test_image_parameters,
+    };
+
+    pixel_source_t background = {
+        .read_span = read_image_span,
+        .source_ctx = &image_source,
+    };
+
+    blit_sprite(panel_handle, &sprite, 80, 30, &background);
+
+
+    // Example: Showing a popup. --------------------------------------
+
+    // The region under the popup is saved first, here read from the image. Over a compositor read it with
+    // read_compositor_span() instead.
+    static uint32_t snapshot_storage[1024];
+    snapshot_pool_t snapshot_pool;
+    snapshot_pool_init(&snapshot_pool, snapshot_storage, sizeof(snapshot_storage));
+
+    draw_t popup = {
+        .draw_start_x = 64,
+        .draw_start_y = 50,
+        .image_size_x = 64,
+        .image_size_y = 24,
+        .scale_x = 1,
+        .scale_y = 1,
+    };
+
+    region_snapshot_t under_popup;
+    save_region(&snapshot_pool, &under_popup, popup, &background);
+
+    fill_rect(panel_handle, popup, LCD_PURPLE);
+    draw_aa_text(panel_handle, &font_sans_12, 70, 56, LCD_WHITE, LCD_PURPLE, "Popup", 5);
+    vTaskDelay(pdMS_TO_TICKS(1000));
+
+    // Dismissing it sends only the popup's area, nothing under it has to be drawn again.
+    restore_region(panel_handle, &snapshot_pool, &under_popup);
+
+    ESP_LOGI(TAG_DISPLAY, "Snapshots: %lu saved, %lu compressed, %llu pixel bytes kept in %llu bytes, high water %lu bytes",
+        (unsigned long)snapshot_pool.saved, (unsigned long)snapshot_pool.compressed,
+        (unsigned long long)snapshot_pool.pixel_bytes_saved, (unsigned long long)snapshot_pool.bytes_stored,
+        (unsigned long)snapshot_pool.high_water_bytes
+    );
+
+
+    // Example: Measuring transfer throughput. --------------------------------------
+
+    // The SPI clock, queue depth and max transfer size can be changed with setup_display_with_config(),
+    // compare the throughput of different settings with the transfer statistics.
+    transfer_stats_t transfer_stats;
+    get_transfer_stats(&transfer_stats);
+
+    if (transfer_stats.busy_us > 0)
+    {
+        ESP_LOGI(TAG_DISPLAY, "Transfers: %lu, pixel bytes: %llu, throughput: %llu kbit/s",
+            (unsigned long)transfer_stats.transfers, (unsigned long long)transfer_stats.pixel_bytes,
+            (unsigned long long)(transfer_stats.pixel_bytes * 8 * 1000 / transfer_stats.busy_us)
+        );
+    }
+
+    // The draw functions borrow their buffers from a small block pool, check it never ran dry.
+    pool_stats_t pool_stats;
+    get_pool_stats(&pool_stats);
+
+    ESP_LOGI(TAG_DISPLAY, "Pool blocks: %d, high water: %d, exhausted: %lu",
+        pool_stats.blocks, pool_stats.high_water, (unsigned long)pool_stats.exhausted
+    );
+
+#ifdef GRAPHICS_RECORDER
+    // Example: Recording draw calls. ---------------------------------------------
+
+    // Built with GRAPHICS_RECORDER, the latest draw calls can be dumped and replayed on a PC with
+    // tools/replay_draws.c. Logs share the UART, so they are off while the binary recording is written.
+    esp_log_level_set("*", ESP_LOG_NONE);
+    dump_draw_record(write_to_console, NULL);
+    fflush(stdout);
+    esp_log_level_set("*", ESP_LOG_INFO);
+#endif
+
+#ifdef GRAPHICS_TRACE
+    // Example: Tracing the draw pipeline. ----------------------------------------
+
+    // Built with GRAPHICS_TRACE, the time of every draw call is split into rasterizing, submitting, transfers in
+    // flight and waits. Save the JSON written here to a file and open it in https://ui.perfetto.dev.
+    esp_log_level_set("*", ESP_LOG_NONE);
+    dump_draw_trace(write_to_console, NULL);
+    fflush(stdout);
+    esp_log_level_set("*", ESP_LOG_INFO);
+#endif
 
 
     // Since this function is a task, delete it.
@@ -210,5 +449,6 @@ void app_main(void)
     // Since images can be quite big and fill static memory we need to allocate more memory, this can be done by creating a task.
     xTaskCreate(graphics_examples, "Graphic task", 16000, NULL, 1, NULL);
 
-    // It is probably possible to stream images from a remote server to the ESP and allocate these images as heap instead. 
+    // Images can also be streamed from a remote server with draw_image_stream() from graphics_stream.h,
+    // which draws them while they arrive without ever holding a whole image in memory.
 }
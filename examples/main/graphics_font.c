@@ -0,0 +1,684 @@
+#include "graphics_font.h"
+
+#ifndef GRAPHICS_HOST_BUILD
+#include "esp_partition.h"
+#endif
+
+
+// Blend table, the BGR color for every coverage value of a (text color, background color) pair.
+typedef struct {
+    uint16_t text_color;
+    uint16_t background_color;
+    uint8_t bpp;
+    uint8_t valid;
+    uint16_t colors[16];
+} blend_table_t;
+
+static blend_table_t blend_cache[AA_BLEND_CACHE_SIZE];
+static int blend_cache_next = 0;
+
+
+// Glyph cache slot, for fonts read through a reader callback.
+typedef struct {
+    const aa_font_t *font;
+    uint32_t glyph_index;
+    uint32_t last_used;
+    aa_glyph_t glyph;
+    uint8_t bitmap[AA_GLYPH_CACHE_SLOT_SIZE];
+} glyph_cache_slot_t;
+
+static glyph_cache_slot_t glyph_cache[AA_GLYPH_CACHE_SLOTS];
+static uint32_t glyph_cache_clock = 0;
+
+
+// Binary font blob header, see tools/make_font.py.
+typedef struct {
+    char magic[4];
+    uint8_t bpp;
+    uint8_t line_height;
+    uint8_t baseline;
+    uint8_t reserved_0;
+    uint16_t range_amount;
+    uint16_t glyph_amount;
+    uint32_t ranges_offset;
+    uint32_t glyphs_offset;
+    uint32_t bitmap_offset;
+    uint32_t bitmap_size;
+    uint8_t reserved_1[4];
+} aa_font_blob_header_t;
+
+_Static_assert(sizeof(aa_glyph_t) == 12, "aa_glyph_t must match the font blob glyph table.");
+_Static_assert(sizeof(aa_range_t) == 8, "aa_range_t must match the font blob range table.");
+_Static_assert(sizeof(aa_font_blob_header_t) == 32, "aa_font_blob_header_t must match the font blob header.");
+
+
+// Mixes a single color channel, coverage from 0 (background) to max_coverage (text).
+static uint16_t mix_channel(uint16_t text, uint16_t background, int coverage, int max_coverage)
+{
+    return (text * coverage + background * (max_coverage - coverage) + max_coverage / 2) / max_coverage;
+}
+
+
+// Returns the blend table for a color pair, computing it the first time the pair is used.
+static const uint16_t *get_blend_table(uint16_t text_color, uint16_t background_color, uint8_t bpp)
+{
+    for (int i = 0; i < AA_BLEND_CACHE_SIZE; ++i)
+    {
+        blend_table_t *table = &blend_cache[i];
+
+        if (table->valid && (table->bpp == bpp) && (table->text_color == text_color) && (table->background_color == background_color))
+        {
+            return table->colors;
+        }
+    }
+
+    // Replace the oldest table.
+    blend_table_t *table = &blend_cache[blend_cache_next];
+    blend_cache_next = (blend_cache_next + 1) % AA_BLEND_CACHE_SIZE;
+
+    table->text_color = text_color;
+    table->background_color = background_color;
+    table->bpp = bpp;
+    table->valid = 1;
+
+    int max_coverage = (1 << bpp) - 1;
+
+    for (int coverage = 0; coverage <= max_coverage; ++coverage)
+    {
+        uint16_t red = mix_channel(text_color >> 11, background_color >> 11, coverage, max_coverage);
+        uint16_t green = mix_channel((text_color >> 5) & 0x3F, (background_color >> 5) & 0x3F, coverage, max_coverage);
+        uint16_t blue = mix_channel(text_color & 0x1F, background_color & 0x1F, coverage, max_coverage);
+        uint16_t RGB_color = (red << 11) | (green << 5) | blue;
+
+        table->colors[coverage] = COLOR_SWAP(RGB_color);
+    }
+
+    return table->colors;
+}
+
+
+// Checks amount entries of entry_size bytes starting at offset fit in size bytes. Divides instead of adding up, so
+// offsets and amounts near the top of their range cannot wrap around.
+static int fits_in(size_t offset, size_t amount, size_t entry_size, size_t size)
+{
+    return (offset <= size) && (amount <= (size - offset) / entry_size);
+}
+
+
+// Checks two tables do not share bytes, empty tables share none.
+static int tables_overlap(uint32_t first_offset, uint32_t first_size, uint32_t second_offset, uint32_t second_size)
+{
+    return (first_size > 0) && (second_size > 0) && (first_offset < second_offset + second_size) && (second_offset < first_offset + first_size);
+}
+
+
+// Sanity checks shared by all font blob sources. The tables must fit in blob_size, behind the header and apart.
+static int check_font_blob_header(const aa_font_blob_header_t *header, size_t blob_size)
+{
+    if (memcmp(header->magic, AA_FONT_BLOB_MAGIC, 4) != 0)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Not a font blob.");
+        return DRAW_FAILURE;
+    }
+
+    if ( (header->bpp != 2) && (header->bpp != 4) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Anti-aliased fonts must be 2 or 4 bpp.");
+        return DRAW_FAILURE;
+    }
+
+    if ( !fits_in(header->ranges_offset, header->range_amount, sizeof(aa_range_t), blob_size) ||
+         !fits_in(header->glyphs_offset, header->glyph_amount, sizeof(aa_glyph_t), blob_size) ||
+         !fits_in(header->bitmap_offset, header->bitmap_size, 1, blob_size) ||
+         (header->ranges_offset % 4 != 0) || (header->glyphs_offset % 4 != 0) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Font blob tables are out of bounds or misaligned.");
+        return DRAW_FAILURE;
+    }
+
+    // In bounds, so the table ends below fit in 32 bits.
+    uint32_t ranges_size = header->range_amount * sizeof(aa_range_t);
+    uint32_t glyphs_size = header->glyph_amount * sizeof(aa_glyph_t);
+
+    if ( tables_overlap(0, sizeof(aa_font_blob_header_t), header->ranges_offset, ranges_size) ||
+         tables_overlap(0, sizeof(aa_font_blob_header_t), header->glyphs_offset, glyphs_size) ||
+         tables_overlap(0, sizeof(aa_font_blob_header_t), header->bitmap_offset, header->bitmap_size) ||
+         tables_overlap(header->ranges_offset, ranges_size, header->glyphs_offset, glyphs_size) ||
+         tables_overlap(header->ranges_offset, ranges_size, header->bitmap_offset, header->bitmap_size) ||
+         tables_overlap(header->glyphs_offset, glyphs_size, header->bitmap_offset, header->bitmap_size) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Font blob tables overlap.");
+        return DRAW_FAILURE;
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+// Checks the range table is sorted and only points at existing glyphs, so lookups never need to.
+static int check_font_ranges(const aa_range_t *ranges, uint16_t range_amount, uint16_t glyph_amount)
+{
+    for (int i = 0; i < range_amount; ++i)
+    {
+        if (ranges[i].first_glyph + ranges[i].length > glyph_amount)
+        {
+            ESP_LOGE(TAG_DISPLAY, "Font range %d points past the glyph table.", i);
+            return DRAW_FAILURE;
+        }
+
+        if ( (i > 0) && (ranges[i].first_code_point < ranges[i - 1].first_code_point + ranges[i - 1].length) )
+        {
+            ESP_LOGE(TAG_DISPLAY, "Font ranges are not sorted.");
+            return DRAW_FAILURE;
+        }
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+int load_aa_font_blob(aa_font_t *font, const void *blob, size_t blob_size)
+{
+    const aa_font_blob_header_t *header = (const aa_font_blob_header_t *)blob;
+
+    // Sanity checks.
+    if ( (blob == NULL) || (blob_size < sizeof(aa_font_blob_header_t)) || ((uintptr_t)blob % 4 != 0) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Font blob is NULL, too small or not 4 byte aligned.");
+        return DRAW_FAILURE;
+    }
+
+    if (check_font_blob_header(header, blob_size) != DRAW_SUCCESS)
+    {
+        return DRAW_FAILURE;
+    }
+
+    const uint8_t *blob_bytes = (const uint8_t *)blob;
+    const aa_glyph_t *glyphs = (const aa_glyph_t *)(blob_bytes + header->glyphs_offset);
+    const aa_range_t *ranges = (const aa_range_t *)(blob_bytes + header->ranges_offset);
+
+    if (check_font_ranges(ranges, header->range_amount, header->glyph_amount) != DRAW_SUCCESS)
+    {
+        return DRAW_FAILURE;
+    }
+
+    for (int i = 0; i < header->glyph_amount; ++i)
+    {
+        if (!fits_in(glyphs[i].bitmap_offset, ((glyphs[i].width * header->bpp + 7) / 8) * glyphs[i].height, 1, header->bitmap_size))
+        {
+            ESP_LOGE(TAG_DISPLAY, "Glyph %d points past the font bitmap.", i);
+            return DRAW_FAILURE;
+        }
+    }
+
+    memset(font, 0, sizeof(aa_font_t));
+    font->bpp = header->bpp;
+    font->line_height = header->line_height;
+    font->baseline = header->baseline;
+    font->first_char = header->range_amount > 0 ? ranges[0].first_code_point : 0;
+    font->glyph_amount = header->glyph_amount;
+    font->glyphs = glyphs;
+    font->bitmap = blob_bytes + header->bitmap_offset;
+    font->ranges = ranges;
+    font->range_amount = header->range_amount;
+
+    return DRAW_SUCCESS;
+}
+
+
+// Host builds have no partitions, see tools/host/graphics_host.h.
+#ifndef GRAPHICS_HOST_BUILD
+int load_aa_font_partition(aa_font_t *font, const char *partition_label)
+{
+    const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, partition_label);
+    if (partition == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Font partition %s not found.", partition_label);
+        return DRAW_FAILURE;
+    }
+
+    // Fonts are used until reset, so the mapping is never released.
+    const void *blob = NULL;
+    esp_partition_mmap_handle_t mmap_handle;
+    if (esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &blob, &mmap_handle) != ESP_OK)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Font partition %s could not be mapped.", partition_label);
+        return DRAW_FAILURE;
+    }
+
+    return load_aa_font_blob(font, blob, partition->size);
+}
+#endif
+
+
+int open_aa_font_reader(aa_font_t *font, aa_range_t *range_storage, uint16_t max_ranges, aa_font_reader_t reader, void *reader_ctx)
+{
+    aa_font_blob_header_t header;
+
+    if ( (reader == NULL) || (range_storage == NULL) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Font reader or range storage is a NULL pointer.");
+        return DRAW_FAILURE;
+    }
+
+    if (reader(reader_ctx, 0, &header, sizeof(header)) != 0)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Font blob header could not be read.");
+        return DRAW_FAILURE;
+    }
+
+    // The size is unknown, the reader fails on reads past the end instead. The tables must still fit in the 32 bit
+    // offsets of the reader, so reads cannot wrap around to the start of the blob.
+    if (check_font_blob_header(&header, UINT32_MAX) != DRAW_SUCCESS)
+    {
+        return DRAW_FAILURE;
+    }
+
+    if (header.range_amount > max_ranges)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Font has %d ranges, only room for %d.", header.range_amount, max_ranges);
+        return DRAW_FAILURE;
+    }
+
+    if ( (reader(reader_ctx, header.ranges_offset, range_storage, header.range_amount * sizeof(aa_range_t)) != 0) ||
+         (check_font_ranges(range_storage, header.range_amount, header.glyph_amount) != DRAW_SUCCESS) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Font range table could not be read.");
+        return DRAW_FAILURE;
+    }
+
+    memset(font, 0, sizeof(aa_font_t));
+    font->bpp = header.bpp;
+    font->line_height = header.line_height;
+    font->baseline = header.baseline;
+    font->first_char = header.range_amount > 0 ? range_storage[0].first_code_point : 0;
+    font->glyph_amount = header.glyph_amount;
+    font->ranges = range_storage;
+    font->range_amount = header.range_amount;
+    font->reader = reader;
+    font->reader_ctx = reader_ctx;
+    font->glyphs_offset = header.glyphs_offset;
+    font->bitmap_offset = header.bitmap_offset;
+    font->bitmap_size = header.bitmap_size;
+
+    // A font opened again at the same address must not use glyphs cached from the old one.
+    for (int i = 0; i < AA_GLYPH_CACHE_SLOTS; ++i)
+    {
+        if (glyph_cache[i].font == font)
+        {
+            glyph_cache[i].font = NULL;
+        }
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+uint32_t decode_utf8(const char **text, const char *text_end)
+{
+    const uint8_t *in = (const uint8_t *)*text;
+    int remaining = (const uint8_t *)text_end - in;
+    uint32_t code_point;
+    int length;
+
+    if (in[0] < 0x80)
+    {
+        *text += 1;
+        return in[0];
+    }
+    else if ((in[0] & 0xE0) == 0xC0)
+    {
+        code_point = in[0] & 0x1F;
+        length = 2;
+    }
+    else if ((in[0] & 0xF0) == 0xE0)
+    {
+        code_point = in[0] & 0x0F;
+        length = 3;
+    }
+    else if ((in[0] & 0xF8) == 0xF0)
+    {
+        code_point = in[0] & 0x07;
+        length = 4;
+    }
+    else
+    {
+        *text += 1;
+        return 0xFFFD;
+    }
+
+    if (remaining < length)
+    {
+        *text += 1;
+        return 0xFFFD;
+    }
+
+    for (int i = 1; i < length; ++i)
+    {
+        if ((in[i] & 0xC0) != 0x80)
+        {
+            *text += 1;
+            return 0xFFFD;
+        }
+        code_point = (code_point << 6) | (in[i] & 0x3F);
+    }
+
+    // Overlong encodings, surrogates and code points past Unicode are invalid.
+    static const uint32_t smallest[5] = { 0, 0, 0x80, 0x800, 0x10000 };
+    if ( (code_point < smallest[length]) || ( (code_point >= 0xD800) && (code_point <= 0xDFFF) ) || (code_point > 0x10FFFF) )
+    {
+        *text += 1;
+        return 0xFFFD;
+    }
+
+    *text += length;
+    return code_point;
+}
+
+
+// Returns the glyph index of a code point, or -1 if it is not in the font.
+static int find_glyph_index(const aa_font_t *font, uint32_t code_point)
+{
+    if (font->ranges == NULL)
+    {
+        uint32_t glyph_number = code_point - font->first_char;
+        return (code_point >= font->first_char) && (glyph_number < font->glyph_amount) ? (int)glyph_number : -1;
+    }
+
+    // Binary search the sorted ranges.
+    int low = 0;
+    int high = font->range_amount - 1;
+
+    while (low <= high)
+    {
+        int middle = (low + high) / 2;
+        const aa_range_t *range = &font->ranges[middle];
+
+        if (code_point < range->first_code_point)
+        {
+            high = middle - 1;
+        }
+        else if (code_point >= range->first_code_point + range->length)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            return range->first_glyph + (code_point - range->first_code_point);
+        }
+    }
+
+    return -1;
+}
+
+
+// Reads a glyph of a reader font into the glyph cache, replacing the least recently used slot.
+static glyph_cache_slot_t *read_cached_glyph(const aa_font_t *font, int glyph_index)
+{
+    glyph_cache_slot_t *slot = &glyph_cache[0];
+
+    glyph_cache_clock += 1;
+
+    for (int i = 0; i < AA_GLYPH_CACHE_SLOTS; ++i)
+    {
+        if ( (glyph_cache[i].font == font) && (glyph_cache[i].glyph_index == glyph_index) )
+        {
+            glyph_cache[i].last_used = glyph_cache_clock;
+            return &glyph_cache[i];
+        }
+
+        if (glyph_cache[i].last_used < slot->last_used)
+        {
+            slot = &glyph_cache[i];
+        }
+    }
+
+    slot->font = NULL;
+
+    if (font->reader(font->reader_ctx, font->glyphs_offset + glyph_index * sizeof(aa_glyph_t), &slot->glyph, sizeof(aa_glyph_t)) != 0)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Glyph %d could not be read.", glyph_index);
+        return NULL;
+    }
+
+    uint32_t bitmap_size = ((slot->glyph.width * font->bpp + 7) / 8) * slot->glyph.height;
+    if (bitmap_size > AA_GLYPH_CACHE_SLOT_SIZE)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Glyph %d is larger than a glyph cache slot.", glyph_index);
+        return NULL;
+    }
+
+    if (!fits_in(slot->glyph.bitmap_offset, bitmap_size, 1, font->bitmap_size))
+    {
+        ESP_LOGE(TAG_DISPLAY, "Glyph %d points past the font bitmap.", glyph_index);
+        return NULL;
+    }
+
+    if (font->reader(font->reader_ctx, font->bitmap_offset + slot->glyph.bitmap_offset, slot->bitmap, bitmap_size) != 0)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Glyph %d bitmap could not be read.", glyph_index);
+        return NULL;
+    }
+
+    slot->font = font;
+    slot->glyph_index = glyph_index;
+    slot->last_used = glyph_cache_clock;
+
+    return slot;
+}
+
+
+// Looks up the glyph and bitmap of a code point. The bitmap of a reader font is only valid until the next lookup.
+static int find_aa_glyph(const aa_font_t *font, uint32_t code_point, const aa_glyph_t **glyph, const uint8_t **bitmap)
+{
+    int glyph_index = find_glyph_index(font, code_point);
+    if (glyph_index < 0)
+    {
+        return DRAW_FAILURE;
+    }
+
+    if (font->reader != NULL)
+    {
+        glyph_cache_slot_t *slot = read_cached_glyph(font, glyph_index);
+        if (slot == NULL)
+        {
+            return DRAW_FAILURE;
+        }
+
+        *glyph = &slot->glyph;
+        *bitmap = slot->bitmap;
+        return DRAW_SUCCESS;
+    }
+
+    *glyph = &font->glyphs[glyph_index];
+    *bitmap = font->bitmap + (*glyph)->bitmap_offset;
+    return DRAW_SUCCESS;
+}
+
+
+int get_aa_text_width(const aa_font_t *font, const char *text_buffer, unsigned int buffer_size)
+{
+    const char *text = text_buffer;
+    const char *text_end = text_buffer + buffer_size;
+    const aa_glyph_t *glyph;
+    const uint8_t *bitmap;
+    int width = 0;
+
+    while (text < text_end)
+    {
+        if (find_aa_glyph(font, decode_utf8(&text, text_end), &glyph, &bitmap) == DRAW_SUCCESS)
+        {
+            width += glyph->advance;
+        }
+    }
+
+    return width;
+}
+
+
+// Renders the glyph lines falling inside a band, a single table lookup per pixel.
+static void render_aa_glyph(const aa_font_t *font, const aa_glyph_t *glyph, const uint8_t *bitmap, const uint16_t *blend_table, int pen_x,
+    int band_first_line, int band_lines, int band_width, uint16_t *band_buffer)
+{
+    int bytes_per_line = (glyph->width * font->bpp + 7) / 8;
+    uint8_t coverage_mask = (1 << font->bpp) - 1;
+
+    int first_line = band_first_line - glyph->y_offset;
+    int last_line = band_first_line + band_lines - glyph->y_offset;
+
+    if (first_line < 0)
+    {
+        first_line = 0;
+    }
+
+    if (last_line > glyph->height)
+    {
+        last_line = glyph->height;
+    }
+
+    for (int glyph_line = first_line; glyph_line < last_line; ++glyph_line)
+    {
+        const uint8_t *coverage_line = bitmap + glyph_line * bytes_per_line;
+        uint16_t *out = band_buffer + (glyph->y_offset + glyph_line - band_first_line) * band_width;
+
+        for (int glyph_x = 0; glyph_x < glyph->width; ++glyph_x)
+        {
+            int x = pen_x + glyph->x_offset + glyph_x;
+            int bit = glyph_x * font->bpp;
+            uint8_t coverage = (coverage_line[bit >> 3] >> (8 - font->bpp - (bit & 7))) & coverage_mask;
+
+            // The band is already filled with the background, overlapping glyphs must not erase each other.
+            if ( (coverage != 0) && (x >= 0) && (x < band_width) )
+            {
+                out[x] = blend_table[coverage];
+            }
+        }
+    }
+}
+
+
+void render_aa_text_span(const aa_font_t *font, uint16_t text_color, uint16_t background_color, const char *text_buffer,
+    unsigned int buffer_size, int text_line, int first_x, int width, uint16_t *span_buffer)
+{
+    if ( (font == NULL) || (text_buffer == NULL) || (text_line < 0) || (text_line >= font->line_height) )
+    {
+        return;
+    }
+
+    const uint16_t *blend_table = get_blend_table(text_color, background_color, font->bpp);
+    const char *text = text_buffer;
+    const char *text_end = text_buffer + buffer_size;
+    const aa_glyph_t *glyph;
+    const uint8_t *bitmap;
+    int pen_x = -first_x;
+
+    while ( (text < text_end) && (pen_x < width) )
+    {
+        if (find_aa_glyph(font, decode_utf8(&text, text_end), &glyph, &bitmap) == DRAW_SUCCESS)
+        {
+            // Glyphs left of the span only move the pen.
+            if (pen_x + glyph->x_offset + glyph->width > 0)
+            {
+                render_aa_glyph(font, glyph, bitmap, blend_table, pen_x, text_line, 1, width, span_buffer);
+            }
+            pen_x += glyph->advance;
+        }
+    }
+}
+
+
+int draw_aa_text(esp_lcd_panel_handle_t panel_handle, const aa_font_t *font, unsigned short start_x, unsigned short start_y,
+    uint16_t text_color, uint16_t background_color, const char *text_buffer, unsigned int buffer_size)
+{
+    // Sanity checks.
+    if ( (font == NULL) || (text_buffer == NULL) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot draw, font or text buffer is a NULL pointer.");
+        return DRAW_FAILURE;
+    }
+
+    if ( (font->bpp != 2) && (font->bpp != 4) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Anti-aliased fonts must be 2 or 4 bpp.");
+        return DRAW_FAILURE;
+    }
+
+    if ( (start_x >= SCREEN_WIDTH) || (start_y >= SCREEN_HEIGHT) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Draw starting position out of bounds.");
+        return DRAW_FAILURE;
+    }
+
+    // Clip the line to the screen.
+    int width = get_aa_text_width(font, text_buffer, buffer_size);
+    int height = font->line_height;
+
+    if (start_x + width > SCREEN_WIDTH)
+    {
+        width = SCREEN_WIDTH - start_x;
+    }
+
+    if (start_y + height > SCREEN_HEIGHT)
+    {
+        height = SCREEN_HEIGHT - start_y;
+    }
+
+    // Nothing to draw.
+    if (width == 0)
+    {
+        return DRAW_SUCCESS;
+    }
+
+    const uint16_t *blend_table = get_blend_table(text_color, background_color, font->bpp);
+
+    uint16_t *band_buffer = pool_borrow();
+    if (band_buffer == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for drawing text.");
+        return DRAW_FAILURE;
+    }
+
+    int result = DRAW_SUCCESS;
+    int band_lines = POOL_BLOCK_PIXELS / width;
+
+    draw_t band = {
+        .draw_start_x = start_x,
+        .image_size_x = width,
+        .scale_x = 1,
+        .scale_y = 1,
+    };
+
+    for (int line = 0; line < height; line += band_lines)
+    {
+        int lines = height - line < band_lines ? height - line : band_lines;
+
+        for (int i = 0; i < width * lines; ++i)
+        {
+            band_buffer[i] = blend_table[0];
+        }
+
+        const char *text = text_buffer;
+        const char *text_end = text_buffer + buffer_size;
+        const aa_glyph_t *glyph;
+        const uint8_t *bitmap;
+        int pen_x = 0;
+
+        while ( (text < text_end) && (pen_x < width) )
+        {
+            if (find_aa_glyph(font, decode_utf8(&text, text_end), &glyph, &bitmap) == DRAW_SUCCESS)
+            {
+                render_aa_glyph(font, glyph, bitmap, blend_table, pen_x, line, lines, width, band_buffer);
+                pen_x += glyph->advance;
+            }
+        }
+
+        band.draw_start_y = start_y + line;
+        band.image_size_y = lines;
+
+        result |= draw_bgr_image(panel_handle, band, band_buffer);
+    }
+
+    pool_return(band_buffer);
+
+    return result;
+}
@@ -0,0 +1,1418 @@
+/* Anti-aliased fonts for graphics_font.h, generated by tools/make_font.py.
+
+   Rendered from the DejaVu fonts. Bitstream Vera Fonts Copyright (c) 2003 by Bitstream, Inc.
+   All Rights Reserved. Bitstream Vera is a trademark of Bitstream, Inc. DejaVu changes are in public domain.
+*/
+#include "graphics_font.h"
+
+// DejaVuSans.ttf 12px, 2 bpp, characters 32-126,160-255. Generated by tools/make_font.py.
+static const uint8_t font_sans_12_bitmap[] = 
+{
+    0x70,0x70,0x70,0x70,0x30,0x30,0x00,0x70,0x70,0xC9,0xC9,0xC9,0x00,0xC6,0x00,0x00,
+    0x85,0x00,0x1F,0xFF,0xC0,0x02,0x4C,0x00,0x03,0x18,0x00,0x3F,0xFF,0x40,0x06,0x24,
+    0x00,0x09,0x30,0x00,0x08,0x00,0x6F,0x40,0xD9,0x80,0xC8,0x00,0x69,0x00,0x0A,0xC0,
+    0x08,0xA0,0x99,0x90,0x6F,0x80,0x08,0x00,0x08,0x00,0x2E,0x01,0x80,0x32,0x82,0x00,
+    0x61,0x89,0x00,0x72,0x98,0x00,0x2E,0x25,0xE0,0x00,0x63,0x28,0x00,0x86,0x18,0x02,
+    0x43,0x28,0x06,0x01,0xE0,0x07,0xD0,0x00,0x0D,0x20,0x00,0x0C,0x00,0x00,0x0E,0x00,
+    0x00,0x26,0x82,0x40,0x30,0xA3,0x40,0x70,0x2E,0x00,0x38,0x1E,0x00,0x0B,0xE6,0x80,
+    0xC0,0xC0,0xC0,0x14,0x30,0x60,0x90,0xD0,0xD0,0xD0,0x90,0x60,0x30,0x14,0x90,0x60,
+    0x30,0x24,0x28,0x28,0x28,0x24,0x30,0x60,0x90,0x05,0x00,0x55,0x50,0x1A,0x40,0x1A,
+    0x40,0x55,0x50,0x05,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0xBF,0xFE,0x01,0x80,0x01,
+    0x80,0x01,0x80,0x28,0x24,0x30,0x7E,0xA0,0xA0,0x03,0x06,0x09,0x0C,0x18,0x24,0x30,
+    0x60,0x90,0xC0,0x0B,0xD0,0x28,0x74,0x34,0x28,0x30,0x18,0x70,0x18,0x30,0x18,0x34,
+    0x28,0x28,0x74,0x0B,0xD0,0xBE,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,0x00,0x0A,
+    0x00,0x0A,0x00,0x0A,0x00,0xBF,0xE0,0x1B,0x90,0x24,0x70,0x00,0x34,0x00,0x34,0x00,
+    0xA0,0x02,0x80,0x0A,0x00,0x28,0x00,0x3F,0xF4,0x1B,0xD0,0x24,0x74,0x00,0x24,0x00,
+    0x74,0x0B,0xD0,0x00,0x74,0x00,0x28,0x20,0x74,0x1B,0xD0,0x00,0xE0,0x02,0xA0,0x06,
+    0x60,0x0C,0x60,0x24,0x60,0x60,0x60,0x7F,0xFC,0x00,0x60,0x00,0x60,0x2F,0xF0,0x24,
+    0x00,0x24,0x00,0x2F,0x90,0x00,0x74,0x00,0x28,0x00,0x28,0x20,0x74,0x1F,0x90,0x07,
+    0xE0,0x1D,0x14,0x24,0x00,0x37,0xE0,0x38,0x28,0x34,0x18,0x34,0x18,0x28,0x24,0x0B,
+    0xE0,0x3F,0xF8,0x00,0x34,0x00,0x70,0x00,0x90,0x00,0xC0,0x01,0x80,0x03,0x40,0x07,
+    0x00,0x0A,0x00,0x0B,0xE0,0x28,0x34,0x34,0x28,0x28,0x34,0x0F,0xE0,0x34,0x24,0x30,
+    0x18,0x34,0x28,0x1B,0xE0,0x0B,0xD0,0x38,0x74,0x70,0x28,0x70,0x28,0x38,0x78,0x1B,
+    0xA8,0x00,0x24,0x14,0x70,0x1B,0x80,0xA0,0xA0,0x00,0x00,0xA0,0xA0,0x28,0x28,0x00,
+    0x00,0x28,0x24,0x30,0x00,0x1A,0x06,0xE4,0x79,0x00,0x79,0x00,0x06,0xE4,0x00,0x1A,
+    0xBF,0xFE,0x00,0x00,0xBF,0xFE,0xA4,0x00,0x1B,0x90,0x00,0x6D,0x00,0x6D,0x1B,0x90,
+    0xA4,0x00,0x1F,0x80,0x20,0xD0,0x00,0x90,0x02,0x80,0x06,0x00,0x09,0x00,0x00,0x00,
+    0x09,0x00,0x09,0x00,0x01,0xBE,0x40,0x0A,0x41,0xA0,0x18,0x00,0x28,0x20,0xBE,0x8C,
+    0x21,0x82,0x88,0x61,0x81,0x88,0x21,0x82,0x98,0x20,0xBA,0xE0,0x18,0x00,0x00,0x0A,
+    0x41,0x90,0x01,0xBE,0x40,0x02,0xC0,0x00,0x03,0xD0,0x00,0x06,0x60,0x00,0x0D,0x30,
+    0x00,0x1C,0x24,0x00,0x28,0x18,0x00,0x3F,0xFD,0x00,0x70,0x0A,0x00,0xA0,0x07,0x00,
+    0xBF,0x90,0x90,0xA0,0x90,0x70,0x90,0xA0,0xBF,0xD0,0x90,0x70,0x90,0x34,0x90,0x74,
+    0xBF,0xD0,0x06,0xF8,0x1D,0x06,0x34,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x34,0x00,
+    0x1D,0x06,0x06,0xF8,0xBF,0x90,0x90,0x78,0x90,0x1D,0x90,0x0D,0x90,0x0A,0x90,0x0D,
+    0x90,0x1D,0x90,0x78,0xBF,0x90,0xBF,0xE0,0x90,0x00,0x90,0x00,0x90,0x00,0xBF,0xE0,
+    0x90,0x00,0x90,0x00,0x90,0x00,0xBF,0xE0,0xBF,0xD0,0x90,0x00,0x90,0x00,0x90,0x00,
+    0xBF,0x80,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x06,0xF9,0x00,0x1D,0x06,0x00,
+    0x34,0x00,0x00,0x70,0x00,0x00,0x70,0x2F,0x40,0x70,0x03,0x40,0x34,0x03,0x40,0x1D,
+    0x07,0x40,0x06,0xF9,0x00,0x90,0x1C,0x90,0x1C,0x90,0x1C,0x90,0x1C,0xBF,0xFC,0x90,
+    0x1C,0x90,0x1C,0x90,0x1C,0x90,0x1C,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,
+    0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x0D,0x1C,0xB4,0x90,0x74,0x91,0xD0,0x97,
+    0x40,0xAD,0x00,0xB8,0x00,0x9A,0x00,0x92,0x80,0x90,0xA0,0x90,0x38,0x90,0x00,0x90,
+    0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0xBF,0xE0,0xB0,
+    0x0B,0x40,0xB8,0x0F,0x40,0x9C,0x27,0x40,0x99,0x33,0x40,0x96,0x63,0x40,0x93,0x93,
+    0x40,0x92,0xC3,0x40,0x90,0x03,0x40,0x90,0x03,0x40,0xB0,0x18,0xB8,0x18,0x9C,0x18,
+    0x9A,0x18,0x93,0x18,0x92,0x98,0x90,0xD8,0x90,0xB8,0x90,0x38,0x06,0xF8,0x00,0x1D,
+    0x0A,0x00,0x34,0x03,0x40,0x70,0x02,0x80,0x70,0x02,0x80,0x70,0x02,0x80,0x34,0x03,
+    0x40,0x1D,0x0A,0x00,0x06,0xF8,0x00,0xBF,0x80,0x90,0xA0,0x90,0x60,0x90,0xA0,0xBF,
+    0x80,0x90,0x00,0x90,0x00,0x90,0x00,0x90,0x00,0x06,0xF8,0x00,0x1D,0x0A,0x00,0x34,
+    0x03,0x40,0x70,0x02,0x80,0x70,0x02,0x80,0x70,0x02,0x80,0x34,0x03,0x40,0x1D,0x0A,
+    0x00,0x06,0xF8,0x00,0x00,0x1C,0x00,0x00,0x0A,0x00,0xBF,0x80,0x90,0xA0,0x90,0x60,
+    0x90,0xA0,0xBF,0x80,0x91,0xD0,0x90,0x60,0x90,0x34,0x90,0x28,0x1B,0xE0,0x34,0x14,
+    0x30,0x00,0x38,0x00,0x0B,0xE0,0x00,0x28,0x00,0x1C,0x24,0x28,0x1B,0xE0,0x3F,0xFF,
+    0x40,0x00,0xD0,0x00,0x00,0xD0,0x00,0x00,0xD0,0x00,0x00,0xD0,0x00,0x00,0xD0,0x00,
+    0x00,0xD0,0x00,0x00,0xD0,0x00,0x00,0xD0,0x00,0xD0,0x18,0xD0,0x18,0xD0,0x18,0xD0,
+    0x18,0xD0,0x18,0xD0,0x18,0x90,0x28,0x74,0x74,0x1F,0x90,0xA0,0x07,0x00,0x70,0x0A,
+    0x00,0x34,0x0D,0x00,0x28,0x18,0x00,0x1C,0x24,0x00,0x0D,0x30,0x00,0x06,0x60,0x00,
+    0x03,0xD0,0x00,0x02,0xC0,0x00,0x60,0x38,0x0D,0x70,0x3C,0x0C,0x34,0x69,0x1C,0x24,
+    0x99,0x28,0x28,0x86,0x24,0x1C,0xC3,0x30,0x0D,0x82,0x70,0x0B,0x42,0xE0,0x0B,0x41,
+    0xD0,0x34,0x0D,0x1C,0x28,0x0A,0x70,0x03,0xD0,0x02,0xC0,0x07,0xA0,0x0D,0x34,0x28,
+    0x1C,0x70,0x0A,0xA0,0x1C,0x34,0x34,0x1C,0xA0,0x0A,0xC0,0x03,0x40,0x03,0x40,0x03,
+    0x40,0x03,0x40,0x03,0x40,0x7F,0xFE,0x00,0x1C,0x00,0x34,0x00,0xE0,0x02,0x80,0x07,
+    0x00,0x1D,0x00,0x34,0x00,0x7F,0xFE,0xF8,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0xC0,0xF8,0xC0,0x90,0x60,0x30,0x24,0x18,0x0C,0x09,0x06,0x03,0xB8,0x18,0x18,0x18,
+    0x18,0x18,0x18,0x18,0x18,0x18,0xB8,0x07,0xD0,0x1D,0x74,0x64,0x09,0x3F,0xFC,0xA0,
+    0x24,0x2F,0x90,0x00,0x70,0x00,0x30,0x1F,0xF4,0x34,0x34,0x70,0x74,0x2F,0xA4,0xD0,
+    0x00,0xD0,0x00,0xD0,0x00,0xDF,0x80,0xE0,0x90,0xD0,0x70,0xD0,0x70,0xD0,0x70,0xE0,
+    0x90,0xDF,0x80,0x0B,0xD0,0x28,0x20,0x70,0x00,0x60,0x00,0x70,0x00,0x28,0x20,0x0B,
+    0xD0,0x00,0x28,0x00,0x28,0x00,0x28,0x0B,0xA8,0x38,0x78,0x70,0x28,0x60,0x28,0x70,
+    0x28,0x38,0x78,0x1B,0xA8,0x0B,0xD0,0x28,0x34,0x70,0x18,0x7F,0xF8,0x70,0x00,0x28,
+    0x14,0x0B,0xE0,0x0B,0x40,0x28,0x00,0x24,0x00,0xBF,0x40,0x24,0x00,0x24,0x00,0x24,
+    0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x1B,0xA8,0x34,0x78,0x70,0x28,0x60,0x28,0x70,
+    0x28,0x34,0x78,0x1B,0xA8,0x00,0x24,0x14,0x70,0x0B,0x90,0xD0,0x00,0xD0,0x00,0xD0,
+    0x00,0xDF,0x80,0xE0,0xD0,0xD0,0xA0,0xD0,0x60,0xD0,0x60,0xD0,0x60,0xD0,0x60,0xD0,
+    0x00,0xD0,0xD0,0xD0,0xD0,0xD0,0xD0,0xD0,0x0D,0x00,0x0D,0x0D,0x0D,0x0D,0x0D,0x0D,
+    0x0D,0x0D,0x0C,0x78,0xD0,0x00,0xD0,0x00,0xD0,0x00,0xD1,0xD0,0xD7,0x40,0xDD,0x00,
+    0xF8,0x00,0xDD,0x00,0xD3,0x40,0xD0,0xD0,0xD0,0xD0,0xD0,0xD0,0xD0,0xD0,0xD0,0xD0,
+    0xD0,0xD0,0xEF,0x9B,0x80,0xE0,0xF4,0x90,0xD0,0x90,0x60,0xD0,0x90,0x60,0xD0,0x90,
+    0x60,0xD0,0x90,0x60,0xD0,0x90,0x60,0xDF,0x80,0xE0,0xD0,0xD0,0xA0,0xD0,0x60,0xD0,
+    0x60,0xD0,0x60,0xD0,0x60,0x0B,0xD0,0x38,0x74,0x70,0x28,0x60,0x18,0x70,0x28,0x38,
+    0x74,0x0B,0xD0,0xDF,0x80,0xE0,0x90,0xD0,0x70,0xD0,0x70,0xD0,0x70,0xE0,0x90,0xDF,
+    0x80,0xD0,0x00,0xD0,0x00,0xD0,0x00,0x0B,0xA8,0x38,0x78,0x70,0x28,0x60,0x28,0x70,
+    0x28,0x38,0x78,0x1B,0xA8,0x00,0x28,0x00,0x28,0x00,0x28,0xDB,0xE0,0xD0,0xD0,0xD0,
+    0xD0,0xD0,0x2F,0x80,0x70,0x50,0x70,0x00,0x1A,0x40,0x00,0xA0,0x50,0xA0,0x2F,0x80,
+    0x34,0x00,0x34,0x00,0xBF,0x40,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x24,0x00,
+    0x1F,0x40,0xC0,0xA0,0xC0,0xA0,0xC0,0xA0,0xC0,0xA0,0xC0,0xA0,0xA1,0xE0,0x6E,0xA0,
+    0x60,0x28,0x30,0x34,0x24,0x70,0x18,0xA0,0x0C,0xC0,0x0A,0x80,0x07,0x40,0x60,0xE0,
+    0xD0,0x30,0xF0,0xC0,0x35,0xA1,0x80,0x26,0x66,0x40,0x1A,0x1B,0x40,0x0F,0x0F,0x00,
+    0x0E,0x0A,0x00,0x34,0x34,0x1C,0xA0,0x0A,0x80,0x07,0x40,0x0E,0xC0,0x28,0xA0,0x70,
+    0x34,0x60,0x28,0x30,0x34,0x24,0x70,0x18,0x90,0x0D,0xC0,0x0B,0x80,0x03,0x40,0x07,
+    0x00,0x0A,0x00,0x3C,0x00,0x7F,0xE0,0x00,0x90,0x02,0x80,0x06,0x00,0x1C,0x00,0x34,
+    0x00,0x7F,0xE0,0x06,0xC0,0x0A,0x00,0x09,0x00,0x09,0x00,0x0D,0x00,0xB8,0x00,0x0D,
+    0x00,0x09,0x00,0x09,0x00,0x0A,0x00,0x07,0xC0,0x60,0x60,0x60,0x60,0x60,0x60,0x60,
+    0x60,0x60,0x60,0x60,0x60,0x78,0x00,0x0D,0x00,0x09,0x00,0x09,0x00,0x0A,0x00,0x07,
+    0xC0,0x0A,0x00,0x09,0x00,0x09,0x00,0x0D,0x00,0x78,0x00,0x00,0x00,0x6E,0x46,0x51,
+    0xB9,0x70,0x70,0x00,0x30,0x30,0x70,0x70,0x70,0x70,0x02,0x00,0x02,0x00,0x1F,0x80,
+    0x76,0x50,0xD2,0x00,0xD2,0x00,0xD2,0x00,0x76,0x50,0x1F,0x80,0x02,0x00,0x02,0x00,
+    0x02,0xE0,0x0A,0x14,0x09,0x00,0x0D,0x00,0x3F,0xE0,0x0D,0x00,0x0D,0x00,0x0D,0x00,
+    0x7F,0xF8,0x60,0x08,0x2B,0xE4,0x18,0x70,0x24,0x24,0x18,0x70,0x2B,0xE8,0x60,0x08,
+    0x70,0x18,0x24,0x24,0x0C,0x60,0x7E,0xF8,0x03,0x80,0x7F,0xF8,0x02,0x40,0x02,0x40,
+    0x02,0x40,0x60,0x60,0x60,0x60,0x00,0x00,0x60,0x60,0x60,0x60,0x1F,0xC0,0x34,0x00,
+    0x28,0x00,0x27,0x40,0x60,0xD0,0x74,0x90,0x1E,0x80,0x02,0x80,0x01,0xC0,0x3F,0x40,
+    0x96,0x06,0xF9,0x00,0x19,0x06,0x40,0x22,0xF8,0x80,0x56,0x00,0x50,0x59,0x00,0x50,
+    0x56,0x00,0x50,0x22,0xF8,0x80,0x1D,0x07,0x40,0x06,0xF9,0x00,0x3F,0x40,0x01,0x80,
+    0x2F,0x80,0x61,0x80,0x2D,0x80,0x00,0x00,0x7F,0xC0,0x01,0x14,0x19,0xA0,0x35,0x80,
+    0x19,0xA0,0x01,0x14,0xBF,0xFE,0x00,0x06,0x00,0x06,0x7E,0x06,0xF9,0x00,0x19,0x06,
+    0x40,0x22,0xF4,0x80,0x52,0x1C,0x50,0x52,0xF4,0x50,0x52,0x24,0x50,0x22,0x0D,0x80,
+    0x1D,0x07,0x40,0x06,0xF9,0x00,0xBE,0x7D,0x96,0x86,0x7D,0x01,0x80,0x01,0x80,0xBF,
+    0xFE,0x01,0x80,0x01,0x80,0x00,0x00,0xBF,0xFE,0x7E,0x00,0x03,0x00,0x05,0x00,0x24,
+    0x00,0x7F,0x00,0x7E,0x00,0x03,0x00,0x1E,0x00,0x03,0x00,0x7E,0x00,0x28,0x60,0xC0,
+    0xA0,0xC0,0xA0,0xC0,0xA0,0xC0,0xA0,0xC0,0xA0,0xE1,0xE0,0xEE,0x74,0xC0,0x00,0xC0,
+    0x00,0xC0,0x00,0x0B,0xF4,0x2F,0x54,0x3F,0x54,0x3F,0x54,0x1F,0x54,0x01,0x54,0x01,
+    0x54,0x01,0x54,0x01,0x54,0x01,0x54,0xA0,0xA0,0x08,0x7C,0x7C,0x00,0x0C,0x00,0x0C,
+    0x00,0x0C,0x00,0x3F,0x00,0x2F,0x40,0x61,0xC0,0x60,0xC0,0x61,0xC0,0x2F,0x40,0x00,
+    0x00,0x7F,0xC0,0x85,0x00,0x66,0x40,0x18,0xD0,0x66,0x40,0x85,0x00,0x7C,0x01,0x80,
+    0x0C,0x02,0x00,0x0C,0x05,0x00,0x0C,0x08,0x00,0x3F,0x24,0x24,0x00,0x60,0x54,0x00,
+    0x81,0x54,0x01,0x42,0xFD,0x02,0x00,0x14,0x7C,0x01,0x80,0x0C,0x02,0x00,0x0C,0x05,
+    0x00,0x0C,0x08,0x00,0x3F,0x26,0xF4,0x00,0x60,0x18,0x00,0x80,0x20,0x01,0x40,0x80,
+    0x02,0x02,0xFC,0x7E,0x01,0x80,0x03,0x02,0x00,0x1E,0x05,0x00,0x03,0x08,0x00,0x7E,
+    0x24,0x24,0x00,0x60,0x54,0x00,0x81,0x54,0x01,0x42,0xFD,0x02,0x00,0x14,0x03,0x00,
+    0x03,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x0A,0x00,0x28,0x00,0x30,0x00,0x34,0x50,
+    0x1F,0x80,0x03,0x00,0x00,0x01,0x80,0x00,0x02,0xC0,0x00,0x03,0xD0,0x00,0x06,0x60,
+    0x00,0x0D,0x30,0x00,0x1C,0x24,0x00,0x28,0x18,0x00,0x3F,0xFD,0x00,0x70,0x0A,0x00,
+    0xA0,0x07,0x00,0x00,0x90,0x00,0x01,0x80,0x00,0x02,0xC0,0x00,0x03,0xD0,0x00,0x06,
+    0x60,0x00,0x0D,0x30,0x00,0x1C,0x24,0x00,0x28,0x18,0x00,0x3F,0xFD,0x00,0x70,0x0A,
+    0x00,0xA0,0x07,0x00,0x02,0x80,0x00,0x06,0x60,0x00,0x02,0xC0,0x00,0x03,0xD0,0x00,
+    0x06,0x60,0x00,0x0D,0x30,0x00,0x1C,0x24,0x00,0x28,0x18,0x00,0x3F,0xFD,0x00,0x70,
+    0x0A,0x00,0xA0,0x07,0x00,0x07,0x60,0x00,0x09,0xA0,0x00,0x02,0xC0,0x00,0x03,0xD0,
+    0x00,0x06,0x60,0x00,0x0D,0x30,0x00,0x1C,0x24,0x00,0x28,0x18,0x00,0x3F,0xFD,0x00,
+    0x70,0x0A,0x00,0xA0,0x07,0x00,0x0A,0x70,0x00,0x00,0x00,0x00,0x02,0xC0,0x00,0x03,
+    0xD0,0x00,0x06,0x60,0x00,0x0D,0x30,0x00,0x1C,0x24,0x00,0x28,0x18,0x00,0x3F,0xFD,
+    0x00,0x70,0x0A,0x00,0xA0,0x07,0x00,0x02,0xD0,0x00,0x05,0x60,0x00,0x05,0x60,0x00,
+    0x03,0xC0,0x00,0x03,0x90,0x00,0x0A,0x60,0x00,0x0D,0x30,0x00,0x1C,0x24,0x00,0x28,
+    0x18,0x00,0x3F,0xFD,0x00,0x70,0x0A,0x00,0xA0,0x07,0x00,0x02,0xFF,0xF8,0x03,0x64,
+    0x00,0x07,0x24,0x00,0x0A,0x24,0x00,0x0D,0x2F,0xF8,0x28,0x24,0x00,0x3F,0xF4,0x00,
+    0x70,0x24,0x00,0x90,0x2F,0xFC,0x06,0xF8,0x1D,0x06,0x34,0x00,0x70,0x00,0x70,0x00,
+    0x70,0x00,0x34,0x00,0x1D,0x06,0x06,0xF8,0x00,0x20,0x01,0xE0,0x18,0x00,0x09,0x00,
+    0xBF,0xE0,0x90,0x00,0x90,0x00,0x90,0x00,0xBF,0xE0,0x90,0x00,0x90,0x00,0x90,0x00,
+    0xBF,0xE0,0x03,0x00,0x09,0x00,0xBF,0xE0,0x90,0x00,0x90,0x00,0x90,0x00,0xBF,0xE0,
+    0x90,0x00,0x90,0x00,0x90,0x00,0xBF,0xE0,0x0A,0x00,0x25,0x40,0xBF,0xE0,0x90,0x00,
+    0x90,0x00,0x90,0x00,0xBF,0xE0,0x90,0x00,0x90,0x00,0x90,0x00,0xBF,0xE0,0x26,0x80,
+    0x00,0x00,0xBF,0xE0,0x90,0x00,0x90,0x00,0x90,0x00,0xBF,0xE0,0x90,0x00,0x90,0x00,
+    0x90,0x00,0xBF,0xE0,0x60,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x60,
+    0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x90,0x38,0x99,0x24,0x24,0x24,0x24,
+    0x24,0x24,0x24,0x24,0x24,0xDA,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,
+    0x2F,0xE4,0x00,0x24,0x1E,0x00,0x24,0x03,0x40,0x24,0x02,0x80,0xFF,0x42,0x80,0x24,
+    0x02,0x80,0x24,0x03,0x40,0x24,0x1E,0x00,0x2F,0xE4,0x00,0x0E,0x50,0x16,0xC0,0xB0,
+    0x18,0xB8,0x18,0x9C,0x18,0x9A,0x18,0x93,0x18,0x92,0x98,0x90,0xD8,0x90,0xB8,0x90,
+    0x38,0x01,0x80,0x00,0x00,0x90,0x00,0x06,0xF8,0x00,0x1D,0x0A,0x00,0x34,0x03,0x40,
+    0x70,0x02,0x80,0x70,0x02,0x80,0x70,0x02,0x80,0x34,0x03,0x40,0x1D,0x0A,0x00,0x06,
+    0xF8,0x00,0x00,0x60,0x00,0x00,0x80,0x00,0x06,0xF8,0x00,0x1D,0x0A,0x00,0x34,0x03,
+    0x40,0x70,0x02,0x80,0x70,0x02,0x80,0x70,0x02,0x80,0x34,0x03,0x40,0x1D,0x0A,0x00,
+    0x06,0xF8,0x00,0x00,0xE0,0x00,0x02,0x24,0x00,0x06,0xF8,0x00,0x1D,0x0A,0x00,0x34,
+    0x03,0x40,0x70,0x02,0x80,0x70,0x02,0x80,0x70,0x02,0x80,0x34,0x03,0x40,0x1D,0x0A,
+    0x00,0x06,0xF8,0x00,0x02,0x98,0x00,0x02,0x74,0x00,0x06,0xF8,0x00,0x1D,0x0A,0x00,
+    0x34,0x03,0x40,0x70,0x02,0x80,0x70,0x02,0x80,0x70,0x02,0x80,0x34,0x03,0x40,0x1D,
+    0x0A,0x00,0x06,0xF8,0x00,0x03,0x64,0x00,0x00,0x00,0x00,0x06,0xF8,0x00,0x1D,0x0A,
+    0x00,0x34,0x03,0x40,0x70,0x02,0x80,0x70,0x02,0x80,0x70,0x02,0x80,0x34,0x03,0x40,
+    0x1D,0x0A,0x00,0x06,0xF8,0x00,0x20,0x09,0x28,0x28,0x0A,0xA0,0x03,0xC0,0x0A,0xA0,
+    0x28,0x28,0x20,0x09,0x00,0x00,0x00,0x06,0xF9,0x80,0x1D,0x0B,0x00,0x34,0x0B,0x40,
+    0x70,0x26,0x80,0x70,0x91,0x80,0x72,0x42,0x80,0x3A,0x03,0x40,0x2D,0x0A,0x00,0x26,
+    0xF8,0x00,0x00,0x00,0x00,0x09,0x00,0x02,0x00,0xD0,0x18,0xD0,0x18,0xD0,0x18,0xD0,
+    0x18,0xD0,0x18,0xD0,0x18,0x90,0x28,0x74,0x74,0x1F,0x90,0x02,0x40,0x02,0x00,0xD0,
+    0x18,0xD0,0x18,0xD0,0x18,0xD0,0x18,0xD0,0x18,0xD0,0x18,0x90,0x28,0x74,0x74,0x1F,
+    0x90,0x07,0x40,0x08,0x80,0xD0,0x18,0xD0,0x18,0xD0,0x18,0xD0,0x18,0xD0,0x18,0xD0,
+    0x18,0x90,0x28,0x74,0x74,0x1F,0x90,0x1C,0xC0,0x00,0x00,0xD0,0x18,0xD0,0x18,0xD0,
+    0x18,0xD0,0x18,0xD0,0x18,0xD0,0x18,0x90,0x28,0x74,0x74,0x1F,0x90,0x01,0x80,0x02,
+    0x00,0xA0,0x1C,0x34,0x34,0x1C,0xA0,0x0A,0xC0,0x03,0x40,0x03,0x40,0x03,0x40,0x03,
+    0x40,0x03,0x40,0x90,0x00,0xBF,0x80,0x90,0xA0,0x90,0x60,0x90,0xA0,0xBF,0x80,0x90,
+    0x00,0x90,0x00,0x90,0x00,0x2F,0x40,0xA1,0xC0,0xD1,0xD0,0xD6,0x00,0xD9,0x00,0xD7,
+    0x40,0xD1,0xD0,0xD0,0x70,0xD0,0x70,0xDF,0xD0,0x08,0x00,0x06,0x00,0x00,0x00,0x2F,
+    0x90,0x00,0x70,0x00,0x30,0x1F,0xF4,0x34,0x34,0x70,0x74,0x2F,0xA4,0x00,0x80,0x02,
+    0x00,0x00,0x00,0x2F,0x90,0x00,0x70,0x00,0x30,0x1F,0xF4,0x34,0x34,0x70,0x74,0x2F,
+    0xA4,0x07,0x40,0x08,0x80,0x00,0x00,0x2F,0x90,0x00,0x70,0x00,0x30,0x1F,0xF4,0x34,
+    0x34,0x70,0x74,0x2F,0xA4,0x0D,0x50,0x16,0xC0,0x2F,0x90,0x00,0x70,0x00,0x30,0x1F,
+    0xF4,0x34,0x34,0x70,0x74,0x2F,0xA4,0x1C,0xD0,0x00,0x00,0x2F,0x90,0x00,0x70,0x00,
+    0x30,0x1F,0xF4,0x34,0x34,0x70,0x74,0x2F,0xA4,0x07,0x40,0x08,0x80,0x08,0x80,0x07,
+    0x40,0x00,0x00,0x2F,0x90,0x00,0x70,0x00,0x30,0x1F,0xF4,0x34,0x34,0x70,0x74,0x2F,
+    0xA4,0x2F,0xD7,0xE0,0x00,0x7D,0x28,0x00,0x34,0x0C,0x1F,0xFF,0xFC,0x34,0x34,0x00,
+    0x70,0xB9,0x18,0x2F,0x9B,0xE4,0x0B,0xD0,0x28,0x20,0x70,0x00,0x60,0x00,0x70,0x00,
+    0x28,0x20,0x0B,0xD0,0x00,0x80,0x07,0x80,0x09,0x00,0x02,0x40,0x00,0x00,0x0B,0xD0,
+    0x28,0x34,0x70,0x18,0x7F,0xF8,0x70,0x00,0x28,0x14,0x0B,0xE0,0x00,0x90,0x02,0x40,
+    0x00,0x00,0x0B,0xD0,0x28,0x34,0x70,0x18,0x7F,0xF8,0x70,0x00,0x28,0x14,0x0B,0xE0,
+    0x03,0x80,0x09,0x90,0x00,0x00,0x0B,0xD0,0x28,0x34,0x70,0x18,0x7F,0xF8,0x70,0x00,
+    0x28,0x14,0x0B,0xE0,0x0D,0xA0,0x00,0x00,0x0B,0xD0,0x28,0x34,0x70,0x18,0x7F,0xF8,
+    0x70,0x00,0x28,0x14,0x0B,0xE0,0x24,0x08,0x00,0x0D,0x0D,0x0D,0x0D,0x0D,0x0D,0x0D,
+    0x09,0x24,0x00,0x34,0x34,0x34,0x34,0x34,0x34,0x34,0x0D,0x00,0x22,0x40,0x00,0x00,
+    0x0D,0x00,0x0D,0x00,0x0D,0x00,0x0D,0x00,0x0D,0x00,0x0D,0x00,0x0D,0x00,0x32,0x40,
+    0x00,0x00,0x0D,0x00,0x0D,0x00,0x0D,0x00,0x0D,0x00,0x0D,0x00,0x0D,0x00,0x0D,0x00,
+    0x0A,0x60,0x0B,0x80,0x15,0xC0,0x1B,0xF0,0x34,0x34,0x70,0x28,0x70,0x28,0x34,0x74,
+    0x1B,0xD0,0x28,0x80,0x27,0x40,0xDF,0x80,0xE0,0xD0,0xD0,0xA0,0xD0,0x60,0xD0,0x60,
+    0xD0,0x60,0xD0,0x60,0x09,0x00,0x02,0x00,0x00,0x00,0x0B,0xD0,0x38,0x74,0x70,0x28,
+    0x60,0x18,0x70,0x28,0x38,0x74,0x0B,0xD0,0x00,0x90,0x02,0x40,0x00,0x00,0x0B,0xD0,
+    0x38,0x74,0x70,0x28,0x60,0x18,0x70,0x28,0x38,0x74,0x0B,0xD0,0x03,0x40,0x08,0x90,
+    0x00,0x00,0x0B,0xD0,0x38,0x74,0x70,0x28,0x60,0x18,0x70,0x28,0x38,0x74,0x0B,0xD0,
+    0x0A,0x60,0x19,0xD0,0x0B,0xD0,0x38,0x74,0x70,0x28,0x60,0x18,0x70,0x28,0x38,0x74,
+    0x0B,0xD0,0x0C,0x90,0x00,0x00,0x0B,0xD0,0x38,0x74,0x70,0x28,0x60,0x18,0x70,0x28,
+    0x38,0x74,0x0B,0xD0,0x02,0x80,0x00,0x00,0xBF,0xFE,0x00,0x00,0x02,0x80,0x00,0x00,
+    0x0B,0xE8,0x38,0x74,0x70,0xA8,0x62,0x58,0x79,0x28,0x38,0x74,0x6B,0xD0,0x00,0x00,
+    0x24,0x00,0x08,0x00,0x00,0x00,0xC0,0xA0,0xC0,0xA0,0xC0,0xA0,0xC0,0xA0,0xC0,0xA0,
+    0xA1,0xE0,0x6E,0xA0,0x02,0x40,0x09,0x00,0x00,0x00,0xC0,0xA0,0xC0,0xA0,0xC0,0xA0,
+    0xC0,0xA0,0xC0,0xA0,0xA1,0xE0,0x6E,0xA0,0x0E,0x00,0x22,0x40,0x00,0x00,0xC0,0xA0,
+    0xC0,0xA0,0xC0,0xA0,0xC0,0xA0,0xC0,0xA0,0xA1,0xE0,0x6E,0xA0,0x36,0x40,0x00,0x00,
+    0xC0,0xA0,0xC0,0xA0,0xC0,0xA0,0xC0,0xA0,0xC0,0xA0,0xA1,0xE0,0x6E,0xA0,0x00,0x80,
+    0x02,0x40,0x00,0x00,0x60,0x28,0x30,0x34,0x24,0x70,0x18,0x90,0x0D,0xC0,0x0B,0x80,
+    0x03,0x40,0x07,0x00,0x0A,0x00,0x3C,0x00,0xD0,0x00,0xD0,0x00,0xD0,0x00,0xDF,0x80,
+    0xE0,0x90,0xD0,0x70,0xD0,0x70,0xD0,0x70,0xE0,0x90,0xDF,0x80,0xD0,0x00,0xD0,0x00,
+    0xD0,0x00,0x1C,0xD0,0x00,0x00,0x60,0x28,0x30,0x34,0x24,0x70,0x18,0x90,0x0D,0xC0,
+    0x0B,0x80,0x03,0x40,0x07,0x00,0x0A,0x00,0x3C,0x00,
+};
+
+static const aa_glyph_t font_sans_12_glyphs[] = 
+{
+    {     0,  0,  0,   0,   0,  4 },   // ' '
+    {     0,  2,  9,   1,   3,  5 },   // '!'
+    {     9,  4,  3,   1,   3,  6 },   // '"'
+    {    12, 10,  8,   0,   4, 10 },   // '#'
+    {    36,  6, 11,   1,   3,  8 },   // '$'
+    {    58, 11,  9,   0,   3, 11 },   // '%'
+    {    85,  9,  9,   0,   3,  9 },   // '&'
+    {   112,  2,  3,   1,   3,  3 },   // "'"
+    {   115,  3, 11,   1,   2,  5 },   // '('
+    {   126,  3, 11,   1,   2,  5 },   // ')'
+    {   137,  6,  6,   0,   3,  6 },   // '*'
+    {   149,  8,  7,   1,   5, 10 },   // '+'
+    {   163,  3,  3,   0,  10,  4 },   // ','
+    {   166,  4,  1,   0,   8,  4 },   // '-'
+    {   167,  2,  2,   1,  10,  4 },   // '.'
+    {   169,  4, 10,   0,   3,  4 },   // '/'
+    {   179,  7,  9,   0,   3,  8 },   // '0'
+    {   197,  6,  9,   1,   3,  8 },   // '1'
+    {   215,  7,  9,   0,   3,  8 },   // '2'
+    {   233,  7,  9,   0,   3,  8 },   // '3'
+    {   251,  7,  9,   0,   3,  8 },   // '4'
+    {   269,  7,  9,   0,   3,  8 },   // '5'
+    {   287,  7,  9,   0,   3,  8 },   // '6'
+    {   305,  7,  9,   0,   3,  8 },   // '7'
+    {   323,  7,  9,   0,   3,  8 },   // '8'
+    {   341,  7,  9,   0,   3,  8 },   // '9'
+    {   359,  2,  6,   1,   6,  4 },   // ':'
+    {   365,  3,  7,   0,   6,  4 },   // ';'
+    {   372,  8,  6,   1,   5, 10 },   // '<'
+    {   384,  8,  3,   1,   7, 10 },   // '='
+    {   390,  8,  6,   1,   5, 10 },   // '>'
+    {   402,  6,  9,   0,   3,  6 },   // '?'
+    {   420, 12, 11,   0,   4, 12 },   // '@'
+    {   453,  9,  9,   0,   3,  8 },   // 'A'
+    {   480,  7,  9,   1,   3,  8 },   // 'B'
+    {   498,  8,  9,   0,   3,  8 },   // 'C'
+    {   516,  8,  9,   1,   3,  9 },   // 'D'
+    {   534,  6,  9,   1,   3,  8 },   // 'E'
+    {   552,  6,  9,   1,   3,  7 },   // 'F'
+    {   570,  9,  9,   0,   3,  9 },   // 'G'
+    {   597,  7,  9,   1,   3,  9 },   // 'H'
+    {   615,  2,  9,   1,   3,  4 },   // 'I'
+    {   624,  4, 11,  -1,   3,  4 },   // 'J'
+    {   635,  8,  9,   1,   3,  8 },   // 'K'
+    {   653,  6,  9,   1,   3,  7 },   // 'L'
+    {   671,  9,  9,   1,   3, 10 },   // 'M'
+    {   698,  7,  9,   1,   3,  9 },   // 'N'
+    {   716,  9,  9,   0,   3,  9 },   // 'O'
+    {   743,  6,  9,   1,   3,  7 },   // 'P'
+    {   761,  9, 11,   0,   3,  9 },   // 'Q'
+    {   794,  7,  9,   1,   3,  8 },   // 'R'
+    {   812,  7,  9,   0,   3,  8 },   // 'S'
+    {   830,  9,  9,  -1,   3,  7 },   // 'T'
+    {   857,  7,  9,   1,   3,  9 },   // 'U'
+    {   875,  9,  9,   0,   3,  8 },   // 'V'
+    {   902, 12,  9,   0,   3, 12 },   // 'W'
+    {   929,  8,  9,   0,   3,  8 },   // 'X'
+    {   947,  8,  9,   0,   3,  7 },   // 'Y'
+    {   965,  8,  9,   0,   3,  8 },   // 'Z'
+    {   983,  3, 11,   1,   3,  5 },   // '['
+    {   994,  4, 10,   0,   3,  4 },   // '\\'
+    {  1004,  3, 11,   1,   3,  5 },   // ']'
+    {  1015,  8,  3,   1,   3, 10 },   // '^'
+    {  1021,  8,  1,  -1,  14,  6 },   // '_'
+    {  1023,  3,  2,   1,   2,  6 },   // '`'
+    {  1025,  7,  7,   0,   5,  7 },   // 'a'
+    {  1039,  6, 10,   1,   2,  8 },   // 'b'
+    {  1059,  6,  7,   0,   5,  7 },   // 'c'
+    {  1073,  7, 10,   0,   2,  8 },   // 'd'
+    {  1093,  7,  7,   0,   5,  7 },   // 'e'
+    {  1107,  5, 10,   0,   2,  4 },   // 'f'
+    {  1127,  7, 10,   0,   5,  8 },   // 'g'
+    {  1147,  6, 10,   1,   2,  8 },   // 'h'
+    {  1167,  2,  9,   1,   3,  3 },   // 'i'
+    {  1176,  4, 12,  -1,   3,  3 },   // 'j'
+    {  1188,  6, 10,   1,   2,  7 },   // 'k'
+    {  1208,  2, 10,   1,   2,  3 },   // 'l'
+    {  1218, 10,  7,   1,   5, 12 },   // 'm'
+    {  1239,  6,  7,   1,   5,  8 },   // 'n'
+    {  1253,  7,  7,   0,   5,  7 },   // 'o'
+    {  1267,  6, 10,   1,   5,  8 },   // 'p'
+    {  1287,  7, 10,   0,   5,  8 },   // 'q'
+    {  1307,  4,  7,   1,   5,  5 },   // 'r'
+    {  1314,  6,  7,   0,   5,  6 },   // 's'
+    {  1328,  5,  9,   0,   3,  5 },   // 't'
+    {  1346,  6,  7,   1,   5,  8 },   // 'u'
+    {  1360,  7,  7,   0,   5,  7 },   // 'v'
+    {  1374, 10,  7,   0,   5, 10 },   // 'w'
+    {  1395,  7,  7,   0,   5,  7 },   // 'x'
+    {  1409,  7, 10,   0,   5,  7 },   // 'y'
+    {  1429,  6,  7,   0,   5,  6 },   // 'z'
+    {  1443,  6, 11,   1,   3,  8 },   // '{'
+    {  1465,  2, 12,   1,   3,  4 },   // '|'
+    {  1477,  6, 11,   1,   3,  8 },   // '}'
+    {  1499,  8,  3,   1,   6, 10 },   // '~'
+    {  1505,  0,  0,   0,   0,  4 },   // U+00A0
+    {  1505,  2,  9,   1,   5,  5 },   // U+00A1
+    {  1514,  6, 11,   1,   3,  8 },   // U+00A2
+    {  1536,  7,  9,   0,   3,  8 },   // U+00A3
+    {  1554,  8,  7,   0,   5,  8 },   // U+00A4
+    {  1568,  8,  9,   0,   3,  8 },   // U+00A5
+    {  1586,  2, 10,   1,   4,  4 },   // U+00A6
+    {  1596,  6, 10,   0,   3,  6 },   // U+00A7
+    {  1616,  4,  1,   1,   3,  6 },   // U+00A8
+    {  1617, 10,  9,   1,   3, 12 },   // U+00A9
+    {  1644,  5,  7,   0,   3,  6 },   // U+00AA
+    {  1658,  7,  5,   0,   6,  7 },   // U+00AB
+    {  1668,  8,  3,   1,   7, 10 },   // U+00AC
+    {  1674,  4,  1,   0,   8,  4 },   // U+00AD
+    {  1675, 10,  9,   1,   3, 12 },   // U+00AE
+    {  1702,  4,  1,   1,   3,  6 },   // U+00AF
+    {  1703,  4,  4,   1,   3,  6 },   // U+00B0
+    {  1707,  8,  7,   1,   5, 10 },   // U+00B1
+    {  1721,  5,  5,   0,   3,  5 },   // U+00B2
+    {  1731,  5,  5,   0,   3,  5 },   // U+00B3
+    {  1741,  3,  2,   2,   2,  6 },   // U+00B4
+    {  1743,  7, 10,   1,   5,  8 },   // U+00B5
+    {  1763,  7, 10,   0,   3,  8 },   // U+00B6
+    {  1783,  2,  2,   1,   7,  4 },   // U+00B7
+    {  1785,  4,  2,   1,  12,  6 },   // U+00B8
+    {  1787,  5,  5,   0,   3,  5 },   // U+00B9
+    {  1797,  6,  7,   0,   3,  6 },   // U+00BA
+    {  1811,  6,  5,   1,   6,  7 },   // U+00BB
+    {  1821, 12,  9,   0,   3, 12 },   // U+00BC
+    {  1848, 11,  9,   0,   3, 12 },   // U+00BD
+    {  1875, 12,  9,   0,   3, 12 },   // U+00BE
+    {  1902,  6, 10,   0,   5,  6 },   // U+00BF
+    {  1922,  9, 11,   0,   1,  8 },   // U+00C0
+    {  1955,  9, 11,   0,   1,  8 },   // U+00C1
+    {  1988,  9, 11,   0,   1,  8 },   // U+00C2
+    {  2021,  9, 11,   0,   1,  8 },   // U+00C3
+    {  2054,  9, 11,   0,   1,  8 },   // U+00C4
+    {  2087,  9, 12,   0,   0,  8 },   // U+00C5
+    {  2123, 11,  9,   0,   3, 12 },   // U+00C6
+    {  2150,  8, 11,   0,   3,  8 },   // U+00C7
+    {  2172,  6, 11,   1,   1,  8 },   // U+00C8
+    {  2194,  6, 11,   1,   1,  8 },   // U+00C9
+    {  2216,  6, 11,   1,   1,  8 },   // U+00CA
+    {  2238,  6, 11,   1,   1,  8 },   // U+00CB
+    {  2260,  3, 11,   0,   1,  4 },   // U+00CC
+    {  2271,  3, 11,   1,   1,  4 },   // U+00CD
+    {  2282,  4, 11,   0,   1,  4 },   // U+00CE
+    {  2293,  4, 11,   0,   1,  4 },   // U+00CF
+    {  2304,  9,  9,   0,   3,  9 },   // U+00D0
+    {  2331,  7, 11,   1,   1,  9 },   // U+00D1
+    {  2353,  9, 11,   0,   1,  9 },   // U+00D2
+    {  2386,  9, 11,   0,   1,  9 },   // U+00D3
+    {  2419,  9, 11,   0,   1,  9 },   // U+00D4
+    {  2452,  9, 11,   0,   1,  9 },   // U+00D5
+    {  2485,  9, 11,   0,   1,  9 },   // U+00D6
+    {  2518,  8,  7,   1,   5, 10 },   // U+00D7
+    {  2532,  9, 11,   0,   2,  9 },   // U+00D8
+    {  2565,  7, 11,   1,   1,  9 },   // U+00D9
+    {  2587,  7, 11,   1,   1,  9 },   // U+00DA
+    {  2609,  7, 11,   1,   1,  9 },   // U+00DB
+    {  2631,  7, 11,   1,   1,  9 },   // U+00DC
+    {  2653,  8, 11,   0,   1,  7 },   // U+00DD
+    {  2675,  6,  9,   1,   3,  7 },   // U+00DE
+    {  2693,  6, 10,   1,   2,  8 },   // U+00DF
+    {  2713,  7, 10,   0,   2,  7 },   // U+00E0
+    {  2733,  7, 10,   0,   2,  7 },   // U+00E1
+    {  2753,  7, 10,   0,   2,  7 },   // U+00E2
+    {  2773,  7,  9,   0,   3,  7 },   // U+00E3
+    {  2791,  7,  9,   0,   3,  7 },   // U+00E4
+    {  2809,  7, 12,   0,   0,  7 },   // U+00E5
+    {  2833, 12,  7,   0,   5, 12 },   // U+00E6
+    {  2854,  6,  9,   0,   5,  7 },   // U+00E7
+    {  2872,  7, 10,   0,   2,  7 },   // U+00E8
+    {  2892,  7, 10,   0,   2,  7 },   // U+00E9
+    {  2912,  7, 10,   0,   2,  7 },   // U+00EA
+    {  2932,  7,  9,   0,   3,  7 },   // U+00EB
+    {  2950,  4, 10,  -1,   2,  3 },   // U+00EC
+    {  2960,  4, 10,   0,   2,  3 },   // U+00ED
+    {  2970,  5, 10,  -1,   2,  3 },   // U+00EE
+    {  2990,  5,  9,  -1,   3,  3 },   // U+00EF
+    {  3008,  7,  9,   0,   3,  7 },   // U+00F0
+    {  3026,  6,  9,   1,   3,  8 },   // U+00F1
+    {  3044,  7, 10,   0,   2,  7 },   // U+00F2
+    {  3064,  7, 10,   0,   2,  7 },   // U+00F3
+    {  3084,  7, 10,   0,   2,  7 },   // U+00F4
+    {  3104,  7,  9,   0,   3,  7 },   // U+00F5
+    {  3122,  7,  9,   0,   3,  7 },   // U+00F6
+    {  3140,  8,  5,   1,   6, 10 },   // U+00F7
+    {  3150,  7,  9,   0,   4,  7 },   // U+00F8
+    {  3168,  6, 10,   1,   2,  8 },   // U+00F9
+    {  3188,  6, 10,   1,   2,  8 },   // U+00FA
+    {  3208,  6, 10,   1,   2,  8 },   // U+00FB
+    {  3228,  6,  9,   1,   3,  8 },   // U+00FC
+    {  3246,  7, 13,   0,   2,  7 },   // U+00FD
+    {  3272,  6, 13,   1,   2,  8 },   // U+00FE
+    {  3298,  7, 12,   0,   3,  7 },   // U+00FF
+};
+
+static const aa_range_t font_sans_12_ranges[] = 
+{
+    { 32, 95, 0 },
+    { 160, 96, 95 },
+};
+
+const aa_font_t font_sans_12 = {
+    .bpp = 2,
+    .line_height = 15,
+    .baseline = 12,
+    .first_char = 32,
+    .glyph_amount = 191,
+    .glyphs = font_sans_12_glyphs,
+    .bitmap = font_sans_12_bitmap,
+    .ranges = font_sans_12_ranges,
+    .range_amount = 2,
+};
+
+
+// DejaVuSans.ttf 16px, 4 bpp, characters 32-126,160-255. Generated by tools/make_font.py.
+static const uint8_t font_sans_16_bitmap[] = 
+{
+    0x9F,0x9F,0x9F,0x9F,0x9F,0x8F,0x8E,0x7D,0x00,0x00,0x9F,0x9F,0x7D,0x08,0xC0,0x7D,
+    0x08,0xC0,0x7D,0x08,0xC0,0x7D,0x08,0xC0,0x00,0x00,0x6D,0x00,0xD6,0x00,0x00,0x00,
+    0xA9,0x02,0xF2,0x00,0x00,0x00,0xE5,0x06,0xD0,0x00,0x0D,0xFF,0xFF,0xFF,0xFF,0xF3,
+    0x00,0x07,0xC0,0x0E,0x50,0x00,0x00,0x0A,0x90,0x2F,0x20,0x00,0x00,0x0E,0x50,0x5E,
+    0x00,0x00,0xCF,0xFF,0xFF,0xFF,0xFF,0x40,0x00,0x7C,0x00,0xD5,0x00,0x00,0x00,0xB8,
+    0x03,0xF1,0x00,0x00,0x00,0xE4,0x06,0xC0,0x00,0x00,0x00,0x06,0x60,0x00,0x00,0x06,
+    0x60,0x00,0x05,0xCE,0xFC,0x50,0x4F,0x66,0x74,0xA2,0x9C,0x06,0x60,0x00,0x8E,0x26,
+    0x60,0x00,0x1D,0xED,0xA4,0x00,0x00,0x5A,0xEF,0xD2,0x00,0x06,0x62,0xDB,0x00,0x06,
+    0x60,0xAC,0x87,0x26,0x75,0xE7,0x28,0xCF,0xEC,0x60,0x00,0x06,0x60,0x00,0x00,0x06,
+    0x60,0x00,0x02,0xBE,0xC3,0x00,0x00,0xA9,0x00,0x00,0x0C,0x91,0x7D,0x10,0x04,0xE1,
+    0x00,0x00,0x1F,0x30,0x1F,0x30,0x0D,0x50,0x00,0x00,0x1F,0x30,0x1F,0x30,0x8B,0x00,
+    0x00,0x00,0x0C,0x91,0x7E,0x12,0xE2,0x00,0x00,0x00,0x02,0xBE,0xC3,0x0B,0x80,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x5D,0x12,0xBE,0xC4,0x00,0x00,0x00,0x01,0xD5,0x0B,0xA1,
+    0x7E,0x10,0x00,0x00,0x08,0xB0,0x0F,0x40,0x0F,0x40,0x00,0x00,0x3E,0x20,0x0F,0x40,
+    0x0F,0x40,0x00,0x00,0xB7,0x00,0x0B,0xA1,0x7E,0x10,0x00,0x06,0xD0,0x00,0x02,0xBE,
+    0xC4,0x00,0x00,0x5C,0xEC,0x50,0x00,0x00,0x04,0xF7,0x13,0xA2,0x00,0x00,0x09,0xD0,
+    0x00,0x00,0x00,0x00,0x08,0xF1,0x00,0x00,0x00,0x00,0x03,0xF9,0x00,0x00,0x00,0x00,
+    0x07,0xFF,0x70,0x00,0x00,0x00,0x5F,0x69,0xF7,0x00,0x2F,0x50,0xCB,0x00,0x8F,0x70,
+    0x5F,0x10,0xE8,0x00,0x08,0xF7,0xCA,0x00,0xCC,0x00,0x00,0x8F,0xE2,0x00,0x4F,0xA2,
+    0x13,0xAF,0xF7,0x00,0x03,0xAE,0xFD,0x92,0x7F,0x70,0x7D,0x7D,0x7D,0x7D,0x00,0x9B,
+    0x02,0xF3,0x09,0xC0,0x1E,0x60,0x4F,0x30,0x7F,0x00,0x9E,0x00,0x9E,0x00,0x7F,0x00,
+    0x4F,0x30,0x1E,0x70,0x09,0xC0,0x02,0xF3,0x00,0x9B,0x7C,0x00,0x1E,0x60,0x08,0xD0,
+    0x03,0xF4,0x00,0xE8,0x00,0xCB,0x00,0xAC,0x00,0xAC,0x00,0xCB,0x00,0xE8,0x03,0xF4,
+    0x08,0xD0,0x1E,0x60,0x7C,0x00,0x00,0x07,0x70,0x00,0x00,0x07,0x70,0x00,0x4A,0x37,
+    0x73,0xA4,0x02,0x9D,0xD9,0x20,0x02,0x9D,0xD9,0x20,0x4A,0x37,0x73,0xA4,0x00,0x07,
+    0x70,0x00,0x00,0x07,0x70,0x00,0x00,0x00,0x0E,0x50,0x00,0x00,0x00,0x00,0x0E,0x50,
+    0x00,0x00,0x00,0x00,0x0E,0x50,0x00,0x00,0x00,0x00,0x0E,0x50,0x00,0x00,0x4F,0xFF,
+    0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x0E,0x50,0x00,0x00,0x00,0x00,0x0E,0x50,0x00,0x00,
+    0x00,0x00,0x0E,0x50,0x00,0x00,0x00,0x00,0x0E,0x50,0x00,0x00,0x2F,0x80,0x3F,0x70,
+    0x6E,0x10,0xA7,0x00,0x3F,0xFF,0xF0,0x4F,0x50,0x4F,0x50,0x00,0x01,0xF3,0x00,0x06,
+    0xE0,0x00,0x0B,0x90,0x00,0x1F,0x40,0x00,0x5E,0x00,0x00,0xAA,0x00,0x00,0xE5,0x00,
+    0x04,0xF1,0x00,0x09,0xB0,0x00,0x0E,0x60,0x00,0x3F,0x20,0x00,0x8C,0x00,0x00,0xD7,
+    0x00,0x00,0x01,0xAE,0xEB,0x30,0x00,0x0C,0xC2,0x1A,0xE1,0x00,0x6F,0x20,0x01,0xE8,
+    0x00,0xAD,0x00,0x00,0xAD,0x00,0xDB,0x00,0x00,0x8F,0x10,0xEA,0x00,0x00,0x7F,0x10,
+    0xEA,0x00,0x00,0x7F,0x10,0xDB,0x00,0x00,0x8F,0x10,0xAD,0x00,0x00,0xAD,0x00,0x6F,
+    0x20,0x01,0xE8,0x00,0x0C,0xC2,0x1A,0xE2,0x00,0x01,0xAE,0xEB,0x30,0x00,0x04,0x9E,
+    0xF2,0x00,0x3B,0x67,0xF2,0x00,0x00,0x07,0xF2,0x00,0x00,0x07,0xF2,0x00,0x00,0x07,
+    0xF2,0x00,0x00,0x07,0xF2,0x00,0x00,0x07,0xF2,0x00,0x00,0x07,0xF2,0x00,0x00,0x07,
+    0xF2,0x00,0x00,0x07,0xF2,0x00,0x00,0x07,0xF2,0x00,0x0F,0xFF,0xFF,0xFB,0x28,0xCE,
+    0xD9,0x10,0xBD,0x41,0x3C,0xD1,0x71,0x00,0x04,0xF6,0x00,0x00,0x02,0xF7,0x00,0x00,
+    0x06,0xF5,0x00,0x00,0x1D,0xD1,0x00,0x00,0xBF,0x40,0x00,0x0A,0xF5,0x00,0x00,0x8F,
+    0x60,0x00,0x07,0xF7,0x00,0x00,0x6F,0x80,0x00,0x00,0xCF,0xFF,0xFF,0xF9,0x16,0xCE,
+    0xEB,0x30,0x68,0x31,0x2A,0xF3,0x00,0x00,0x01,0xF9,0x00,0x00,0x01,0xF8,0x00,0x00,
+    0x2A,0xE2,0x00,0xCF,0xFE,0x30,0x00,0x00,0x2A,0xE4,0x00,0x00,0x00,0xDB,0x00,0x00,
+    0x00,0xBD,0x00,0x00,0x00,0xDB,0x95,0x21,0x3A,0xF3,0x29,0xDF,0xDA,0x20,0x00,0x00,
+    0x0A,0xF9,0x00,0x00,0x00,0x5E,0xF9,0x00,0x00,0x01,0xE6,0xE9,0x00,0x00,0x0A,0xC0,
+    0xE9,0x00,0x00,0x4F,0x30,0xE9,0x00,0x01,0xD9,0x00,0xE9,0x00,0x09,0xE1,0x00,0xE9,
+    0x00,0x2F,0x50,0x00,0xE9,0x00,0x3F,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0x00,0xE9,0x00,
+    0x00,0x00,0x00,0xE9,0x00,0x00,0x00,0x00,0xE9,0x00,0x4F,0xFF,0xFF,0xE0,0x4F,0x30,
+    0x00,0x00,0x4F,0x30,0x00,0x00,0x4F,0x30,0x00,0x00,0x4F,0xEF,0xE9,0x20,0x48,0x21,
+    0x4D,0xD1,0x00,0x00,0x03,0xF8,0x00,0x00,0x00,0xDB,0x00,0x00,0x00,0xDB,0x00,0x00,
+    0x03,0xF8,0x95,0x21,0x4D,0xD1,0x29,0xDF,0xD9,0x20,0x00,0x4B,0xED,0x81,0x00,0x06,
+    0xE5,0x11,0x76,0x00,0x2F,0x50,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,0x00,0xBC,0x7D,
+    0xFD,0x60,0x00,0xDF,0xD3,0x17,0xF7,0x00,0xDF,0x40,0x00,0xBE,0x00,0xCF,0x10,0x00,
+    0x7F,0x20,0x9F,0x10,0x00,0x7F,0x20,0x4F,0x40,0x00,0xAE,0x00,0x0B,0xD3,0x16,0xF6,
+    0x00,0x01,0x9E,0xFC,0x60,0x00,0xAF,0xFF,0xFF,0xFC,0x00,0x00,0x04,0xF8,0x00,0x00,
+    0x09,0xF2,0x00,0x00,0x1E,0xB0,0x00,0x00,0x5F,0x60,0x00,0x00,0xBE,0x10,0x00,0x01,
+    0xFA,0x00,0x00,0x07,0xF4,0x00,0x00,0x0C,0xD0,0x00,0x00,0x2F,0x80,0x00,0x00,0x8F,
+    0x20,0x00,0x00,0xDB,0x00,0x00,0x04,0xBE,0xEC,0x50,0x00,0x3F,0x91,0x17,0xF6,0x00,
+    0x8F,0x10,0x00,0xDB,0x00,0x8F,0x10,0x00,0xDB,0x00,0x2E,0x91,0x17,0xE4,0x00,0x03,
+    0xDF,0xFE,0x50,0x00,0x3E,0x92,0x17,0xF6,0x00,0xBD,0x00,0x00,0xAE,0x00,0xDB,0x00,
+    0x00,0x8F,0x10,0xCD,0x00,0x00,0xAE,0x00,0x5F,0x91,0x17,0xF8,0x00,0x04,0xBE,0xEC,
+    0x60,0x00,0x04,0xBE,0xEA,0x20,0x00,0x4F,0x91,0x2B,0xD1,0x00,0xBD,0x00,0x02,0xF7,
+    0x00,0xEA,0x00,0x00,0xDC,0x00,0xEA,0x00,0x00,0xDE,0x00,0xBD,0x00,0x02,0xFF,0x10,
+    0x4F,0x91,0x2B,0xFF,0x00,0x05,0xCF,0xE8,0x9E,0x00,0x00,0x00,0x00,0xCA,0x00,0x00,
+    0x00,0x03,0xF4,0x00,0x38,0x20,0x4D,0x90,0x00,0x07,0xDF,0xC6,0x00,0x00,0x2F,0x80,
+    0x2F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0x80,0x2F,0x80,0x2F,0x80,
+    0x2F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2F,0x80,0x3F,0x70,0x6E,0x10,
+    0xA7,0x00,0x00,0x00,0x00,0x00,0x28,0x90,0x00,0x00,0x01,0x6C,0xFE,0x70,0x00,0x04,
+    0x9E,0xFB,0x50,0x00,0x17,0xDF,0xC7,0x10,0x00,0x00,0x4F,0xE6,0x00,0x00,0x00,0x00,
+    0x17,0xDF,0xC6,0x10,0x00,0x00,0x00,0x04,0xAE,0xFA,0x50,0x00,0x00,0x00,0x01,0x6C,
+    0xFE,0x70,0x00,0x00,0x00,0x00,0x28,0x90,0x4F,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xB0,
+    0x4A,0x50,0x00,0x00,0x00,0x00,0x2C,0xFE,0x83,0x00,0x00,0x00,0x00,0x38,0xEF,0xC6,
+    0x10,0x00,0x00,0x00,0x05,0xAF,0xFA,0x30,0x00,0x00,0x00,0x02,0xCF,0xB0,0x00,0x00,
+    0x04,0xAE,0xFA,0x40,0x00,0x28,0xDF,0xC6,0x10,0x00,0x2C,0xFE,0x83,0x00,0x00,0x00,
+    0x4B,0x50,0x00,0x00,0x00,0x00,0x3A,0xDE,0xB3,0x00,0xA5,0x12,0xBE,0x10,0x00,0x00,
+    0x4F,0x50,0x00,0x00,0x8F,0x30,0x00,0x05,0xF9,0x00,0x00,0x3F,0xA0,0x00,0x00,0xBD,
+    0x00,0x00,0x00,0xD9,0x00,0x00,0x00,0xD9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xEA,
+    0x00,0x00,0x00,0xEA,0x00,0x00,0x00,0x01,0x7C,0xEE,0xD9,0x30,0x00,0x00,0x4E,0x94,
+    0x10,0x27,0xE7,0x00,0x04,0xE4,0x00,0x00,0x00,0x2D,0x70,0x1E,0x50,0x1A,0xFE,0x8C,
+    0x52,0xF3,0x7B,0x00,0xAC,0x22,0xBF,0x50,0x99,0xB5,0x01,0xF3,0x00,0x3F,0x50,0x6C,
+    0xD3,0x03,0xF0,0x00,0x0E,0x50,0x4D,0xD3,0x04,0xF0,0x00,0x0E,0x50,0x6B,0xC5,0x01,
+    0xF3,0x00,0x2F,0x50,0xB7,0x7A,0x00,0xAC,0x22,0xBF,0x68,0xC0,0x1E,0x40,0x1A,0xED,
+    0x8B,0xC7,0x00,0x05,0xE3,0x00,0x00,0x00,0x00,0x00,0x00,0x5E,0x93,0x11,0x36,0xC4,
+    0x00,0x00,0x01,0x8C,0xEE,0xDB,0x61,0x00,0x00,0x00,0x9F,0x80,0x00,0x00,0x00,0x01,
+    0xEF,0xE0,0x00,0x00,0x00,0x05,0xF7,0xF4,0x00,0x00,0x00,0x0B,0xD0,0xEA,0x00,0x00,
+    0x00,0x2F,0x80,0x9F,0x10,0x00,0x00,0x7F,0x30,0x3F,0x60,0x00,0x00,0xDD,0x00,0x0D,
+    0xC0,0x00,0x03,0xF7,0x00,0x08,0xF2,0x00,0x09,0xFF,0xFF,0xFF,0xF8,0x00,0x0E,0xA0,
+    0x00,0x00,0xBD,0x00,0x5F,0x50,0x00,0x00,0x5F,0x40,0xAE,0x00,0x00,0x00,0x1E,0x90,
+    0x6F,0xFF,0xFD,0xA2,0x00,0x6F,0x20,0x03,0xCD,0x10,0x6F,0x20,0x00,0x5F,0x40,0x6F,
+    0x20,0x00,0x5F,0x40,0x6F,0x20,0x03,0xCD,0x00,0x6F,0xFF,0xFF,0xD3,0x00,0x6F,0x20,
+    0x02,0x9E,0x30,0x6F,0x20,0x00,0x0E,0xA0,0x6F,0x20,0x00,0x0D,0xC0,0x6F,0x20,0x00,
+    0x0E,0xB0,0x6F,0x20,0x02,0x9F,0x40,0x6F,0xFF,0xFE,0xB4,0x00,0x00,0x03,0xAD,0xFD,
+    0xB5,0x00,0x00,0x6F,0x92,0x02,0x7F,0x50,0x03,0xF8,0x00,0x00,0x03,0x40,0x0A,0xE0,
+    0x00,0x00,0x00,0x00,0x0E,0xB0,0x00,0x00,0x00,0x00,0x1F,0x90,0x00,0x00,0x00,0x00,
+    0x1F,0x90,0x00,0x00,0x00,0x00,0x0E,0xB0,0x00,0x00,0x00,0x00,0x0A,0xE0,0x00,0x00,
+    0x00,0x00,0x03,0xF7,0x00,0x00,0x03,0x40,0x00,0x6F,0x92,0x02,0x7F,0x50,0x00,0x03,
+    0xAE,0xFD,0xB5,0x00,0x6F,0xFF,0xED,0xA5,0x00,0x00,0x6F,0x20,0x02,0x7E,0xB0,0x00,
+    0x6F,0x20,0x00,0x03,0xF9,0x00,0x6F,0x20,0x00,0x00,0xAF,0x10,0x6F,0x20,0x00,0x00,
+    0x6F,0x40,0x6F,0x20,0x00,0x00,0x5F,0x50,0x6F,0x20,0x00,0x00,0x5F,0x50,0x6F,0x20,
+    0x00,0x00,0x6F,0x40,0x6F,0x20,0x00,0x00,0xAF,0x10,0x6F,0x20,0x00,0x03,0xF9,0x00,
+    0x6F,0x20,0x02,0x7E,0xB0,0x00,0x6F,0xFF,0xED,0xA5,0x00,0x00,0x6F,0xFF,0xFF,0xFE,
+    0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,
+    0x6F,0x20,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFB,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,
+    0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,
+    0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0x10,0x6F,0xFF,0xFF,0xF4,0x6F,0x20,0x00,0x00,
+    0x6F,0x20,0x00,0x00,0x6F,0x20,0x00,0x00,0x6F,0x20,0x00,0x00,0x6F,0xFF,0xFF,0xC0,
+    0x6F,0x20,0x00,0x00,0x6F,0x20,0x00,0x00,0x6F,0x20,0x00,0x00,0x6F,0x20,0x00,0x00,
+    0x6F,0x20,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x03,0xAD,0xFE,0xC8,0x20,0x00,0x6F,
+    0x93,0x01,0x5D,0xC0,0x03,0xF7,0x00,0x00,0x00,0x70,0x0A,0xE0,0x00,0x00,0x00,0x00,
+    0x0E,0xA0,0x00,0x00,0x00,0x00,0x1F,0x90,0x00,0x00,0x00,0x00,0x1F,0x90,0x00,0x1F,
+    0xFF,0xF1,0x0E,0xA0,0x00,0x00,0x07,0xF1,0x0A,0xE0,0x00,0x00,0x07,0xF1,0x03,0xF7,
+    0x00,0x00,0x07,0xF1,0x00,0x6F,0x93,0x01,0x4B,0xF1,0x00,0x03,0xAD,0xFE,0xC9,0x30,
+    0x6F,0x20,0x00,0x02,0xF7,0x6F,0x20,0x00,0x02,0xF7,0x6F,0x20,0x00,0x02,0xF7,0x6F,
+    0x20,0x00,0x02,0xF7,0x6F,0x20,0x00,0x02,0xF7,0x6F,0xFF,0xFF,0xFF,0xF7,0x6F,0x20,
+    0x00,0x02,0xF7,0x6F,0x20,0x00,0x02,0xF7,0x6F,0x20,0x00,0x02,0xF7,0x6F,0x20,0x00,
+    0x02,0xF7,0x6F,0x20,0x00,0x02,0xF7,0x6F,0x20,0x00,0x02,0xF7,0x6F,0x20,0x6F,0x20,
+    0x6F,0x20,0x6F,0x20,0x6F,0x20,0x6F,0x20,0x6F,0x20,0x6F,0x20,0x6F,0x20,0x6F,0x20,
+    0x6F,0x20,0x6F,0x20,0x00,0x6F,0x20,0x00,0x6F,0x20,0x00,0x6F,0x20,0x00,0x6F,0x20,
+    0x00,0x6F,0x20,0x00,0x6F,0x20,0x00,0x6F,0x20,0x00,0x6F,0x20,0x00,0x6F,0x20,0x00,
+    0x6F,0x20,0x00,0x6F,0x20,0x00,0x7F,0x20,0x00,0x8F,0x10,0x03,0xEB,0x00,0xCD,0x91,
+    0x00,0x6F,0x20,0x00,0x3E,0xC1,0x6F,0x20,0x03,0xEC,0x10,0x6F,0x20,0x4E,0xC1,0x00,
+    0x6F,0x24,0xEB,0x10,0x00,0x6F,0x7F,0xB1,0x00,0x00,0x6F,0xFD,0x00,0x00,0x00,0x6F,
+    0xBF,0x80,0x00,0x00,0x6F,0x29,0xF7,0x00,0x00,0x6F,0x20,0x9F,0x70,0x00,0x6F,0x20,
+    0x0A,0xF6,0x00,0x6F,0x20,0x00,0xAF,0x60,0x6F,0x20,0x00,0x0B,0xF5,0x6F,0x20,0x00,
+    0x00,0x6F,0x20,0x00,0x00,0x6F,0x20,0x00,0x00,0x6F,0x20,0x00,0x00,0x6F,0x20,0x00,
+    0x00,0x6F,0x20,0x00,0x00,0x6F,0x20,0x00,0x00,0x6F,0x20,0x00,0x00,0x6F,0x20,0x00,
+    0x00,0x6F,0x20,0x00,0x00,0x6F,0x20,0x00,0x00,0x6F,0xFF,0xFF,0xFC,0x6F,0xF2,0x00,
+    0x00,0x4F,0xF4,0x6F,0xE7,0x00,0x00,0xAE,0xF4,0x6F,0xAC,0x00,0x01,0xEA,0xF4,0x6F,
+    0x5F,0x20,0x05,0xE5,0xF4,0x6F,0x2D,0x80,0x0B,0xA4,0xF4,0x6F,0x27,0xD0,0x1F,0x44,
+    0xF4,0x6F,0x22,0xF3,0x6E,0x04,0xF4,0x6F,0x20,0xC9,0xC9,0x04,0xF4,0x6F,0x20,0x6E,
+    0xF3,0x04,0xF4,0x6F,0x20,0x1F,0xD0,0x04,0xF4,0x6F,0x20,0x00,0x00,0x04,0xF4,0x6F,
+    0x20,0x00,0x00,0x04,0xF4,0x6F,0xE1,0x00,0x02,0xF6,0x6F,0xF7,0x00,0x02,0xF6,0x6F,
+    0xBE,0x10,0x02,0xF6,0x6F,0x4F,0x80,0x02,0xF6,0x6F,0x29,0xE1,0x02,0xF6,0x6F,0x22,
+    0xF8,0x02,0xF6,0x6F,0x20,0x8E,0x12,0xF6,0x6F,0x20,0x1E,0x92,0xF6,0x6F,0x20,0x08,
+    0xF4,0xF6,0x6F,0x20,0x01,0xEB,0xF6,0x6F,0x20,0x00,0x7F,0xF6,0x6F,0x20,0x00,0x1E,
+    0xF6,0x00,0x04,0xBE,0xFD,0x81,0x00,0x00,0x7F,0x82,0x03,0xCD,0x20,0x03,0xF8,0x00,
+    0x00,0x1D,0xC0,0x0A,0xE1,0x00,0x00,0x06,0xF4,0x0E,0xB0,0x00,0x00,0x02,0xF8,0x1F,
+    0x90,0x00,0x00,0x00,0xFA,0x1F,0x90,0x00,0x00,0x00,0xFA,0x0E,0xB0,0x00,0x00,0x02,
+    0xF8,0x0A,0xE0,0x00,0x00,0x06,0xF4,0x04,0xF8,0x00,0x00,0x1D,0xC0,0x00,0x7F,0x82,
+    0x03,0xCE,0x20,0x00,0x04,0xBE,0xFD,0x91,0x00,0x6F,0xFF,0xEC,0x70,0x00,0x6F,0x20,
+    0x17,0xF8,0x00,0x6F,0x20,0x00,0xBE,0x00,0x6F,0x20,0x00,0x9F,0x10,0x6F,0x20,0x00,
+    0xBE,0x00,0x6F,0x20,0x17,0xF8,0x00,0x6F,0xFF,0xEC,0x70,0x00,0x6F,0x20,0x00,0x00,
+    0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,
+    0x6F,0x20,0x00,0x00,0x00,0x00,0x04,0xBE,0xFD,0x81,0x00,0x00,0x7F,0x82,0x03,0xCD,
+    0x20,0x03,0xF8,0x00,0x00,0x1D,0xC0,0x0A,0xE1,0x00,0x00,0x06,0xF4,0x0E,0xB0,0x00,
+    0x00,0x02,0xF8,0x1F,0x90,0x00,0x00,0x00,0xFA,0x1F,0x90,0x00,0x00,0x00,0xFA,0x0E,
+    0xB0,0x00,0x00,0x02,0xF8,0x0A,0xE0,0x00,0x00,0x06,0xF4,0x04,0xF8,0x00,0x00,0x1D,
+    0xD0,0x00,0x7F,0x82,0x03,0xCE,0x20,0x00,0x04,0xBE,0xFF,0xC1,0x00,0x00,0x00,0x00,
+    0x09,0xF4,0x00,0x00,0x00,0x00,0x00,0xBE,0x30,0x6F,0xFF,0xFD,0x70,0x00,0x6F,0x20,
+    0x16,0xF8,0x00,0x6F,0x20,0x00,0xBE,0x00,0x6F,0x20,0x00,0x9F,0x10,0x6F,0x20,0x00,
+    0xBE,0x00,0x6F,0x20,0x16,0xF8,0x00,0x6F,0xFF,0xFF,0x90,0x00,0x6F,0x20,0x19,0xF4,
+    0x00,0x6F,0x20,0x00,0xCD,0x00,0x6F,0x20,0x00,0x4F,0x60,0x6F,0x20,0x00,0x0C,0xD0,
+    0x6F,0x20,0x00,0x04,0xF6,0x04,0xBE,0xEC,0x71,0x00,0x6F,0x82,0x15,0xD8,0x00,0xCC,
+    0x00,0x00,0x16,0x00,0xDA,0x00,0x00,0x00,0x00,0xAE,0x40,0x00,0x00,0x00,0x2C,0xFD,
+    0x96,0x10,0x00,0x00,0x37,0xAE,0xE5,0x00,0x00,0x00,0x01,0xCE,0x10,0x00,0x00,0x00,
+    0x6F,0x30,0x80,0x00,0x00,0x8F,0x20,0xDC,0x41,0x16,0xEB,0x00,0x28,0xCE,0xEC,0x81,
+    0x00,0x1F,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x00,0x0E,0xA0,0x00,0x00,0x00,0x00,0x0E,
+    0xA0,0x00,0x00,0x00,0x00,0x0E,0xA0,0x00,0x00,0x00,0x00,0x0E,0xA0,0x00,0x00,0x00,
+    0x00,0x0E,0xA0,0x00,0x00,0x00,0x00,0x0E,0xA0,0x00,0x00,0x00,0x00,0x0E,0xA0,0x00,
+    0x00,0x00,0x00,0x0E,0xA0,0x00,0x00,0x00,0x00,0x0E,0xA0,0x00,0x00,0x00,0x00,0x0E,
+    0xA0,0x00,0x00,0x00,0x00,0x0E,0xA0,0x00,0x00,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,
+    0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,
+    0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,
+    0xF5,0x8F,0x10,0x00,0x05,0xF4,0x4F,0x50,0x00,0x09,0xE1,0x0B,0xD4,0x12,0x7F,0x70,
+    0x01,0x8D,0xFE,0xC5,0x00,0xAE,0x00,0x00,0x00,0x1E,0x90,0x5F,0x50,0x00,0x00,0x6F,
+    0x40,0x0E,0xA0,0x00,0x00,0xBD,0x00,0x09,0xF1,0x00,0x02,0xF8,0x00,0x03,0xF6,0x00,
+    0x07,0xF2,0x00,0x00,0xDC,0x00,0x0D,0xC0,0x00,0x00,0x7F,0x20,0x3F,0x60,0x00,0x00,
+    0x2F,0x80,0x9F,0x10,0x00,0x00,0x0B,0xD0,0xEA,0x00,0x00,0x00,0x05,0xF8,0xF4,0x00,
+    0x00,0x00,0x01,0xEF,0xE0,0x00,0x00,0x00,0x00,0x9F,0x80,0x00,0x00,0x5F,0x40,0x00,
+    0x1F,0xE0,0x00,0x06,0xF3,0x2F,0x70,0x00,0x5E,0xF2,0x00,0x0A,0xE0,0x0D,0xB0,0x00,
+    0x9B,0xD6,0x00,0x0E,0xA0,0x09,0xE0,0x00,0xC7,0x9A,0x00,0x2F,0x70,0x06,0xF3,0x01,
+    0xF3,0x6D,0x00,0x6F,0x30,0x02,0xF7,0x05,0xE0,0x2F,0x20,0x9E,0x00,0x00,0xDA,0x08,
+    0xB0,0x0E,0x60,0xDB,0x00,0x00,0xAE,0x0C,0x80,0x0A,0x92,0xF7,0x00,0x00,0x6F,0x3F,
+    0x40,0x07,0xD5,0xF3,0x00,0x00,0x2F,0xAF,0x10,0x03,0xFA,0xE0,0x00,0x00,0x0E,0xFC,
+    0x00,0x00,0xEF,0xB0,0x00,0x00,0x0A,0xF8,0x00,0x00,0xBF,0x70,0x00,0x0A,0xE2,0x00,
+    0x00,0xCD,0x10,0x01,0xEA,0x00,0x07,0xF3,0x00,0x00,0x6F,0x50,0x2F,0x80,0x00,0x00,
+    0x0B,0xE1,0xCD,0x00,0x00,0x00,0x02,0xED,0xF3,0x00,0x00,0x00,0x00,0x7F,0x90,0x00,
+    0x00,0x00,0x00,0xCF,0xD1,0x00,0x00,0x00,0x08,0xF6,0xF8,0x00,0x00,0x00,0x3F,0x80,
+    0x7F,0x30,0x00,0x00,0xCD,0x00,0x0C,0xC0,0x00,0x08,0xF3,0x00,0x03,0xF7,0x00,0x3F,
+    0x80,0x00,0x00,0x8F,0x30,0xBE,0x10,0x00,0x03,0xF7,0x2E,0xA0,0x00,0x0C,0xC0,0x06,
+    0xF5,0x00,0x8F,0x30,0x00,0xBE,0x13,0xF8,0x00,0x00,0x2E,0x9C,0xC0,0x00,0x00,0x06,
+    0xFF,0x30,0x00,0x00,0x00,0xEB,0x00,0x00,0x00,0x00,0xEA,0x00,0x00,0x00,0x00,0xEA,
+    0x00,0x00,0x00,0x00,0xEA,0x00,0x00,0x00,0x00,0xEA,0x00,0x00,0x00,0x00,0xEA,0x00,
+    0x00,0x1F,0xFF,0xFF,0xFF,0xFF,0x10,0x00,0x00,0x00,0x04,0xFD,0x00,0x00,0x00,0x00,
+    0x2E,0xE3,0x00,0x00,0x00,0x00,0xCF,0x60,0x00,0x00,0x00,0x08,0xF9,0x00,0x00,0x00,
+    0x00,0x5F,0xC1,0x00,0x00,0x00,0x02,0xEE,0x20,0x00,0x00,0x00,0x0C,0xF5,0x00,0x00,
+    0x00,0x00,0x9F,0x90,0x00,0x00,0x00,0x05,0xFC,0x00,0x00,0x00,0x00,0x2E,0xE2,0x00,
+    0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0x40,0x9F,0xFA,0x9C,0x00,0x9C,0x00,0x9C,
+    0x00,0x9C,0x00,0x9C,0x00,0x9C,0x00,0x9C,0x00,0x9C,0x00,0x9C,0x00,0x9C,0x00,0x9C,
+    0x00,0x9C,0x00,0x9F,0xFA,0xD7,0x00,0x00,0x8C,0x00,0x00,0x3F,0x20,0x00,0x0E,0x60,
+    0x00,0x09,0xB0,0x00,0x04,0xF1,0x00,0x00,0xE5,0x00,0x00,0xAA,0x00,0x00,0x5E,0x00,
+    0x00,0x1F,0x40,0x00,0x0B,0x90,0x00,0x06,0xE0,0x00,0x02,0xF3,0x7F,0xFD,0x00,0x9D,
+    0x00,0x9D,0x00,0x9D,0x00,0x9D,0x00,0x9D,0x00,0x9D,0x00,0x9D,0x00,0x9D,0x00,0x9D,
+    0x00,0x9D,0x00,0x9D,0x00,0x9D,0x7F,0xFD,0x00,0x00,0x9F,0xD2,0x00,0x00,0x00,0x09,
+    0xE6,0xCE,0x30,0x00,0x00,0xAD,0x30,0x0A,0xE3,0x00,0x1B,0xC1,0x00,0x00,0x7E,0x40,
+    0x2F,0xFF,0xFF,0xFF,0xF2,0x4F,0x40,0x00,0x06,0xD1,0x00,0x00,0x8B,0x00,0x06,0xFF,
+    0xFD,0xA2,0x00,0x00,0x00,0x03,0xBC,0x00,0x00,0x00,0x00,0x2F,0x30,0x00,0x7D,0xEF,
+    0xFF,0x50,0x09,0xE4,0x10,0x2F,0x50,0x0E,0x80,0x00,0x3F,0x50,0x0E,0x70,0x00,0x9F,
+    0x50,0x0A,0xD3,0x16,0xAF,0x50,0x01,0xAE,0xE9,0x2F,0x50,0x8E,0x00,0x00,0x00,0x00,
+    0x8E,0x00,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,0x00,0x8E,0x2B,0xED,0x70,0x00,0x8E,
+    0xA4,0x16,0xF6,0x00,0x8F,0x50,0x00,0x9D,0x00,0x8F,0x00,0x00,0x5F,0x20,0x8E,0x00,
+    0x00,0x3F,0x40,0x8F,0x00,0x00,0x5F,0x20,0x8F,0x50,0x00,0x9E,0x00,0x8E,0xA3,0x16,
+    0xF6,0x00,0x8E,0x2B,0xED,0x70,0x00,0x00,0x3A,0xEE,0xB3,0x03,0xEA,0x21,0x49,0x0B,
+    0xD0,0x00,0x00,0x0F,0x80,0x00,0x00,0x1F,0x70,0x00,0x00,0x0F,0x80,0x00,0x00,0x0B,
+    0xD0,0x00,0x00,0x03,0xEA,0x21,0x49,0x00,0x3A,0xEE,0xB3,0x00,0x00,0x00,0x0B,0xB0,
+    0x00,0x00,0x00,0x0B,0xB0,0x00,0x00,0x00,0x0B,0xB0,0x00,0x5D,0xFC,0x3B,0xB0,0x04,
+    0xF8,0x13,0xBC,0xB0,0x0B,0xC0,0x00,0x2F,0xB0,0x0F,0x70,0x00,0x0D,0xB0,0x1F,0x60,
+    0x00,0x0B,0xB0,0x0F,0x70,0x00,0x0D,0xB0,0x0B,0xB0,0x00,0x2F,0xB0,0x04,0xF8,0x12,
+    0xAC,0xB0,0x00,0x5D,0xFC,0x3B,0xB0,0x00,0x3A,0xEF,0xC4,0x00,0x03,0xEA,0x21,0x7F,
+    0x30,0x0B,0xD0,0x00,0x0B,0xA0,0x0F,0x80,0x00,0x08,0xE0,0x1F,0xFF,0xFF,0xFF,0xF0,
+    0x0F,0x70,0x00,0x00,0x00,0x0B,0xC0,0x00,0x00,0x00,0x03,0xEA,0x21,0x27,0x80,0x00,
+    0x2A,0xEF,0xD8,0x20,0x00,0x6D,0xFE,0x01,0xF7,0x00,0x04,0xF3,0x00,0x9F,0xFF,0xF8,
+    0x04,0xF3,0x00,0x04,0xF3,0x00,0x04,0xF3,0x00,0x04,0xF3,0x00,0x04,0xF3,0x00,0x04,
+    0xF3,0x00,0x04,0xF3,0x00,0x04,0xF3,0x00,0x00,0x5D,0xFC,0x3B,0xB0,0x04,0xF8,0x12,
+    0xAC,0xB0,0x0B,0xB0,0x00,0x2F,0xB0,0x0F,0x70,0x00,0x0D,0xB0,0x1F,0x60,0x00,0x0B,
+    0xB0,0x0F,0x70,0x00,0x0D,0xB0,0x0B,0xB0,0x00,0x2F,0xB0,0x04,0xF7,0x12,0xAC,0xB0,
+    0x00,0x5D,0xFC,0x3C,0xA0,0x00,0x00,0x00,0x1E,0x80,0x01,0x93,0x12,0xAE,0x20,0x00,
+    0x6C,0xEE,0xB3,0x00,0x8E,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,
+    0x8E,0x1A,0xED,0x60,0x8E,0xA4,0x17,0xF3,0x8F,0x40,0x00,0xD9,0x8F,0x00,0x00,0xBB,
+    0x8E,0x00,0x00,0xAC,0x8E,0x00,0x00,0xAC,0x8E,0x00,0x00,0xAC,0x8E,0x00,0x00,0xAC,
+    0x8E,0x00,0x00,0xAC,0x7E,0x7E,0x00,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,
+    0x00,0x7E,0x00,0x7E,0x00,0x00,0x00,0x7E,0x00,0x7E,0x00,0x7E,0x00,0x7E,0x00,0x7E,
+    0x00,0x7E,0x00,0x7E,0x00,0x7E,0x00,0x7E,0x00,0x8D,0x01,0xCA,0x4E,0xB2,0x8E,0x00,
+    0x00,0x00,0x00,0x8E,0x00,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,0x00,0x8E,0x00,0x06,
+    0xF7,0x00,0x8E,0x00,0x7F,0x60,0x00,0x8E,0x08,0xE5,0x00,0x00,0x8E,0xAE,0x40,0x00,
+    0x00,0x8F,0xEB,0x00,0x00,0x00,0x8E,0x4E,0xA0,0x00,0x00,0x8E,0x04,0xEA,0x00,0x00,
+    0x8E,0x00,0x3E,0xA0,0x00,0x8E,0x00,0x03,0xEA,0x00,0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,
+    0x7E,0x7E,0x7E,0x7E,0x7E,0x7E,0x8E,0x1B,0xED,0x40,0x4C,0xFB,0x20,0x8E,0xA3,0x19,
+    0xE4,0x92,0x2D,0xA0,0x8F,0x40,0x01,0xFD,0x00,0x06,0xF1,0x8F,0x00,0x00,0xEA,0x00,
+    0x04,0xF3,0x8E,0x00,0x00,0xD9,0x00,0x03,0xF4,0x8E,0x00,0x00,0xD8,0x00,0x03,0xF4,
+    0x8E,0x00,0x00,0xD8,0x00,0x03,0xF4,0x8E,0x00,0x00,0xD8,0x00,0x03,0xF4,0x8E,0x00,
+    0x00,0xD8,0x00,0x03,0xF4,0x8E,0x1A,0xED,0x60,0x8E,0xA4,0x17,0xF3,0x8F,0x40,0x00,
+    0xD9,0x8F,0x00,0x00,0xBB,0x8E,0x00,0x00,0xAC,0x8E,0x00,0x00,0xAC,0x8E,0x00,0x00,
+    0xAC,0x8E,0x00,0x00,0xAC,0x8E,0x00,0x00,0xAC,0x00,0x4C,0xEE,0xA2,0x00,0x04,0xF9,
+    0x12,0xBE,0x20,0x0C,0xC0,0x00,0x1E,0x90,0x0F,0x80,0x00,0x0B,0xC0,0x1F,0x70,0x00,
+    0x0A,0xE0,0x0F,0x80,0x00,0x0B,0xC0,0x0C,0xC0,0x00,0x1E,0x90,0x04,0xF8,0x12,0xBE,
+    0x20,0x00,0x4C,0xFE,0xB2,0x00,0x8E,0x2B,0xED,0x70,0x00,0x8E,0xA4,0x16,0xF6,0x00,
+    0x8F,0x50,0x00,0x9D,0x00,0x8F,0x00,0x00,0x5F,0x20,0x8E,0x00,0x00,0x3F,0x40,0x8F,
+    0x00,0x00,0x5F,0x20,0x8F,0x50,0x00,0x9E,0x00,0x8E,0xA3,0x16,0xF6,0x00,0x8E,0x2B,
+    0xED,0x70,0x00,0x8E,0x00,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,0x00,0x8E,0x00,0x00,
+    0x00,0x00,0x00,0x5D,0xFC,0x3B,0xB0,0x04,0xF8,0x13,0xBC,0xB0,0x0B,0xC0,0x00,0x2F,
+    0xB0,0x0F,0x70,0x00,0x0D,0xB0,0x1F,0x60,0x00,0x0B,0xB0,0x0F,0x70,0x00,0x0D,0xB0,
+    0x0B,0xB0,0x00,0x2F,0xB0,0x04,0xF8,0x12,0xAC,0xB0,0x00,0x5D,0xFC,0x3B,0xB0,0x00,
+    0x00,0x00,0x0B,0xB0,0x00,0x00,0x00,0x0B,0xB0,0x00,0x00,0x00,0x0B,0xB0,0x8E,0x1A,
+    0xE9,0x8E,0xA4,0x00,0x8F,0x50,0x00,0x8F,0x00,0x00,0x8E,0x00,0x00,0x8E,0x00,0x00,
+    0x8E,0x00,0x00,0x8E,0x00,0x00,0x8E,0x00,0x00,0x02,0xAE,0xEC,0x50,0x0C,0xB2,0x13,
+    0xA1,0x0F,0x60,0x00,0x00,0x0D,0xD5,0x10,0x00,0x02,0xBF,0xFC,0x50,0x00,0x01,0x4A,
+    0xF4,0x00,0x00,0x00,0xF8,0x2A,0x41,0x16,0xF4,0x04,0xBE,0xEC,0x50,0x08,0xE0,0x00,
+    0x08,0xE0,0x00,0x8F,0xFF,0xFD,0x08,0xE0,0x00,0x08,0xE0,0x00,0x08,0xE0,0x00,0x08,
+    0xE0,0x00,0x08,0xE0,0x00,0x07,0xE0,0x00,0x05,0xF4,0x00,0x00,0x9E,0xFD,0xAC,0x00,
+    0x00,0xBA,0xAC,0x00,0x00,0xBA,0xAC,0x00,0x00,0xBA,0xAC,0x00,0x00,0xBA,0xAC,0x00,
+    0x00,0xBA,0x9D,0x00,0x00,0xDA,0x7E,0x10,0x02,0xFA,0x2F,0x91,0x3A,0xCA,0x05,0xDF,
+    0xB2,0xBA,0x5F,0x30,0x00,0x0B,0xC0,0x0E,0x80,0x00,0x1F,0x70,0x09,0xD0,0x00,0x7F,
+    0x10,0x04,0xF4,0x00,0xCB,0x00,0x00,0xD9,0x02,0xF5,0x00,0x00,0x8E,0x18,0xE1,0x00,
+    0x00,0x2F,0x5D,0x90,0x00,0x00,0x0C,0xDF,0x40,0x00,0x00,0x06,0xFD,0x00,0x00,0x3F,
+    0x40,0x06,0xF8,0x00,0x2F,0x40,0x0E,0x70,0x0A,0xEC,0x00,0x6F,0x10,0x0A,0xB0,0x0E,
+    0x8F,0x10,0xAC,0x00,0x07,0xF0,0x3F,0x1E,0x40,0xE8,0x00,0x03,0xF4,0x7C,0x0B,0x83,
+    0xF4,0x00,0x00,0xE8,0xB8,0x07,0xC6,0xF1,0x00,0x00,0xAC,0xE4,0x03,0xFB,0xB0,0x00,
+    0x00,0x6F,0xF1,0x00,0xEF,0x80,0x00,0x00,0x2F,0xC0,0x00,0xAF,0x40,0x00,0x1D,0xC0,
+    0x00,0x4F,0x60,0x03,0xF8,0x01,0xEA,0x00,0x00,0x7F,0x4B,0xD1,0x00,0x00,0x0B,0xFF,
+    0x40,0x00,0x00,0x05,0xFC,0x00,0x00,0x00,0x1E,0xCF,0x70,0x00,0x00,0xBD,0x18,0xF3,
+    0x00,0x07,0xF4,0x00,0xCD,0x10,0x3F,0x80,0x00,0x2E,0x90,0x5F,0x30,0x00,0x0B,0xC0,
+    0x0E,0x90,0x00,0x2F,0x60,0x08,0xE0,0x00,0x8E,0x10,0x02,0xF5,0x00,0xD9,0x00,0x00,
+    0xBB,0x04,0xF3,0x00,0x00,0x5F,0x2A,0xC0,0x00,0x00,0x0D,0x9F,0x60,0x00,0x00,0x08,
+    0xFE,0x10,0x00,0x00,0x02,0xF9,0x00,0x00,0x00,0x04,0xF3,0x00,0x00,0x00,0x1C,0xB0,
+    0x00,0x00,0x0B,0xFC,0x20,0x00,0x00,0x2F,0xFF,0xFF,0xFB,0x00,0x00,0x05,0xF8,0x00,
+    0x00,0x3E,0xC0,0x00,0x01,0xDD,0x10,0x00,0x0B,0xE3,0x00,0x00,0x9F,0x50,0x00,0x06,
+    0xF8,0x00,0x00,0x3F,0xB0,0x00,0x00,0x5F,0xFF,0xFF,0xFB,0x00,0x19,0xEF,0x30,0x00,
+    0x6F,0x40,0x00,0x00,0x8E,0x00,0x00,0x00,0x8D,0x00,0x00,0x00,0x8D,0x00,0x00,0x00,
+    0xAC,0x00,0x00,0x03,0xE9,0x00,0x00,0xFF,0xC1,0x00,0x00,0x03,0xE9,0x00,0x00,0x00,
+    0x9C,0x00,0x00,0x00,0x8D,0x00,0x00,0x00,0x8D,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,
+    0x6F,0x40,0x00,0x00,0x1A,0xEF,0x30,0xF5,0xF5,0xF5,0xF5,0xF5,0xF5,0xF5,0xF5,0xF5,
+    0xF5,0xF5,0xF5,0xF5,0xF5,0xF5,0xF5,0xFE,0xB2,0x00,0x00,0x02,0xE9,0x00,0x00,0x00,
+    0xBB,0x00,0x00,0x00,0xAB,0x00,0x00,0x00,0xAB,0x00,0x00,0x00,0xAC,0x00,0x00,0x00,
+    0x6F,0x50,0x00,0x00,0x0A,0xFF,0x30,0x00,0x6F,0x40,0x00,0x00,0xAC,0x00,0x00,0x00,
+    0xAB,0x00,0x00,0x00,0xAB,0x00,0x00,0x00,0xBB,0x00,0x00,0x02,0xE9,0x00,0x00,0xFE,
+    0xB2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xCE,0xD9,0x41,0x16,0xA0,0x4A,
+    0x30,0x37,0xCE,0xDA,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x9F,0x9F,0x00,0x00,0x7D,
+    0x8E,0x8F,0x9F,0x9F,0x9F,0x9F,0x9F,0x00,0x00,0xB1,0x00,0x00,0x00,0xB2,0x00,0x00,
+    0x7C,0xFD,0x70,0x0A,0xE5,0xB3,0x84,0x4F,0x50,0xB2,0x00,0x8F,0x00,0xB2,0x00,0xAE,
+    0x00,0xB1,0x00,0x8F,0x00,0xB1,0x00,0x4F,0x50,0xB1,0x00,0x0B,0xE5,0xB3,0x84,0x00,
+    0x7D,0xFE,0x80,0x00,0x00,0xB1,0x00,0x00,0x00,0xB1,0x00,0x00,0x18,0xDE,0xA2,0x00,
+    0x9E,0x41,0x57,0x00,0xE9,0x00,0x00,0x02,0xF7,0x00,0x00,0x02,0xF6,0x00,0x00,0x02,
+    0xF6,0x00,0x00,0xBF,0xFF,0xFF,0x70,0x02,0xF6,0x00,0x00,0x02,0xF6,0x00,0x00,0x02,
+    0xF6,0x00,0x00,0x02,0xF6,0x00,0x00,0xFF,0xFF,0xFF,0xFC,0x1B,0x40,0x00,0x02,0xC2,
+    0x08,0xFA,0xEE,0xBD,0xA1,0x00,0xCC,0x21,0xAF,0x10,0x01,0xF3,0x00,0x1E,0x40,0x03,
+    0xF1,0x00,0x0D,0x60,0x01,0xF3,0x00,0x1E,0x40,0x00,0xCC,0x21,0xAE,0x00,0x08,0xEA,
+    0xEE,0xAD,0xB1,0x1B,0x40,0x00,0x02,0xB2,0x2F,0x60,0x00,0x03,0xF4,0x09,0xD0,0x00,
+    0x0B,0xC0,0x02,0xF6,0x00,0x3F,0x40,0x00,0x9D,0x00,0xBC,0x00,0x00,0x2F,0x63,0xF4,
+    0x00,0x0E,0xFF,0xDB,0xFF,0xF2,0x00,0x02,0xFF,0x40,0x00,0x00,0x00,0xBE,0x00,0x00,
+    0x0E,0xFF,0xFF,0xFF,0xF2,0x00,0x00,0xAD,0x00,0x00,0x00,0x00,0xAD,0x00,0x00,0x00,
+    0x00,0xAD,0x00,0x00,0xF5,0xF5,0xF5,0xF5,0xF5,0xF5,0x00,0x00,0xF5,0xF5,0xF5,0xF5,
+    0xF5,0xF5,0x01,0xAE,0xFF,0x70,0x09,0xD2,0x00,0x00,0x0A,0xC0,0x00,0x00,0x03,0xFC,
+    0x30,0x00,0x09,0xDC,0xF7,0x00,0x2F,0x30,0x8F,0x80,0x4F,0x10,0x07,0xF2,0x1F,0x90,
+    0x01,0xF3,0x06,0xFA,0x14,0xF1,0x00,0x5E,0xDE,0x60,0x00,0x01,0xAF,0x40,0x00,0x00,
+    0x0C,0xA0,0x00,0x00,0x3E,0x80,0x0A,0xFF,0xE9,0x10,0x5F,0x44,0xF5,0x5F,0x44,0xF5,
+    0x00,0x06,0xCE,0xEC,0x60,0x00,0x01,0xBB,0x41,0x14,0xAB,0x10,0x0A,0x71,0x9E,0xFF,
+    0x57,0xA0,0x4B,0x0B,0xC3,0x00,0x00,0xA4,0x94,0x3F,0x20,0x00,0x00,0x49,0xB1,0x6D,
+    0x00,0x00,0x00,0x1B,0xB1,0x6D,0x00,0x00,0x00,0x1B,0x94,0x3F,0x20,0x00,0x00,0x49,
+    0x4B,0x0B,0xC3,0x00,0x00,0xA4,0x0A,0x81,0x9E,0xFF,0x57,0xA0,0x01,0xBB,0x41,0x14,
+    0xAB,0x10,0x00,0x06,0xCE,0xEC,0x60,0x00,0x09,0xFF,0xD7,0x00,0x00,0x00,0x2D,0x40,
+    0x04,0xCE,0xFF,0x70,0x0E,0x51,0x0C,0x70,0x0F,0x51,0x5F,0x70,0x06,0xEE,0x9B,0x70,
+    0x00,0x00,0x00,0x00,0x0E,0xFF,0xFF,0x70,0x00,0x08,0x00,0x54,0x01,0xBB,0x07,0xE3,
+    0x2D,0xA1,0x9D,0x30,0xBC,0x05,0xF3,0x00,0x2D,0xA1,0x9D,0x30,0x01,0xBB,0x07,0xE3,
+    0x00,0x08,0x00,0x54,0x4F,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x00,0x00,0x09,0xB0,
+    0x00,0x00,0x00,0x00,0x09,0xB0,0x00,0x00,0x00,0x00,0x09,0xB0,0x00,0x00,0x00,0x00,
+    0x09,0xB0,0x3F,0xFF,0xF0,0x00,0x06,0xCE,0xEC,0x60,0x00,0x01,0xBB,0x41,0x14,0xAB,
+    0x10,0x0A,0x76,0xFF,0xEA,0x17,0xA0,0x4B,0x06,0xC0,0x1D,0x70,0xA4,0x94,0x06,0xC0,
+    0x1C,0x70,0x49,0xB1,0x06,0xFF,0xF9,0x10,0x1B,0xB1,0x06,0xC1,0xC9,0x00,0x1B,0x94,
+    0x06,0xC0,0x4F,0x10,0x49,0x4B,0x06,0xC0,0x0D,0x80,0xA4,0x0A,0x86,0xC0,0x06,0xE8,
+    0xA0,0x01,0xBB,0x41,0x14,0xAB,0x10,0x00,0x06,0xCE,0xEC,0x60,0x00,0x5F,0xFF,0xF5,
+    0x06,0xED,0x60,0x3D,0x22,0xD3,0x68,0x00,0x87,0x3D,0x22,0xD4,0x07,0xEE,0x70,0x00,
+    0x00,0x0E,0x50,0x00,0x00,0x00,0x00,0x0E,0x50,0x00,0x00,0x00,0x00,0x0E,0x50,0x00,
+    0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x0E,0x50,0x00,0x00,0x00,0x00,0x0E,
+    0x50,0x00,0x00,0x00,0x00,0x0E,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0xB0,0x3F,0xFE,0x80,0x00,0x03,
+    0xE4,0x00,0x01,0xE3,0x00,0x0A,0x90,0x00,0x9A,0x00,0x0A,0xA0,0x00,0x4F,0xFF,0xF6,
+    0x0F,0xFE,0x90,0x00,0x02,0xD5,0x00,0x02,0xD4,0x00,0xFF,0xA0,0x00,0x02,0xC7,0x00,
+    0x02,0xC8,0x4F,0xFE,0xA1,0x00,0x4F,0x40,0x01,0xE6,0x00,0x0B,0x80,0x00,0xAC,0x00,
+    0x00,0xBA,0x00,0xAC,0x00,0x00,0xBA,0x00,0xAC,0x00,0x00,0xBA,0x00,0xAC,0x00,0x00,
+    0xBA,0x00,0xAC,0x00,0x00,0xBA,0x00,0xAC,0x00,0x00,0xCA,0x00,0xAE,0x00,0x00,0xEA,
+    0x00,0xAF,0x71,0x18,0xFC,0x00,0xAC,0x9E,0xE9,0x6E,0xA0,0xAC,0x00,0x00,0x00,0x00,
+    0xAC,0x00,0x00,0x00,0x00,0xAC,0x00,0x00,0x00,0x00,0x03,0xBE,0xFF,0xF7,0x3F,0xFF,
+    0xD0,0xA7,0x9F,0xFF,0xD0,0xA7,0xBF,0xFF,0xD0,0xA7,0x9F,0xFF,0xD0,0xA7,0x2F,0xFF,
+    0xD0,0xA7,0x03,0xAE,0xD0,0xA7,0x00,0x04,0xD0,0xA7,0x00,0x04,0xD0,0xA7,0x00,0x04,
+    0xD0,0xA7,0x00,0x04,0xD0,0xA7,0x00,0x04,0xD0,0xA7,0x00,0x04,0xD0,0xA7,0x00,0x04,
+    0xD0,0xA7,0x4F,0x50,0x4F,0x50,0x01,0xC1,0x00,0xB7,0xAF,0xD3,0xEF,0xE0,0x00,0x03,
+    0xE0,0x00,0x03,0xE0,0x00,0x03,0xE0,0x00,0x03,0xE0,0x00,0x03,0xE0,0x00,0xCF,0xFF,
+    0x80,0x02,0xBE,0xD7,0x00,0x0D,0x91,0x3D,0x60,0x3F,0x10,0x08,0xB0,0x3F,0x10,0x08,
+    0xA0,0x0D,0x91,0x3D,0x60,0x02,0xBE,0xD7,0x00,0x00,0x00,0x00,0x00,0x0E,0xFF,0xFF,
+    0x70,0x63,0x01,0x70,0x00,0x5E,0x41,0xD9,0x00,0x05,0xE6,0x1C,0xB1,0x00,0x6F,0x21,
+    0xE8,0x05,0xE6,0x1C,0xB1,0x5E,0x41,0xD9,0x00,0x63,0x01,0x70,0x00,0xEF,0xE0,0x00,
+    0x00,0x08,0xB0,0x00,0x03,0xE0,0x00,0x00,0x2E,0x20,0x00,0x03,0xE0,0x00,0x00,0xB8,
+    0x00,0x00,0x03,0xE0,0x00,0x05,0xD0,0x00,0x00,0x03,0xE0,0x00,0x1E,0x40,0x00,0x00,
+    0x03,0xE0,0x00,0x9A,0x00,0x0A,0xE0,0xCF,0xFF,0x83,0xE2,0x00,0x4B,0xE0,0x00,0x00,
+    0x0C,0x70,0x01,0xC4,0xE0,0x00,0x00,0x6D,0x00,0x08,0x53,0xE0,0x00,0x01,0xE4,0x00,
+    0x3B,0x03,0xE0,0x00,0x09,0xA0,0x00,0x6F,0xFF,0xFF,0x00,0x3E,0x10,0x00,0x00,0x03,
+    0xE0,0xEF,0xE0,0x00,0x00,0x08,0xB0,0x00,0x03,0xE0,0x00,0x00,0x2E,0x20,0x00,0x03,
+    0xE0,0x00,0x00,0xB8,0x00,0x00,0x03,0xE0,0x00,0x05,0xD0,0x00,0x00,0x03,0xE0,0x00,
+    0x1E,0x40,0x00,0x00,0x03,0xE0,0x00,0x9A,0x2F,0xFE,0x90,0xCF,0xFF,0x83,0xE2,0x00,
+    0x03,0xE5,0x00,0x00,0x0C,0x70,0x00,0x00,0xD4,0x00,0x00,0x6D,0x00,0x00,0x08,0xA0,
+    0x00,0x01,0xE4,0x00,0x00,0x8B,0x10,0x00,0x09,0xA0,0x00,0x09,0xB1,0x00,0x00,0x3E,
+    0x10,0x00,0x3F,0xFF,0xF8,0x0F,0xFE,0x90,0x00,0x00,0x8B,0x00,0x00,0x00,0x02,0xD5,
+    0x00,0x02,0xE2,0x00,0x00,0x00,0x02,0xD4,0x00,0x0B,0x80,0x00,0x00,0x00,0xFF,0xA0,
+    0x00,0x5D,0x00,0x00,0x00,0x00,0x02,0xC7,0x01,0xE4,0x00,0x00,0x00,0x00,0x02,0xC8,
+    0x09,0xA0,0x00,0xAE,0x00,0x4F,0xFE,0xA1,0x3E,0x20,0x04,0xBE,0x00,0x00,0x00,0x00,
+    0xC7,0x00,0x1C,0x4E,0x00,0x00,0x00,0x06,0xD0,0x00,0x85,0x3E,0x00,0x00,0x00,0x1E,
+    0x40,0x03,0xB0,0x3E,0x00,0x00,0x00,0x9A,0x00,0x06,0xFF,0xFF,0xF0,0x00,0x03,0xE1,
+    0x00,0x00,0x00,0x3E,0x00,0x00,0x2F,0x70,0x00,0x00,0x2F,0x70,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x1F,0x60,0x00,0x00,0x2F,0x60,0x00,0x00,0x5F,0x30,0x00,0x03,0xEA,0x00,
+    0x00,0x2E,0xC1,0x00,0x00,0xBE,0x10,0x00,0x00,0xCB,0x00,0x00,0x00,0x8F,0x51,0x38,
+    0x50,0x08,0xDE,0xC6,0x00,0x00,0x02,0xD6,0x00,0x00,0x00,0x00,0x00,0x2D,0x30,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x80,0x00,0x00,0x00,0x01,0xEF,
+    0xE0,0x00,0x00,0x00,0x05,0xF7,0xF4,0x00,0x00,0x00,0x0B,0xD0,0xEA,0x00,0x00,0x00,
+    0x2F,0x80,0x9F,0x10,0x00,0x00,0x7F,0x30,0x3F,0x60,0x00,0x00,0xDD,0x00,0x0D,0xC0,
+    0x00,0x03,0xF7,0x00,0x08,0xF2,0x00,0x09,0xFF,0xFF,0xFF,0xF8,0x00,0x0E,0xA0,0x00,
+    0x00,0xBD,0x00,0x5F,0x50,0x00,0x00,0x5F,0x40,0xAE,0x00,0x00,0x00,0x1E,0x90,0x00,
+    0x00,0x07,0xC1,0x00,0x00,0x00,0x00,0x4D,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x9F,0x80,0x00,0x00,0x00,0x01,0xEF,0xE0,0x00,0x00,0x00,0x05,0xF7,
+    0xF4,0x00,0x00,0x00,0x0B,0xD0,0xEA,0x00,0x00,0x00,0x2F,0x80,0x9F,0x10,0x00,0x00,
+    0x7F,0x30,0x3F,0x60,0x00,0x00,0xDD,0x00,0x0D,0xC0,0x00,0x03,0xF7,0x00,0x08,0xF2,
+    0x00,0x09,0xFF,0xFF,0xFF,0xF8,0x00,0x0E,0xA0,0x00,0x00,0xBD,0x00,0x5F,0x50,0x00,
+    0x00,0x5F,0x40,0xAE,0x00,0x00,0x00,0x1E,0x90,0x00,0x00,0xAD,0x90,0x00,0x00,0x00,
+    0x08,0xA0,0xA6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x80,0x00,
+    0x00,0x00,0x01,0xEF,0xE0,0x00,0x00,0x00,0x05,0xF7,0xF4,0x00,0x00,0x00,0x0B,0xD0,
+    0xEA,0x00,0x00,0x00,0x2F,0x80,0x9F,0x10,0x00,0x00,0x7F,0x30,0x3F,0x60,0x00,0x00,
+    0xDD,0x00,0x0D,0xC0,0x00,0x03,0xF7,0x00,0x08,0xF2,0x00,0x09,0xFF,0xFF,0xFF,0xF8,
+    0x00,0x0E,0xA0,0x00,0x00,0xBD,0x00,0x5F,0x50,0x00,0x00,0x5F,0x40,0xAE,0x00,0x00,
+    0x00,0x1E,0x90,0x00,0x08,0xE8,0x2E,0x00,0x00,0x00,0x1E,0x29,0xE7,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x80,0x00,0x00,0x00,0x01,0xEF,0xE0,0x00,
+    0x00,0x00,0x05,0xF7,0xF4,0x00,0x00,0x00,0x0B,0xD0,0xEA,0x00,0x00,0x00,0x2F,0x80,
+    0x9F,0x10,0x00,0x00,0x7F,0x30,0x3F,0x60,0x00,0x00,0xDD,0x00,0x0D,0xC0,0x00,0x03,
+    0xF7,0x00,0x08,0xF2,0x00,0x09,0xFF,0xFF,0xFF,0xF8,0x00,0x0E,0xA0,0x00,0x00,0xBD,
+    0x00,0x5F,0x50,0x00,0x00,0x5F,0x40,0xAE,0x00,0x00,0x00,0x1E,0x90,0x00,0x0D,0xB0,
+    0xCC,0x00,0x00,0x00,0x0D,0xB0,0xCC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x9F,0x80,0x00,0x00,0x00,0x01,0xEF,0xE0,0x00,0x00,0x00,0x05,0xF7,0xF4,0x00,
+    0x00,0x00,0x0B,0xD0,0xEA,0x00,0x00,0x00,0x2F,0x80,0x9F,0x10,0x00,0x00,0x7F,0x30,
+    0x3F,0x60,0x00,0x00,0xDD,0x00,0x0D,0xC0,0x00,0x03,0xF7,0x00,0x08,0xF2,0x00,0x09,
+    0xFF,0xFF,0xFF,0xF8,0x00,0x0E,0xA0,0x00,0x00,0xBD,0x00,0x5F,0x50,0x00,0x00,0x5F,
+    0x40,0xAE,0x00,0x00,0x00,0x1E,0x90,0x00,0x01,0xBE,0xA1,0x00,0x00,0x00,0x08,0x81,
+    0x98,0x00,0x00,0x00,0x08,0x81,0x97,0x00,0x00,0x00,0x01,0xDF,0xD1,0x00,0x00,0x00,
+    0x01,0xEE,0xE0,0x00,0x00,0x00,0x06,0xF6,0xF5,0x00,0x00,0x00,0x0B,0xC0,0xDA,0x00,
+    0x00,0x00,0x2F,0x70,0x8F,0x10,0x00,0x00,0x7F,0x30,0x3F,0x60,0x00,0x00,0xDD,0x00,
+    0x0D,0xC0,0x00,0x03,0xF8,0x00,0x08,0xF2,0x00,0x09,0xFF,0xFF,0xFF,0xF8,0x00,0x0E,
+    0xA0,0x00,0x00,0xBD,0x00,0x5F,0x50,0x00,0x00,0x5F,0x40,0xAE,0x00,0x00,0x00,0x1E,
+    0x90,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0xAD,0x0E,0x90,0x00,0x00,
+    0x00,0x00,0x01,0xF7,0x0E,0x90,0x00,0x00,0x00,0x00,0x07,0xF2,0x0E,0x90,0x00,0x00,
+    0x00,0x00,0x0D,0xB0,0x0E,0x90,0x00,0x00,0x00,0x00,0x4F,0x60,0x0E,0xFF,0xFF,0xFF,
+    0x30,0x00,0xBE,0x10,0x0E,0x90,0x00,0x00,0x00,0x02,0xFA,0x00,0x0E,0x90,0x00,0x00,
+    0x00,0x08,0xFF,0xFF,0xFF,0x90,0x00,0x00,0x00,0x0E,0xB0,0x00,0x0E,0x90,0x00,0x00,
+    0x00,0x5F,0x40,0x00,0x0E,0x90,0x00,0x00,0x00,0xBD,0x00,0x00,0x0E,0xFF,0xFF,0xFF,
+    0x80,0x00,0x03,0xAD,0xFD,0xB5,0x00,0x00,0x6F,0x92,0x02,0x7F,0x50,0x03,0xF8,0x00,
+    0x00,0x03,0x40,0x0A,0xE0,0x00,0x00,0x00,0x00,0x0E,0xB0,0x00,0x00,0x00,0x00,0x1F,
+    0x90,0x00,0x00,0x00,0x00,0x1F,0x90,0x00,0x00,0x00,0x00,0x0E,0xB0,0x00,0x00,0x00,
+    0x00,0x0A,0xE0,0x00,0x00,0x00,0x00,0x03,0xF7,0x00,0x00,0x03,0x40,0x00,0x6F,0x92,
+    0x02,0x7F,0x50,0x00,0x03,0xAE,0xFD,0xB5,0x00,0x00,0x00,0x00,0x96,0x00,0x00,0x00,
+    0x00,0x00,0x6C,0x00,0x00,0x00,0x00,0x5E,0xE7,0x00,0x00,0x00,0x4E,0x30,0x00,0x00,
+    0x00,0x05,0xD1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFE,0x00,0x6F,
+    0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,
+    0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFB,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,
+    0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,
+    0x00,0x6F,0xFF,0xFF,0xFF,0x10,0x00,0x00,0xBA,0x00,0x00,0x00,0x07,0xB0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFE,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,
+    0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0xFF,
+    0xFF,0xFB,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,
+    0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,
+    0x10,0x00,0x1D,0xD6,0x00,0x00,0x00,0xB6,0x1C,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x6F,0xFF,0xFF,0xFE,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,
+    0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFB,0x00,0x6F,0x20,
+    0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,
+    0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0x10,0x01,0xF8,0x0F,0x80,
+    0x00,0x01,0xF8,0x0F,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFE,0x00,
+    0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,
+    0x20,0x00,0x00,0x00,0x6F,0xFF,0xFF,0xFB,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,
+    0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,
+    0x00,0x00,0x6F,0xFF,0xFF,0xFF,0x10,0x2E,0x50,0x03,0xD2,0x00,0x00,0x06,0xF2,0x06,
+    0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,0xF2,0x06,
+    0xF2,0x06,0xF2,0x06,0xF2,0x09,0xC0,0x5D,0x10,0x00,0x00,0x6F,0x20,0x6F,0x20,0x6F,
+    0x20,0x6F,0x20,0x6F,0x20,0x6F,0x20,0x6F,0x20,0x6F,0x20,0x6F,0x20,0x6F,0x20,0x6F,
+    0x20,0x6F,0x20,0x0B,0xD8,0x00,0x98,0x1B,0x50,0x00,0x00,0x00,0x06,0xF2,0x00,0x06,
+    0xF2,0x00,0x06,0xF2,0x00,0x06,0xF2,0x00,0x06,0xF2,0x00,0x06,0xF2,0x00,0x06,0xF2,
+    0x00,0x06,0xF2,0x00,0x06,0xF2,0x00,0x06,0xF2,0x00,0x06,0xF2,0x00,0x06,0xF2,0x00,
+    0xEA,0x0D,0xA0,0xEA,0x0D,0xA0,0x00,0x00,0x00,0x06,0xF2,0x00,0x06,0xF2,0x00,0x06,
+    0xF2,0x00,0x06,0xF2,0x00,0x06,0xF2,0x00,0x06,0xF2,0x00,0x06,0xF2,0x00,0x06,0xF2,
+    0x00,0x06,0xF2,0x00,0x06,0xF2,0x00,0x06,0xF2,0x00,0x06,0xF2,0x00,0x05,0xFF,0xFE,
+    0xDA,0x50,0x00,0x05,0xF4,0x00,0x27,0xEC,0x10,0x05,0xF4,0x00,0x00,0x2E,0xA0,0x05,
+    0xF4,0x00,0x00,0x09,0xF1,0x05,0xF4,0x00,0x00,0x05,0xF5,0xEF,0xFF,0xFD,0x00,0x03,
+    0xF6,0x05,0xF4,0x00,0x00,0x04,0xF6,0x05,0xF4,0x00,0x00,0x05,0xF5,0x05,0xF4,0x00,
+    0x00,0x09,0xF1,0x05,0xF4,0x00,0x00,0x2E,0xA0,0x05,0xF4,0x00,0x26,0xEC,0x10,0x05,
+    0xFF,0xFF,0xDB,0x60,0x00,0x00,0x2D,0xC4,0x87,0x00,0x00,0x88,0x4D,0xD2,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x6F,0xE1,0x00,0x02,0xF6,0x6F,0xF7,0x00,0x02,0xF6,0x6F,0xBE,
+    0x10,0x02,0xF6,0x6F,0x4F,0x80,0x02,0xF6,0x6F,0x29,0xE1,0x02,0xF6,0x6F,0x22,0xF8,
+    0x02,0xF6,0x6F,0x20,0x8E,0x12,0xF6,0x6F,0x20,0x1E,0x92,0xF6,0x6F,0x20,0x08,0xF4,
+    0xF6,0x6F,0x20,0x01,0xEB,0xF6,0x6F,0x20,0x00,0x7F,0xF6,0x6F,0x20,0x00,0x1E,0xF6,
+    0x00,0x00,0x3E,0x40,0x00,0x00,0x00,0x00,0x04,0xD1,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x04,0xBE,0xFD,0x81,0x00,0x00,0x7F,0x82,0x03,0xCD,0x20,0x03,0xF8,
+    0x00,0x00,0x1D,0xC0,0x0A,0xE1,0x00,0x00,0x06,0xF4,0x0E,0xB0,0x00,0x00,0x02,0xF8,
+    0x1F,0x90,0x00,0x00,0x00,0xFA,0x1F,0x90,0x00,0x00,0x00,0xFA,0x0E,0xB0,0x00,0x00,
+    0x02,0xF8,0x0A,0xE0,0x00,0x00,0x06,0xF4,0x04,0xF8,0x00,0x00,0x1D,0xC0,0x00,0x7F,
+    0x82,0x03,0xCE,0x20,0x00,0x04,0xBE,0xFD,0x91,0x00,0x00,0x00,0x00,0xAB,0x00,0x00,
+    0x00,0x00,0x06,0xC1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xBE,0xFD,
+    0x81,0x00,0x00,0x7F,0x82,0x03,0xCD,0x20,0x03,0xF8,0x00,0x00,0x1D,0xC0,0x0A,0xE1,
+    0x00,0x00,0x06,0xF4,0x0E,0xB0,0x00,0x00,0x02,0xF8,0x1F,0x90,0x00,0x00,0x00,0xFA,
+    0x1F,0x90,0x00,0x00,0x00,0xFA,0x0E,0xB0,0x00,0x00,0x02,0xF8,0x0A,0xE0,0x00,0x00,
+    0x06,0xF4,0x04,0xF8,0x00,0x00,0x1D,0xC0,0x00,0x7F,0x82,0x03,0xCE,0x20,0x00,0x04,
+    0xBE,0xFD,0x91,0x00,0x00,0x00,0x1C,0xD7,0x00,0x00,0x00,0x00,0xA7,0x1C,0x40,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xBE,0xFD,0x81,0x00,0x00,0x7F,0x82,0x03,
+    0xCD,0x20,0x03,0xF8,0x00,0x00,0x1D,0xC0,0x0A,0xE1,0x00,0x00,0x06,0xF4,0x0E,0xB0,
+    0x00,0x00,0x02,0xF8,0x1F,0x90,0x00,0x00,0x00,0xFA,0x1F,0x90,0x00,0x00,0x00,0xFA,
+    0x0E,0xB0,0x00,0x00,0x02,0xF8,0x0A,0xE0,0x00,0x00,0x06,0xF4,0x04,0xF8,0x00,0x00,
+    0x1D,0xC0,0x00,0x7F,0x82,0x03,0xCE,0x20,0x00,0x04,0xBE,0xFD,0x91,0x00,0x00,0x00,
+    0xBE,0x74,0xC0,0x00,0x00,0x03,0xC2,0xAE,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x04,0xBE,0xFD,0x81,0x00,0x00,0x7F,0x82,0x03,0xCD,0x20,0x03,0xF8,0x00,0x00,
+    0x1D,0xC0,0x0A,0xE1,0x00,0x00,0x06,0xF4,0x0E,0xB0,0x00,0x00,0x02,0xF8,0x1F,0x90,
+    0x00,0x00,0x00,0xFA,0x1F,0x90,0x00,0x00,0x00,0xFA,0x0E,0xB0,0x00,0x00,0x02,0xF8,
+    0x0A,0xE0,0x00,0x00,0x06,0xF4,0x04,0xF8,0x00,0x00,0x1D,0xC0,0x00,0x7F,0x82,0x03,
+    0xCE,0x20,0x00,0x04,0xBE,0xFD,0x91,0x00,0x00,0x00,0xF9,0x0E,0x90,0x00,0x00,0x00,
+    0xF9,0x0E,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xBE,0xFD,0x81,0x00,
+    0x00,0x7F,0x82,0x03,0xCD,0x20,0x03,0xF8,0x00,0x00,0x1D,0xC0,0x0A,0xE1,0x00,0x00,
+    0x06,0xF4,0x0E,0xB0,0x00,0x00,0x02,0xF8,0x1F,0x90,0x00,0x00,0x00,0xFA,0x1F,0x90,
+    0x00,0x00,0x00,0xFA,0x0E,0xB0,0x00,0x00,0x02,0xF8,0x0A,0xE0,0x00,0x00,0x06,0xF4,
+    0x04,0xF8,0x00,0x00,0x1D,0xC0,0x00,0x7F,0x82,0x03,0xCE,0x20,0x00,0x04,0xBE,0xFD,
+    0x91,0x00,0x69,0x00,0x00,0x04,0xB1,0x4F,0x90,0x00,0x4E,0xA0,0x04,0xF9,0x04,0xEA,
+    0x00,0x00,0x4F,0xBE,0xA0,0x00,0x00,0x07,0xFD,0x00,0x00,0x00,0x4E,0xBE,0xA0,0x00,
+    0x04,0xE9,0x04,0xEA,0x00,0x4E,0x90,0x00,0x4E,0xA0,0x69,0x00,0x00,0x04,0xB1,0x00,
+    0x00,0x00,0x00,0x00,0x11,0x00,0x04,0xAE,0xED,0x93,0xC8,0x00,0x6F,0x82,0x04,0xCF,
+    0xB0,0x03,0xF8,0x00,0x00,0x8F,0xE1,0x0A,0xE1,0x00,0x06,0xE8,0xF5,0x0E,0xB0,0x00,
+    0x3E,0x32,0xF9,0x1F,0x90,0x01,0xD6,0x00,0xFA,0x1F,0x90,0x0C,0x90,0x00,0xFA,0x0F,
+    0xB0,0x9B,0x00,0x02,0xF8,0x0B,0xE7,0xD1,0x00,0x06,0xF4,0x05,0xFF,0x30,0x00,0x1D,
+    0xC0,0x02,0xFF,0x92,0x03,0xCD,0x20,0x1C,0x75,0xBE,0xFD,0x81,0x00,0x02,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x09,0xC0,0x00,0x00,0x00,0x00,0xA8,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,
+    0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,
+    0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x8F,0x10,0x00,0x05,0xF4,0x4F,
+    0x50,0x00,0x09,0xE1,0x0B,0xD4,0x12,0x7F,0x70,0x01,0x8D,0xFE,0xC5,0x00,0x00,0x00,
+    0x2E,0x50,0x00,0x00,0x01,0xC6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x00,
+    0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,
+    0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,
+    0x9F,0x00,0x00,0x04,0xF5,0x8F,0x10,0x00,0x05,0xF4,0x4F,0x50,0x00,0x09,0xE1,0x0B,
+    0xD4,0x12,0x7F,0x70,0x01,0x8D,0xFE,0xC5,0x00,0x00,0x04,0xDD,0x20,0x00,0x00,0x3D,
+    0x25,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,
+    0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,
+    0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,
+    0x8F,0x10,0x00,0x05,0xF4,0x4F,0x50,0x00,0x09,0xE1,0x0B,0xD4,0x12,0x7F,0x70,0x01,
+    0x8D,0xFE,0xC5,0x00,0x00,0x7F,0x26,0xF3,0x00,0x00,0x7F,0x26,0xF3,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,
+    0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,
+    0xF5,0x9F,0x00,0x00,0x04,0xF5,0x9F,0x00,0x00,0x04,0xF5,0x8F,0x10,0x00,0x05,0xF4,
+    0x4F,0x50,0x00,0x09,0xE1,0x0B,0xD4,0x12,0x7F,0x70,0x01,0x8D,0xFE,0xC5,0x00,0x00,
+    0x00,0x2E,0x50,0x00,0x00,0x00,0xC7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xBE,0x10,
+    0x00,0x03,0xF7,0x2E,0xA0,0x00,0x0C,0xC0,0x06,0xF5,0x00,0x8F,0x30,0x00,0xBE,0x13,
+    0xF8,0x00,0x00,0x2E,0x9C,0xC0,0x00,0x00,0x06,0xFF,0x30,0x00,0x00,0x00,0xEB,0x00,
+    0x00,0x00,0x00,0xEA,0x00,0x00,0x00,0x00,0xEA,0x00,0x00,0x00,0x00,0xEA,0x00,0x00,
+    0x00,0x00,0xEA,0x00,0x00,0x00,0x00,0xEA,0x00,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,
+    0x20,0x00,0x00,0x00,0x6F,0xFF,0xEC,0x70,0x00,0x6F,0x20,0x17,0xF8,0x00,0x6F,0x20,
+    0x00,0xBE,0x00,0x6F,0x20,0x00,0x9F,0x10,0x6F,0x20,0x00,0xBE,0x00,0x6F,0x20,0x17,
+    0xF8,0x00,0x6F,0xFF,0xEC,0x70,0x00,0x6F,0x20,0x00,0x00,0x00,0x6F,0x20,0x00,0x00,
+    0x00,0x6F,0x20,0x00,0x00,0x00,0x03,0xBE,0xEB,0x20,0x00,0x2E,0x91,0x1A,0xD0,0x00,
+    0x6F,0x10,0x03,0xF3,0x00,0x8E,0x00,0x8E,0xA3,0x00,0x8E,0x04,0xF3,0x00,0x00,0x8E,
+    0x07,0xE0,0x00,0x00,0x8E,0x04,0xF9,0x10,0x00,0x8E,0x00,0x7F,0xD3,0x00,0x8E,0x00,
+    0x03,0xCE,0x20,0x8E,0x00,0x00,0x3F,0x40,0x8E,0x00,0x01,0x8E,0x20,0x8E,0x3F,0xFE,
+    0xB4,0x00,0x00,0x9D,0x10,0x00,0x00,0x00,0x0B,0x90,0x00,0x00,0x00,0x01,0xD5,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFD,0xA2,0x00,0x00,0x00,0x03,0xBC,0x00,
+    0x00,0x00,0x00,0x2F,0x30,0x00,0x7D,0xEF,0xFF,0x50,0x09,0xE4,0x10,0x2F,0x50,0x0E,
+    0x80,0x00,0x3F,0x50,0x0E,0x70,0x00,0x9F,0x50,0x0A,0xD3,0x16,0xAF,0x50,0x01,0xAE,
+    0xE9,0x2F,0x50,0x00,0x00,0x0A,0xC1,0x00,0x00,0x00,0x5D,0x20,0x00,0x00,0x02,0xE3,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFD,0xA2,0x00,0x00,0x00,0x03,0xBC,
+    0x00,0x00,0x00,0x00,0x2F,0x30,0x00,0x7D,0xEF,0xFF,0x50,0x09,0xE4,0x10,0x2F,0x50,
+    0x0E,0x80,0x00,0x3F,0x50,0x0E,0x70,0x00,0x9F,0x50,0x0A,0xD3,0x16,0xAF,0x50,0x01,
+    0xAE,0xE9,0x2F,0x50,0x00,0x04,0xF8,0x00,0x00,0x00,0x0D,0x6E,0x30,0x00,0x00,0x89,
+    0x05,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFD,0xA2,0x00,0x00,0x00,0x03,
+    0xBC,0x00,0x00,0x00,0x00,0x2F,0x30,0x00,0x7D,0xEF,0xFF,0x50,0x09,0xE4,0x10,0x2F,
+    0x50,0x0E,0x80,0x00,0x3F,0x50,0x0E,0x70,0x00,0x9F,0x50,0x0A,0xD3,0x16,0xAF,0x50,
+    0x01,0xAE,0xE9,0x2F,0x50,0x00,0x6E,0x91,0xD2,0x00,0x00,0xD3,0x6E,0xA0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x06,0xFF,0xFD,0xA2,0x00,0x00,0x00,0x03,0xBC,0x00,0x00,0x00,
+    0x00,0x2F,0x30,0x00,0x7D,0xEF,0xFF,0x50,0x09,0xE4,0x10,0x2F,0x50,0x0E,0x80,0x00,
+    0x3F,0x50,0x0E,0x70,0x00,0x9F,0x50,0x0A,0xD3,0x16,0xAF,0x50,0x01,0xAE,0xE9,0x2F,
+    0x50,0x00,0xAE,0x09,0xF0,0x00,0x00,0xAE,0x09,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x06,0xFF,0xFD,0xA2,0x00,0x00,0x00,0x03,0xBC,0x00,0x00,0x00,0x00,0x2F,0x30,0x00,
+    0x7D,0xEF,0xFF,0x50,0x09,0xE4,0x10,0x2F,0x50,0x0E,0x80,0x00,0x3F,0x50,0x0E,0x70,
+    0x00,0x9F,0x50,0x0A,0xD3,0x16,0xAF,0x50,0x01,0xAE,0xE9,0x2F,0x50,0x00,0x0A,0xEC,
+    0x20,0x00,0x00,0x6A,0x17,0xA0,0x00,0x00,0x6A,0x16,0xA0,0x00,0x00,0x0A,0xEC,0x20,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xFD,0xA2,0x00,0x00,0x00,0x03,0xBC,0x00,
+    0x00,0x00,0x00,0x2F,0x30,0x00,0x7D,0xEF,0xFF,0x50,0x09,0xE4,0x10,0x2F,0x50,0x0E,
+    0x80,0x00,0x3F,0x50,0x0E,0x70,0x00,0x9F,0x50,0x0A,0xD3,0x16,0xAF,0x50,0x01,0xAE,
+    0xE9,0x2F,0x50,0x06,0xFF,0xFE,0xB4,0x6C,0xEE,0xB3,0x00,0x00,0x00,0x03,0xBF,0xF8,
+    0x21,0x9F,0x30,0x00,0x00,0x00,0x2F,0xB0,0x00,0x0D,0xA0,0x00,0x7D,0xEF,0xFF,0x60,
+    0x00,0x0A,0xD0,0x09,0xE4,0x10,0x1F,0xFF,0xFF,0xFF,0xD0,0x0E,0x80,0x00,0x3F,0x60,
+    0x00,0x00,0x00,0x0E,0x70,0x00,0x7F,0xA0,0x00,0x00,0x00,0x0A,0xD3,0x15,0xD5,0xE9,
+    0x21,0x38,0x70,0x01,0xAE,0xEB,0x30,0x2A,0xEE,0xC7,0x10,0x00,0x3A,0xEE,0xB3,0x03,
+    0xEA,0x21,0x49,0x0B,0xD0,0x00,0x00,0x0F,0x80,0x00,0x00,0x1F,0x70,0x00,0x00,0x0F,
+    0x80,0x00,0x00,0x0B,0xD0,0x00,0x00,0x03,0xEA,0x21,0x49,0x00,0x3A,0xEE,0xB3,0x00,
+    0x00,0x0C,0x30,0x00,0x00,0x09,0x90,0x00,0x08,0xFD,0x40,0x00,0x3E,0x50,0x00,0x00,
+    0x00,0x05,0xE2,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x3A,0xEF,0xC4,0x00,0x03,0xEA,0x21,0x7F,0x30,0x0B,0xD0,0x00,0x0B,0xA0,0x0F,0x80,
+    0x00,0x08,0xE0,0x1F,0xFF,0xFF,0xFF,0xF0,0x0F,0x70,0x00,0x00,0x00,0x0B,0xC0,0x00,
+    0x00,0x00,0x03,0xEA,0x21,0x27,0x80,0x00,0x2A,0xEF,0xD8,0x20,0x00,0x00,0x03,0xF5,
+    0x00,0x00,0x00,0x1D,0x70,0x00,0x00,0x00,0xA9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x3A,0xEF,0xC4,0x00,0x03,0xEA,0x21,0x7F,0x30,0x0B,0xD0,0x00,0x0B,0xA0,0x0F,
+    0x80,0x00,0x08,0xE0,0x1F,0xFF,0xFF,0xFF,0xF0,0x0F,0x70,0x00,0x00,0x00,0x0B,0xC0,
+    0x00,0x00,0x00,0x03,0xEA,0x21,0x27,0x80,0x00,0x2A,0xEF,0xD8,0x20,0x00,0x00,0xCE,
+    0x10,0x00,0x00,0x07,0xB9,0xA0,0x00,0x00,0x2D,0x20,0xC4,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x3A,0xEF,0xC4,0x00,0x03,0xEA,0x21,0x7F,0x30,0x0B,0xD0,0x00,0x0B,0xA0,
+    0x0F,0x80,0x00,0x08,0xE0,0x1F,0xFF,0xFF,0xFF,0xF0,0x0F,0x70,0x00,0x00,0x00,0x0B,
+    0xC0,0x00,0x00,0x00,0x03,0xEA,0x21,0x27,0x80,0x00,0x2A,0xEF,0xD8,0x20,0x00,0x3F,
+    0x53,0xF6,0x00,0x00,0x3F,0x53,0xF6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3A,0xEF,
+    0xC4,0x00,0x03,0xEA,0x21,0x7F,0x30,0x0B,0xD0,0x00,0x0B,0xA0,0x0F,0x80,0x00,0x08,
+    0xE0,0x1F,0xFF,0xFF,0xFF,0xF0,0x0F,0x70,0x00,0x00,0x00,0x0B,0xC0,0x00,0x00,0x00,
+    0x03,0xEA,0x21,0x27,0x80,0x00,0x2A,0xEF,0xD8,0x20,0x2E,0x70,0x00,0x03,0xE3,0x00,
+    0x00,0x5D,0x10,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,
+    0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,
+    0x00,0x02,0xE6,0x0C,0x90,0x8B,0x00,0x00,0x00,0x7E,0x00,0x7E,0x00,0x7E,0x00,0x7E,
+    0x00,0x7E,0x00,0x7E,0x00,0x7E,0x00,0x7E,0x00,0x7E,0x00,0x00,0xAF,0x20,0x05,0xD7,
+    0xB0,0x1D,0x30,0xB6,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,
+    0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,
+    0x7E,0x00,0x1F,0x71,0xF8,0x1F,0x71,0xF8,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x7E,
+    0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,
+    0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x2D,0xB2,0x69,0x00,0x01,0x4A,0xFF,0x51,0x00,
+    0x02,0x62,0x2D,0xB1,0x00,0x00,0x4C,0xFF,0xF9,0x00,0x03,0xF9,0x21,0x7F,0x30,0x0B,
+    0xD0,0x00,0x0E,0x90,0x0F,0x80,0x00,0x0B,0xC0,0x1F,0x70,0x00,0x0A,0xE0,0x0F,0x80,
+    0x00,0x0B,0xC0,0x0B,0xC0,0x00,0x1E,0x80,0x03,0xF9,0x12,0xBE,0x10,0x00,0x3B,0xEE,
+    0xA2,0x00,0x01,0xCE,0x45,0xA0,0x05,0xB1,0xBE,0x40,0x00,0x00,0x00,0x00,0x8E,0x1A,
+    0xED,0x60,0x8E,0xA4,0x17,0xF3,0x8F,0x40,0x00,0xD9,0x8F,0x00,0x00,0xBB,0x8E,0x00,
+    0x00,0xAC,0x8E,0x00,0x00,0xAC,0x8E,0x00,0x00,0xAC,0x8E,0x00,0x00,0xAC,0x8E,0x00,
+    0x00,0xAC,0x00,0x5E,0x30,0x00,0x00,0x00,0x07,0xD1,0x00,0x00,0x00,0x00,0xA9,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4C,0xEE,0xA2,0x00,0x04,0xF9,0x12,0xBE,0x20,
+    0x0C,0xC0,0x00,0x1E,0x90,0x0F,0x80,0x00,0x0B,0xC0,0x1F,0x70,0x00,0x0A,0xE0,0x0F,
+    0x80,0x00,0x0B,0xC0,0x0C,0xC0,0x00,0x1E,0x90,0x04,0xF8,0x12,0xBE,0x20,0x00,0x4C,
+    0xFE,0xB2,0x00,0x00,0x00,0x05,0xE3,0x00,0x00,0x00,0x2E,0x40,0x00,0x00,0x00,0xC6,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4C,0xEE,0xA2,0x00,0x04,0xF9,0x12,0xBE,
+    0x20,0x0C,0xC0,0x00,0x1E,0x90,0x0F,0x80,0x00,0x0B,0xC0,0x1F,0x70,0x00,0x0A,0xE0,
+    0x0F,0x80,0x00,0x0B,0xC0,0x0C,0xC0,0x00,0x1E,0x90,0x04,0xF8,0x12,0xBE,0x20,0x00,
+    0x4C,0xFE,0xB2,0x00,0x00,0x01,0xEC,0x00,0x00,0x00,0x09,0x9B,0x70,0x00,0x00,0x4C,
+    0x02,0xD2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4C,0xEE,0xA2,0x00,0x04,0xF9,0x12,
+    0xBE,0x20,0x0C,0xC0,0x00,0x1E,0x90,0x0F,0x80,0x00,0x0B,0xC0,0x1F,0x70,0x00,0x0A,
+    0xE0,0x0F,0x80,0x00,0x0B,0xC0,0x0C,0xC0,0x00,0x1E,0x90,0x04,0xF8,0x12,0xBE,0x20,
+    0x00,0x4C,0xFE,0xB2,0x00,0x00,0x3E,0xC2,0x96,0x00,0x00,0x97,0x3D,0xD1,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x4C,0xEE,0xA2,0x00,0x04,0xF9,0x12,0xBE,0x20,0x0C,0xC0,
+    0x00,0x1E,0x90,0x0F,0x80,0x00,0x0B,0xC0,0x1F,0x70,0x00,0x0A,0xE0,0x0F,0x80,0x00,
+    0x0B,0xC0,0x0C,0xC0,0x00,0x1E,0x90,0x04,0xF8,0x12,0xBE,0x20,0x00,0x4C,0xFE,0xB2,
+    0x00,0x00,0x6F,0x35,0xF4,0x00,0x00,0x6F,0x35,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x4C,0xEE,0xA2,0x00,0x04,0xF9,0x12,0xBE,0x20,0x0C,0xC0,0x00,0x1E,0x90,0x0F,
+    0x80,0x00,0x0B,0xC0,0x1F,0x70,0x00,0x0A,0xE0,0x0F,0x80,0x00,0x0B,0xC0,0x0C,0xC0,
+    0x00,0x1E,0x90,0x04,0xF8,0x12,0xBE,0x20,0x00,0x4C,0xFE,0xB2,0x00,0x00,0x00,0x4F,
+    0xA0,0x00,0x00,0x00,0x00,0x4F,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4F,
+    0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4F,0xA0,0x00,
+    0x00,0x00,0x00,0x4F,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x4C,0xEE,0xB9,
+    0xC1,0x04,0xF8,0x12,0xCF,0x30,0x0B,0xC0,0x03,0xEE,0x90,0x0F,0x80,0x1D,0x5A,0xC0,
+    0x1F,0x60,0xB8,0x0A,0xE0,0x0F,0x78,0xB0,0x0B,0xC0,0x0C,0xDD,0x10,0x1E,0x80,0x06,
+    0xF9,0x12,0xBE,0x20,0x2D,0x8C,0xEE,0xA2,0x00,0x14,0x00,0x00,0x00,0x00,0x04,0xF3,
+    0x00,0x00,0x00,0x6D,0x10,0x00,0x00,0x09,0xA0,0x00,0x00,0x00,0x00,0x00,0xAC,0x00,
+    0x00,0xBA,0xAC,0x00,0x00,0xBA,0xAC,0x00,0x00,0xBA,0xAC,0x00,0x00,0xBA,0xAC,0x00,
+    0x00,0xBA,0x9D,0x00,0x00,0xDA,0x7E,0x10,0x02,0xFA,0x2F,0x91,0x3A,0xCA,0x05,0xDF,
+    0xB2,0xBA,0x00,0x00,0x5E,0x30,0x00,0x02,0xE5,0x00,0x00,0x0B,0x70,0x00,0x00,0x00,
+    0x00,0x00,0xAC,0x00,0x00,0xBA,0xAC,0x00,0x00,0xBA,0xAC,0x00,0x00,0xBA,0xAC,0x00,
+    0x00,0xBA,0xAC,0x00,0x00,0xBA,0x9D,0x00,0x00,0xDA,0x7E,0x10,0x02,0xFA,0x2F,0x91,
+    0x3A,0xCA,0x05,0xDF,0xB2,0xBA,0x00,0x1D,0xD0,0x00,0x00,0x8A,0xB8,0x00,0x03,0xD1,
+    0x1D,0x30,0x00,0x00,0x00,0x00,0xAC,0x00,0x00,0xBA,0xAC,0x00,0x00,0xBA,0xAC,0x00,
+    0x00,0xBA,0xAC,0x00,0x00,0xBA,0xAC,0x00,0x00,0xBA,0x9D,0x00,0x00,0xDA,0x7E,0x10,
+    0x02,0xFA,0x2F,0x91,0x3A,0xCA,0x05,0xDF,0xB2,0xBA,0x05,0xF4,0x4F,0x40,0x05,0xF4,
+    0x4F,0x40,0x00,0x00,0x00,0x00,0xAC,0x00,0x00,0xBA,0xAC,0x00,0x00,0xBA,0xAC,0x00,
+    0x00,0xBA,0xAC,0x00,0x00,0xBA,0xAC,0x00,0x00,0xBA,0x9D,0x00,0x00,0xDA,0x7E,0x10,
+    0x02,0xFA,0x2F,0x91,0x3A,0xCA,0x05,0xDF,0xB2,0xBA,0x00,0x00,0x08,0xD1,0x00,0x00,
+    0x00,0x4E,0x20,0x00,0x00,0x01,0xD4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0x30,
+    0x00,0x0B,0xC0,0x0E,0x90,0x00,0x2F,0x60,0x08,0xE0,0x00,0x8E,0x10,0x02,0xF5,0x00,
+    0xD9,0x00,0x00,0xBB,0x04,0xF3,0x00,0x00,0x5F,0x2A,0xC0,0x00,0x00,0x0D,0x9F,0x60,
+    0x00,0x00,0x08,0xFE,0x10,0x00,0x00,0x02,0xF9,0x00,0x00,0x00,0x04,0xF3,0x00,0x00,
+    0x00,0x1C,0xB0,0x00,0x00,0x0B,0xFC,0x20,0x00,0x00,0x8E,0x00,0x00,0x00,0x00,0x8E,
+    0x00,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,0x00,0x8E,0x2B,0xED,0x70,0x00,0x8E,0xA4,
+    0x16,0xF6,0x00,0x8F,0x50,0x00,0x9D,0x00,0x8F,0x00,0x00,0x5F,0x20,0x8E,0x00,0x00,
+    0x3F,0x40,0x8F,0x00,0x00,0x5F,0x20,0x8F,0x50,0x00,0x9E,0x00,0x8E,0xA3,0x16,0xF6,
+    0x00,0x8E,0x2B,0xED,0x70,0x00,0x8E,0x00,0x00,0x00,0x00,0x8E,0x00,0x00,0x00,0x00,
+    0x8E,0x00,0x00,0x00,0x00,0x00,0x9F,0x08,0xF1,0x00,0x00,0x9F,0x08,0xF1,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x5F,0x30,0x00,0x0B,0xC0,0x0E,0x90,0x00,0x2F,0x60,0x08,0xE0,
+    0x00,0x8E,0x10,0x02,0xF5,0x00,0xD9,0x00,0x00,0xBB,0x04,0xF3,0x00,0x00,0x5F,0x2A,
+    0xC0,0x00,0x00,0x0D,0x9F,0x60,0x00,0x00,0x08,0xFE,0x10,0x00,0x00,0x02,0xF9,0x00,
+    0x00,0x00,0x04,0xF3,0x00,0x00,0x00,0x1C,0xB0,0x00,0x00,0x0B,0xFC,0x20,0x00,0x00,
+};
+
+static const aa_glyph_t font_sans_16_glyphs[] = 
+{
+    {     0,  0,  0,   0,   0,  5 },   // ' '
+    {     0,  2, 12,   2,   3,  6 },   // '!'
+    {    12,  5,  4,   1,   3,  7 },   // '"'
+    {    24, 12, 11,   1,   4, 13 },   // '#'
+    {    90,  8, 14,   1,   3, 10 },   // '$'
+    {   146, 15, 12,   0,   3, 15 },   // '%'
+    {   242, 11, 12,   1,   3, 12 },   // '&'
+    {   314,  2,  4,   1,   3,  4 },   // "'"
+    {   318,  4, 14,   1,   3,  6 },   // '('
+    {   346,  4, 14,   1,   3,  6 },   // ')'
+    {   374,  8,  8,   0,   3,  8 },   // '*'
+    {   406, 11,  9,   1,   6, 13 },   // '+'
+    {   460,  3,  4,   1,  13,  5 },   // ','
+    {   468,  5,  1,   0,  10,  6 },   // '-'
+    {   471,  3,  2,   1,  13,  5 },   // '.'
+    {   475,  6, 13,   0,   3,  5 },   // '/'
+    {   514,  9, 12,   1,   3, 10 },   // '0'
+    {   574,  8, 12,   1,   3, 10 },   // '1'
+    {   622,  8, 12,   1,   3, 10 },   // '2'
+    {   670,  8, 12,   1,   3, 10 },   // '3'
+    {   718, 10, 12,   0,   3, 10 },   // '4'
+    {   778,  8, 12,   1,   3, 10 },   // '5'
+    {   826,  9, 12,   1,   3, 10 },   // '6'
+    {   886,  8, 12,   1,   3, 10 },   // '7'
+    {   934,  9, 12,   1,   3, 10 },   // '8'
+    {   994,  9, 12,   1,   3, 10 },   // '9'
+    {  1054,  3,  8,   1,   7,  5 },   // ':'
+    {  1070,  3, 10,   1,   7,  5 },   // ';'
+    {  1090, 11,  9,   1,   6, 13 },   // '<'
+    {  1144, 11,  4,   1,   8, 13 },   // '='
+    {  1168, 11,  9,   1,   6, 13 },   // '>'
+    {  1222,  7, 12,   1,   3,  9 },   // '?'
+    {  1270, 14, 14,   1,   4, 16 },   // '@'
+    {  1368, 11, 12,   0,   3, 11 },   // 'A'
+    {  1440,  9, 12,   1,   3, 11 },   // 'B'
+    {  1500, 11, 12,   0,   3, 11 },   // 'C'
+    {  1572, 11, 12,   1,   3, 12 },   // 'D'
+    {  1644,  9, 12,   1,   3, 10 },   // 'E'
+    {  1704,  8, 12,   1,   3,  9 },   // 'F'
+    {  1752, 12, 12,   0,   3, 12 },   // 'G'
+    {  1824, 10, 12,   1,   3, 12 },   // 'H'
+    {  1884,  3, 12,   1,   3,  5 },   // 'I'
+    {  1908,  5, 15,  -1,   3,  5 },   // 'J'
+    {  1953, 10, 12,   1,   3, 11 },   // 'K'
+    {  2013,  8, 12,   1,   3,  9 },   // 'L'
+    {  2061, 12, 12,   1,   3, 14 },   // 'M'
+    {  2133, 10, 12,   1,   3, 12 },   // 'N'
+    {  2193, 12, 12,   0,   3, 13 },   // 'O'
+    {  2265,  9, 12,   1,   3, 10 },   // 'P'
+    {  2325, 12, 14,   0,   3, 13 },   // 'Q'
+    {  2409, 10, 12,   1,   3, 11 },   // 'R'
+    {  2469,  9, 12,   1,   3, 10 },   // 'S'
+    {  2529, 11, 12,  -1,   3, 10 },   // 'T'
+    {  2601, 10, 12,   1,   3, 12 },   // 'U'
+    {  2661, 11, 12,   0,   3, 11 },   // 'V'
+    {  2733, 16, 12,   0,   3, 16 },   // 'W'
+    {  2829, 11, 12,   0,   3, 11 },   // 'X'
+    {  2901, 10, 12,   0,   3, 10 },   // 'Y'
+    {  2961, 11, 12,   0,   3, 11 },   // 'Z'
+    {  3033,  4, 14,   1,   3,  6 },   // '['
+    {  3061,  6, 13,   0,   3,  5 },   // '\\'
+    {  3100,  4, 14,   1,   3,  6 },   // ']'
+    {  3128, 11,  4,   1,   3, 13 },   // '^'
+    {  3152, 10,  1,  -1,  18,  8 },   // '_'
+    {  3157,  5,  3,   1,   2,  8 },   // '`'
+    {  3166,  9,  9,   0,   6, 10 },   // 'a'
+    {  3211,  9, 12,   1,   3, 10 },   // 'b'
+    {  3271,  8,  9,   0,   6,  9 },   // 'c'
+    {  3307,  9, 12,   0,   3, 10 },   // 'd'
+    {  3367,  9,  9,   0,   6, 10 },   // 'e'
+    {  3412,  6, 12,   0,   3,  6 },   // 'f'
+    {  3448,  9, 12,   0,   6, 10 },   // 'g'
+    {  3508,  8, 12,   1,   3, 10 },   // 'h'
+    {  3556,  2, 12,   1,   3,  4 },   // 'i'
+    {  3568,  4, 15,  -1,   3,  4 },   // 'j'
+    {  3598,  9, 12,   1,   3,  9 },   // 'k'
+    {  3658,  2, 12,   1,   3,  4 },   // 'l'
+    {  3670, 14,  9,   1,   6, 16 },   // 'm'
+    {  3733,  8,  9,   1,   6, 10 },   // 'n'
+    {  3769,  9,  9,   0,   6, 10 },   // 'o'
+    {  3814,  9, 12,   1,   6, 10 },   // 'p'
+    {  3874,  9, 12,   0,   6, 10 },   // 'q'
+    {  3934,  6,  9,   1,   6,  7 },   // 'r'
+    {  3961,  8,  9,   0,   6,  8 },   // 's'
+    {  3997,  6, 11,   0,   4,  6 },   // 't'
+    {  4030,  8,  9,   1,   6, 10 },   // 'u'
+    {  4066,  9,  9,   0,   6,  9 },   // 'v'
+    {  4111, 13,  9,   0,   6, 13 },   // 'w'
+    {  4174,  9,  9,   0,   6,  9 },   // 'x'
+    {  4219,  9, 12,   0,   6,  9 },   // 'y'
+    {  4279,  8,  9,   0,   6,  8 },   // 'z'
+    {  4315,  7, 15,   2,   3, 10 },   // '{'
+    {  4375,  2, 16,   2,   3,  5 },   // '|'
+    {  4391,  7, 15,   2,   3, 10 },   // '}'
+    {  4451, 11,  4,   1,   8, 13 },   // '~'
+    {  4475,  0,  0,   0,   0,  5 },   // U+00A0
+    {  4475,  2, 12,   2,   6,  6 },   // U+00A1
+    {  4487,  8, 13,   1,   4, 10 },   // U+00A2
+    {  4539,  8, 12,   1,   3, 10 },   // U+00A3
+    {  4587, 10,  9,   0,   6, 10 },   // U+00A4
+    {  4632, 10, 12,   0,   3, 10 },   // U+00A5
+    {  4692,  2, 14,   2,   4,  5 },   // U+00A6
+    {  4706,  8, 14,   0,   3,  8 },   // U+00A7
+    {  4762,  6,  2,   1,   3,  8 },   // U+00A8
+    {  4768, 12, 12,   2,   3, 16 },   // U+00A9
+    {  4840,  7,  8,   0,   3,  8 },   // U+00AA
+    {  4872,  8,  7,   1,   7, 10 },   // U+00AB
+    {  4900, 11,  5,   1,   8, 13 },   // U+00AC
+    {  4930,  5,  1,   0,  10,  6 },   // U+00AD
+    {  4933, 12, 12,   2,   3, 16 },   // U+00AE
+    {  5005,  6,  1,   1,   3,  8 },   // U+00AF
+    {  5008,  6,  5,   1,   3,  8 },   // U+00B0
+    {  5023, 11, 10,   1,   5, 13 },   // U+00B1
+    {  5083,  6,  7,   0,   3,  6 },   // U+00B2
+    {  5104,  6,  7,   0,   3,  6 },   // U+00B3
+    {  5125,  5,  3,   2,   2,  8 },   // U+00B4
+    {  5134,  9, 12,   1,   6, 10 },   // U+00B5
+    {  5194,  8, 14,   1,   3, 10 },   // U+00B6
+    {  5250,  3,  2,   1,   8,  5 },   // U+00B7
+    {  5254,  4,  3,   2,  15,  8 },   // U+00B8
+    {  5260,  5,  7,   1,   3,  6 },   // U+00B9
+    {  5281,  7,  8,   0,   3,  8 },   // U+00BA
+    {  5313,  8,  7,   1,   7, 10 },   // U+00BB
+    {  5341, 14, 12,   1,   3, 16 },   // U+00BC
+    {  5425, 14, 12,   1,   3, 16 },   // U+00BD
+    {  5509, 15, 12,   0,   3, 16 },   // U+00BE
+    {  5605,  7, 12,   1,   6,  9 },   // U+00BF
+    {  5653, 11, 15,   0,   0, 11 },   // U+00C0
+    {  5743, 11, 15,   0,   0, 11 },   // U+00C1
+    {  5833, 11, 15,   0,   0, 11 },   // U+00C2
+    {  5923, 11, 15,   0,   0, 11 },   // U+00C3
+    {  6013, 11, 15,   0,   0, 11 },   // U+00C4
+    {  6103, 11, 15,   0,   0, 11 },   // U+00C5
+    {  6193, 15, 12,   0,   3, 16 },   // U+00C6
+    {  6289, 11, 15,   0,   3, 11 },   // U+00C7
+    {  6379,  9, 15,   1,   0, 10 },   // U+00C8
+    {  6454,  9, 15,   1,   0, 10 },   // U+00C9
+    {  6529,  9, 15,   1,   0, 10 },   // U+00CA
+    {  6604,  9, 15,   1,   0, 10 },   // U+00CB
+    {  6679,  4, 15,   0,   0,  5 },   // U+00CC
+    {  6709,  4, 15,   1,   0,  5 },   // U+00CD
+    {  6739,  5, 15,   0,   0,  5 },   // U+00CE
+    {  6784,  5, 15,   0,   0,  5 },   // U+00CF
+    {  6829, 12, 12,   0,   3, 12 },   // U+00D0
+    {  6901, 10, 15,   1,   0, 12 },   // U+00D1
+    {  6976, 12, 15,   0,   0, 13 },   // U+00D2
+    {  7066, 12, 15,   0,   0, 13 },   // U+00D3
+    {  7156, 12, 15,   0,   0, 13 },   // U+00D4
+    {  7246, 12, 15,   0,   0, 13 },   // U+00D5
+    {  7336, 12, 15,   0,   0, 13 },   // U+00D6
+    {  7426, 10,  9,   2,   5, 13 },   // U+00D7
+    {  7471, 12, 14,   0,   2, 13 },   // U+00D8
+    {  7555, 10, 15,   1,   0, 12 },   // U+00D9
+    {  7630, 10, 15,   1,   0, 12 },   // U+00DA
+    {  7705, 10, 15,   1,   0, 12 },   // U+00DB
+    {  7780, 10, 15,   1,   0, 12 },   // U+00DC
+    {  7855, 10, 15,   0,   0, 10 },   // U+00DD
+    {  7930,  9, 12,   1,   3, 10 },   // U+00DE
+    {  7990,  9, 12,   1,   3, 10 },   // U+00DF
+    {  8050,  9, 13,   0,   2, 10 },   // U+00E0
+    {  8115,  9, 13,   0,   2, 10 },   // U+00E1
+    {  8180,  9, 13,   0,   2, 10 },   // U+00E2
+    {  8245,  9, 12,   0,   3, 10 },   // U+00E3
+    {  8305,  9, 12,   0,   3, 10 },   // U+00E4
+    {  8365,  9, 14,   0,   1, 10 },   // U+00E5
+    {  8435, 15,  9,   0,   6, 16 },   // U+00E6
+    {  8507,  8, 12,   0,   6,  9 },   // U+00E7
+    {  8555,  9, 13,   0,   2, 10 },   // U+00E8
+    {  8620,  9, 13,   0,   2, 10 },   // U+00E9
+    {  8685,  9, 13,   0,   2, 10 },   // U+00EA
+    {  8750,  9, 12,   0,   3, 10 },   // U+00EB
+    {  8810,  5, 13,  -1,   2,  4 },   // U+00EC
+    {  8849,  4, 13,   1,   2,  4 },   // U+00ED
+    {  8875,  6, 13,  -1,   2,  4 },   // U+00EE
+    {  8914,  6, 12,  -1,   3,  4 },   // U+00EF
+    {  8950,  9, 12,   0,   3, 10 },   // U+00F0
+    {  9010,  8, 12,   1,   3, 10 },   // U+00F1
+    {  9058,  9, 13,   0,   2, 10 },   // U+00F2
+    {  9123,  9, 13,   0,   2, 10 },   // U+00F3
+    {  9188,  9, 13,   0,   2, 10 },   // U+00F4
+    {  9253,  9, 12,   0,   3, 10 },   // U+00F5
+    {  9313,  9, 12,   0,   3, 10 },   // U+00F6
+    {  9373, 11,  7,   1,   7, 13 },   // U+00F7
+    {  9415, 10, 11,   0,   5, 10 },   // U+00F8
+    {  9470,  8, 13,   1,   2, 10 },   // U+00F9
+    {  9522,  8, 13,   1,   2, 10 },   // U+00FA
+    {  9574,  8, 13,   1,   2, 10 },   // U+00FB
+    {  9626,  8, 12,   1,   3, 10 },   // U+00FC
+    {  9674,  9, 16,   0,   2,  9 },   // U+00FD
+    {  9754,  9, 15,   1,   3, 10 },   // U+00FE
+    {  9829,  9, 15,   0,   3,  9 },   // U+00FF
+};
+
+static const aa_range_t font_sans_16_ranges[] = 
+{
+    { 32, 95, 0 },
+    { 160, 96, 95 },
+};
+
+const aa_font_t font_sans_16 = {
+    .bpp = 4,
+    .line_height = 19,
+    .baseline = 15,
+    .first_char = 32,
+    .glyph_amount = 191,
+    .glyphs = font_sans_16_glyphs,
+    .bitmap = font_sans_16_bitmap,
+    .ranges = font_sans_16_ranges,
+    .range_amount = 2,
+};
+
+
+// DejaVuSans-Bold.ttf 24px, 4 bpp, characters 43-58. Generated by tools/make_font.py.
+static const uint8_t font_sans_bold_24_bitmap[] = 
+{
+    0x00,0x00,0x00,0x5F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xF7,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x5F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xF7,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x5F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xF7,0x00,0x00,0x00,
+    0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,
+    0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x00,0x00,0x5F,0xF7,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x5F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xF7,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x5F,0xF7,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,0xF7,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x5F,0xF7,0x00,0x00,0x00,0x08,0xFF,0xFA,0x08,0xFF,0xFA,0x08,0xFF,
+    0xFA,0x09,0xFF,0xF9,0x0C,0xFF,0xE2,0x1F,0xFF,0x60,0x5F,0xFB,0x00,0x9F,0xE2,0x00,
+    0xBF,0xFF,0xFF,0xFA,0xBF,0xFF,0xFF,0xFA,0xBF,0xFF,0xFF,0xFA,0x8F,0xFF,0xA0,0x8F,
+    0xFF,0xA0,0x8F,0xFF,0xA0,0x8F,0xFF,0xA0,0x8F,0xFF,0xA0,0x00,0x00,0x00,0xEF,0x90,
+    0x00,0x00,0x04,0xFF,0x40,0x00,0x00,0x09,0xFE,0x00,0x00,0x00,0x0E,0xFA,0x00,0x00,
+    0x00,0x3F,0xF6,0x00,0x00,0x00,0x8F,0xF1,0x00,0x00,0x00,0xDF,0xB0,0x00,0x00,0x02,
+    0xFF,0x70,0x00,0x00,0x07,0xFF,0x20,0x00,0x00,0x0B,0xFC,0x00,0x00,0x00,0x1F,0xF8,
+    0x00,0x00,0x00,0x6F,0xF3,0x00,0x00,0x00,0xAF,0xE0,0x00,0x00,0x01,0xEF,0x90,0x00,
+    0x00,0x05,0xFF,0x40,0x00,0x00,0x09,0xFE,0x00,0x00,0x00,0x0E,0xFA,0x00,0x00,0x00,
+    0x3F,0xF5,0x00,0x00,0x00,0x8F,0xF1,0x00,0x00,0x00,0xDF,0xB0,0x00,0x00,0x00,0x00,
+    0x01,0x7C,0xEF,0xDA,0x50,0x00,0x00,0x00,0x3D,0xFF,0xFF,0xFF,0xFB,0x10,0x00,0x02,
+    0xEF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x0A,0xFF,0xFD,0x30,0x5F,0xFF,0xF6,0x00,0x2F,
+    0xFF,0xF4,0x00,0x08,0xFF,0xFC,0x00,0x7F,0xFF,0xE0,0x00,0x04,0xFF,0xFF,0x20,0xAF,
+    0xFF,0xC0,0x00,0x01,0xFF,0xFF,0x50,0xBF,0xFF,0xB0,0x00,0x00,0xFF,0xFF,0x70,0xCF,
+    0xFF,0xA0,0x00,0x00,0xFF,0xFF,0x80,0xCF,0xFF,0xA0,0x00,0x00,0xFF,0xFF,0x80,0xBF,
+    0xFF,0xB0,0x00,0x00,0xFF,0xFF,0x70,0xAF,0xFF,0xC0,0x00,0x01,0xFF,0xFF,0x50,0x7F,
+    0xFF,0xE0,0x00,0x04,0xFF,0xFF,0x20,0x2F,0xFF,0xF4,0x00,0x08,0xFF,0xFC,0x00,0x0A,
+    0xFF,0xFD,0x30,0x5F,0xFF,0xF6,0x00,0x02,0xEF,0xFF,0xFF,0xFF,0xFF,0xB0,0x00,0x00,
+    0x3D,0xFF,0xFF,0xFF,0xFB,0x10,0x00,0x00,0x01,0x7C,0xEF,0xEA,0x50,0x00,0x00,0x03,
+    0x7A,0xEF,0xFF,0xF1,0x00,0x00,0x4F,0xFF,0xFF,0xFF,0xF1,0x00,0x00,0x4F,0xFF,0xFF,
+    0xFF,0xF1,0x00,0x00,0x4C,0x85,0x4F,0xFF,0xF1,0x00,0x00,0x00,0x00,0x3F,0xFF,0xF1,
+    0x00,0x00,0x00,0x00,0x3F,0xFF,0xF1,0x00,0x00,0x00,0x00,0x3F,0xFF,0xF1,0x00,0x00,
+    0x00,0x00,0x3F,0xFF,0xF1,0x00,0x00,0x00,0x00,0x3F,0xFF,0xF1,0x00,0x00,0x00,0x00,
+    0x3F,0xFF,0xF1,0x00,0x00,0x00,0x00,0x3F,0xFF,0xF1,0x00,0x00,0x00,0x00,0x3F,0xFF,
+    0xF1,0x00,0x00,0x00,0x00,0x3F,0xFF,0xF1,0x00,0x00,0x00,0x00,0x3F,0xFF,0xF1,0x00,
+    0x00,0x00,0x00,0x3F,0xFF,0xF1,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0x3F,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xF1,0x02,0x69,0xCE,
+    0xFE,0xDA,0x50,0x00,0x1F,0xFF,0xFF,0xFF,0xFF,0xFB,0x10,0x1F,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xA0,0x1F,0xE9,0x41,0x16,0xEF,0xFF,0xF3,0x1A,0x10,0x00,0x00,0x6F,0xFF,0xF6,
+    0x00,0x00,0x00,0x00,0x2F,0xFF,0xF7,0x00,0x00,0x00,0x00,0x2F,0xFF,0xF5,0x00,0x00,
+    0x00,0x00,0x7F,0xFF,0xF1,0x00,0x00,0x00,0x03,0xEF,0xFF,0x80,0x00,0x00,0x00,0x3E,
+    0xFF,0xFB,0x00,0x00,0x00,0x04,0xEF,0xFF,0xB1,0x00,0x00,0x00,0x5F,0xFF,0xFB,0x10,
+    0x00,0x00,0x06,0xFF,0xFF,0xA0,0x00,0x00,0x00,0x7F,0xFF,0xF8,0x00,0x00,0x00,0x08,
+    0xFF,0xFF,0x70,0x00,0x00,0x00,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x1F,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xF9,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xF9,0x01,0x59,0xCD,0xFE,0xDB,
+    0x71,0x00,0x0A,0xFF,0xFF,0xFF,0xFF,0xFE,0x40,0x0A,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,
+    0x09,0x94,0x21,0x14,0xDF,0xFF,0xF4,0x00,0x00,0x00,0x00,0x4F,0xFF,0xF5,0x00,0x00,
+    0x00,0x00,0x4F,0xFF,0xF3,0x00,0x00,0x00,0x15,0xDF,0xFF,0xA0,0x00,0x06,0xFF,0xFF,
+    0xFF,0xE8,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xC6,0x00,0x00,0x06,0xFF,0xFF,0xFF,0xFF,
+    0x90,0x00,0x00,0x00,0x25,0xCF,0xFF,0xF5,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFA,0x00,
+    0x00,0x00,0x00,0x0C,0xFF,0xFB,0x00,0x00,0x00,0x00,0x1E,0xFF,0xFB,0x6B,0x73,0x20,
+    0x15,0xCF,0xFF,0xF7,0x6F,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,0x6F,0xFF,0xFF,0xFF,0xFF,
+    0xFC,0x20,0x04,0x8B,0xDE,0xFE,0xC9,0x40,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0x20,
+    0x00,0x00,0x00,0x00,0xDF,0xFF,0xFF,0x20,0x00,0x00,0x00,0x08,0xFF,0xFF,0xFF,0x20,
+    0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0x20,0x00,0x00,0x00,0xCF,0xFB,0xFF,0xFF,0x20,
+    0x00,0x00,0x06,0xFF,0xD3,0xFF,0xFF,0x20,0x00,0x00,0x2E,0xFF,0x52,0xFF,0xFF,0x20,
+    0x00,0x00,0xBF,0xFA,0x02,0xFF,0xFF,0x20,0x00,0x05,0xFF,0xE2,0x02,0xFF,0xFF,0x20,
+    0x00,0x1E,0xFF,0x70,0x02,0xFF,0xFF,0x20,0x00,0x9F,0xFC,0x00,0x02,0xFF,0xFF,0x20,
+    0x00,0xEF,0xF3,0x00,0x02,0xFF,0xFF,0x20,0x00,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0x90,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x90,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0x90,0x00,0x00,0x00,0x02,0xFF,0xFF,0x20,0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0x20,
+    0x00,0x00,0x00,0x00,0x02,0xFF,0xFF,0x20,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,
+    0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,
+    0x00,0x07,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xF2,0x00,0x00,0x00,0x00,
+    0x00,0x07,0xFF,0xF2,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFC,0xEF,0xEB,0x61,0x00,
+    0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFD,0x30,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,
+    0x00,0x06,0xA5,0x31,0x14,0xCF,0xFF,0xF8,0x00,0x00,0x00,0x00,0x00,0x1D,0xFF,0xFD,
+    0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x09,0xFF,0xFF,
+    0x00,0x00,0x00,0x00,0x00,0x1D,0xFF,0xFD,0x00,0x2C,0x84,0x21,0x14,0xCF,0xFF,0xF8,
+    0x00,0x2F,0xFF,0xFF,0xFF,0xFF,0xFF,0xD1,0x00,0x2F,0xFF,0xFF,0xFF,0xFF,0xFC,0x20,
+    0x00,0x03,0x6A,0xCE,0xFE,0xDA,0x50,0x00,0x00,0x00,0x00,0x17,0xBD,0xFE,0xC9,0x40,
+    0x00,0x00,0x04,0xEF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0x5F,0xFF,0xFF,0xFF,0xFF,0xF4,
+    0x00,0x02,0xEF,0xFF,0xC4,0x11,0x25,0xA4,0x00,0x09,0xFF,0xFB,0x00,0x00,0x00,0x00,
+    0x00,0x0E,0xFF,0xF3,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xE4,0xAE,0xFE,0xA4,0x00,
+    0x00,0x6F,0xFF,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,
+    0x00,0x7F,0xFF,0xFE,0x51,0x3C,0xFF,0xFE,0x10,0x7F,0xFF,0xF8,0x00,0x03,0xFF,0xFF,
+    0x40,0x5F,0xFF,0xF6,0x00,0x00,0xFF,0xFF,0x60,0x2F,0xFF,0xF5,0x00,0x00,0xFF,0xFF,
+    0x50,0x0D,0xFF,0xF8,0x00,0x03,0xFF,0xFF,0x30,0x06,0xFF,0xFE,0x51,0x2C,0xFF,0xFC,
+    0x00,0x00,0xCF,0xFF,0xFF,0xFF,0xFF,0xF4,0x00,0x00,0x1B,0xFF,0xFF,0xFF,0xFE,0x50,
+    0x00,0x00,0x00,0x5B,0xEF,0xEC,0x81,0x00,0x00,0x6F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,
+    0x6F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x6F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFB,0x00,0x00,
+    0x00,0x00,0x3F,0xFF,0xF6,0x00,0x00,0x00,0x00,0x9F,0xFF,0xE1,0x00,0x00,0x00,0x01,
+    0xFF,0xFF,0x80,0x00,0x00,0x00,0x07,0xFF,0xFF,0x10,0x00,0x00,0x00,0x0D,0xFF,0xF9,
+    0x00,0x00,0x00,0x00,0x5F,0xFF,0xF3,0x00,0x00,0x00,0x00,0xCF,0xFF,0xB0,0x00,0x00,
+    0x00,0x03,0xFF,0xFF,0x40,0x00,0x00,0x00,0x09,0xFF,0xFD,0x00,0x00,0x00,0x00,0x1F,
+    0xFF,0xF6,0x00,0x00,0x00,0x00,0x7F,0xFF,0xE1,0x00,0x00,0x00,0x00,0xDF,0xFF,0x80,
+    0x00,0x00,0x00,0x05,0xFF,0xFF,0x10,0x00,0x00,0x00,0x0C,0xFF,0xFA,0x00,0x00,0x00,
+    0x00,0x3F,0xFF,0xF3,0x00,0x00,0x00,0x00,0x05,0xAD,0xEF,0xEC,0x93,0x00,0x00,0x01,
+    0xCF,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x0A,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x00,0x1F,
+    0xFF,0xFB,0x21,0x4E,0xFF,0xFB,0x00,0x2F,0xFF,0xF3,0x00,0x08,0xFF,0xFC,0x00,0x0F,
+    0xFF,0xF3,0x00,0x08,0xFF,0xFA,0x00,0x09,0xFF,0xFB,0x21,0x4E,0xFF,0xF4,0x00,0x01,
+    0xAF,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x00,0x08,0xFF,0xFF,0xFF,0xE4,0x00,0x00,0x02,
+    0xDF,0xFF,0xFF,0xFF,0xFF,0xA0,0x00,0x0D,0xFF,0xFA,0x21,0x3D,0xFF,0xF8,0x00,0x5F,
+    0xFF,0xE0,0x00,0x04,0xFF,0xFF,0x00,0x7F,0xFF,0xC0,0x00,0x01,0xFF,0xFF,0x30,0x7F,
+    0xFF,0xE0,0x00,0x04,0xFF,0xFF,0x20,0x4F,0xFF,0xFA,0x21,0x3D,0xFF,0xFE,0x00,0x0C,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x02,0xDF,0xFF,0xFF,0xFF,0xFF,0x90,0x00,0x00,
+    0x06,0xAD,0xEF,0xEC,0x94,0x00,0x00,0x00,0x03,0x9D,0xEE,0xD9,0x30,0x00,0x00,0x00,
+    0x9F,0xFF,0xFF,0xFF,0xF7,0x00,0x00,0x09,0xFF,0xFF,0xFF,0xFF,0xFF,0x60,0x00,0x3F,
+    0xFF,0xF8,0x11,0x9F,0xFF,0xE1,0x00,0x8F,0xFF,0xD0,0x00,0x0D,0xFF,0xF7,0x00,0xAF,
+    0xFF,0xA0,0x00,0x0B,0xFF,0xFC,0x00,0xBF,0xFF,0xA0,0x00,0x0B,0xFF,0xFF,0x00,0x9F,
+    0xFF,0xD0,0x00,0x0D,0xFF,0xFF,0x10,0x5F,0xFF,0xF8,0x11,0x9F,0xFF,0xFF,0x20,0x0C,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x20,0x02,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x10,0x00,
+    0x17,0xCE,0xFD,0x85,0xFF,0xFD,0x00,0x00,0x00,0x00,0x00,0x08,0xFF,0xF9,0x00,0x00,
+    0x00,0x00,0x00,0x2E,0xFF,0xF4,0x00,0x08,0x94,0x20,0x26,0xEF,0xFF,0xB0,0x00,0x09,
+    0xFF,0xFF,0xFF,0xFF,0xFD,0x10,0x00,0x09,0xFF,0xFF,0xFF,0xFF,0xB1,0x00,0x00,0x01,
+    0x6A,0xDE,0xED,0xA5,0x00,0x00,0x00,0x5F,0xFF,0xE0,0x5F,0xFF,0xE0,0x5F,0xFF,0xE0,
+    0x5F,0xFF,0xE0,0x5F,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5F,
+    0xFF,0xE0,0x5F,0xFF,0xE0,0x5F,0xFF,0xE0,0x5F,0xFF,0xE0,0x5F,0xFF,0xE0,
+};
+
+static const aa_glyph_t font_sans_bold_24_glyphs[] = 
+{
+    {     0, 16, 15,   2,   8, 20 },   // '+'
+    {   120,  6,  8,   1,  18,  9 },   // ','
+    {   144,  8,  3,   1,  14, 10 },   // '-'
+    {   156,  5,  5,   2,  18,  9 },   // '.'
+    {   171,  9, 20,   0,   5,  9 },   // '/'
+    {   271, 15, 18,   1,   5, 17 },   // '0'
+    {   415, 14, 18,   2,   5, 17 },   // '1'
+    {   541, 14, 18,   1,   5, 17 },   // '2'
+    {   667, 14, 18,   1,   5, 17 },   // '3'
+    {   793, 15, 18,   1,   5, 17 },   // '4'
+    {   937, 15, 18,   1,   5, 17 },   // '5'
+    {  1081, 15, 18,   1,   5, 17 },   // '6'
+    {  1225, 14, 18,   1,   5, 17 },   // '7'
+    {  1351, 15, 18,   1,   5, 17 },   // '8'
+    {  1495, 15, 18,   1,   5, 17 },   // '9'
+    {  1639,  5, 13,   2,  10, 10 },   // ':'
+};
+
+static const aa_range_t font_sans_bold_24_ranges[] = 
+{
+    { 43, 16, 0 },
+};
+
+const aa_font_t font_sans_bold_24 = {
+    .bpp = 4,
+    .line_height = 29,
+    .baseline = 23,
+    .first_char = 43,
+    .glyph_amount = 16,
+    .glyphs = font_sans_bold_24_glyphs,
+    .bitmap = font_sans_bold_24_bitmap,
+    .ranges = font_sans_bold_24_ranges,
+    .range_amount = 1,
+};
@@ -0,0 +1,220 @@
+#include "graphics_frame.h"
+
+
+int frame_scheduler_init(frame_scheduler_t *scheduler, esp_lcd_panel_handle_t panel_handle, unsigned short target_fps)
+{
+    memset(scheduler, 0, sizeof(frame_scheduler_t));
+    scheduler->panel_handle = panel_handle;
+
+    if (set_target_fps(scheduler, target_fps) != FRAME_SUCCESS)
+    {
+        return FRAME_FAILURE;
+    }
+
+    reset_frame_stats(scheduler);
+
+    return FRAME_SUCCESS;
+}
+
+
+int set_target_fps(frame_scheduler_t *scheduler, unsigned short target_fps)
+{
+    // Sanity check, we cannot divide by 0.
+    if (target_fps == 0)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Target fps cannot be 0.");
+        return FRAME_FAILURE;
+    }
+
+    scheduler->period_us = 1000000 / target_fps;
+
+    return FRAME_SUCCESS;
+}
+
+
+int add_render_callback(frame_scheduler_t *scheduler, frame_render_cb_t render_cb, void *user_ctx)
+{
+    if (render_cb == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Render callback is a NULL pointer.");
+        return FRAME_FAILURE;
+    }
+
+    if (scheduler->render_cb_amount >= FRAME_MAX_RENDER_CALLBACKS)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot add more than %d render callbacks.", FRAME_MAX_RENDER_CALLBACKS);
+        return FRAME_FAILURE;
+    }
+
+    scheduler->render_cb[scheduler->render_cb_amount] = render_cb;
+    scheduler->render_ctx[scheduler->render_cb_amount] = user_ctx;
+    scheduler->render_cb_amount += 1;
+
+    return FRAME_SUCCESS;
+}
+
+
+void set_flush_callback(frame_scheduler_t *scheduler, frame_flush_cb_t flush_cb, void *user_ctx)
+{
+    scheduler->flush_cb = flush_cb;
+    scheduler->flush_ctx = user_ctx;
+}
+
+
+int begin_frame(frame_scheduler_t *scheduler)
+{
+    if (scheduler->in_frame)
+    {
+        ESP_LOGE(TAG_DISPLAY, "begin_frame() called twice without end_frame().");
+        return FRAME_FAILURE;
+    }
+
+    scheduler->frame_start_us = esp_timer_get_time();
+    get_transfer_stats(&scheduler->frame_start_transfers);
+
+    // The first frame sets the pace for the rest.
+    if (scheduler->next_deadline_us == 0)
+    {
+        scheduler->next_deadline_us = scheduler->frame_start_us + scheduler->period_us;
+    }
+
+    scheduler->in_frame = 1;
+
+    return FRAME_SUCCESS;
+}
+
+
+int end_frame(frame_scheduler_t *scheduler)
+{
+    if (!scheduler->in_frame)
+    {
+        ESP_LOGE(TAG_DISPLAY, "end_frame() called without begin_frame().");
+        return FRAME_FAILURE;
+    }
+
+    if (scheduler->flush_cb != NULL)
+    {
+        scheduler->flush_cb(scheduler->panel_handle, scheduler->flush_ctx);
+    }
+
+    int64_t now_us = esp_timer_get_time();
+    int64_t frame_us = now_us - scheduler->frame_start_us;
+
+    transfer_stats_t transfers;
+    get_transfer_stats(&transfers);
+
+    // Record frame statistics.
+    scheduler->frames += 1;
+    scheduler->total_us += frame_us;
+    scheduler->total_transfer_us += transfers.busy_us - scheduler->frame_start_transfers.busy_us;
+
+    if (frame_us < scheduler->min_us)
+    {
+        scheduler->min_us = frame_us;
+    }
+
+    if (frame_us > scheduler->max_us)
+    {
+        scheduler->max_us = frame_us;
+    }
+
+    scheduler->history_us[scheduler->history_index] = (int32_t)frame_us;
+    scheduler->history_index = (scheduler->history_index + 1) % FRAME_HISTORY_SIZE;
+
+    // Over budget, drop the frame slots that have already passed instead of trying to catch up.
+    // The next frame then draws the newest state, at the next slot boundary.
+    uint32_t slots = 1;
+    if (now_us > scheduler->next_deadline_us)
+    {
+        uint32_t missed = (now_us - scheduler->next_deadline_us) / scheduler->period_us + 1;
+
+        scheduler->dropped += missed;
+        scheduler->next_deadline_us += missed * scheduler->period_us;
+        slots += missed;
+    }
+
+    // Sleep until the next frame is due. vTaskDelay() wakes on a tick interrupt, so it can return up to a tick early but
+    // never late: the whole ticks left are slept and the rest is waited out on the timer, no frame starts early.
+    TickType_t ticks = (scheduler->next_deadline_us - now_us) / (portTICK_PERIOD_MS * 1000);
+    if (ticks > 0)
+    {
+        vTaskDelay(ticks);
+    }
+
+    while (esp_timer_get_time() < scheduler->next_deadline_us)
+    {
+    }
+
+    scheduler->next_deadline_us += scheduler->period_us;
+    scheduler->frame_number += slots;
+    scheduler->in_frame = 0;
+
+    return FRAME_SUCCESS;
+}
+
+
+int run_frame(frame_scheduler_t *scheduler)
+{
+    if (begin_frame(scheduler) != FRAME_SUCCESS)
+    {
+        return FRAME_FAILURE;
+    }
+
+    for (int i = 0; i < scheduler->render_cb_amount; ++i)
+    {
+        scheduler->render_cb[i](scheduler->panel_handle, scheduler->frame_number, scheduler->render_ctx[i]);
+    }
+
+    return end_frame(scheduler);
+}
+
+
+void get_frame_stats(const frame_scheduler_t *scheduler, frame_stats_t *stats)
+{
+    memset(stats, 0, sizeof(frame_stats_t));
+
+    if (scheduler->frames == 0)
+    {
+        return;
+    }
+
+    stats->frames = scheduler->frames;
+    stats->dropped = scheduler->dropped;
+    stats->min_us = scheduler->min_us;
+    stats->max_us = scheduler->max_us;
+    stats->avg_us = scheduler->total_us / scheduler->frames;
+    stats->avg_transfer_us = scheduler->total_transfer_us / scheduler->frames;
+    stats->avg_render_us = stats->avg_us - stats->avg_transfer_us;
+
+    // Sort a copy of the recent frame times, the history is small enough for an insertion sort.
+    int32_t sorted_us[FRAME_HISTORY_SIZE];
+    int history_size = scheduler->frames < FRAME_HISTORY_SIZE ? scheduler->frames : FRAME_HISTORY_SIZE;
+
+    for (int i = 0; i < history_size; ++i)
+    {
+        int32_t value = scheduler->history_us[i];
+        int j = i - 1;
+
+        while (j >= 0 && sorted_us[j] > value)
+        {
+            sorted_us[j + 1] = sorted_us[j];
+            --j;
+        }
+        sorted_us[j + 1] = value;
+    }
+
+    // Nearest rank p99.
+    stats->p99_us = sorted_us[(history_size * 99 + 99) / 100 - 1];
+}
+
+
+void reset_frame_stats(frame_scheduler_t *scheduler)
+{
+    scheduler->frames = 0;
+    scheduler->dropped = 0;
+    scheduler->min_us = INT64_MAX;
+    scheduler->max_us = 0;
+    scheduler->total_us = 0;
+    scheduler->total_transfer_us = 0;
+    scheduler->history_index = 0;
+}
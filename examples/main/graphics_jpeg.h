@@ -0,0 +1,49 @@
+#ifndef GRAPHICS_JPEG_H
+#define GRAPHICS_JPEG_H
+
+#include "graphics_stream.h"
+
+
+// Largest MCU height in output lines, the height of a band at full scale.
+#define JPEG_MAX_MCU_SIZE 16
+
+
+// JPEG output scaling, done while decoding.
+typedef enum {
+    JPEG_SCALE_1 = 1,
+    JPEG_SCALE_1_2 = 2,
+    JPEG_SCALE_1_4 = 4,
+    JPEG_SCALE_1_8 = 8,         // Only the DC coefficient of every block is used, no IDCT is done.
+} jpeg_scale_t;
+
+// Information from the JPEG frame header.
+typedef struct {
+    unsigned short width;       // Before scaling.
+    unsigned short height;
+    uint8_t components;         // 1 for grayscale, 3 for YCbCr.
+    uint8_t h_sampling;         // Luma sampling factors, Ex: 2 and 2 for 4:2:0.
+    uint8_t v_sampling;
+} jpeg_info_t;
+
+// Where decoded bands go. A band is one MCU row, at most JPEG_MAX_MCU_SIZE lines of max_width pixels.
+typedef struct {
+    uint16_t *(*get_band)(void *band_ctx);      // Buffer for the next band, NULL to stop.
+    int (*put_band)(void *band_ctx, uint16_t *pixels, unsigned short y, unsigned short width, unsigned short lines);
+    void *band_ctx;
+    unsigned short max_width;   // Output is clipped to this size, the rest is decoded but not stored.
+    unsigned short max_height;
+} jpeg_output_t;
+
+
+// Decodes a baseline JPEG from a byte source into pre-swapped BGR565 bands, top to bottom.
+// Supports 8 bit grayscale and YCbCr with 4:4:4, 4:2:2, 4:4:0 and 4:2:0 sampling and restart markers,
+// progressive and arithmetic coded files are rejected. The decoder state is about 5 KB of static memory,
+// so only one JPEG can be decoded at a time. info may be NULL.
+int decode_jpeg(stream_read_cb_t read_cb, void *stream_ctx, jpeg_scale_t scale, const jpeg_output_t *output, jpeg_info_t *info);
+
+// Decodes a JPEG with its top left corner at start_x, start_y, clipped to the screen. Every band is decoded
+// into a pool block and sent right away, the blocks are used in rotation.
+int draw_jpeg(esp_lcd_panel_handle_t panel_handle, stream_read_cb_t read_cb, void *stream_ctx,
+    unsigned short start_x, unsigned short start_y, jpeg_scale_t scale, jpeg_info_t *info);
+
+#endif
@@ -0,0 +1,308 @@
+#include "graphics_snapshot.h"
+
+#include <string.h>
+
+
+// Snapshots start on 4 byte boundaries in the pool storage.
+#define SNAPSHOT_ALIGN(bytes) (((bytes) + 3) & ~3UL)
+
+
+int snapshot_pool_init(snapshot_pool_t *pool, void *storage, uint32_t capacity)
+{
+    // Sanity checks.
+    if ( (pool == NULL) || (storage == NULL) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Snapshot pool needs storage.");
+        return DRAW_FAILURE;
+    }
+
+    memset(pool, 0, sizeof(snapshot_pool_t));
+
+    // Pixels are read as uint16_t, so the storage used starts aligned.
+    uint32_t skipped = (4 - ((uintptr_t)storage & 3)) & 3;
+    if (capacity <= skipped)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Snapshot pool storage of %lu bytes is too small.", (unsigned long)capacity);
+        return DRAW_FAILURE;
+    }
+
+    pool->storage = (uint8_t *)storage + skipped;
+    pool->capacity = (capacity - skipped) & ~3UL;
+
+    return DRAW_SUCCESS;
+}
+
+
+// Encodes a region as runs of (length, color) pairs, one after the other across the lines. Returns the bytes written,
+// or 0 if they would reach limit_bytes.
+static uint32_t encode_runs(draw_t region, const pixel_source_t *source, uint16_t *line_buffer, uint16_t *out, uint32_t limit_bytes)
+{
+    uint32_t words = 0;
+    uint32_t limit_words = limit_bytes / sizeof(uint16_t);
+    uint32_t run_length = 0;
+    uint16_t run_color = 0;
+
+    for (int line = 0; line < region.image_size_y; ++line)
+    {
+        source->read_span(source->source_ctx, region.draw_start_x, region.draw_start_y + line, region.image_size_x, line_buffer);
+
+        for (int i = 0; i < region.image_size_x; ++i)
+        {
+            if ( (run_length > 0) && (line_buffer[i] == run_color) && (run_length < UINT16_MAX) )
+            {
+                run_length += 1;
+                continue;
+            }
+
+            if (run_length > 0)
+            {
+                if (words + 2 >= limit_words)
+                {
+                    return 0;
+                }
+                out[words] = run_length;
+                out[words + 1] = run_color;
+                words += 2;
+            }
+
+            run_color = line_buffer[i];
+            run_length = 1;
+        }
+    }
+
+    if (words + 2 >= limit_words)
+    {
+        return 0;
+    }
+    out[words] = run_length;
+    out[words + 1] = run_color;
+    words += 2;
+
+    return words * sizeof(uint16_t);
+}
+
+
+int save_region(snapshot_pool_t *pool, region_snapshot_t *snapshot, draw_t region, const pixel_source_t *source)
+{
+    // Sanity checks.
+    if ( (pool == NULL) || (snapshot == NULL) || (source == NULL) || (source->read_span == NULL) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot save region, NULL pointer.");
+        return DRAW_FAILURE;
+    }
+
+    snapshot->slot = SNAPSHOT_NONE;
+
+    if ( (region.image_size_x == 0) || (region.image_size_y == 0) ||
+        (region.draw_start_x + region.image_size_x > SCREEN_WIDTH) || (region.draw_start_y + region.image_size_y > SCREEN_HEIGHT) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Region to save is empty or out of bounds.");
+        return DRAW_FAILURE;
+    }
+
+    int slot = 0;
+    while ( (slot < SNAPSHOT_MAX_LIVE) && pool->slots[slot].live )
+    {
+        slot += 1;
+    }
+
+    if (slot == SNAPSHOT_MAX_LIVE)
+    {
+        ESP_LOGE(TAG_DISPLAY, "All %d snapshots are in use.", SNAPSHOT_MAX_LIVE);
+        return DRAW_FAILURE;
+    }
+
+    uint16_t *line_buffer = pool_borrow();
+    if (line_buffer == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for saving.");
+        return DRAW_FAILURE;
+    }
+
+    region.scale_x = 1;
+    region.scale_y = 1;
+
+    uint32_t pixel_bytes = (uint32_t)region.image_size_x * region.image_size_y * sizeof(uint16_t);
+    uint32_t free_bytes = pool->capacity - pool->used;
+    uint16_t *out = (uint16_t *)(pool->storage + pool->used);
+
+    // Runs are only kept when they are smaller than the pixels.
+    uint32_t stored_bytes = encode_runs(region, source, line_buffer, out, pixel_bytes < free_bytes ? pixel_bytes : free_bytes);
+    uint8_t compressed = stored_bytes > 0;
+
+    pool_return(line_buffer);
+
+    if (!compressed)
+    {
+        if (pixel_bytes > free_bytes)
+        {
+            pool->out_of_memory += 1;
+            ESP_LOGE(TAG_DISPLAY, "Snapshot of %lu bytes does not fit, %lu bytes free.", (unsigned long)pixel_bytes,
+                (unsigned long)free_bytes);
+            return DRAW_FAILURE;
+        }
+
+        for (int line = 0; line < region.image_size_y; ++line)
+        {
+            source->read_span(source->source_ctx, region.draw_start_x, region.draw_start_y + line, region.image_size_x,
+                out + line * region.image_size_x);
+        }
+        stored_bytes = pixel_bytes;
+    }
+
+    pool->slots[slot].offset = pool->used;
+    pool->slots[slot].stored_bytes = stored_bytes;
+    pool->slots[slot].live = 1;
+    pool->used += SNAPSHOT_ALIGN(stored_bytes);
+
+    snapshot->region = region;
+    snapshot->slot = slot;
+    snapshot->compressed = compressed;
+    snapshot->offset = pool->slots[slot].offset;
+    snapshot->stored_bytes = stored_bytes;
+
+    pool->live_snapshots += 1;
+    pool->bytes_in_use += stored_bytes;
+    if (pool->bytes_in_use > pool->high_water_bytes)
+    {
+        pool->high_water_bytes = pool->bytes_in_use;
+    }
+
+    pool->saved += 1;
+    pool->compressed += compressed;
+    pool->pixel_bytes_saved += pixel_bytes;
+    pool->bytes_stored += stored_bytes;
+
+    return DRAW_SUCCESS;
+}
+
+
+// Draws runs band by band through every free pool block, waiting only when they run out and once at the end.
+static int restore_runs(esp_lcd_panel_handle_t panel_handle, draw_t region, const uint16_t *runs)
+{
+    uint16_t *band_buffers[POOL_BLOCK_AMOUNT];
+    int band_buffer_amount = 0;
+
+    while (band_buffer_amount < POOL_BLOCK_AMOUNT)
+    {
+        band_buffers[band_buffer_amount] = pool_borrow();
+        if (band_buffers[band_buffer_amount] == NULL)
+        {
+            break;
+        }
+        band_buffer_amount += 1;
+    }
+
+    if (band_buffer_amount == 0)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for restoring.");
+        return DRAW_FAILURE;
+    }
+
+    int result = DRAW_SUCCESS;
+    int band_lines = POOL_BLOCK_PIXELS / region.image_size_x;
+    int next_buffer = 0;
+    uint32_t run_length = 0;
+    uint16_t run_color = 0;
+    draw_t band = region;
+
+    for (int line = 0; line < region.image_size_y; line += band_lines)
+    {
+        band.draw_start_y = region.draw_start_y + line;
+        band.image_size_y = region.image_size_y - line < band_lines ? region.image_size_y - line : band_lines;
+
+        if (next_buffer == band_buffer_amount)
+        {
+            wait_for_draws();
+            next_buffer = 0;
+        }
+
+        uint16_t *band_buffer = band_buffers[next_buffer];
+        int band_pixels = band.image_size_y * region.image_size_x;
+
+        for (int i = 0; i < band_pixels; )
+        {
+            if (run_length == 0)
+            {
+                run_length = runs[0];
+                run_color = runs[1];
+                runs += 2;
+            }
+
+            int pixels = band_pixels - i < (int)run_length ? band_pixels - i : (int)run_length;
+            for (int end = i + pixels; i < end; ++i)
+            {
+                band_buffer[i] = run_color;
+            }
+            run_length -= pixels;
+        }
+
+        result |= queue_bgr_image(panel_handle, band, band_buffer);
+        next_buffer += 1;
+    }
+
+    wait_for_draws();
+
+    for (int i = 0; i < band_buffer_amount; ++i)
+    {
+        pool_return(band_buffers[i]);
+    }
+
+    return result;
+}
+
+
+int restore_region(esp_lcd_panel_handle_t panel_handle, snapshot_pool_t *pool, region_snapshot_t *snapshot)
+{
+    // Sanity checks.
+    if ( (pool == NULL) || (snapshot == NULL) || (snapshot->slot < 0) || (snapshot->slot >= SNAPSHOT_MAX_LIVE) ||
+        !pool->slots[snapshot->slot].live )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot restore, the snapshot holds nothing.");
+        return DRAW_FAILURE;
+    }
+
+    int result;
+    uint16_t *stored = (uint16_t *)(pool->storage + snapshot->offset);
+
+    if (snapshot->compressed)
+    {
+        result = restore_runs(panel_handle, snapshot->region, stored);
+    }
+    else
+    {
+        result = draw_bgr_image(panel_handle, snapshot->region, stored);
+    }
+
+    pool->restored += 1;
+    release_region(pool, snapshot);
+
+    return result;
+}
+
+
+void release_region(snapshot_pool_t *pool, region_snapshot_t *snapshot)
+{
+    if ( (pool == NULL) || (snapshot == NULL) || (snapshot->slot < 0) || (snapshot->slot >= SNAPSHOT_MAX_LIVE) ||
+        !pool->slots[snapshot->slot].live )
+    {
+        return;
+    }
+
+    pool->slots[snapshot->slot].live = 0;
+    pool->live_snapshots -= 1;
+    pool->bytes_in_use -= pool->slots[snapshot->slot].stored_bytes;
+    snapshot->slot = SNAPSHOT_NONE;
+
+    // Space is taken back up to the end of the last live snapshot.
+    pool->used = 0;
+    for (int i = 0; i < SNAPSHOT_MAX_LIVE; ++i)
+    {
+        uint32_t end = pool->slots[i].offset + SNAPSHOT_ALIGN(pool->slots[i].stored_bytes);
+
+        if (pool->slots[i].live && (end > pool->used))
+        {
+            pool->used = end;
+        }
+    }
+}
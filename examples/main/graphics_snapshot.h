@@ -0,0 +1,66 @@
+#ifndef GRAPHICS_SNAPSHOT_H
+#define GRAPHICS_SNAPSHOT_H
+
+#include "graphics_blit.h"
+
+
+// Most snapshots a pool holds at the same time.
+#define SNAPSHOT_MAX_LIVE 8
+
+// Returned in a snapshot's slot when it holds nothing.
+#define SNAPSHOT_NONE -1
+
+
+// Saved screen region. Filled by save_region(), emptied by restore_region() or release_region().
+typedef struct {
+    draw_t region;              // Only start and size are used.
+    int8_t slot;                // Pool slot, SNAPSHOT_NONE when empty.
+    uint8_t compressed;         // Stored as runs instead of pixels.
+    uint32_t offset;            // In the pool storage, in bytes.
+    uint32_t stored_bytes;
+} region_snapshot_t;
+
+// Snapshot pool in caller provided storage, nothing is allocated. Snapshots are placed one after the other, the space
+// of a released snapshot is reused once the snapshots after it are released too, which fits nested popups and menus.
+typedef struct {
+    uint8_t *storage;
+    uint32_t capacity;
+    uint32_t used;              // End of the last live snapshot.
+    struct {
+        uint32_t offset;
+        uint32_t stored_bytes;
+        uint8_t live;
+    } slots[SNAPSHOT_MAX_LIVE];
+
+    // Memory.
+    uint32_t live_snapshots;
+    uint32_t bytes_in_use;      // Held by live snapshots.
+    uint32_t high_water_bytes;
+
+    // Totals since snapshot_pool_init().
+    uint32_t saved;
+    uint32_t compressed;        // Saved as runs.
+    uint32_t restored;
+    uint32_t out_of_memory;     // save_region() calls that did not fit.
+    uint64_t pixel_bytes_saved; // Size of the regions as pixels.
+    uint64_t bytes_stored;      // What they took in the pool.
+} snapshot_pool_t;
+
+
+// Sets up a pool in storage of capacity bytes. Storage that is DMA capable lets uncompressed snapshots be sent without a
+// copy, Ex: from heap_caps_malloc(capacity, MALLOC_CAP_DMA).
+int snapshot_pool_init(snapshot_pool_t *pool, void *storage, uint32_t capacity);
+
+// Saves a screen region as read from source, Ex: read_compositor_span() or read_image_span() over a retained frame.
+// The region is kept as runs of equal pixels when that is smaller, which is the usual case for UI screens, else as
+// pixels. A region that does not compress is read twice.
+int save_region(snapshot_pool_t *pool, region_snapshot_t *snapshot, draw_t region, const pixel_source_t *source);
+
+// Draws a saved region back where it was, Ex: when a popup drawn over it is dismissed, and releases it. Only the region
+// is sent, as a single window when stored as pixels. Returns once it is sent.
+int restore_region(esp_lcd_panel_handle_t panel_handle, snapshot_pool_t *pool, region_snapshot_t *snapshot);
+
+// Releases a saved region without drawing it.
+void release_region(snapshot_pool_t *pool, region_snapshot_t *snapshot);
+
+#endif
@@ -0,0 +1,369 @@
+#include "graphics_sprite.h"
+
+
+// Returns an existing sprite, or NULL after logging an error.
+static engine_sprite_t *get_engine_sprite(sprite_engine_t *engine, int sprite)
+{
+    if ( (sprite < 0) || (sprite >= engine->sprite_amount) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Sprite engine has no sprite %d.", sprite);
+        return NULL;
+    }
+
+    return &engine->sprites[sprite];
+}
+
+
+// Sorts the sprite indices by z, sprites with equal z stay in the order they were added.
+static void sort_z_order(sprite_engine_t *engine)
+{
+    for (int i = 0; i < engine->sprite_amount; ++i)
+    {
+        engine->z_order[i] = i;
+    }
+
+    for (int i = 1; i < engine->sprite_amount; ++i)
+    {
+        uint8_t sprite = engine->z_order[i];
+        int j = i - 1;
+
+        while (j >= 0 && engine->sprites[engine->z_order[j]].z > engine->sprites[sprite].z)
+        {
+            engine->z_order[j + 1] = engine->z_order[j];
+            --j;
+        }
+        engine->z_order[j + 1] = sprite;
+    }
+}
+
+
+int sprite_engine_init(sprite_engine_t *engine, const pixel_source_t *background)
+{
+    if ( (background == NULL) || (background->read_span == NULL) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Sprite engine background is a NULL pointer.");
+        return DRAW_FAILURE;
+    }
+
+    memset(engine, 0, sizeof(sprite_engine_t));
+    engine->background = background;
+
+    return DRAW_SUCCESS;
+}
+
+
+int add_engine_sprite(sprite_engine_t *engine, const sprite_t *frames, uint8_t frame_amount, uint16_t frame_period,
+    int x, int y, int8_t z)
+{
+    if ( (frames == NULL) || (frame_amount == 0) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Sprite frames are a NULL pointer or empty.");
+        return SPRITE_NO_SPRITE;
+    }
+
+    for (int i = 0; i < frame_amount; ++i)
+    {
+        if ( (frames[i].pixels == NULL) || ( (frames[i].format == SPRITE_FORMAT_A8) && (frames[i].alpha == NULL) ) )
+        {
+            ESP_LOGE(TAG_DISPLAY, "Buffers of sprite frame %d are NULL pointers.", i);
+            return SPRITE_NO_SPRITE;
+        }
+    }
+
+    if (engine->sprite_amount >= SPRITE_ENGINE_MAX_SPRITES)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot add more than %d sprites to a sprite engine.", SPRITE_ENGINE_MAX_SPRITES);
+        return SPRITE_NO_SPRITE;
+    }
+
+    engine_sprite_t *sprite = &engine->sprites[engine->sprite_amount];
+    memset(sprite, 0, sizeof(engine_sprite_t));
+    sprite->frames = frames;
+    sprite->frame_amount = frame_amount;
+    sprite->frame_period = frame_period;
+    sprite->x = x * (1 << SPRITE_SUBPIXEL_BITS);
+    sprite->y = y * (1 << SPRITE_SUBPIXEL_BITS);
+    sprite->z = z;
+    sprite->visible = 1;
+
+    engine->sprite_amount += 1;
+    sort_z_order(engine);
+
+    return engine->sprite_amount - 1;
+}
+
+
+int set_sprite_position(sprite_engine_t *engine, int sprite, int x, int y)
+{
+    engine_sprite_t *changed = get_engine_sprite(engine, sprite);
+    if (changed == NULL)
+    {
+        return DRAW_FAILURE;
+    }
+
+    changed->x = x * (1 << SPRITE_SUBPIXEL_BITS);
+    changed->y = y * (1 << SPRITE_SUBPIXEL_BITS);
+
+    return DRAW_SUCCESS;
+}
+
+
+int set_sprite_velocity(sprite_engine_t *engine, int sprite, int16_t velocity_x, int16_t velocity_y)
+{
+    engine_sprite_t *changed = get_engine_sprite(engine, sprite);
+    if (changed == NULL)
+    {
+        return DRAW_FAILURE;
+    }
+
+    changed->velocity_x = velocity_x;
+    changed->velocity_y = velocity_y;
+
+    return DRAW_SUCCESS;
+}
+
+
+int set_sprite_z(sprite_engine_t *engine, int sprite, int8_t z)
+{
+    engine_sprite_t *changed = get_engine_sprite(engine, sprite);
+    if (changed == NULL)
+    {
+        return DRAW_FAILURE;
+    }
+
+    if (changed->z != z)
+    {
+        changed->z = z;
+        sort_z_order(engine);
+
+        // Overlapping sprites swap places, so the sprite area is redrawn.
+        changed->dirty = 1;
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+int set_sprite_visible(sprite_engine_t *engine, int sprite, uint8_t visible)
+{
+    engine_sprite_t *changed = get_engine_sprite(engine, sprite);
+    if (changed == NULL)
+    {
+        return DRAW_FAILURE;
+    }
+
+    changed->visible = (visible != 0);
+
+    return DRAW_SUCCESS;
+}
+
+
+void update_sprites(sprite_engine_t *engine, uint32_t frame_number)
+{
+    // The first update only sets the starting point.
+    uint32_t elapsed = engine->updated ? frame_number - engine->frame_number : 0;
+
+    engine->frame_number = frame_number;
+    engine->updated = 1;
+
+    for (int i = 0; i < engine->sprite_amount; ++i)
+    {
+        engine_sprite_t *sprite = &engine->sprites[i];
+
+        sprite->x += sprite->velocity_x * (int32_t)elapsed;
+        sprite->y += sprite->velocity_y * (int32_t)elapsed;
+
+        if (sprite->frame_period > 0)
+        {
+            sprite->frame = (frame_number / sprite->frame_period) % sprite->frame_amount;
+        }
+    }
+}
+
+
+// Adds a rectangle, clipped to the screen, to the regions to redraw.
+static void add_region(draw_t *regions, int *region_amount, int x, int y, int width, int height)
+{
+    int x_start = x < 0 ? 0 : x;
+    int y_start = y < 0 ? 0 : y;
+    int x_end = x + width > SCREEN_WIDTH ? SCREEN_WIDTH : x + width;
+    int y_end = y + height > SCREEN_HEIGHT ? SCREEN_HEIGHT : y + height;
+
+    // Nothing on screen.
+    if ( (x_start >= x_end) || (y_start >= y_end) )
+    {
+        return;
+    }
+
+    regions[*region_amount] = (draw_t){
+        .draw_start_x = x_start,
+        .draw_start_y = y_start,
+        .image_size_x = x_end - x_start,
+        .image_size_y = y_end - y_start,
+        .scale_x = 1,
+        .scale_y = 1,
+    };
+    *region_amount += 1;
+}
+
+
+// Renders a screen line of a region, the background with the visible sprites over it from bottom to top.
+static void render_sprite_line(const sprite_engine_t *engine, const draw_t *region, int y, uint16_t *line_buffer)
+{
+    int region_x_end = region->draw_start_x + region->image_size_x;
+
+    engine->background->read_span(engine->background->source_ctx, region->draw_start_x, y, region->image_size_x, line_buffer);
+
+    for (int i = 0; i < engine->sprite_amount; ++i)
+    {
+        const engine_sprite_t *sprite = &engine->sprites[engine->z_order[i]];
+        const sprite_t *frame = &sprite->frames[sprite->frame];
+        int sprite_x = sprite->x >> SPRITE_SUBPIXEL_BITS;
+        int sprite_y = sprite->y >> SPRITE_SUBPIXEL_BITS;
+
+        if ( !sprite->visible || (y < sprite_y) || (y >= sprite_y + frame->height) )
+        {
+            continue;
+        }
+
+        int x_start = sprite_x > region->draw_start_x ? sprite_x : region->draw_start_x;
+        int x_end = sprite_x + frame->width < region_x_end ? sprite_x + frame->width : region_x_end;
+
+        if (x_start < x_end)
+        {
+            blend_sprite_line(frame, (y - sprite_y) * frame->width + (x_start - sprite_x), x_end - x_start,
+                line_buffer + (x_start - region->draw_start_x));
+        }
+    }
+}
+
+
+int draw_sprites(esp_lcd_panel_handle_t panel_handle, sprite_engine_t *engine)
+{
+    draw_t regions[SPRITE_ENGINE_MAX_SPRITES * 2];
+    int region_amount = 0;
+
+    // Damaged regions, the old bounds of a changed sprite show the background again and the new bounds the sprite.
+    for (int i = 0; i < engine->sprite_amount; ++i)
+    {
+        const engine_sprite_t *sprite = &engine->sprites[i];
+        const sprite_t *frame = &sprite->frames[sprite->frame];
+        int sprite_x = sprite->x >> SPRITE_SUBPIXEL_BITS;
+        int sprite_y = sprite->y >> SPRITE_SUBPIXEL_BITS;
+
+        if ( !sprite->dirty && (sprite->drawn == sprite->visible) &&
+             ( !sprite->visible || ( (sprite->drawn_frame == frame) && (sprite->drawn_x == sprite_x) && (sprite->drawn_y == sprite_y) ) ) )
+        {
+            continue;
+        }
+
+        if (sprite->drawn)
+        {
+            add_region(regions, &region_amount, sprite->drawn_x, sprite->drawn_y, sprite->drawn_frame->width, sprite->drawn_frame->height);
+        }
+
+        if (sprite->visible)
+        {
+            add_region(regions, &region_amount, sprite_x, sprite_y, frame->width, frame->height);
+        }
+    }
+
+    if (region_amount == 0)
+    {
+        return DRAW_SUCCESS;
+    }
+
+    // A sprite that moved a little becomes the union of its old and new bounds.
+    merge_overlapping_regions(regions, &region_amount);
+
+    // Every free pool block is used, so bands are only waited for when the blocks run out.
+    uint16_t *band_buffers[POOL_BLOCK_AMOUNT];
+    int band_buffer_amount = 0;
+
+    while (band_buffer_amount < POOL_BLOCK_AMOUNT)
+    {
+        band_buffers[band_buffer_amount] = pool_borrow();
+        if (band_buffers[band_buffer_amount] == NULL)
+        {
+            break;
+        }
+        band_buffer_amount += 1;
+    }
+
+    if (band_buffer_amount == 0)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for drawing sprites.");
+        return DRAW_FAILURE;
+    }
+
+    int result = DRAW_SUCCESS;
+    int next_buffer = 0;
+
+    for (int i = 0; i < region_amount; ++i)
+    {
+        const draw_t *region = &regions[i];
+        int width = region->image_size_x;
+        int region_y_end = region->draw_start_y + region->image_size_y;
+        int band_lines = POOL_BLOCK_PIXELS / width;
+
+        draw_t band = {
+            .draw_start_x = region->draw_start_x,
+            .image_size_x = width,
+            .scale_x = 1,
+            .scale_y = 1,
+        };
+
+        for (int y = region->draw_start_y; y < region_y_end; y += band_lines)
+        {
+            // All blocks queued, wait for them before rendering over them.
+            if (next_buffer == band_buffer_amount)
+            {
+                wait_for_draws();
+                next_buffer = 0;
+            }
+
+            uint16_t *band_buffer = band_buffers[next_buffer];
+            next_buffer += 1;
+
+            band.draw_start_y = y;
+            band.image_size_y = region_y_end - y < band_lines ? region_y_end - y : band_lines;
+
+            for (int band_line = 0; band_line < band.image_size_y; ++band_line)
+            {
+                render_sprite_line(engine, region, y + band_line, band_buffer + band_line * width);
+            }
+
+            result |= queue_bgr_image(panel_handle, band, band_buffer);
+        }
+    }
+
+    wait_for_draws();
+
+    for (int i = 0; i < band_buffer_amount; ++i)
+    {
+        pool_return(band_buffers[i]);
+    }
+
+    // The screen now shows the current state.
+    for (int i = 0; i < engine->sprite_amount; ++i)
+    {
+        engine_sprite_t *sprite = &engine->sprites[i];
+
+        sprite->dirty = 0;
+        sprite->drawn = sprite->visible;
+        sprite->drawn_frame = &sprite->frames[sprite->frame];
+        sprite->drawn_x = sprite->x >> SPRITE_SUBPIXEL_BITS;
+        sprite->drawn_y = sprite->y >> SPRITE_SUBPIXEL_BITS;
+    }
+
+    return result;
+}
+
+
+void run_sprite_engine(esp_lcd_panel_handle_t panel_handle, uint32_t frame_number, void *user_ctx)
+{
+    sprite_engine_t *engine = (sprite_engine_t *)user_ctx;
+
+    update_sprites(engine, frame_number);
+    draw_sprites(panel_handle, engine);
+}
@@ -0,0 +1,74 @@
+#ifndef GRAPHICS_SPRITE_H
+#define GRAPHICS_SPRITE_H
+
+#include "graphics_blit.h"
+
+
+// Amount of sprites a single sprite engine can move.
+#define SPRITE_ENGINE_MAX_SPRITES 16
+
+// Positions and velocities are in 1 / (1 << SPRITE_SUBPIXEL_BITS) pixels, so slow sprites still move smoothly.
+#define SPRITE_SUBPIXEL_BITS 8
+
+// Returned instead of a sprite index when a sprite cannot be added.
+#define SPRITE_NO_SPRITE -1
+
+
+// Animated sprite, moved and drawn by a sprite engine.
+typedef struct {
+    const sprite_t *frames;     // Animation frames, frame_amount sprites.
+    uint8_t frame_amount;
+    uint16_t frame_period;      // Frame slots per animation frame, 0 keeps the current frame.
+    uint8_t frame;              // Current animation frame.
+
+    int32_t x;                  // Top left corner, in subpixels.
+    int32_t y;
+    int16_t velocity_x;         // Subpixels per frame slot.
+    int16_t velocity_y;
+    int8_t z;                   // Higher z is drawn on top, equal z in the order the sprites were added.
+    uint8_t visible;
+
+    // What is on the screen right now.
+    uint8_t dirty;              // Redrawn by the next draw_sprites(), even when it did not change.
+    uint8_t drawn;
+    const sprite_t *drawn_frame;
+    int drawn_x;
+    int drawn_y;
+} engine_sprite_t;
+
+// Sprite engine, sprites over a background source.
+typedef struct {
+    engine_sprite_t sprites[SPRITE_ENGINE_MAX_SPRITES];
+    uint8_t z_order[SPRITE_ENGINE_MAX_SPRITES];     // Sprite indices from bottom to top.
+    int sprite_amount;
+    const pixel_source_t *background;
+    uint32_t frame_number;      // Frame slot of the last update_sprites().
+    uint8_t updated;
+} sprite_engine_t;
+
+
+// Sets up an empty sprite engine. The background is what sprites are drawn over and what is restored when they move.
+int sprite_engine_init(sprite_engine_t *engine, const pixel_source_t *background);
+
+// Adds a sprite with its top left corner at x, y in pixels. Returns the sprite index, or SPRITE_NO_SPRITE.
+// The frames are not copied and must stay valid while the engine is used.
+int add_engine_sprite(sprite_engine_t *engine, const sprite_t *frames, uint8_t frame_amount, uint16_t frame_period,
+    int x, int y, int8_t z);
+
+// Sprite changes, shown at the next draw_sprites(). Positions are in pixels, velocities in subpixels per frame slot.
+int set_sprite_position(sprite_engine_t *engine, int sprite, int x, int y);
+int set_sprite_velocity(sprite_engine_t *engine, int sprite, int16_t velocity_x, int16_t velocity_y);
+int set_sprite_z(sprite_engine_t *engine, int sprite, int8_t z);
+int set_sprite_visible(sprite_engine_t *engine, int sprite, uint8_t visible);
+
+// Moves and animates the sprites up to frame_number, Ex: the frame number of a frame scheduler.
+void update_sprites(sprite_engine_t *engine, uint32_t frame_number);
+
+// Redraws every sprite that moved, changed frame or was shown or hidden. The union of its old and new bounds is
+// rendered from the background and the sprites over it, all bands are queued back to back and waited for once.
+int draw_sprites(esp_lcd_panel_handle_t panel_handle, sprite_engine_t *engine);
+
+// update_sprites() followed by draw_sprites(), with the engine as user_ctx. Can be added as a frame scheduler render callback.
+void run_sprite_engine(esp_lcd_panel_handle_t panel_handle, uint32_t frame_number, void *user_ctx);
+
+#endif
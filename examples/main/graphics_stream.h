@@ -0,0 +1,58 @@
+#ifndef GRAPHICS_STREAM_H
+#define GRAPHICS_STREAM_H
+
+#include "graphics.h"
+
+
+// Bytes read from the byte source at a time.
+#define STREAM_INPUT_BUFFER_SIZE 256
+
+// First bytes of an image stream, see tools/make_stream.py.
+#define STREAM_MAGIC "LCDS"
+#define STREAM_VERSION 1
+
+
+// Reads up to size bytes from a byte source, Ex: a UART, a socket or a file. Returns the amount read,
+// 0 at the end of the stream or a negative value on errors. Blocking here is what slows the sender down.
+typedef int (*stream_read_cb_t)(void *stream_ctx, uint8_t *buffer, int size);
+
+// Context for read_memory_stream(), a byte source over data already in memory, Ex: a file embedded in flash.
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+    size_t position;
+} memory_stream_t;
+
+// Pixel encodings of an image stream.
+typedef enum {
+    STREAM_ENCODING_RAW,        // 2 bytes per pixel, BGR565 as sent to the LCD.
+    STREAM_ENCODING_RLE,        // Packets of a count byte n: n < 128 is n + 1 raw pixels, else n - 127 times the next pixel.
+    STREAM_ENCODING_QOI,        // QOI chunks, without the QOI header and end marker.
+} stream_encoding_t;
+
+// Image stream header, 20 bytes little endian at the start of the stream:
+// "LCDS", uint8 version, uint8 encoding, uint16 x, y, width, height, reserved, uint32 lines.
+typedef struct {
+    stream_encoding_t encoding;
+    draw_t window;              // Screen area the lines are drawn in, top to bottom, wrapping back to the top.
+    uint32_t lines;             // Lines in the stream, 0 to read lines until the stream ends.
+} stream_header_t;
+
+// Ingest statistics of a single stream.
+typedef struct {
+    uint64_t bytes_read;        // Including the header.
+    uint64_t pixels_drawn;
+    uint32_t bands;
+    int64_t total_us;
+} stream_stats_t;
+
+
+// Byte source callback for a memory_stream_t.
+int read_memory_stream(void *stream_ctx, uint8_t *buffer, int size);
+
+// Reads an image stream from a byte source and draws it while it arrives. Pixels are decoded straight into pool
+// blocks used in rotation as bands, and a block is only refilled once its band has been sent. Memory use does not
+// depend on the image size, so images taller than the window or endless streams work as well. stats may be NULL.
+int draw_image_stream(esp_lcd_panel_handle_t panel_handle, stream_read_cb_t read_cb, void *stream_ctx, stream_stats_t *stats);
+
+#endif
@@ -0,0 +1,224 @@
+#include "graphics_tilemap.h"
+
+
+// Modulo that stays positive for negative values.
+static int wrap(int value, int range)
+{
+    return ((value % range) + range) % range;
+}
+
+
+int tilemap_init(tilemap_t *tilemap, const tileset_t *tileset, const uint16_t *map, unsigned short map_width,
+    unsigned short map_height, draw_t viewport, uint16_t BGR_color)
+{
+    // Sanity checks.
+    if ( (tileset == NULL) || (map == NULL) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Tileset or map is a NULL pointer.");
+        return DRAW_FAILURE;
+    }
+
+    if ( (tileset->tile_size != 8) && (tileset->tile_size != 16) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Tiles must be 8x8 or 16x16 pixels.");
+        return DRAW_FAILURE;
+    }
+
+    if ( ( (tileset->format == TILE_FORMAT_BGR565) && (tileset->pixels == NULL) ) ||
+         ( (tileset->format == TILE_FORMAT_INDEXED8) && ( (tileset->indices == NULL) || (tileset->palette == NULL) ) ) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Tileset buffers are NULL pointers.");
+        return DRAW_FAILURE;
+    }
+
+    if ( (viewport.image_size_x == 0) || (viewport.image_size_y == 0) ||
+         (viewport.draw_start_x + viewport.image_size_x > SCREEN_WIDTH) || (viewport.draw_start_y + viewport.image_size_y > SCREEN_HEIGHT) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Tilemap viewport out of bounds.");
+        return DRAW_FAILURE;
+    }
+
+    memset(tilemap, 0, sizeof(tilemap_t));
+    tilemap->tileset = tileset;
+    tilemap->map = map;
+    tilemap->map_width = map_width;
+    tilemap->map_height = map_height;
+    tilemap->BGR_color = BGR_color;
+    tilemap->viewport = viewport;
+
+    // The hardware scroll moves whole screen lines.
+    tilemap->hardware_scroll = (viewport.draw_start_x == 0) && (viewport.image_size_x == SCREEN_WIDTH);
+
+    return DRAW_SUCCESS;
+}
+
+
+void set_tilemap_camera(tilemap_t *tilemap, int camera_x, int camera_y)
+{
+    tilemap->camera_x = camera_x;
+    tilemap->camera_y = camera_y;
+}
+
+
+void invalidate_tilemap(tilemap_t *tilemap)
+{
+    tilemap->drawn = 0;
+}
+
+
+// Renders a span of a world pixel line, tile run by tile run.
+static void render_tile_span(const tilemap_t *tilemap, int world_x, int world_y, int width, uint16_t *span_buffer)
+{
+    const tileset_t *tileset = tilemap->tileset;
+    int tile_size = tileset->tile_size;
+    int tile_y = world_y >= 0 ? world_y / tile_size : -1;
+    int tile_line = wrap(world_y, tile_size);
+
+    while (width > 0)
+    {
+        int tile_x = world_x >= 0 ? world_x / tile_size : -1;
+        int tile_column = wrap(world_x, tile_size);
+        int run = tile_size - tile_column < width ? tile_size - tile_column : width;
+
+        uint16_t tile = TILEMAP_EMPTY_TILE;
+        if ( (tile_x >= 0) && (tile_x < tilemap->map_width) && (tile_y >= 0) && (tile_y < tilemap->map_height) )
+        {
+            tile = tilemap->map[tile_y * tilemap->map_width + tile_x];
+        }
+
+        int first_pixel = (tile * tile_size + tile_line) * tile_size + tile_column;
+
+        if (tile >= tileset->tile_amount)
+        {
+            for (int i = 0; i < run; ++i)
+            {
+                span_buffer[i] = tilemap->BGR_color;
+            }
+        }
+        else if (tileset->format == TILE_FORMAT_BGR565)
+        {
+            memcpy(span_buffer, tileset->pixels + first_pixel, run * sizeof(uint16_t));
+        }
+        else
+        {
+            const uint8_t *indices = tileset->indices + first_pixel;
+
+            for (int i = 0; i < run; ++i)
+            {
+                span_buffer[i] = tileset->palette[indices[i]];
+            }
+        }
+
+        span_buffer += run;
+        world_x += run;
+        width -= run;
+    }
+}
+
+
+// Draws the world lines from first_world_line up to last_world_line, at their place in the viewport.
+// With the hardware scroll every world line has a fixed viewport line, the scroll offset decides where it shows up.
+static int draw_world_lines(esp_lcd_panel_handle_t panel_handle, const tilemap_t *tilemap, int first_world_line, int last_world_line)
+{
+    uint16_t *band_buffer = pool_borrow();
+    if (band_buffer == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "No pool block available for the tilemap.");
+        return DRAW_FAILURE;
+    }
+
+    int result = DRAW_SUCCESS;
+    draw_t viewport = tilemap->viewport;
+    int max_band_lines = POOL_BLOCK_PIXELS / viewport.image_size_x;
+    draw_t band = viewport;
+
+    for (int world_line = first_world_line; world_line < last_world_line; world_line += band.image_size_y)
+    {
+        int viewport_line = wrap(tilemap->hardware_scroll ? world_line : world_line - tilemap->camera_y, viewport.image_size_y);
+
+        // Bands stop at the bottom of the viewport, lines past it wrap around to the top.
+        int band_lines = last_world_line - world_line;
+        band_lines = band_lines < max_band_lines ? band_lines : max_band_lines;
+        band_lines = band_lines < viewport.image_size_y - viewport_line ? band_lines : viewport.image_size_y - viewport_line;
+
+        band.draw_start_y = viewport.draw_start_y + viewport_line;
+        band.image_size_y = band_lines;
+
+        for (int band_line = 0; band_line < band_lines; ++band_line)
+        {
+            render_tile_span(tilemap, tilemap->camera_x, world_line + band_line, viewport.image_size_x,
+                band_buffer + band_line * viewport.image_size_x);
+        }
+
+        result |= draw_bgr_image(panel_handle, band, band_buffer);
+    }
+
+    pool_return(band_buffer);
+
+    return result;
+}
+
+
+int draw_tilemap(esp_lcd_panel_handle_t panel_handle, tilemap_t *tilemap)
+{
+    int height = tilemap->viewport.image_size_y;
+    int first_world_line = tilemap->camera_y;
+    int last_world_line = tilemap->camera_y + height;
+
+    if (tilemap->drawn && (tilemap->camera_x == tilemap->drawn_camera_x))
+    {
+        int moved_lines = tilemap->camera_y - tilemap->drawn_camera_y;
+
+        if (moved_lines == 0)
+        {
+            return DRAW_SUCCESS;
+        }
+
+        // Only the lines scrolled into view are new.
+        if (tilemap->hardware_scroll && (abs(moved_lines) < height))
+        {
+            if (moved_lines > 0)
+            {
+                first_world_line = tilemap->drawn_camera_y + height;
+            }
+            else
+            {
+                last_world_line = tilemap->drawn_camera_y;
+            }
+        }
+    }
+
+    if (tilemap->hardware_scroll &&
+        (set_vertical_scroll(tilemap->viewport.draw_start_y, height, wrap(tilemap->camera_y, height)) != DRAW_SUCCESS))
+    {
+        return DRAW_FAILURE;
+    }
+
+    int result = draw_world_lines(panel_handle, tilemap, first_world_line, last_world_line);
+
+    tilemap->drawn = (result == DRAW_SUCCESS);
+    tilemap->drawn_camera_x = tilemap->camera_x;
+    tilemap->drawn_camera_y = tilemap->camera_y;
+
+    return result;
+}
+
+
+int release_tilemap_scroll(esp_lcd_panel_handle_t panel_handle, tilemap_t *tilemap)
+{
+    if (!tilemap->hardware_scroll)
+    {
+        return DRAW_SUCCESS;
+    }
+
+    if (set_vertical_scroll(tilemap->viewport.draw_start_y, tilemap->viewport.image_size_y, 0) != DRAW_SUCCESS)
+    {
+        return DRAW_FAILURE;
+    }
+
+    // Redrawn unrotated, from here on the viewport is drawn like any other screen area.
+    tilemap->hardware_scroll = 0;
+    invalidate_tilemap(tilemap);
+
+    return draw_tilemap(panel_handle, tilemap);
+}
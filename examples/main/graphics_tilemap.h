@@ -0,0 +1,65 @@
+#ifndef GRAPHICS_TILEMAP_H
+#define GRAPHICS_TILEMAP_H
+
+#include "graphics.h"
+
+
+// Map entry drawn as the background color, like the area outside the map.
+#define TILEMAP_EMPTY_TILE 0xFFFF
+
+
+// Tile pixel formats.
+typedef enum {
+    TILE_FORMAT_BGR565,         // tile_size * tile_size BGR565 pixels per tile.
+    TILE_FORMAT_INDEXED8,       // tile_size * tile_size palette indices per tile.
+} tile_format_t;
+
+// Tileset, square tiles stored one after another.
+typedef struct {
+    tile_format_t format;
+    uint8_t tile_size;          // 8 or 16.
+    uint16_t tile_amount;
+    const uint16_t *pixels;     // TILE_FORMAT_BGR565 only.
+    const uint8_t *indices;     // TILE_FORMAT_INDEXED8 only.
+    const uint16_t *palette;    // TILE_FORMAT_INDEXED8 only, 256 BGR565 colors.
+} tileset_t;
+
+// Tilemap, a world of map_width * map_height tiles seen through a viewport on the screen.
+typedef struct {
+    const tileset_t *tileset;
+    const uint16_t *map;        // Tile indices, row by row.
+    unsigned short map_width;   // In tiles.
+    unsigned short map_height;
+    uint16_t BGR_color;         // Outside the map and for TILEMAP_EMPTY_TILE.
+
+    draw_t viewport;            // Screen area, only start and size are used.
+    int camera_x;               // World pixel shown in the top left corner of the viewport.
+    int camera_y;
+
+    // Drawing state.
+    uint8_t drawn;              // The viewport shows drawn_camera_x, drawn_camera_y.
+    uint8_t hardware_scroll;    // The viewport spans the screen width, so vertical moves use the hardware scroll.
+    int drawn_camera_x;
+    int drawn_camera_y;
+} tilemap_t;
+
+
+// Sets up a tilemap with the camera at 0, 0. The tileset and map are not copied and must stay valid.
+int tilemap_init(tilemap_t *tilemap, const tileset_t *tileset, const uint16_t *map, unsigned short map_width,
+    unsigned short map_height, draw_t viewport, uint16_t BGR_color);
+
+// Moves the camera, takes effect at the next draw_tilemap().
+void set_tilemap_camera(tilemap_t *tilemap, int camera_x, int camera_y);
+
+// Draws the viewport band by band straight from the tiles. Only what the camera move exposed is drawn:
+// vertical moves scroll the viewport in hardware when it spans the screen width, other moves redraw it.
+int draw_tilemap(esp_lcd_panel_handle_t panel_handle, tilemap_t *tilemap);
+
+// Makes the next draw_tilemap() redraw the whole viewport, Ex: after changing the map.
+void invalidate_tilemap(tilemap_t *tilemap);
+
+// Turns the hardware scroll off and redraws the viewport unrotated, needed before drawing anything else over it.
+// From then on every camera move redraws the viewport, until tilemap_init() is called again.
+int release_tilemap_scroll(esp_lcd_panel_handle_t panel_handle, tilemap_t *tilemap);
+
+#endif
@@ -0,0 +1,788 @@
+#include "graphics_widget.h"
+
+#include <math.h>
+#include <stdio.h>
+
+
+// What changed in a dirty widget, a bar whose fill is all that changed only redraws the difference.
+#define WIDGET_DIRTY_CONTENT 1
+#define WIDGET_DIRTY_FILL 2
+
+// Gauge ring, degrees clockwise from the positive x axis with y pointing down.
+#define GAUGE_START_ANGLE 135.0f
+#define GAUGE_SWEEP_ANGLE 270.0f
+
+
+// Returns an existing widget, or NULL after logging an error.
+static widget_t *get_widget(widget_tree_t *tree, int widget)
+{
+    if ( (tree == NULL) || (widget < 0) || (widget >= tree->widget_amount) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Widget %d does not exist.", widget);
+        return NULL;
+    }
+
+    return &tree->widgets[widget];
+}
+
+
+// Copies text into a widget, cut at a character boundary if it does not fit.
+static void store_widget_text(widget_t *target, const char *text)
+{
+    int length = strlen(text);
+
+    if (length > WIDGET_TEXT_SIZE - 1)
+    {
+        length = WIDGET_TEXT_SIZE - 1;
+        while ( (length > 0) && ((text[length] & 0xC0) == 0x80) )
+        {
+            --length;
+        }
+    }
+
+    memcpy(target->text, text, length);
+    target->text[length] = '\0';
+    target->text_length = length;
+    target->text_width = get_aa_text_width(target->font, target->text, length);
+}
+
+
+// Formats the value of a number widget, Ex: 1234 with 2 decimals is "12.34".
+static void format_number(widget_t *target)
+{
+    char text[WIDGET_TEXT_SIZE];
+    int32_t value = target->value;
+
+    // add_number() allows at most 9 decimals, bounded here too so the text is known to fit, at most "-214748364.8".
+    int decimals = target->decimals < 9 ? target->decimals : 9;
+
+    if (decimals == 0)
+    {
+        snprintf(text, sizeof(text), "%ld", (long)value);
+    }
+    else
+    {
+        uint32_t divisor = 1;
+        for (int i = 0; i < decimals; ++i)
+        {
+            divisor *= 10;
+        }
+
+        uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+        snprintf(text, sizeof(text), "%s%lu.%0*lu", value < 0 ? "-" : "", (unsigned long)(magnitude / divisor),
+            decimals, (unsigned long)(magnitude % divisor));
+    }
+
+    store_widget_text(target, text);
+}
+
+
+// Adds a widget on top of the other children of parent.
+static widget_t *add_widget(widget_tree_t *tree, int parent, draw_t bounds, widget_type_t type, int *index)
+{
+    *index = WIDGET_NONE;
+
+    widget_t *parent_widget = get_widget(tree, parent);
+    if (parent_widget == NULL)
+    {
+        return NULL;
+    }
+
+    if (parent_widget->type != WIDGET_CONTAINER)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Widget %d is not a container.", parent);
+        return NULL;
+    }
+
+    if (tree->widget_amount >= tree->capacity)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot add more than %d widgets.", tree->capacity);
+        return NULL;
+    }
+
+    *index = tree->widget_amount;
+    tree->widget_amount += 1;
+
+    widget_t *added = &tree->widgets[*index];
+    memset(added, 0, sizeof(widget_t));
+    added->type = type;
+    added->visible = 1;
+    added->dirty = WIDGET_DIRTY_CONTENT;
+    added->parent = parent;
+    added->first_child = WIDGET_NONE;
+    added->next_sibling = WIDGET_NONE;
+    added->x = bounds.draw_start_x;
+    added->y = bounds.draw_start_y;
+    added->width = bounds.image_size_x;
+    added->height = bounds.image_size_y;
+
+    // Children are drawn in order, the last one on top.
+    if (parent_widget->first_child == WIDGET_NONE)
+    {
+        parent_widget->first_child = *index;
+    }
+    else
+    {
+        widget_t *sibling = &tree->widgets[parent_widget->first_child];
+        while (sibling->next_sibling != WIDGET_NONE)
+        {
+            sibling = &tree->widgets[sibling->next_sibling];
+        }
+        sibling->next_sibling = *index;
+    }
+
+    return added;
+}
+
+
+int widget_tree_init(widget_tree_t *tree, widget_t *storage, uint16_t capacity, uint16_t background_color)
+{
+    // Sanity checks.
+    if ( (tree == NULL) || (storage == NULL) || (capacity == 0) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Widget tree needs storage for at least the root widget.");
+        return DRAW_FAILURE;
+    }
+
+    memset(tree, 0, sizeof(widget_tree_t));
+    tree->widgets = storage;
+    tree->capacity = capacity;
+    tree->widget_amount = 1;
+
+    widget_t *root = &storage[WIDGET_ROOT];
+    memset(root, 0, sizeof(widget_t));
+    root->type = WIDGET_CONTAINER;
+    root->visible = 1;
+    root->dirty = WIDGET_DIRTY_CONTENT;
+    root->parent = WIDGET_NONE;
+    root->first_child = WIDGET_NONE;
+    root->next_sibling = WIDGET_NONE;
+    root->width = SCREEN_WIDTH;
+    root->height = SCREEN_HEIGHT;
+    root->background_color = background_color;
+
+    return DRAW_SUCCESS;
+}
+
+
+int add_container(widget_tree_t *tree, int parent, draw_t bounds, uint16_t background_color)
+{
+    int index;
+    widget_t *added = add_widget(tree, parent, bounds, WIDGET_CONTAINER, &index);
+
+    if (added != NULL)
+    {
+        added->background_color = background_color;
+    }
+
+    return index;
+}
+
+
+int add_label(widget_tree_t *tree, int parent, draw_t bounds, const aa_font_t *font, uint16_t color, uint16_t background_color,
+    widget_align_t align, const char *text)
+{
+    if ( (font == NULL) || (text == NULL) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Label font or text is a NULL pointer.");
+        return WIDGET_NONE;
+    }
+
+    int index;
+    widget_t *added = add_widget(tree, parent, bounds, WIDGET_LABEL, &index);
+
+    if (added != NULL)
+    {
+        added->font = font;
+        added->color = color;
+        added->background_color = background_color;
+        added->align = align;
+        store_widget_text(added, text);
+    }
+
+    return index;
+}
+
+
+int add_number(widget_tree_t *tree, int parent, draw_t bounds, const aa_font_t *font, uint16_t color, uint16_t background_color,
+    widget_align_t align, int32_t value, uint8_t decimals)
+{
+    if ( (font == NULL) || (decimals > 9) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Number needs a font and at most 9 decimals.");
+        return WIDGET_NONE;
+    }
+
+    int index;
+    widget_t *added = add_widget(tree, parent, bounds, WIDGET_NUMBER, &index);
+
+    if (added != NULL)
+    {
+        added->font = font;
+        added->color = color;
+        added->background_color = background_color;
+        added->align = align;
+        added->value = value;
+        added->decimals = decimals;
+        format_number(added);
+    }
+
+    return index;
+}
+
+
+int add_bar(widget_tree_t *tree, int parent, draw_t bounds, uint16_t color, uint16_t background_color, int32_t min, int32_t max,
+    int32_t value)
+{
+    int index;
+    widget_t *added = add_widget(tree, parent, bounds, WIDGET_BAR, &index);
+
+    if (added != NULL)
+    {
+        added->color = color;
+        added->background_color = background_color;
+        added->min = min;
+        added->max = max;
+        added->value = value;
+    }
+
+    return index;
+}
+
+
+int add_gauge(widget_tree_t *tree, int parent, draw_t bounds, uint16_t color, uint16_t background_color, int32_t min, int32_t max,
+    int32_t value)
+{
+    int index;
+    widget_t *added = add_widget(tree, parent, bounds, WIDGET_GAUGE, &index);
+
+    if (added != NULL)
+    {
+        added->color = color;
+        added->background_color = background_color;
+        added->min = min;
+        added->max = max;
+        added->value = value;
+    }
+
+    return index;
+}
+
+
+int add_image(widget_tree_t *tree, int parent, draw_t bounds, const uint16_t *image_buffer)
+{
+    if (image_buffer == NULL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Image widget buffer is a NULL pointer.");
+        return WIDGET_NONE;
+    }
+
+    int index;
+    widget_t *added = add_widget(tree, parent, bounds, WIDGET_IMAGE, &index);
+
+    if (added != NULL)
+    {
+        added->image_buffer = image_buffer;
+    }
+
+    return index;
+}
+
+
+int set_widget_text(widget_tree_t *tree, int widget, const char *text)
+{
+    widget_t *target = get_widget(tree, widget);
+    if ( (target == NULL) || (text == NULL) )
+    {
+        return DRAW_FAILURE;
+    }
+
+    if (target->type != WIDGET_LABEL)
+    {
+        ESP_LOGE(TAG_DISPLAY, "Widget %d has no text to set.", widget);
+        return DRAW_FAILURE;
+    }
+
+    if (strncmp(target->text, text, WIDGET_TEXT_SIZE) != 0)
+    {
+        store_widget_text(target, text);
+        target->dirty |= WIDGET_DIRTY_CONTENT;
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+int set_widget_value(widget_tree_t *tree, int widget, int32_t value)
+{
+    widget_t *target = get_widget(tree, widget);
+    if (target == NULL)
+    {
+        return DRAW_FAILURE;
+    }
+
+    if ( (target->type != WIDGET_NUMBER) && (target->type != WIDGET_BAR) && (target->type != WIDGET_GAUGE) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Widget %d has no value to set.", widget);
+        return DRAW_FAILURE;
+    }
+
+    if (target->value == value)
+    {
+        return DRAW_SUCCESS;
+    }
+
+    target->value = value;
+
+    if (target->type == WIDGET_NUMBER)
+    {
+        format_number(target);
+    }
+
+    target->dirty |= target->type == WIDGET_BAR ? WIDGET_DIRTY_FILL : WIDGET_DIRTY_CONTENT;
+
+    return DRAW_SUCCESS;
+}
+
+
+int set_widget_colors(widget_tree_t *tree, int widget, uint16_t color, uint16_t background_color)
+{
+    widget_t *target = get_widget(tree, widget);
+    if (target == NULL)
+    {
+        return DRAW_FAILURE;
+    }
+
+    if ( (target->color != color) || (target->background_color != background_color) )
+    {
+        target->color = color;
+        target->background_color = background_color;
+        target->dirty |= WIDGET_DIRTY_CONTENT;
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+int set_widget_visible(widget_tree_t *tree, int widget, uint8_t visible)
+{
+    widget_t *target = get_widget(tree, widget);
+    if (target == NULL)
+    {
+        return DRAW_FAILURE;
+    }
+
+    visible = visible ? 1 : 0;
+    if (target->visible != visible)
+    {
+        target->visible = visible;
+        target->dirty |= WIDGET_DIRTY_CONTENT;
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+int move_widget(widget_tree_t *tree, int widget, int x, int y)
+{
+    widget_t *target = get_widget(tree, widget);
+    if (target == NULL)
+    {
+        return DRAW_FAILURE;
+    }
+
+    if ( (target->x != x) || (target->y != y) )
+    {
+        target->x = x;
+        target->y = y;
+        target->dirty |= WIDGET_DIRTY_CONTENT;
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+// Screen area a widget shows, clipped to its ancestors and the screen. Returns 0 if nothing of it is shown.
+// origin_x and origin_y get the screen position of the widget's top left corner.
+static int get_shown_bounds(const widget_tree_t *tree, int widget, draw_t *bounds, int *origin_x, int *origin_y)
+{
+    int clip_x_start = 0;
+    int clip_y_start = 0;
+    int clip_x_end = SCREEN_WIDTH;
+    int clip_y_end = SCREEN_HEIGHT;
+    int parent_x = 0;
+    int parent_y = 0;
+
+    const widget_t *target = &tree->widgets[widget];
+
+    if (target->parent != WIDGET_NONE)
+    {
+        draw_t parent_bounds;
+        if (!get_shown_bounds(tree, target->parent, &parent_bounds, &parent_x, &parent_y))
+        {
+            return 0;
+        }
+
+        clip_x_start = parent_bounds.draw_start_x;
+        clip_y_start = parent_bounds.draw_start_y;
+        clip_x_end = clip_x_start + parent_bounds.image_size_x;
+        clip_y_end = clip_y_start + parent_bounds.image_size_y;
+    }
+
+    *origin_x = parent_x + target->x;
+    *origin_y = parent_y + target->y;
+
+    if (!target->visible)
+    {
+        return 0;
+    }
+
+    int x_start = *origin_x > clip_x_start ? *origin_x : clip_x_start;
+    int y_start = *origin_y > clip_y_start ? *origin_y : clip_y_start;
+    int x_end = *origin_x + target->width < clip_x_end ? *origin_x + target->width : clip_x_end;
+    int y_end = *origin_y + target->height < clip_y_end ? *origin_y + target->height : clip_y_end;
+
+    if ( (x_start >= x_end) || (y_start >= y_end) )
+    {
+        return 0;
+    }
+
+    bounds->draw_start_x = x_start;
+    bounds->draw_start_y = y_start;
+    bounds->image_size_x = x_end - x_start;
+    bounds->image_size_y = y_end - y_start;
+    bounds->scale_x = 1;
+    bounds->scale_y = 1;
+
+    return 1;
+}
+
+
+static int is_vertical_bar(const widget_t *target)
+{
+    return target->height > target->width;
+}
+
+
+// Filled pixels of a bar, along its length.
+static int get_bar_fill(const widget_t *target)
+{
+    int length = is_vertical_bar(target) ? target->height : target->width;
+
+    if (target->max <= target->min)
+    {
+        return 0;
+    }
+
+    int64_t value = target->value < target->min ? target->min : (target->value > target->max ? target->max : target->value);
+
+    return (int)((value - target->min) * length / ((int64_t)target->max - target->min));
+}
+
+
+// Renders the gauge pixels from x_start to x_end of screen line y.
+static void render_gauge_span(const widget_t *target, int origin_x, int origin_y, int y, int x_start, int x_end, uint16_t *span)
+{
+    uint16_t foreground = COLOR_SWAP(target->color);
+    uint16_t background = COLOR_SWAP(target->background_color);
+    uint16_t track = blend_bgr565(foreground, background, 8);
+
+    float outer_radius = (target->width < target->height ? target->width : target->height) / 2.0f;
+    float inner_radius = outer_radius - (outer_radius / 4.0f > 2.0f ? outer_radius / 4.0f : 2.0f);
+    float fraction = 0.0f;
+
+    if (target->max > target->min)
+    {
+        fraction = (float)((int64_t)target->value - target->min) / (float)((int64_t)target->max - target->min);
+        fraction = fraction < 0.0f ? 0.0f : (fraction > 1.0f ? 1.0f : fraction);
+    }
+
+    float dy = (y - origin_y) + 0.5f - target->height / 2.0f;
+
+    for (int x = x_start; x < x_end; ++x)
+    {
+        float dx = (x - origin_x) + 0.5f - target->width / 2.0f;
+        float distance = dx * dx + dy * dy;
+        uint16_t color = background;
+
+        if ( (distance <= outer_radius * outer_radius) && (distance >= inner_radius * inner_radius) )
+        {
+            float angle = atan2f(dy, dx) * (180.0f / (float)M_PI) - GAUGE_START_ANGLE;
+            angle = angle < 0.0f ? angle + 360.0f : angle;
+            angle = angle < 0.0f ? angle + 360.0f : angle;
+
+            if (angle <= GAUGE_SWEEP_ANGLE)
+            {
+                color = (angle <= fraction * GAUGE_SWEEP_ANGLE) && (fraction > 0.0f) ? foreground : track;
+            }
+        }
+
+        span[x - x_start] = color;
+    }
+}
+
+
+// Renders the widget's own pixels from x_start to x_end of screen line y, under its children.
+static void render_widget_span(const widget_t *target, int origin_x, int origin_y, int y, int x_start, int x_end, uint16_t *span)
+{
+    int width = x_end - x_start;
+    uint16_t background = COLOR_SWAP(target->background_color);
+
+    switch (target->type)
+    {
+        case WIDGET_LABEL:
+        case WIDGET_NUMBER:
+        {
+            for (int i = 0; i < width; ++i)
+            {
+                span[i] = background;
+            }
+
+            int text_x = 0;
+            if (target->align == WIDGET_ALIGN_CENTER)
+            {
+                text_x = (target->width - target->text_width) / 2;
+            }
+            else if (target->align == WIDGET_ALIGN_RIGHT)
+            {
+                text_x = target->width - target->text_width;
+            }
+
+            int text_line = y - origin_y - (target->height - target->font->line_height) / 2;
+            render_aa_text_span(target->font, target->color, target->background_color, target->text, target->text_length,
+                text_line, x_start - origin_x - text_x, width, span);
+            break;
+        }
+        case WIDGET_BAR:
+        {
+            uint16_t foreground = COLOR_SWAP(target->color);
+            int fill = get_bar_fill(target);
+
+            if (is_vertical_bar(target))
+            {
+                uint16_t color = y - origin_y >= target->height - fill ? foreground : background;
+                for (int i = 0; i < width; ++i)
+                {
+                    span[i] = color;
+                }
+            }
+            else
+            {
+                for (int i = 0; i < width; ++i)
+                {
+                    span[i] = x_start + i - origin_x < fill ? foreground : background;
+                }
+            }
+            break;
+        }
+        case WIDGET_GAUGE:
+            render_gauge_span(target, origin_x, origin_y, y, x_start, x_end, span);
+            break;
+        case WIDGET_IMAGE:
+            memcpy(span, target->image_buffer + (y - origin_y) * target->width + (x_start - origin_x), width * sizeof(uint16_t));
+            break;
+        default:
+            for (int i = 0; i < width; ++i)
+            {
+                span[i] = background;
+            }
+            break;
+    }
+}
+
+
+// Renders a widget and its children into the part of screen line y from clip_x_start to clip_x_end.
+// span holds the line starting at screen x span_x.
+static void render_tree_span(const widget_tree_t *tree, int widget, int parent_x, int parent_y, int clip_x_start, int clip_x_end,
+    int y, int span_x, uint16_t *span)
+{
+    const widget_t *target = &tree->widgets[widget];
+
+    int origin_x = parent_x + target->x;
+    int origin_y = parent_y + target->y;
+
+    if ( !target->visible || (y < origin_y) || (y >= origin_y + target->height) )
+    {
+        return;
+    }
+
+    int x_start = origin_x > clip_x_start ? origin_x : clip_x_start;
+    int x_end = origin_x + target->width < clip_x_end ? origin_x + target->width : clip_x_end;
+
+    if (x_start >= x_end)
+    {
+        return;
+    }
+
+    render_widget_span(target, origin_x, origin_y, y, x_start, x_end, span + (x_start - span_x));
+
+    for (int child = target->first_child; child != WIDGET_NONE; child = tree->widgets[child].next_sibling)
+    {
+        render_tree_span(tree, child, origin_x, origin_y, x_start, x_end, y, span_x, span);
+    }
+}
+
+
+// Damages what a dirty widget changed on screen.
+static void damage_dirty_widget(widget_tree_t *tree, int widget)
+{
+    widget_t *target = &tree->widgets[widget];
+    draw_t shown;
+    int origin_x;
+    int origin_y;
+    int is_shown = get_shown_bounds(tree, widget, &shown, &origin_x, &origin_y);
+    const draw_t *drawn = &target->drawn_bounds;
+    int was_shown = drawn->image_size_x != 0;
+
+    // Only the fill moved, redraw between the old and new edge.
+    if ( (target->dirty == WIDGET_DIRTY_FILL) && is_shown && was_shown &&
+        (shown.draw_start_x == drawn->draw_start_x) && (shown.draw_start_y == drawn->draw_start_y) &&
+        (shown.image_size_x == drawn->image_size_x) && (shown.image_size_y == drawn->image_size_y) )
+    {
+        int fill = get_bar_fill(target);
+        int low = fill < target->drawn_fill ? fill : target->drawn_fill;
+        int high = fill > target->drawn_fill ? fill : target->drawn_fill;
+        int x = shown.draw_start_x;
+        int y = shown.draw_start_y;
+        int width = shown.image_size_x;
+        int height = shown.image_size_y;
+
+        if (is_vertical_bar(target))
+        {
+            int y_start = origin_y + target->height - high;
+            int y_end = origin_y + target->height - low;
+            y = y_start > y ? y_start : y;
+            height = (y_end < shown.draw_start_y + shown.image_size_y ? y_end : shown.draw_start_y + shown.image_size_y) - y;
+        }
+        else
+        {
+            int x_start = origin_x + low;
+            int x_end = origin_x + high;
+            x = x_start > x ? x_start : x;
+            width = (x_end < shown.draw_start_x + shown.image_size_x ? x_end : shown.draw_start_x + shown.image_size_x) - x;
+        }
+
+        if ( (width > 0) && (height > 0) )
+        {
+            add_damage_rect(&tree->damage, x, y, width, height);
+        }
+        return;
+    }
+
+    if (was_shown)
+    {
+        add_damage_rect(&tree->damage, drawn->draw_start_x, drawn->draw_start_y, drawn->image_size_x, drawn->image_size_y);
+    }
+
+    if (is_shown)
+    {
+        add_damage_rect(&tree->damage, shown.draw_start_x, shown.draw_start_y, shown.image_size_x, shown.image_size_y);
+    }
+}
+
+
+int render_widgets(esp_lcd_panel_handle_t panel_handle, widget_tree_t *tree)
+{
+    // Sanity check.
+    if ( (tree == NULL) || (tree->widgets == NULL) )
+    {
+        ESP_LOGE(TAG_DISPLAY, "Cannot render widgets, the tree is not set up.");
+        return DRAW_FAILURE;
+    }
+
+    for (int i = 0; i < tree->widget_amount; ++i)
+    {
+        if (tree->widgets[i].dirty)
+        {
+            damage_dirty_widget(tree, i);
+            tree->widgets[i].dirty = 0;
+        }
+    }
+
+    int result = DRAW_SUCCESS;
+
+    if (tree->damage.region_amount > 0)
+    {
+        // Every free pool block is used, so bands are only waited for when the blocks run out.
+        uint16_t *band_buffers[POOL_BLOCK_AMOUNT];
+        int band_buffer_amount = 0;
+
+        while (band_buffer_amount < POOL_BLOCK_AMOUNT)
+        {
+            band_buffers[band_buffer_amount] = pool_borrow();
+            if (band_buffers[band_buffer_amount] == NULL)
+            {
+                break;
+            }
+            band_buffer_amount += 1;
+        }
+
+        if (band_buffer_amount == 0)
+        {
+            ESP_LOGE(TAG_DISPLAY, "No pool block available for rendering widgets.");
+            return DRAW_FAILURE;
+        }
+
+        int next_buffer = 0;
+
+        for (int i = 0; i < tree->damage.region_amount; ++i)
+        {
+            draw_t region = tree->damage.regions[i];
+            int band_lines = POOL_BLOCK_PIXELS / region.image_size_x;
+            draw_t band = region;
+
+            for (int line = 0; line < region.image_size_y; line += band_lines)
+            {
+                band.draw_start_y = region.draw_start_y + line;
+                band.image_size_y = region.image_size_y - line < band_lines ? region.image_size_y - line : band_lines;
+
+                if (next_buffer == band_buffer_amount)
+                {
+                    wait_for_draws();
+                    next_buffer = 0;
+                }
+
+                uint16_t *band_buffer = band_buffers[next_buffer];
+                next_buffer += 1;
+
+                for (int band_line = 0; band_line < band.image_size_y; ++band_line)
+                {
+                    render_tree_span(tree, WIDGET_ROOT, 0, 0, region.draw_start_x, region.draw_start_x + region.image_size_x,
+                        band.draw_start_y + band_line, region.draw_start_x, band_buffer + band_line * region.image_size_x);
+                }
+
+                result |= queue_bgr_image(panel_handle, band, band_buffer);
+            }
+
+            tree->pixel_bytes_sent += region.image_size_x * region.image_size_y * sizeof(uint16_t);
+        }
+
+        wait_for_draws();
+
+        for (int i = 0; i < band_buffer_amount; ++i)
+        {
+            pool_return(band_buffers[i]);
+        }
+
+        tree->regions_drawn += tree->damage.region_amount;
+        tree->damage.region_amount = 0;
+    }
+
+    // Remember what the screen shows now, moving a container also moved its children.
+    for (int i = 0; i < tree->widget_amount; ++i)
+    {
+        widget_t *target = &tree->widgets[i];
+        int origin_x;
+        int origin_y;
+
+        if (!get_shown_bounds(tree, i, &target->drawn_bounds, &origin_x, &origin_y))
+        {
+            memset(&target->drawn_bounds, 0, sizeof(draw_t));
+        }
+        target->drawn_fill = get_bar_fill(target);
+    }
+
+    tree->renders += 1;
+
+    return result;
+}
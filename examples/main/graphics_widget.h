@@ -0,0 +1,112 @@
+#ifndef GRAPHICS_WIDGET_H
+#define GRAPHICS_WIDGET_H
+
+#include "graphics_font.h"
+#include "graphics_layer.h"
+
+
+// Bytes of text a label or number widget holds, including the formatted number.
+#define WIDGET_TEXT_SIZE 24
+
+// Returned instead of a widget index when a widget cannot be added, and used for missing links.
+#define WIDGET_NONE -1
+
+// The root widget, a screen sized container created by widget_tree_init().
+#define WIDGET_ROOT 0
+
+
+// Widget types.
+typedef enum {
+    WIDGET_CONTAINER,           // Background color, its children are clipped to it.
+    WIDGET_LABEL,               // Single line of text.
+    WIDGET_NUMBER,              // Integer value, shown with a fixed amount of decimals.
+    WIDGET_BAR,                 // Horizontal bar filled from the left, or vertical filled from the bottom.
+    WIDGET_GAUGE,               // 270 degree ring filled clockwise from the bottom left.
+    WIDGET_IMAGE,               // BGR565 image the size of the widget.
+} widget_type_t;
+
+// Text alignment in label and number widgets, the text is centered vertically.
+typedef enum {
+    WIDGET_ALIGN_LEFT,
+    WIDGET_ALIGN_CENTER,
+    WIDGET_ALIGN_RIGHT,
+} widget_align_t;
+
+// Retained widget, the same fixed size for every type. Positions are relative to the parent.
+typedef struct {
+    uint8_t type;
+    uint8_t visible;
+    uint8_t dirty;              // Changed since the last render_widgets().
+    uint8_t align;
+    int16_t parent;
+    int16_t first_child;
+    int16_t next_sibling;
+    int16_t x;
+    int16_t y;
+    uint16_t width;
+    uint16_t height;
+
+    // RGB565 colors, like fill_rect().
+    uint16_t color;             // Text, bar fill and gauge arc.
+    uint16_t background_color;
+
+    int32_t value;              // Number, bar and gauge.
+    int32_t min;                // Bar and gauge.
+    int32_t max;
+    uint8_t decimals;           // Number only.
+
+    const aa_font_t *font;      // Label and number.
+    char text[WIDGET_TEXT_SIZE];
+    uint8_t text_length;
+    uint16_t text_width;        // In pixels, kept so lines can be aligned without measuring the text again.
+
+    const uint16_t *image_buffer;       // Image only.
+
+    // What the screen shows, so render_widgets() can redraw only what changed.
+    draw_t drawn_bounds;        // Screen area after clipping, empty if not shown.
+    uint16_t drawn_fill;        // Filled pixels of a bar.
+} widget_t;
+
+// Widget tree in caller provided storage, nothing is allocated.
+typedef struct {
+    widget_t *widgets;
+    uint16_t capacity;
+    uint16_t widget_amount;
+    damage_list_t damage;
+
+    uint32_t renders;
+    uint32_t regions_drawn;
+    uint64_t pixel_bytes_sent;
+} widget_tree_t;
+
+
+// Sets up a tree in storage, which holds capacity widgets, with a screen sized root container of background_color.
+// The first render_widgets() draws the whole screen.
+int widget_tree_init(widget_tree_t *tree, widget_t *storage, uint16_t capacity, uint16_t background_color);
+
+// Add widgets on top of the other children of parent, bounds are relative to the parent and only start and size are
+// used. Return the widget index, or WIDGET_NONE if the tree is full. Fonts and images are not copied.
+int add_container(widget_tree_t *tree, int parent, draw_t bounds, uint16_t background_color);
+int add_label(widget_tree_t *tree, int parent, draw_t bounds, const aa_font_t *font, uint16_t color, uint16_t background_color,
+    widget_align_t align, const char *text);
+int add_number(widget_tree_t *tree, int parent, draw_t bounds, const aa_font_t *font, uint16_t color, uint16_t background_color,
+    widget_align_t align, int32_t value, uint8_t decimals);
+int add_bar(widget_tree_t *tree, int parent, draw_t bounds, uint16_t color, uint16_t background_color, int32_t min, int32_t max,
+    int32_t value);
+int add_gauge(widget_tree_t *tree, int parent, draw_t bounds, uint16_t color, uint16_t background_color, int32_t min, int32_t max,
+    int32_t value);
+int add_image(widget_tree_t *tree, int parent, draw_t bounds, const uint16_t *image_buffer);
+
+// Property setters, they only mark the widget dirty. Setting the value it already has does nothing.
+int set_widget_text(widget_tree_t *tree, int widget, const char *text);
+int set_widget_value(widget_tree_t *tree, int widget, int32_t value);
+int set_widget_colors(widget_tree_t *tree, int widget, uint16_t color, uint16_t background_color);
+int set_widget_visible(widget_tree_t *tree, int widget, uint8_t visible);
+int move_widget(widget_tree_t *tree, int widget, int x, int y);
+
+// Redraws what the dirty widgets changed, clipped to their parents and the screen: the area they left and the area
+// they cover now, or for a bar only the part between the old and new fill. All regions are queued as bands and
+// waited for once at the end.
+int render_widgets(esp_lcd_panel_handle_t panel_handle, widget_tree_t *tree);
+
+#endif
@@ -0,0 +1,2033 @@
+// Host checks of the library against the stand-in panel, see graphics_host.h. Every check draws through the public
+// API and compares the stand-in panel memory or the statistics with what is expected. Run them with
+//
+//   sh tools/host/run_checks.sh
+//
+// which builds this file with the host shims and also runs the checks that need other build options. Built with
+// GRAPHICS_RECORDER, "check_graphics --record file" writes a recording of the benchmark scene for replay_draws.
+
+#include "graphics.h"
+#include "graphics_blit.h"
+#include "graphics_chart.h"
+#include "graphics_diff.h"
+#include "graphics_font.h"
+#include "graphics_frame.h"
+#include "graphics_jpeg.h"
+#include "graphics_layer.h"
+#include "graphics_snapshot.h"
+#include "graphics_stream.h"
+#include "graphics_sprite.h"
+#include "graphics_tilemap.h"
+#include "graphics_widget.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Allocations of the checks themselves are not counted.
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+
+
+static int failures = 0;
+
+#define CHECK(condition, ...) \
+    do { \
+        if (!(condition)) \
+        { \
+            failures += 1; \
+            printf("FAIL %s:%d: ", __func__, __LINE__); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+        } \
+    } while (0)
+
+
+// Sets the display up again on the default panel, which also clears the stand-in panel memory.
+static esp_lcd_panel_handle_t setup_panel(int bits_per_pixel)
+{
+    esp_lcd_panel_handle_t panel_handle;
+    display_config_t config;
+
+    get_default_display_config(&config);
+    config.bits_per_pixel = bits_per_pixel;
+
+    if (setup_display_with_config(&panel_handle, &config) != DRAW_SUCCESS)
+    {
+        printf("FAIL setup_panel: %d bit display could not be set up.\n", bits_per_pixel);
+        exit(1);
+    }
+
+    return panel_handle;
+}
+
+
+// RGB565 color of a screen pixel in the stand-in panel memory.
+static uint16_t screen_pixel(int x, int y)
+{
+    const uint16_t *memory = get_stand_in_memory();
+
+    return COLOR_SWAP(memory[(y + SCREEN_HEIGHT_PIXEL_MISALIGNMENT) * STAND_IN_MEMORY_WIDTH + x + SCREEN_WIDTH_PIXEL_MISALIGNMENT]);
+}
+
+
+// An RGB565 color as it comes back from a 12 bit panel: reduced to 4 bits per channel, then widened again by
+// repeating the top bits.
+static uint16_t through_rgb444(uint16_t RGB_color)
+{
+    uint32_t red = (RGB_color >> 11) >> 1;
+    uint32_t green = ((RGB_color >> 5) & 0x3F) >> 2;
+    uint32_t blue = (RGB_color & 0x1F) >> 1;
+
+    return (((red << 1) | (red >> 3)) << 11) | (((green << 2) | (green >> 2)) << 5) | ((blue << 1) | (blue >> 3));
+}
+
+
+// Pseudo random numbers for the checks, the same on every run.
+static uint32_t random_state = 1;
+
+static int random_below(int limit)
+{
+    random_state = random_state * 1664525 + 1013904223;
+    return (random_state >> 8) % limit;
+}
+
+
+// 12 bit mode: fills, images sent in several packed chunks continued with RAMWRC, and odd pixel amounts whose last
+// pixel only fills half of its three bytes.
+static void check_rgb444(void)
+{
+    esp_lcd_panel_handle_t panel_handle = setup_panel(12);
+
+    // 7 x 3 is an odd amount of pixels.
+    const uint16_t fill_color = 0xA5C3;
+    draw_t fill = { .scale_x = 1, .scale_y = 1, .draw_start_x = 3, .draw_start_y = 5, .image_size_x = 7, .image_size_y = 3 };
+    CHECK(fill_rect(panel_handle, fill, fill_color) == DRAW_SUCCESS, "fill_rect failed.");
+
+    for (int y = 4; y < 9; ++y)
+    {
+        for (int x = 2; x < 11; ++x)
+        {
+            int inside = (x >= 3) && (x < 10) && (y >= 5) && (y < 8);
+            uint16_t expected = inside ? through_rgb444(fill_color) : 0;
+
+            CHECK(screen_pixel(x, y) == expected, "Fill pixel %d, %d is 0x%04x, not 0x%04x.", x, y, screen_pixel(x, y), expected);
+        }
+    }
+
+    // An odd amount of pixels over more than two packing buffers, so the window is continued twice.
+    enum { IMAGE_WIDTH = 135, IMAGE_HEIGHT = 41 };
+    static uint16_t image[IMAGE_WIDTH * IMAGE_HEIGHT];
+    _Static_assert((IMAGE_WIDTH * IMAGE_HEIGHT) % 2 == 1, "The image must have an odd amount of pixels.");
+    _Static_assert(IMAGE_WIDTH * IMAGE_HEIGHT > 2 * LCD_PACK_BUFFER_PIXELS, "The image must take three packed chunks.");
+
+    for (int i = 0; i < IMAGE_WIDTH * IMAGE_HEIGHT; ++i)
+    {
+        image[i] = COLOR_SWAP((uint16_t)(i * 2654435761UL >> 16));
+    }
+
+    transfer_stats_t before;
+    transfer_stats_t after;
+    get_transfer_stats(&before);
+
+    draw_t window = { .scale_x = 1, .scale_y = 1, .draw_start_x = 0, .draw_start_y = 100, .image_size_x = IMAGE_WIDTH, .image_size_y = IMAGE_HEIGHT };
+    CHECK(draw_bgr_image(panel_handle, window, image) == DRAW_SUCCESS, "draw_bgr_image failed.");
+
+    get_transfer_stats(&after);
+    CHECK(after.pixel_bytes - before.pixel_bytes == (IMAGE_WIDTH * IMAGE_HEIGHT * 3 + 1) / 2, "%llu pixel bytes sent.",
+        (unsigned long long)(after.pixel_bytes - before.pixel_bytes));
+
+    int wrong_pixels = 0;
+    for (int i = 0; i < IMAGE_WIDTH * IMAGE_HEIGHT; ++i)
+    {
+        wrong_pixels += screen_pixel(i % IMAGE_WIDTH, 100 + i / IMAGE_WIDTH) != through_rgb444(COLOR_SWAP(image[i]));
+    }
+    CHECK(wrong_pixels == 0, "%d of %d image pixels are wrong.", wrong_pixels, IMAGE_WIDTH * IMAGE_HEIGHT);
+    CHECK(screen_pixel(IMAGE_WIDTH - 1, 100 + IMAGE_HEIGHT - 1) == through_rgb444(COLOR_SWAP(image[IMAGE_WIDTH * IMAGE_HEIGHT - 1])),
+        "The odd last pixel is wrong.");
+
+    // A single pixel is only the odd tail.
+    uint16_t single = COLOR_SWAP(0x7BEF);
+    draw_t dot = { .scale_x = 1, .scale_y = 1, .draw_start_x = 20, .draw_start_y = 20, .image_size_x = 1, .image_size_y = 1 };
+    CHECK(queue_bgr_image(panel_handle, dot, &single) == DRAW_SUCCESS, "queue_bgr_image failed.");
+    wait_for_draws();
+    CHECK(screen_pixel(20, 20) == through_rgb444(0x7BEF), "Single pixel is 0x%04x.", screen_pixel(20, 20));
+    CHECK(screen_pixel(21, 20) == 0, "The pixel after the single pixel was written.");
+}
+
+
+// RGB565 packing of an RGB888 color, as fill_rect() and the LCD_ colors take it.
+static uint16_t rgb565_from_rgb888(uint32_t red, uint32_t green, uint32_t blue)
+{
+    return ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
+}
+
+// BGR565_FROM_RGB888() is the byte swapped RGB565 packing for every RGB888 color. draw_image() sends every pixel
+// format as that BGR565, in 16 and 12 bit mode, with an image taller than a pool block so it is converted in bands.
+static void check_pixel_formats(void)
+{
+    int wrong_colors = 0;
+
+    for (uint32_t color = 0; color < 1 << 24; ++color)
+    {
+        uint32_t red = color >> 16;
+        uint32_t green = (color >> 8) & 0xFF;
+        uint32_t blue = color & 0xFF;
+
+        wrong_colors += BGR565_FROM_RGB888(red, green, blue) != COLOR_SWAP(rgb565_from_rgb888(red, green, blue));
+    }
+    CHECK(wrong_colors == 0, "BGR565_FROM_RGB888() differs from the swapped RGB565 packing for %d colors.", wrong_colors);
+
+    enum { IMAGE_WIDTH = 131, IMAGE_HEIGHT = 47 };
+    static uint8_t rgb888[IMAGE_WIDTH * IMAGE_HEIGHT * 3];
+    static uint16_t rgb565[IMAGE_WIDTH * IMAGE_HEIGHT];
+    static uint16_t bgr565[IMAGE_WIDTH * IMAGE_HEIGHT];
+    _Static_assert(IMAGE_WIDTH * IMAGE_HEIGHT > POOL_BLOCK_PIXELS, "The image must take several bands.");
+
+    random_state = 3;
+    for (int i = 0; i < IMAGE_WIDTH * IMAGE_HEIGHT; ++i)
+    {
+        rgb888[i * 3] = random_below(256);
+        rgb888[i * 3 + 1] = random_below(256);
+        rgb888[i * 3 + 2] = random_below(256);
+        rgb565[i] = rgb565_from_rgb888(rgb888[i * 3], rgb888[i * 3 + 1], rgb888[i * 3 + 2]);
+        bgr565[i] = COLOR_SWAP(rgb565[i]);
+    }
+
+    const image_t images[] = {
+        { .format = PIXEL_FORMAT_BGR565, .width = IMAGE_WIDTH, .height = IMAGE_HEIGHT, .pixels = bgr565 },
+        { .format = PIXEL_FORMAT_RGB565, .width = IMAGE_WIDTH, .height = IMAGE_HEIGHT, .pixels = rgb565 },
+        { .format = PIXEL_FORMAT_RGB888, .width = IMAGE_WIDTH, .height = IMAGE_HEIGHT, .pixels = rgb888 },
+    };
+
+    for (int bits = 16; bits >= 12; bits -= 4)
+    {
+        for (int format = 0; format < 3; ++format)
+        {
+            esp_lcd_panel_handle_t panel_handle = setup_panel(bits);
+            CHECK(draw_image(panel_handle, 2, 30, &images[format]) == DRAW_SUCCESS, "The %d bit image of format %d was not drawn.", bits, format);
+
+            int wrong_pixels = 0;
+            for (int i = 0; i < IMAGE_WIDTH * IMAGE_HEIGHT; ++i)
+            {
+                uint16_t expected = bits == 16 ? rgb565[i] : through_rgb444(rgb565[i]);
+                wrong_pixels += screen_pixel(2 + i % IMAGE_WIDTH, 30 + i / IMAGE_WIDTH) != expected;
+            }
+            CHECK(wrong_pixels == 0, "%d pixels of the %d bit image of format %d are wrong.", wrong_pixels, bits, format);
+        }
+    }
+}
+
+
+// A color keyed sprite without a background: every opaque run is its own window, packed into the pool blocks. The
+// runs take more than all blocks together, so the blocks are reused after waiting. Keyed pixels stay untouched.
+static void check_blit_opaque_runs(void)
+{
+    esp_lcd_panel_handle_t panel_handle = setup_panel(16);
+
+    // Runs of 7 opaque pixels, then one keyed pixel.
+    enum { SPRITE_SIZE = 120, RUNS = SPRITE_SIZE / 8 * SPRITE_SIZE };
+    static uint16_t pixels[SPRITE_SIZE * SPRITE_SIZE];
+    const uint16_t key_color = COLOR_SWAP(LCD_BLACK);
+    _Static_assert(RUNS * 7 > POOL_BLOCK_AMOUNT * POOL_BLOCK_PIXELS, "The runs must take more than all pool blocks.");
+
+    for (int i = 0; i < SPRITE_SIZE * SPRITE_SIZE; ++i)
+    {
+        pixels[i] = (i % 8 == 7) ? key_color : COLOR_SWAP((uint16_t)(i * 2654435761UL >> 16) | 1);
+    }
+
+    sprite_t sprite = { .format = SPRITE_FORMAT_COLOR_KEY, .width = SPRITE_SIZE, .height = SPRITE_SIZE, .pixels = pixels, .key_color = key_color };
+
+    // Keyed pixels must keep what was there.
+    fill_display(panel_handle, LCD_BLUE);
+
+    transfer_stats_t before;
+    transfer_stats_t after;
+    pool_stats_t pool;
+    get_transfer_stats(&before);
+
+    CHECK(blit_sprite(panel_handle, &sprite, 5, 50, NULL) == DRAW_SUCCESS, "blit_sprite failed.");
+
+    get_transfer_stats(&after);
+    CHECK(after.transfers - before.transfers == RUNS, "%lu windows sent for %d runs.", (unsigned long)(after.transfers - before.transfers), RUNS);
+
+    get_pool_stats(&pool);
+    CHECK(pool.in_use == 0, "%u pool blocks not returned.", pool.in_use);
+
+    int wrong_pixels = 0;
+    for (int i = 0; i < SPRITE_SIZE * SPRITE_SIZE; ++i)
+    {
+        uint16_t expected = pixels[i] == key_color ? LCD_BLUE : COLOR_SWAP(pixels[i]);
+        wrong_pixels += screen_pixel(5 + i % SPRITE_SIZE, 50 + i / SPRITE_SIZE) != expected;
+    }
+    CHECK(wrong_pixels == 0, "%d of %d sprite pixels are wrong.", wrong_pixels, SPRITE_SIZE * SPRITE_SIZE);
+}
+
+
+// Anti-aliased text from a built in font: one window of the text width and the line height, with ink in it.
+static void check_aa_text(void)
+{
+    esp_lcd_panel_handle_t panel_handle = setup_panel(16);
+    const char *text = "Host 123";
+    int width = get_aa_text_width(&font_sans_16, text, strlen(text));
+
+    CHECK(width > 0, "The text is %d pixels wide.", width);
+    CHECK(draw_aa_text(panel_handle, &font_sans_16, 4, 30, LCD_WHITE, LCD_BLUE, text, strlen(text)) == DRAW_SUCCESS,
+        "draw_aa_text failed.");
+
+    int ink_pixels = 0;
+    int outside_pixels = 0;
+    for (int y = 20; y < 30 + font_sans_16.line_height + 10; ++y)
+    {
+        for (int x = 0; x < 4 + width + 10; ++x)
+        {
+            int inside = (x >= 4) && (x < 4 + width) && (y >= 30) && (y < 30 + font_sans_16.line_height);
+
+            ink_pixels += inside && (screen_pixel(x, y) != LCD_BLUE);
+            outside_pixels += !inside && (screen_pixel(x, y) != 0);
+        }
+    }
+    CHECK(ink_pixels > 0, "No ink drawn.");
+    CHECK(outside_pixels == 0, "%d pixels drawn outside the text.", outside_pixels);
+}
+
+
+// Little endian field of a font blob.
+static void put_blob_field(uint32_t *blob, int offset, uint32_t value, int size)
+{
+    memcpy((uint8_t *)blob + offset, &value, size);
+}
+
+
+// A font blob with one range of one 4 x 2 pixel glyph, laid out like tools/make_font.py does: header, ranges, glyphs,
+// bitmap.
+static void make_font_blob(uint32_t *blob)
+{
+    memset(blob, 0, 56);
+    memcpy(blob, AA_FONT_BLOB_MAGIC, 4);
+    put_blob_field(blob, 4, 2, 1);          // bpp
+    put_blob_field(blob, 5, 8, 1);          // line height
+    put_blob_field(blob, 6, 6, 1);          // baseline
+    put_blob_field(blob, 8, 1, 2);          // ranges
+    put_blob_field(blob, 10, 1, 2);         // glyphs
+    put_blob_field(blob, 12, 32, 4);        // range table offset
+    put_blob_field(blob, 16, 40, 4);        // glyph table offset
+    put_blob_field(blob, 20, 52, 4);        // bitmap offset
+    put_blob_field(blob, 24, 2, 4);         // bitmap size
+    put_blob_field(blob, 32, 'A', 4);       // first code point
+    put_blob_field(blob, 36, 1, 2);         // length
+    put_blob_field(blob, 40, 0, 4);         // glyph bitmap offset
+    put_blob_field(blob, 44, 4, 1);         // width
+    put_blob_field(blob, 45, 2, 1);         // height
+    put_blob_field(blob, 48, 5, 1);         // advance
+    put_blob_field(blob, 52, 0xFFFF, 2);    // bitmap, full coverage
+}
+
+
+typedef struct {
+    const uint32_t *blob;
+    uint32_t size;
+} blob_reader_t;
+
+static int read_blob(void *reader_ctx, uint32_t offset, void *buffer, uint32_t size)
+{
+    blob_reader_t *reader = (blob_reader_t *)reader_ctx;
+
+    if ( (offset > reader->size) || (size > reader->size - offset) )
+    {
+        return 1;
+    }
+
+    memcpy(buffer, (const uint8_t *)reader->blob + offset, size);
+    return 0;
+}
+
+
+// Font blobs with tables or glyphs whose offsets wrap around in 32 bits, or with overlapping tables, are rejected
+// whether loaded from memory or through a reader.
+static void check_font_blob_bounds(void)
+{
+    uint32_t blob[14];
+    aa_font_t font;
+    aa_range_t ranges[2];
+    blob_reader_t reader = { .blob = blob, .size = sizeof(blob) };
+
+    make_font_blob(blob);
+    CHECK(load_aa_font_blob(&font, blob, sizeof(blob)) == DRAW_SUCCESS, "The valid blob was rejected.");
+    CHECK(open_aa_font_reader(&font, ranges, 2, read_blob, &reader) == DRAW_SUCCESS, "The valid blob was rejected by the reader.");
+    CHECK(get_aa_text_width(&font, "AA", 2) == 10, "The reader font is %d pixels wide.", get_aa_text_width(&font, "AA", 2));
+
+    esp_lcd_panel_handle_t panel_handle = setup_panel(16);
+    draw_aa_text(panel_handle, &font, 0, 0, LCD_WHITE, LCD_BLUE, "A", 1);
+    CHECK(screen_pixel(3, 1) == LCD_WHITE, "The reader font glyph was not drawn.");
+
+    // Every blob from here on is meant to be rejected, without filling the output with errors.
+    esp_log_level_set("*", ESP_LOG_NONE);
+
+    // The glyph table end wraps around to inside the blob.
+    make_font_blob(blob);
+    put_blob_field(blob, 16, 0xFFFFFFF4, 4);
+    CHECK(load_aa_font_blob(&font, blob, sizeof(blob)) == DRAW_FAILURE, "A wrapping glyph table was accepted.");
+    CHECK(open_aa_font_reader(&font, ranges, 2, read_blob, &reader) == DRAW_FAILURE, "A wrapping glyph table was accepted by the reader.");
+
+    // The bitmap end wraps around.
+    make_font_blob(blob);
+    put_blob_field(blob, 20, 0xFFFFFFF0, 4);
+    put_blob_field(blob, 24, 0x20, 4);
+    CHECK(load_aa_font_blob(&font, blob, sizeof(blob)) == DRAW_FAILURE, "A wrapping bitmap was accepted.");
+    CHECK(open_aa_font_reader(&font, ranges, 2, read_blob, &reader) == DRAW_FAILURE, "A wrapping bitmap was accepted by the reader.");
+
+    // The glyph table overlaps the range table.
+    make_font_blob(blob);
+    put_blob_field(blob, 16, 36, 4);
+    CHECK(load_aa_font_blob(&font, blob, sizeof(blob)) == DRAW_FAILURE, "Overlapping tables were accepted.");
+    CHECK(open_aa_font_reader(&font, ranges, 2, read_blob, &reader) == DRAW_FAILURE, "Overlapping tables were accepted by the reader.");
+
+    // The glyph bitmap offset wraps around to the start of the bitmap.
+    make_font_blob(blob);
+    put_blob_field(blob, 40, 0xFFFFFFFF, 4);
+    CHECK(load_aa_font_blob(&font, blob, sizeof(blob)) == DRAW_FAILURE, "A wrapping glyph bitmap was accepted.");
+
+    // The reader only reads glyphs when they are drawn.
+    panel_handle = setup_panel(16);
+    CHECK(open_aa_font_reader(&font, ranges, 2, read_blob, &reader) == DRAW_SUCCESS, "The reader rejected the font before drawing.");
+    draw_aa_text(panel_handle, &font, 0, 0, LCD_WHITE, LCD_BLUE, "A", 1);
+    CHECK(screen_pixel(3, 1) != LCD_WHITE, "A wrapping glyph bitmap was read by the reader.");
+
+    esp_log_level_set("*", ESP_LOG_WARN);
+}
+
+
+// Number widget text at the ends of the int32_t range and with the most decimals.
+static void check_number_text(void)
+{
+    static widget_t storage[8];
+    widget_tree_t tree;
+    draw_t bounds = { .scale_x = 1, .scale_y = 1, .image_size_x = 100, .image_size_y = 20 };
+    const struct {
+        int32_t value;
+        uint8_t decimals;
+        const char *text;
+    } numbers[] = {
+        { INT32_MIN, 0, "-2147483648" },
+        { INT32_MIN, 1, "-214748364.8" },
+        { INT32_MIN, 9, "-2.147483648" },
+        { INT32_MAX, 9, "2.147483647" },
+        { -5, 2, "-0.05" },
+        { 1234, 2, "12.34" },
+    };
+
+    widget_tree_init(&tree, storage, 8, LCD_BLACK);
+
+    for (int i = 0; i < (int)(sizeof(numbers) / sizeof(numbers[0])); ++i)
+    {
+        int number = add_number(&tree, 0, bounds, &font_sans_12, LCD_WHITE, LCD_BLACK, WIDGET_ALIGN_LEFT, numbers[i].value, numbers[i].decimals);
+
+        CHECK( (number != WIDGET_NONE) && (strcmp(tree.widgets[number].text, numbers[i].text) == 0), "%ld with %d decimals is \"%s\", not \"%s\".",
+            (long)numbers[i].value, numbers[i].decimals, number != WIDGET_NONE ? tree.widgets[number].text : "", numbers[i].text);
+    }
+}
+
+
+// Copy of the stand-in panel memory, to compare what two ways of drawing left on the screen.
+static uint16_t screen_copy[STAND_IN_MEMORY_WIDTH * STAND_IN_MEMORY_HEIGHT];
+
+static void copy_screen(void)
+{
+    memcpy(screen_copy, get_stand_in_memory(), sizeof(screen_copy));
+}
+
+static int screen_matches_copy(void)
+{
+    return memcmp(screen_copy, get_stand_in_memory(), sizeof(screen_copy)) == 0;
+}
+
+
+// Four lines of letters and digits with 1 pixel glyph spacing, on black.
+static void draw_text_lines(esp_lcd_panel_handle_t panel_handle)
+{
+    static uint16_t letter_font[LETTER_FONT_PIXELS];
+    static uint16_t number_font[NUMBER_FONT_PIXELS];
+    glyph_t letters = { 0 };
+    glyph_t numbers = { 0 };
+
+    load_bitmap_letter_font(&letters, letter_font, LCD_WHITE, LCD_BLACK);
+    load_bitmap_numbers_font(&numbers, number_font, LCD_GREEN, LCD_BLACK);
+    letters.glyph_spacing = 1;
+    letters.glyph_scale = 1;
+    numbers.glyph_spacing = 1;
+    numbers.glyph_scale = 1;
+
+    for (int line = 0; line < 4; ++line)
+    {
+        if (line % 2 == 0)
+        {
+            letters.glyph_start_x = 4;
+            letters.glyph_start_y = 10 + line * 8;
+            CHECK(draw_glyphs(panel_handle, letters, letter_font, "what|is|up", 10) == DRAW_SUCCESS, "Line %d was not drawn.", line);
+        }
+        else
+        {
+            numbers.glyph_start_x = 4;
+            numbers.glyph_start_y = 10 + line * 8;
+            CHECK(draw_number(panel_handle, numbers, number_font, -1234567 * line) == DRAW_SUCCESS, "Line %d was not drawn.", line);
+        }
+    }
+}
+
+
+// Random fills, images and text, seeded so it can be drawn twice the same.
+static void draw_random_scene(esp_lcd_panel_handle_t panel_handle, uint32_t seed)
+{
+    static uint16_t letter_font[LETTER_FONT_PIXELS];
+    static uint16_t image[32 * 32];
+    glyph_t letters = { 0 };
+
+    random_state = seed;
+    load_bitmap_letter_font(&letters, letter_font, LCD_WHITE, LCD_BLACK);
+
+    for (int i = 0; i < 32 * 32; ++i)
+    {
+        image[i] = COLOR_SWAP((uint16_t)(i * 40503u + seed));
+    }
+
+    for (int draw = 0; draw < 24; ++draw)
+    {
+        draw_t window = { .scale_x = 1, .scale_y = 1 };
+        window.image_size_x = 1 + random_below(32);
+        window.image_size_y = 1 + random_below(32);
+        window.draw_start_x = random_below(SCREEN_WIDTH - window.image_size_x + 1);
+        window.draw_start_y = random_below(SCREEN_HEIGHT - window.image_size_y + 1);
+
+        switch (random_below(3))
+        {
+            case 0:
+                fill_rect(panel_handle, window, (uint16_t)random_below(0x10000));
+                break;
+            case 1:
+                draw_bgr_image(panel_handle, window, image);
+                break;
+            default:
+                letters.glyph_start_x = random_below(SCREEN_WIDTH - 7 * 7);
+                letters.glyph_start_y = random_below(SCREEN_HEIGHT - 8);
+                letters.glyph_spacing = random_below(3);
+                letters.glyph_scale = 1;
+                CHECK(draw_glyphs(panel_handle, letters, letter_font, "abc|xyz", 7) == DRAW_SUCCESS, "Random text was not drawn.");
+                break;
+        }
+    }
+}
+
+
+// Text drawn in a batch is merged into a window per line with glyph spacing bridged, one per glyph without. Either way
+// the screen shows the same pixels as drawn without a batch, also for random scenes with a gap of 0.
+static void check_batched_text(void)
+{
+    transfer_stats_t before;
+    transfer_stats_t unbatched;
+    transfer_stats_t gap_0;
+    transfer_stats_t gap_1;
+
+    esp_lcd_panel_handle_t panel_handle = setup_panel(16);
+    get_transfer_stats(&before);
+    draw_text_lines(panel_handle);
+    get_transfer_stats(&unbatched);
+    copy_screen();
+
+    // "what|is|up" twice and two 8 character numbers, a window per glyph.
+    CHECK(unbatched.transfers - before.transfers == 36, "%lu windows sent unbatched.", (unsigned long)(unbatched.transfers - before.transfers));
+    CHECK(unbatched.command_bytes - before.command_bytes == 36 * 11, "%llu command bytes sent unbatched.",
+        (unsigned long long)(unbatched.command_bytes - before.command_bytes));
+    unbatched.transfers -= before.transfers;
+    unbatched.pixel_bytes -= before.pixel_bytes;
+
+    // Every glyph has spacing, so nothing touches and nothing is merged.
+    panel_handle = setup_panel(16);
+    get_transfer_stats(&before);
+    begin_batch(0, LCD_BLACK);
+    draw_text_lines(panel_handle);
+    end_batch();
+    get_transfer_stats(&gap_0);
+    CHECK(screen_matches_copy(), "A batch with gap 0 drew other pixels.");
+    CHECK( (gap_0.transfers - before.transfers == unbatched.transfers) && (gap_0.pixel_bytes - before.pixel_bytes == unbatched.pixel_bytes),
+        "A batch with gap 0 sent %lu windows.", (unsigned long)(gap_0.transfers - before.transfers));
+
+    // The spacing is bridged, a window per line. The letter font draws word gaps as its blank '|' glyph.
+    panel_handle = setup_panel(16);
+    get_transfer_stats(&before);
+    begin_batch(1, LCD_BLACK);
+    draw_text_lines(panel_handle);
+    end_batch();
+    get_transfer_stats(&gap_1);
+    CHECK(screen_matches_copy(), "A batch with gap 1 drew other pixels.");
+    CHECK(gap_1.transfers - before.transfers == 4, "A batch with gap 1 sent %lu windows.", (unsigned long)(gap_1.transfers - before.transfers));
+    CHECK(gap_1.command_bytes - before.command_bytes == 4 * 11, "A batch with gap 1 sent %llu command bytes.",
+        (unsigned long long)(gap_1.command_bytes - before.command_bytes));
+    CHECK(gap_1.merged_draws - before.merged_draws == 32, "A batch with gap 1 merged %lu draws.", (unsigned long)(gap_1.merged_draws - before.merged_draws));
+    CHECK(gap_1.pixel_bytes - before.pixel_bytes > unbatched.pixel_bytes, "A batch with gap 1 sent no gap pixels.");
+
+    int different_scenes = 0;
+    for (uint32_t seed = 1; seed <= 50; ++seed)
+    {
+        panel_handle = setup_panel(16);
+        draw_random_scene(panel_handle, seed);
+        copy_screen();
+
+        panel_handle = setup_panel(16);
+        begin_batch(0, LCD_BLACK);
+        draw_random_scene(panel_handle, seed);
+        end_batch();
+
+        different_scenes += !screen_matches_copy();
+    }
+    CHECK(different_scenes == 0, "%d of 50 random scenes differ when batched.", different_scenes);
+}
+
+// Async fills with a single free pool block, so every fill waits for the fence of the one before it to give the block
+// back. Fences are done in order and the fills land in order.
+static void check_async_fills(void)
+{
+    esp_lcd_panel_handle_t panel_handle = setup_panel(16);
+    draw_t rect = { .scale_x = 1, .scale_y = 1, .draw_start_x = 10, .draw_start_y = 10, .image_size_x = 100, .image_size_y = 60 };
+    draw_fence_t fences[12];
+    uint16_t *held_blocks[POOL_BLOCK_AMOUNT - 1];
+    pool_stats_t before;
+    pool_stats_t after;
+
+    for (int i = 0; i < POOL_BLOCK_AMOUNT - 1; ++i)
+    {
+        held_blocks[i] = pool_borrow();
+    }
+    get_pool_stats(&before);
+
+    for (int i = 0; i < 12; ++i)
+    {
+        CHECK(fill_rect_async(panel_handle, rect, 0x1111 * (i + 1), &fences[i]) == DRAW_SUCCESS, "Async fill %d failed.", i);
+    }
+
+    // A fence done before an earlier one would show up as a later fence done while the earlier one is not. Later
+    // fences are polled first, so one finishing in between cannot look like that.
+    int out_of_order = 0;
+    while (!is_fence_done(fences[11]))
+    {
+        finish_stand_in_transfers();
+
+        int later_done = 0;
+        for (int i = 11; i >= 0; --i)
+        {
+            int done = is_fence_done(fences[i]);
+            out_of_order += later_done && !done;
+            later_done |= done;
+        }
+    }
+    CHECK(out_of_order == 0, "%d fences were not done while a later one was.", out_of_order);
+
+    get_pool_stats(&after);
+    CHECK(after.in_use == POOL_BLOCK_AMOUNT - 1, "%d pool blocks of the fills not returned.", after.in_use - (POOL_BLOCK_AMOUNT - 1));
+    CHECK(after.borrowed - before.borrowed == 12, "%lu pool blocks borrowed for 12 fills.", (unsigned long)(after.borrowed - before.borrowed));
+    CHECK(after.exhausted - before.exhausted >= 11, "The fills only waited for a block %lu times.", (unsigned long)(after.exhausted - before.exhausted));
+    CHECK(screen_pixel(109, 69) == 0x1111 * 12, "The last fill is not on top, 0x%04x.", screen_pixel(109, 69));
+
+    for (int i = 0; i < POOL_BLOCK_AMOUNT - 1; ++i)
+    {
+        pool_return(held_blocks[i]);
+    }
+}
+
+
+// Fences whose callbacks ran, in the order they ran.
+static draw_fence_t callback_fences[8];
+static int callback_amount = 0;
+
+static void log_fence(draw_fence_t fence, void *user_ctx)
+{
+    if (callback_amount < 8)
+    {
+        callback_fences[callback_amount] = fence;
+    }
+    callback_amount += 1;
+}
+
+
+// Logs the fence, then draws from inside the callback.
+static void log_fence_and_draw(draw_fence_t fence, void *user_ctx)
+{
+    draw_t dot = { .scale_x = 1, .scale_y = 1, .draw_start_x = 100, .draw_start_y = 200, .image_size_x = 4, .image_size_y = 4 };
+
+    log_fence(fence, user_ctx);
+    fill_rect_async(*(esp_lcd_panel_handle_t *)user_ctx, dot, LCD_YELLOW, NULL);
+}
+
+
+// Callbacks registered out of order run oldest fence first, and may draw. A fence counts transfers and a 16 bit
+// window is one transfer, so the fences of the next draws are known before drawing and every callback is pending.
+static void check_fence_callbacks(void)
+{
+    static esp_lcd_panel_handle_t panel_handle;
+    static uint16_t image[SCREEN_MAX_WIDTH * 20];
+    const int order[6] = { 5, 2, 0, 4, 1, 3 };
+
+    panel_handle = setup_panel(16);
+    callback_amount = 0;
+
+    draw_fence_t first_fence = get_draw_fence() + 1;
+    for (int i = 0; i < 6; ++i)
+    {
+        on_fence_done(first_fence + order[i], order[i] == 2 ? log_fence_and_draw : log_fence, &panel_handle);
+    }
+    CHECK(callback_amount == 0, "%d callbacks ran before their draws.", callback_amount);
+
+    for (int i = 0; i < 6; ++i)
+    {
+        draw_t window = { .scale_x = 1, .scale_y = 1, .draw_start_x = 0, .draw_start_y = i * 20, .image_size_x = SCREEN_WIDTH, .image_size_y = 20 };
+        CHECK(draw_bgr_image_async(panel_handle, window, image, NULL) == DRAW_SUCCESS, "Async image %d failed.", i);
+    }
+
+    wait_for_draws();
+    wait_for_draws();
+
+    CHECK(callback_amount == 6, "%d of 6 callbacks ran.", callback_amount);
+    for (int i = 0; (i < callback_amount) && (i < 6); ++i)
+    {
+        CHECK(callback_fences[i] == first_fence + i, "Callback %d ran for fence %lu, not %lu.", i, (unsigned long)callback_fences[i],
+            (unsigned long)(first_fence + i));
+    }
+    CHECK(screen_pixel(101, 201) == LCD_YELLOW, "The draw from inside a callback is missing.");
+}
+
+
+// Async images never queue more transfers than the queue holds. Setting an address window waits for the queue to
+// drain, as with esp_lcd, so transfers only pile up within a window: the packed chunks of a 12 bit window. With a
+// queue depth of 2 these keep it full.
+static void check_async_in_flight(void)
+{
+    esp_lcd_panel_handle_t panel_handle;
+    display_config_t config;
+    static uint16_t image[SCREEN_MAX_WIDTH * 60];
+    draw_fence_t fence = 0;
+    stand_in_queue_stats_t queue;
+
+    get_default_display_config(&config);
+    config.bits_per_pixel = 12;
+    config.trans_queue_depth = 2;
+    CHECK(setup_display_with_config(&panel_handle, &config) == DRAW_SUCCESS, "The display could not be set up.");
+
+    for (int i = 0; i < 30; ++i)
+    {
+        draw_t window = { .scale_x = 1, .scale_y = 1, .draw_start_x = 0, .draw_start_y = (i % 4) * 60, .image_size_x = SCREEN_WIDTH, .image_size_y = 60 };
+        draw_bgr_image_async(panel_handle, window, image, &fence);
+    }
+    wait_for_fence(fence);
+
+    get_stand_in_queue_stats(&queue);
+    CHECK(queue.high_water == 2, "At most %d transfers were in flight, the queue depth is 2.", queue.high_water);
+    CHECK(queue.full_queue_waits == 0, "%lu transfers were queued into a full queue.", (unsigned long)queue.full_queue_waits);
+}
+
+// The same scene, a screen of async image bands and a fill, at every pixel clock, queue depth and max transfer size,
+// with the throughput it got on the stand-in. The stand-in sends at the pixel clock and splits transfers into
+// transactions of the max transfer size like esp_lcd, the time between transactions is whatever the host takes, so only
+// the upper bound of the pixel clock is checked. Settings out of range are rejected before anything is set up.
+static void check_display_settings(void)
+{
+    esp_lcd_panel_handle_t panel_handle;
+    display_config_t config;
+    static uint16_t image[SCREEN_MAX_WIDTH * 60];
+    const uint32_t clocks_mhz[] = { 20, 40, 80 };
+    const int queue_depths[] = { 1, 10 };
+    const int max_transfer_sizes[] = { SCREEN_WIDTH * sizeof(uint16_t), LCD_MAX_TRANSFER_SIZE };
+
+    for (int i = 0; i < SCREEN_MAX_WIDTH * 60; ++i)
+    {
+        image[i] = (uint16_t)(i * 2654435761UL >> 16);
+    }
+
+    for (int depth = 0; depth < 2; ++depth)
+    {
+        for (int size = 0; size < 2; ++size)
+        {
+            for (int clock = 0; clock < 3; ++clock)
+            {
+                transfer_stats_t before;
+                transfer_stats_t after;
+                draw_fence_t fence = 0;
+
+                get_default_display_config(&config);
+                config.pixel_clock_hz = clocks_mhz[clock] * 1000 * 1000;
+                config.trans_queue_depth = queue_depths[depth];
+                config.max_transfer_sz = max_transfer_sizes[size];
+                CHECK(setup_display_with_config(&panel_handle, &config) == DRAW_SUCCESS, "The display could not be set up.");
+
+                get_transfer_stats(&before);
+                int64_t start_us = esp_timer_get_time();
+
+                for (int band = 0; band < 4; ++band)
+                {
+                    draw_t window = { .scale_x = 1, .scale_y = 1, .draw_start_x = 0, .draw_start_y = band * 60, .image_size_x = SCREEN_WIDTH, .image_size_y = 60 };
+                    CHECK(draw_bgr_image_async(panel_handle, window, image, &fence) == DRAW_SUCCESS, "Band %d was not drawn.", band);
+                }
+                draw_t box = { .scale_x = 1, .scale_y = 1, .draw_start_x = 20, .draw_start_y = 40, .image_size_x = 80, .image_size_y = 80 };
+                CHECK(fill_rect(panel_handle, box, LCD_RED) == DRAW_SUCCESS, "The box was not drawn.");
+                wait_for_draws();
+
+                int64_t elapsed_us = esp_timer_get_time() - start_us;
+                get_transfer_stats(&after);
+
+                uint64_t bytes = after.pixel_bytes - before.pixel_bytes;
+                double bytes_per_s = bytes * 1e6 / elapsed_us;
+                printf("%2lu MHz, queue depth %2d, max transfer %5d bytes: %5.2f MB/s\n", (unsigned long)clocks_mhz[clock],
+                    queue_depths[depth], max_transfer_sizes[size], bytes_per_s / 1e6);
+
+                CHECK(bytes_per_s <= clocks_mhz[clock] * 1e6 / 8, "%.0f bytes per second is faster than the pixel clock.", bytes_per_s);
+            }
+        }
+    }
+
+    // Every setting out of range on its own.
+    esp_log_level_set("*", ESP_LOG_NONE);
+
+    get_default_display_config(&config);
+    config.trans_queue_depth = 0;
+    CHECK(setup_display_with_config(&panel_handle, &config) == DRAW_FAILURE, "A queue depth of 0 was accepted.");
+    config.trans_queue_depth = -1;
+    CHECK(setup_display_with_config(&panel_handle, &config) == DRAW_FAILURE, "A queue depth of -1 was accepted.");
+
+    get_default_display_config(&config);
+    config.pixel_clock_hz = LCD_MAX_PIXEL_CLOCK_HZ + 1;
+    CHECK(setup_display_with_config(&panel_handle, &config) == DRAW_FAILURE, "A pixel clock above 80 MHz was accepted.");
+
+    get_default_display_config(&config);
+    config.dma_channel = SPI_DMA_DISABLED;
+    CHECK(setup_display_with_config(&panel_handle, &config) == DRAW_FAILURE, "A bus without DMA was accepted.");
+
+    get_default_display_config(&config);
+    config.max_transfer_sz = SCREEN_WIDTH * sizeof(uint16_t) - 2;
+    CHECK(setup_display_with_config(&panel_handle, &config) == DRAW_FAILURE, "A max transfer below a line was accepted.");
+
+    esp_log_level_set("*", ESP_LOG_WARN);
+}
+
+// Returns the amount of region pairs in a damage list that overlap.
+static int overlapping_damage(const damage_list_t *damage)
+{
+    int overlaps = 0;
+
+    for (int i = 0; i < damage->region_amount; ++i)
+    {
+        for (int j = i + 1; j < damage->region_amount; ++j)
+        {
+            const draw_t *a = &damage->regions[i];
+            const draw_t *b = &damage->regions[j];
+
+            overlaps += (a->draw_start_x < b->draw_start_x + b->image_size_x) && (b->draw_start_x < a->draw_start_x + a->image_size_x) &&
+                        (a->draw_start_y < b->draw_start_y + b->image_size_y) && (b->draw_start_y < a->draw_start_y + a->image_size_y);
+        }
+    }
+
+    return overlaps;
+}
+
+// Damage bridging two regions merges all three into one, and a merge into a full list merges on with what the grown
+// region reaches.
+static void check_damage_merging(void)
+{
+    damage_list_t damage = { .region_amount = 0 };
+
+    add_damage_rect(&damage, 0, 0, 10, 10);
+    add_damage_rect(&damage, 20, 0, 10, 10);
+    add_damage_rect(&damage, 5, 0, 20, 10);
+
+    CHECK(damage.region_amount == 1, "Damage over two regions left %d regions.", damage.region_amount);
+    CHECK( (damage.regions[0].draw_start_x == 0) && (damage.regions[0].image_size_x == 30) && (damage.regions[0].image_size_y == 10),
+        "The merged region is %d wide from %d.", damage.regions[0].image_size_x, damage.regions[0].draw_start_x);
+
+    // A full list of regions 5 pixels apart.
+    damage.region_amount = 0;
+    for (int i = 0; i < COMPOSITOR_MAX_DAMAGE; ++i)
+    {
+        add_damage_rect(&damage, i * 15, 0, 10, 10);
+    }
+    CHECK(damage.region_amount == COMPOSITOR_MAX_DAMAGE, "%d separate regions were kept.", damage.region_amount);
+
+    add_damage_rect(&damage, 0, 0, 20, 10);
+    CHECK(overlapping_damage(&damage) == 0, "%d damage regions overlap after merging into a full list.", overlapping_damage(&damage));
+    CHECK(damage.region_amount == COMPOSITOR_MAX_DAMAGE - 1, "Merging into a full list left %d regions.", damage.region_amount);
+}
+
+// Tilemap of the tilemap check, 8 x 8 tiles with a different pattern each, some map entries empty.
+enum { TILEMAP_TILES = 16, TILEMAP_MAP_WIDTH = 40, TILEMAP_MAP_HEIGHT = 80 };
+static uint16_t tile_pixels[TILEMAP_TILES * 8 * 8];
+static uint16_t tile_map[TILEMAP_MAP_WIDTH * TILEMAP_MAP_HEIGHT];
+static const uint16_t tilemap_background = 0x1234;
+
+// World pixel of the tilemap, as the viewport should show it.
+static uint16_t world_pixel(int x, int y)
+{
+    if ( (x < 0) || (y < 0) || (x >= TILEMAP_MAP_WIDTH * 8) || (y >= TILEMAP_MAP_HEIGHT * 8) )
+    {
+        return tilemap_background;
+    }
+
+    uint16_t tile = tile_map[(y / 8) * TILEMAP_MAP_WIDTH + x / 8];
+    if (tile == TILEMAP_EMPTY_TILE)
+    {
+        return tilemap_background;
+    }
+
+    return tile_pixels[(tile * 8 + y % 8) * 8 + x % 8];
+}
+
+// Returns the amount of viewport pixels the panel shows differently from the world at the camera. Shown lines follow the
+// hardware scroll, pixels are compared as sent.
+static int wrong_viewport_pixels(const tilemap_t *tilemap)
+{
+    const uint16_t *memory = get_stand_in_memory();
+    int wrong_pixels = 0;
+
+    for (int y = 0; y < tilemap->viewport.image_size_y; ++y)
+    {
+        int memory_line = get_stand_in_shown_line(tilemap->viewport.draw_start_y + y + SCREEN_HEIGHT_PIXEL_MISALIGNMENT);
+
+        for (int x = 0; x < tilemap->viewport.image_size_x; ++x)
+        {
+            uint16_t shown = memory[memory_line * STAND_IN_MEMORY_WIDTH + tilemap->viewport.draw_start_x + x + SCREEN_WIDTH_PIXEL_MISALIGNMENT];
+            wrong_pixels += shown != world_pixel(tilemap->camera_x + x, tilemap->camera_y + y);
+        }
+    }
+
+    return wrong_pixels;
+}
+
+// Moves the camera, draws the tilemap and checks the viewport against the world and the pixels sent for it.
+static void check_tilemap_move(esp_lcd_panel_handle_t panel_handle, tilemap_t *tilemap, int camera_x, int camera_y, int expected_lines)
+{
+    transfer_stats_t before;
+    transfer_stats_t after;
+
+    set_tilemap_camera(tilemap, camera_x, camera_y);
+    get_transfer_stats(&before);
+    CHECK(draw_tilemap(panel_handle, tilemap) == DRAW_SUCCESS, "The tilemap at %d, %d was not drawn.", camera_x, camera_y);
+    get_transfer_stats(&after);
+
+    int wrong_pixels = wrong_viewport_pixels(tilemap);
+    CHECK(wrong_pixels == 0, "With the camera at %d, %d, %d viewport pixels are wrong.", camera_x, camera_y, wrong_pixels);
+
+    uint64_t lines = (after.pixel_bytes - before.pixel_bytes) / (tilemap->viewport.image_size_x * sizeof(uint16_t));
+    CHECK(lines == expected_lines, "Moving the camera to %d, %d sent %llu lines, not %d.", camera_x, camera_y,
+        (unsigned long long)lines, expected_lines);
+}
+
+// A full width viewport scrolls in hardware: moves of less than its height only send the lines they expose, longer
+// moves and moves in x redraw it. The panel shows the world at the camera after every move, as a full render would,
+// also after the scroll is released. A narrower viewport redraws on every move.
+static void check_tilemap(void)
+{
+    esp_lcd_panel_handle_t panel_handle = setup_panel(16);
+    static tilemap_t tilemap;
+    const int height = 200;
+
+    for (int i = 0; i < TILEMAP_TILES * 8 * 8; ++i)
+    {
+        tile_pixels[i] = (uint16_t)(i * 2654435761UL >> 16);
+    }
+    random_state = 7;
+    for (int i = 0; i < TILEMAP_MAP_WIDTH * TILEMAP_MAP_HEIGHT; ++i)
+    {
+        tile_map[i] = random_below(8) == 0 ? TILEMAP_EMPTY_TILE : random_below(TILEMAP_TILES);
+    }
+
+    tileset_t tileset = { .format = TILE_FORMAT_BGR565, .tile_size = 8, .tile_amount = TILEMAP_TILES, .pixels = tile_pixels };
+    draw_t viewport = { .scale_x = 1, .scale_y = 1, .draw_start_x = 0, .draw_start_y = 20, .image_size_x = SCREEN_WIDTH, .image_size_y = height };
+
+    CHECK(tilemap_init(&tilemap, &tileset, tile_map, TILEMAP_MAP_WIDTH, TILEMAP_MAP_HEIGHT, viewport, tilemap_background) == DRAW_SUCCESS,
+        "The tilemap was not set up.");
+    CHECK(tilemap.hardware_scroll, "A full width viewport does not scroll in hardware.");
+
+    check_tilemap_move(panel_handle, &tilemap, 0, 0, height);
+    check_tilemap_move(panel_handle, &tilemap, 0, 37, 37);
+    check_tilemap_move(panel_handle, &tilemap, 0, 190, 153);
+    check_tilemap_move(panel_handle, &tilemap, 0, 140, 50);
+    check_tilemap_move(panel_handle, &tilemap, 0, 140 + height + 30, height);
+    check_tilemap_move(panel_handle, &tilemap, 0, -15, height);
+    check_tilemap_move(panel_handle, &tilemap, 0, 5, 20);
+    check_tilemap_move(panel_handle, &tilemap, 13, 5, height);
+    check_tilemap_move(panel_handle, &tilemap, 13, 5, 0);
+
+    CHECK(release_tilemap_scroll(panel_handle, &tilemap) == DRAW_SUCCESS, "The scroll was not released.");
+    CHECK(get_stand_in_shown_line(viewport.draw_start_y + SCREEN_HEIGHT_PIXEL_MISALIGNMENT) == viewport.draw_start_y + SCREEN_HEIGHT_PIXEL_MISALIGNMENT,
+        "The released viewport still scrolls.");
+    CHECK(wrong_viewport_pixels(&tilemap) == 0, "The released viewport is wrong.");
+
+    // Away from the screen edge there is no hardware scroll.
+    viewport = (draw_t){ .scale_x = 1, .scale_y = 1, .draw_start_x = 10, .draw_start_y = 30, .image_size_x = 100, .image_size_y = 120 };
+    CHECK(tilemap_init(&tilemap, &tileset, tile_map, TILEMAP_MAP_WIDTH, TILEMAP_MAP_HEIGHT, viewport, tilemap_background) == DRAW_SUCCESS,
+        "The narrow tilemap was not set up.");
+    CHECK(!tilemap.hardware_scroll, "A narrow viewport scrolls in hardware.");
+
+    check_tilemap_move(panel_handle, &tilemap, 40, 16, 120);
+    check_tilemap_move(panel_handle, &tilemap, 40, 19, 120);
+    check_tilemap_move(panel_handle, &tilemap, 31, 19, 120);
+}
+
+// Background of the sprite check, a noise image over the whole screen, and round color keyed sprites.
+enum { SPRITE_SIZE = 24 };
+static uint16_t sprite_background[SCREEN_MAX_WIDTH * SCREEN_MAX_HEIGHT];
+static uint16_t sprite_pixels[3][SPRITE_SIZE * SPRITE_SIZE];
+
+// Returns the amount of screen pixels that differ from the background with the visible sprites over it, rendered
+// whole in z order.
+static int wrong_sprite_pixels(const sprite_engine_t *engine)
+{
+    const uint16_t *memory = get_stand_in_memory();
+    int order[SPRITE_ENGINE_MAX_SPRITES];
+    int wrong_pixels = 0;
+
+    // Bottom to top, equal z in the order added.
+    for (int i = 0; i < engine->sprite_amount; ++i)
+    {
+        int j = i;
+        while ( (j > 0) && (engine->sprites[order[j - 1]].z > engine->sprites[i].z) )
+        {
+            order[j] = order[j - 1];
+            --j;
+        }
+        order[j] = i;
+    }
+
+    for (int y = 0; y < SCREEN_HEIGHT; ++y)
+    {
+        for (int x = 0; x < SCREEN_WIDTH; ++x)
+        {
+            uint16_t expected = sprite_background[y * SCREEN_WIDTH + x];
+
+            for (int i = 0; i < engine->sprite_amount; ++i)
+            {
+                const engine_sprite_t *sprite = &engine->sprites[order[i]];
+                const sprite_t *frame = &sprite->frames[sprite->frame];
+                int sprite_x = x - (sprite->x >> SPRITE_SUBPIXEL_BITS);
+                int sprite_y = y - (sprite->y >> SPRITE_SUBPIXEL_BITS);
+
+                if ( !sprite->visible || (sprite_x < 0) || (sprite_y < 0) || (sprite_x >= frame->width) || (sprite_y >= frame->height) )
+                {
+                    continue;
+                }
+
+                uint16_t pixel = frame->pixels[sprite_y * frame->width + sprite_x];
+                expected = pixel != frame->key_color ? pixel : expected;
+            }
+
+            uint16_t shown = memory[(y + SCREEN_HEIGHT_PIXEL_MISALIGNMENT) * STAND_IN_MEMORY_WIDTH + x + SCREEN_WIDTH_PIXEL_MISALIGNMENT];
+            wrong_pixels += shown != expected;
+        }
+    }
+
+    return wrong_pixels;
+}
+
+// Overlapping sprites over a background, moved, hidden, shown and swapped in z. After every draw_sprites() the screen
+// matches a full render, and a sprite moved a little only sends the union of its old and new bounds.
+static void check_sprites(void)
+{
+    esp_lcd_panel_handle_t panel_handle = setup_panel(16);
+    static sprite_engine_t engine;
+    static sprite_t frames[3];
+    transfer_stats_t before;
+    transfer_stats_t after;
+
+    for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; ++i)
+    {
+        sprite_background[i] = (uint16_t)(i * 2654435761UL >> 16);
+    }
+
+    for (int sprite = 0; sprite < 3; ++sprite)
+    {
+        for (int y = 0; y < SPRITE_SIZE; ++y)
+        {
+            for (int x = 0; x < SPRITE_SIZE; ++x)
+            {
+                int dx = 2 * x + 1 - SPRITE_SIZE;
+                int dy = 2 * y + 1 - SPRITE_SIZE;
+                int inside = dx * dx + dy * dy < SPRITE_SIZE * SPRITE_SIZE;
+
+                sprite_pixels[sprite][y * SPRITE_SIZE + x] = inside ? (uint16_t)(0x0841 * (sprite + 1) + x + y * 32) : 0;
+            }
+        }
+
+        frames[sprite] = (sprite_t){ .format = SPRITE_FORMAT_COLOR_KEY, .width = SPRITE_SIZE, .height = SPRITE_SIZE,
+            .pixels = sprite_pixels[sprite], .key_color = 0 };
+    }
+
+    image_source_t background_image = { .image_buffer = sprite_background, .draw_params = { .scale_x = 1, .scale_y = 1,
+        .image_size_x = SCREEN_WIDTH, .image_size_y = SCREEN_HEIGHT } };
+    pixel_source_t background = { .read_span = read_image_span, .source_ctx = &background_image };
+
+    CHECK(draw_bgr_image(panel_handle, background_image.draw_params, sprite_background) == DRAW_SUCCESS, "The background was not drawn.");
+    CHECK(sprite_engine_init(&engine, &background) == DRAW_SUCCESS, "The sprite engine was not set up.");
+
+    int a = add_engine_sprite(&engine, &frames[0], 1, 0, 20, 30, 0);
+    int b = add_engine_sprite(&engine, &frames[1], 1, 0, 30, 40, 1);
+    int c = add_engine_sprite(&engine, &frames[2], 1, 0, 100, 200, 0);
+    CHECK( (a != SPRITE_NO_SPRITE) && (b != SPRITE_NO_SPRITE) && (c != SPRITE_NO_SPRITE), "The sprites were not added.");
+
+    CHECK(draw_sprites(panel_handle, &engine) == DRAW_SUCCESS, "The sprites were not drawn.");
+    CHECK(wrong_sprite_pixels(&engine) == 0, "%d pixels are wrong after drawing the sprites.", wrong_sprite_pixels(&engine));
+
+    // A small move of the lone sprite.
+    set_sprite_position(&engine, c, 103, 202);
+    get_transfer_stats(&before);
+    CHECK(draw_sprites(panel_handle, &engine) == DRAW_SUCCESS, "The moved sprite was not drawn.");
+    get_transfer_stats(&after);
+    CHECK(wrong_sprite_pixels(&engine) == 0, "%d pixels are wrong after a move.", wrong_sprite_pixels(&engine));
+    CHECK(after.pixel_bytes - before.pixel_bytes == (SPRITE_SIZE + 3) * (SPRITE_SIZE + 2) * sizeof(uint16_t),
+        "A move of 3, 2 pixels sent %llu bytes.", (unsigned long long)(after.pixel_bytes - before.pixel_bytes));
+
+    // Under the other sprite, then across the screen edge.
+    set_sprite_position(&engine, a, 36, 44);
+    CHECK(draw_sprites(panel_handle, &engine) == DRAW_SUCCESS, "The sprite moved under another was not drawn.");
+    CHECK(wrong_sprite_pixels(&engine) == 0, "%d pixels are wrong after moving under another sprite.", wrong_sprite_pixels(&engine));
+
+    set_sprite_position(&engine, c, SCREEN_WIDTH - 10, SCREEN_HEIGHT - 5);
+    CHECK(draw_sprites(panel_handle, &engine) == DRAW_SUCCESS, "The sprite over the edge was not drawn.");
+    CHECK(wrong_sprite_pixels(&engine) == 0, "%d pixels are wrong with a sprite over the edge.", wrong_sprite_pixels(&engine));
+
+    // Swapped in z, the lower one on top.
+    set_sprite_z(&engine, a, 2);
+    CHECK(draw_sprites(panel_handle, &engine) == DRAW_SUCCESS, "The z swap was not drawn.");
+    CHECK(wrong_sprite_pixels(&engine) == 0, "%d pixels are wrong after a z swap.", wrong_sprite_pixels(&engine));
+
+    // Hidden, shown again somewhere else.
+    set_sprite_visible(&engine, b, 0);
+    CHECK(draw_sprites(panel_handle, &engine) == DRAW_SUCCESS, "The hidden sprite was not drawn.");
+    CHECK(wrong_sprite_pixels(&engine) == 0, "%d pixels are wrong after hiding a sprite.", wrong_sprite_pixels(&engine));
+
+    set_sprite_position(&engine, b, 60, 120);
+    set_sprite_visible(&engine, b, 1);
+    CHECK(draw_sprites(panel_handle, &engine) == DRAW_SUCCESS, "The shown sprite was not drawn.");
+    CHECK(wrong_sprite_pixels(&engine) == 0, "%d pixels are wrong after showing a sprite.", wrong_sprite_pixels(&engine));
+
+    // Nothing changed, nothing sent.
+    get_transfer_stats(&before);
+    CHECK(draw_sprites(panel_handle, &engine) == DRAW_SUCCESS, "The unchanged sprites were not drawn.");
+    get_transfer_stats(&after);
+    CHECK(after.pixel_bytes == before.pixel_bytes, "Unchanged sprites sent %llu bytes.", (unsigned long long)(after.pixel_bytes - before.pixel_bytes));
+}
+
+// Returns the amount of screen pixels that differ from a full screen BGR565 frame.
+static int wrong_frame_pixels(const uint16_t *frame_buffer)
+{
+    const uint16_t *memory = get_stand_in_memory();
+    int wrong_pixels = 0;
+
+    for (int y = 0; y < SCREEN_HEIGHT; ++y)
+    {
+        for (int x = 0; x < SCREEN_WIDTH; ++x)
+        {
+            uint16_t shown = memory[(y + SCREEN_HEIGHT_PIXEL_MISALIGNMENT) * STAND_IN_MEMORY_WIDTH + x + SCREEN_WIDTH_PIXEL_MISALIGNMENT];
+            wrong_pixels += shown != frame_buffer[y * SCREEN_WIDTH + x];
+        }
+    }
+
+    return wrong_pixels;
+}
+
+// The first frame is sent whole. After a few pixels are flipped only their tiles are sent, neighbouring tiles of a row
+// as one window, and the screen shows the new frame. An unchanged frame sends nothing.
+static void check_frame_differ(void)
+{
+    esp_lcd_panel_handle_t panel_handle = setup_panel(16);
+    static frame_differ_t differ;
+    static uint16_t frame[SCREEN_MAX_WIDTH * SCREEN_MAX_HEIGHT];
+    transfer_stats_t before;
+    transfer_stats_t after;
+
+    random_state = 11;
+    for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; ++i)
+    {
+        frame[i] = (uint16_t)random_below(0x10000);
+    }
+
+    frame_differ_init(&differ);
+    CHECK(submit_frame(panel_handle, &differ, frame) == DRAW_SUCCESS, "The first frame was not sent.");
+    CHECK(differ.tiles_sent == FRAME_DIFF_COLUMNS * FRAME_DIFF_ROWS, "The first frame sent %lu of %d tiles.",
+        (unsigned long)differ.tiles_sent, FRAME_DIFF_COLUMNS * FRAME_DIFF_ROWS);
+    CHECK(wrong_frame_pixels(frame) == 0, "%d pixels of the first frame are wrong.", wrong_frame_pixels(frame));
+
+    // Two neighbouring tiles, two pixels in one tile and the partial tile in the bottom right corner.
+    const int flipped[][2] = { { 5, 5 }, { 20, 5 }, { 100, 100 }, { 101, 102 }, { SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1 } };
+    const int last_width = SCREEN_WIDTH - (FRAME_DIFF_COLUMNS - 1) * FRAME_DIFF_TILE_SIZE;
+    const int last_height = SCREEN_HEIGHT - (FRAME_DIFF_ROWS - 1) * FRAME_DIFF_TILE_SIZE;
+
+    for (int i = 0; i < 5; ++i)
+    {
+        frame[flipped[i][1] * SCREEN_WIDTH + flipped[i][0]] ^= 0xFFFF;
+    }
+
+    frame_differ_t previous = differ;
+    get_transfer_stats(&before);
+    CHECK(submit_frame(panel_handle, &differ, frame) == DRAW_SUCCESS, "The changed frame was not sent.");
+    get_transfer_stats(&after);
+
+    uint64_t expected_bytes = (3 * FRAME_DIFF_TILE_SIZE * FRAME_DIFF_TILE_SIZE + last_width * last_height) * sizeof(uint16_t);
+    CHECK(differ.tiles_sent - previous.tiles_sent == 4, "%lu tiles were sent for 4 changed tiles.", (unsigned long)(differ.tiles_sent - previous.tiles_sent));
+    CHECK(differ.windows_sent - previous.windows_sent == 3, "%lu windows were sent.", (unsigned long)(differ.windows_sent - previous.windows_sent));
+    CHECK( (differ.pixel_bytes_sent - previous.pixel_bytes_sent == expected_bytes) && (after.pixel_bytes - before.pixel_bytes == expected_bytes),
+        "%llu pixel bytes were sent, %llu counted, not %llu.", (unsigned long long)(after.pixel_bytes - before.pixel_bytes),
+        (unsigned long long)(differ.pixel_bytes_sent - previous.pixel_bytes_sent), (unsigned long long)expected_bytes);
+    CHECK(wrong_frame_pixels(frame) == 0, "%d pixels of the changed frame are wrong.", wrong_frame_pixels(frame));
+
+    previous = differ;
+    CHECK(submit_frame(panel_handle, &differ, frame) == DRAW_SUCCESS, "The unchanged frame was not sent.");
+    CHECK( (differ.tiles_sent == previous.tiles_sent) && (differ.tiles_compared - previous.tiles_compared == FRAME_DIFF_COLUMNS * FRAME_DIFF_ROWS),
+        "The unchanged frame sent %lu tiles.", (unsigned long)(differ.tiles_sent - previous.tiles_sent));
+}
+
+// Appends samples in a range that is already set and returns the pixel bytes sent for them, checked against the bus.
+static uint64_t append_in_range(esp_lcd_panel_handle_t panel_handle, chart_t *chart, int amount)
+{
+    transfer_stats_t before;
+    transfer_stats_t after;
+    uint64_t counted = chart->pixel_bytes_sent;
+    uint32_t rescales = chart->rescales;
+
+    get_transfer_stats(&before);
+    for (int i = 0; i < amount; ++i)
+    {
+        CHECK(append_chart_sample(panel_handle, chart, (i % 7) * 1.5f) == DRAW_SUCCESS, "Sample %d was not drawn.", i);
+    }
+    get_transfer_stats(&after);
+
+    CHECK(chart->rescales == rescales, "Samples in range rescaled the chart %lu times.", (unsigned long)(chart->rescales - rescales));
+    CHECK(chart->pixel_bytes_sent - counted == after.pixel_bytes - before.pixel_bytes, "The chart counted %llu pixel bytes, %llu were sent.",
+        (unsigned long long)(chart->pixel_bytes_sent - counted), (unsigned long long)(after.pixel_bytes - before.pixel_bytes));
+
+    return after.pixel_bytes - before.pixel_bytes;
+}
+
+// A sample in range sends its column and the cleared one after it, or a line when scrolled, whatever the plot width.
+// The range grows right away for a sample above it, but only shrinks once the samples shown span less than
+// CHART_SHRINK_FRACTION of it.
+static void check_chart(void)
+{
+    esp_lcd_panel_handle_t panel_handle = setup_panel(16);
+    static chart_t chart;
+    static float samples[SCREEN_MAX_HEIGHT + 1];
+    chart_config_t config;
+
+    const int widths[] = { 40, 70, SCREEN_WIDTH - 32 };
+    for (int i = 0; i < 3; ++i)
+    {
+        get_default_chart_config(&config);
+        config.plot.image_size_x = widths[i];
+        CHECK(chart_init(&chart, &config, samples) == DRAW_SUCCESS, "The %d pixel wide chart was not set up.", widths[i]);
+
+        // Scaled to the samples first, then 100 samples wrapping the sweep at least once.
+        append_chart_sample(panel_handle, &chart, 0.0f);
+        append_chart_sample(panel_handle, &chart, 9.0f);
+
+        uint64_t bytes = append_in_range(panel_handle, &chart, 100);
+        CHECK(bytes == 100 * 2 * config.plot.image_size_y * sizeof(uint16_t), "100 samples on a %d pixel wide chart sent %llu bytes.",
+            widths[i], (unsigned long long)bytes);
+    }
+
+    get_default_chart_config(&config);
+    config.mode = CHART_HARDWARE_SCROLL;
+    config.plot = (draw_t){ .scale_x = 1, .scale_y = 1, .draw_start_x = 0, .draw_start_y = 40, .image_size_x = SCREEN_WIDTH, .image_size_y = 150 };
+    CHECK(chart_init(&chart, &config, samples) == DRAW_SUCCESS, "The scrolled chart was not set up.");
+    append_chart_sample(panel_handle, &chart, 0.0f);
+    append_chart_sample(panel_handle, &chart, 9.0f);
+
+    uint64_t bytes = append_in_range(panel_handle, &chart, 200);
+    CHECK(bytes == 200 * SCREEN_WIDTH * sizeof(uint16_t), "200 samples on the scrolled chart sent %llu bytes.", (unsigned long long)bytes);
+    CHECK(release_chart_scroll(panel_handle, &chart) == DRAW_SUCCESS, "The chart scroll was not released.");
+
+    // Hysteresis, on a sweep of 39 visible samples.
+    get_default_chart_config(&config);
+    config.plot.image_size_x = 40;
+    CHECK(chart_init(&chart, &config, samples) == DRAW_SUCCESS, "The chart was not set up.");
+
+    for (int i = 0; i < 39; ++i)
+    {
+        append_chart_sample(panel_handle, &chart, i % 2 == 0 ? 0.0f : 100.0f);
+    }
+    uint32_t rescales = chart.rescales;
+    float span = chart.range_max - chart.range_min;
+    float center = (chart.range_max + chart.range_min) / 2.0f;
+
+    // Spanning a bit more than the shrink fraction, once the wide samples are gone.
+    for (int i = 0; i < 2 * 39; ++i)
+    {
+        append_chart_sample(panel_handle, &chart, center + (i % 2 == 0 ? -0.15f : 0.15f) * span);
+    }
+    CHECK(chart.rescales == rescales, "Samples spanning 30%% of the range rescaled it %lu times.", (unsigned long)(chart.rescales - rescales));
+
+    // A bit less, the range shrinks once.
+    for (int i = 0; i < 2 * 39; ++i)
+    {
+        append_chart_sample(panel_handle, &chart, center + (i % 2 == 0 ? -0.1f : 0.1f) * span);
+    }
+    CHECK(chart.rescales == rescales + 1, "Samples spanning 20%% of the range rescaled it %lu times.", (unsigned long)(chart.rescales - rescales));
+    CHECK(chart.range_max - chart.range_min < span, "The range did not shrink.");
+
+    // Above the range, grown right away.
+    rescales = chart.rescales;
+    float above = chart.range_max + 1.0f;
+    append_chart_sample(panel_handle, &chart, above);
+    CHECK( (chart.rescales == rescales + 1) && (chart.range_max >= above), "A sample above the range did not grow it.");
+}
+
+// Image of the stream check, RGB888: flat bands for runs, gradients for QOI differences, a few repeating colors for
+// the QOI index and noise for literals.
+enum { STREAM_WIDTH = 120, STREAM_LINES = 500, STREAM_WINDOW_LINES = 200 };
+static uint8_t stream_image[STREAM_LINES * STREAM_WIDTH][3];
+static uint8_t stream_data[20 + STREAM_LINES * STREAM_WIDTH * 4];
+
+static void make_stream_image(void)
+{
+    random_state = 5;
+
+    for (int y = 0; y < STREAM_LINES; ++y)
+    {
+        for (int x = 0; x < STREAM_WIDTH; ++x)
+        {
+            uint8_t *pixel = stream_image[y * STREAM_WIDTH + x];
+
+            switch ((y / 25) % 4)
+            {
+                case 0:
+                    pixel[0] = (y / 25) * 40;
+                    pixel[1] = x < 60 ? 200 : 30;
+                    pixel[2] = 90;
+                    break;
+
+                case 1:
+                    pixel[0] = x * 2;
+                    pixel[1] = y;
+                    pixel[2] = 255 - x;
+                    break;
+
+                case 2:
+                    pixel[0] = (x / 4) % 3 * 100;
+                    pixel[1] = (x / 4) % 5 * 50;
+                    pixel[2] = (x / 4) % 2 * 250;
+                    break;
+
+                default:
+                    pixel[0] = random_below(256);
+                    pixel[1] = random_below(256);
+                    pixel[2] = random_below(256);
+                    break;
+            }
+        }
+    }
+}
+
+// The encoders of tools/make_stream.py, writing the same bytes. Each returns the end of what it wrote.
+static uint8_t *put_bgr565(uint8_t *out, const uint8_t *pixel)
+{
+    uint16_t RGB_color = ((pixel[0] & 0xF8) << 8) | ((pixel[1] & 0xFC) << 3) | (pixel[2] >> 3);
+
+    *out++ = RGB_color >> 8;
+    *out++ = RGB_color & 0xFF;
+    return out;
+}
+
+static uint8_t *encode_raw(uint8_t *out, int pixel_amount)
+{
+    for (int i = 0; i < pixel_amount; ++i)
+    {
+        out = put_bgr565(out, stream_image[i]);
+    }
+
+    return out;
+}
+
+static uint8_t *encode_rle(uint8_t *out, int pixel_amount)
+{
+    uint8_t words[2][2];
+    int i = 0;
+
+    while (i < pixel_amount)
+    {
+        int run = 1;
+        put_bgr565(words[0], stream_image[i]);
+        while ( (i + run < pixel_amount) && (run < 128) && (memcmp(put_bgr565(words[1], stream_image[i + run]) - 2, words[0], 2) == 0) )
+        {
+            run += 1;
+        }
+
+        if (run >= 2)
+        {
+            *out++ = run + 127;
+            out = put_bgr565(out, stream_image[i]);
+            i += run;
+            continue;
+        }
+
+        // Literals up to the next run of at least 2 pixels.
+        int start = i;
+        while ( (i < pixel_amount) && (i - start < 128) )
+        {
+            if (i + 1 < pixel_amount)
+            {
+                put_bgr565(words[0], stream_image[i]);
+                put_bgr565(words[1], stream_image[i + 1]);
+                if (memcmp(words[0], words[1], 2) == 0)
+                {
+                    break;
+                }
+            }
+            i += 1;
+        }
+        if (i == start)
+        {
+            i += 1;
+        }
+
+        *out++ = i - start - 1;
+        for (int literal = start; literal < i; ++literal)
+        {
+            out = put_bgr565(out, stream_image[literal]);
+        }
+    }
+
+    return out;
+}
+
+static uint8_t *encode_qoi(uint8_t *out, int pixel_amount)
+{
+    uint8_t index[64][4] = { { 0 } };
+    uint8_t previous[4] = { 0, 0, 0, 255 };
+    int run = 0;
+
+    for (int i = 0; i < pixel_amount; ++i)
+    {
+        uint8_t pixel[4] = { stream_image[i][0], stream_image[i][1], stream_image[i][2], 255 };
+
+        if (memcmp(pixel, previous, 4) == 0)
+        {
+            run += 1;
+            if (run == 62)
+            {
+                *out++ = 0xC0 | (run - 1);
+                run = 0;
+            }
+            continue;
+        }
+
+        if (run > 0)
+        {
+            *out++ = 0xC0 | (run - 1);
+            run = 0;
+        }
+
+        int position = (pixel[0] * 3 + pixel[1] * 5 + pixel[2] * 7 + 255 * 11) % 64;
+        if (memcmp(index[position], pixel, 4) == 0)
+        {
+            *out++ = position;
+        }
+        else
+        {
+            memcpy(index[position], pixel, 4);
+            int dr = (int8_t)(pixel[0] - previous[0]);
+            int dg = (int8_t)(pixel[1] - previous[1]);
+            int db = (int8_t)(pixel[2] - previous[2]);
+            int drg = dr - dg;
+            int dbg = db - dg;
+
+            if ( (dr >= -2) && (dr <= 1) && (dg >= -2) && (dg <= 1) && (db >= -2) && (db <= 1) )
+            {
+                *out++ = 0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2);
+            }
+            else if ( (dg >= -32) && (dg <= 31) && (drg >= -8) && (drg <= 7) && (dbg >= -8) && (dbg <= 7) )
+            {
+                *out++ = 0x80 | (dg + 32);
+                *out++ = ((drg + 8) << 4) | (dbg + 8);
+            }
+            else
+            {
+                *out++ = 0xFE;
+                *out++ = pixel[0];
+                *out++ = pixel[1];
+                *out++ = pixel[2];
+            }
+        }
+
+        memcpy(previous, pixel, 4);
+    }
+
+    if (run > 0)
+    {
+        *out++ = 0xC0 | (run - 1);
+    }
+
+    return out;
+}
+
+// Writes a stream of the first lines of the image into stream_data, drawn at 5, 10 in a window of
+// STREAM_WINDOW_LINES lines. Returns its size.
+static size_t make_stream(stream_encoding_t encoding, int lines, int endless)
+{
+    uint32_t header_lines = endless ? 0 : lines;
+    uint8_t header[20] = { 'L', 'C', 'D', 'S', STREAM_VERSION, encoding, 5, 0, 10, 0, STREAM_WIDTH, 0, STREAM_WINDOW_LINES, 0, 0, 0,
+        header_lines & 0xFF, (header_lines >> 8) & 0xFF, (header_lines >> 16) & 0xFF, header_lines >> 24 };
+
+    memcpy(stream_data, header, sizeof(header));
+
+    uint8_t *end = stream_data + sizeof(header);
+    switch (encoding)
+    {
+        case STREAM_ENCODING_RAW:
+            end = encode_raw(end, lines * STREAM_WIDTH);
+            break;
+
+        case STREAM_ENCODING_RLE:
+            end = encode_rle(end, lines * STREAM_WIDTH);
+            break;
+
+        case STREAM_ENCODING_QOI:
+            end = encode_qoi(end, lines * STREAM_WIDTH);
+            break;
+    }
+
+    return end - stream_data;
+}
+
+// Returns the amount of window pixels that differ from the image, after lines image lines were drawn through the
+// window. Every window line shows the last image line that wrapped onto it.
+static int wrong_stream_pixels(int lines)
+{
+    const uint16_t *memory = get_stand_in_memory();
+    int wrong_pixels = 0;
+
+    for (int window_line = 0; window_line < STREAM_WINDOW_LINES && window_line < lines; ++window_line)
+    {
+        int line = window_line + (lines - 1 - window_line) / STREAM_WINDOW_LINES * STREAM_WINDOW_LINES;
+
+        for (int x = 0; x < STREAM_WIDTH; ++x)
+        {
+            uint8_t expected[2];
+            const uint8_t *pixel = stream_image[line * STREAM_WIDTH + x];
+            uint16_t shown = memory[(10 + window_line + SCREEN_HEIGHT_PIXEL_MISALIGNMENT) * STAND_IN_MEMORY_WIDTH + 5 + x + SCREEN_WIDTH_PIXEL_MISALIGNMENT];
+
+            put_bgr565(expected, pixel);
+            wrong_pixels += memcmp(&shown, expected, 2) != 0;
+        }
+    }
+
+    return wrong_pixels;
+}
+
+// Raw, RLE and QOI streams of an image longer than the window decode pixel exact, wrapping in the window, also when
+// the stream has no line count and is read until it ends. A stream cut inside a packet fails after the lines before
+// the cut. The bytes per second of every stream are printed.
+static void check_image_stream(void)
+{
+    esp_lcd_panel_handle_t panel_handle = setup_panel(16);
+    const char *names[] = { "raw", "RLE", "QOI" };
+    memory_stream_t stream;
+    stream_stats_t stats;
+
+    make_stream_image();
+
+    for (int encoding = STREAM_ENCODING_RAW; encoding <= STREAM_ENCODING_QOI; ++encoding)
+    {
+        stream = (memory_stream_t){ .data = stream_data, .size = make_stream(encoding, STREAM_LINES, 0) };
+        CHECK(draw_image_stream(panel_handle, read_memory_stream, &stream, &stats) == DRAW_SUCCESS, "The %s stream was not drawn.", names[encoding]);
+        CHECK( (stats.bytes_read == stream.size) && (stats.pixels_drawn == STREAM_LINES * STREAM_WIDTH), "The %s stream read %llu of %lu bytes, drew %llu pixels.",
+            names[encoding], (unsigned long long)stats.bytes_read, (unsigned long)stream.size, (unsigned long long)stats.pixels_drawn);
+        CHECK(wrong_stream_pixels(STREAM_LINES) == 0, "%d pixels of the %s stream are wrong.", wrong_stream_pixels(STREAM_LINES), names[encoding]);
+
+        printf("%s stream: %llu bytes for %llu pixels, %.2f MB/s read, %.2f Mpixels/s drawn\n", names[encoding],
+            (unsigned long long)stats.bytes_read, (unsigned long long)stats.pixels_drawn, stats.bytes_read / (double)stats.total_us,
+            stats.pixels_drawn / (double)stats.total_us);
+
+        // Without a line count.
+        panel_handle = setup_panel(16);
+        stream = (memory_stream_t){ .data = stream_data, .size = make_stream(encoding, 300, 1) };
+        CHECK(draw_image_stream(panel_handle, read_memory_stream, &stream, &stats) == DRAW_SUCCESS, "The endless %s stream was not drawn.", names[encoding]);
+        CHECK(stats.pixels_drawn == 300 * STREAM_WIDTH, "The endless %s stream drew %llu pixels.", names[encoding], (unsigned long long)stats.pixels_drawn);
+        CHECK(wrong_stream_pixels(300) == 0, "%d pixels of the endless %s stream are wrong.", wrong_stream_pixels(300), names[encoding]);
+    }
+
+    // Cut inside a literal packet of the noise, and inside a QOI_OP_RGB chunk.
+    esp_log_level_set("*", ESP_LOG_NONE);
+
+    for (int encoding = STREAM_ENCODING_RLE; encoding <= STREAM_ENCODING_QOI; ++encoding)
+    {
+        panel_handle = setup_panel(16);
+        size_t size = make_stream(encoding, 100, 0);
+        size_t cut = size - 2;
+
+        if (encoding == STREAM_ENCODING_QOI)
+        {
+            while (stream_data[cut] != 0xFE)
+            {
+                --cut;
+            }
+            cut += 2;
+        }
+
+        stream = (memory_stream_t){ .data = stream_data, .size = cut };
+        CHECK(draw_image_stream(panel_handle, read_memory_stream, &stream, &stats) == DRAW_FAILURE, "The cut %s stream did not fail.", names[encoding]);
+        CHECK( (stats.pixels_drawn == 99 * STREAM_WIDTH) && (wrong_stream_pixels(99) == 0), "The cut %s stream drew %llu pixels, %d wrong.",
+            names[encoding], (unsigned long long)stats.pixels_drawn, wrong_stream_pixels(99));
+    }
+
+    esp_log_level_set("*", ESP_LOG_WARN);
+}
+
+// Baseline 4:2:0 JPEG of 24x24 pixels with a restart marker after every MCU, made with Pillow 12 at quality 90: sharp
+// gray bars, a checker and a diagonal line over a slow color tint. The reference is what libjpeg decodes it to, as
+// RGB565, the tint is slow enough for its smooth chroma upsampling to stay within a step of the boxes of the decoder.
+enum { REFERENCE_JPEG_SIZE = 24 };
+static const uint8_t reference_jpeg[675] = {
+    0xFF, 0xD8, 0xFF, 0xE0, 0x00, 0x10, 0x4A, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x01, 0x00, 0x00, 0xFF, 0xDB, 0x00, 0x43, 0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03,
+    0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0A, 0x07,
+    0x07, 0x06, 0x08, 0x0C, 0x0A, 0x0C, 0x0C, 0x0B, 0x0A, 0x0B, 0x0B, 0x0D, 0x0E, 0x12, 0x10, 0x0D,
+    0x0E, 0x11, 0x0E, 0x0B, 0x0B, 0x10, 0x16, 0x10, 0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0C, 0x0F,
+    0x17, 0x18, 0x16, 0x14, 0x18, 0x12, 0x14, 0x15, 0x14, 0xFF, 0xDB, 0x00, 0x43, 0x01, 0x03, 0x04,
+    0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0D, 0x0B, 0x0D, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0xFF, 0xC0,
+    0x00, 0x11, 0x08, 0x00, 0x18, 0x00, 0x18, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+    0x01, 0xFF, 0xC4, 0x00, 0x19, 0x00, 0x01, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x06, 0x01, 0x03, 0x08, 0xFF, 0xC4, 0x00, 0x34,
+    0x10, 0x00, 0x00, 0x04, 0x04, 0x04, 0x02, 0x05, 0x0D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x12, 0x13, 0x00, 0x07, 0x11, 0x14, 0x15, 0x21, 0x08,
+    0x16, 0x17, 0x24, 0x25, 0x22, 0x28, 0x31, 0x37, 0x38, 0x41, 0x45, 0x54, 0x61, 0x66, 0x82, 0x84,
+    0xB2, 0xC4, 0xFF, 0xC4, 0x00, 0x16, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x05, 0x07, 0xFF, 0xC4, 0x00, 0x1D, 0x11, 0x00,
+    0x02, 0x01, 0x05, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x03, 0x02, 0x05, 0x13, 0x15, 0x51, 0x12, 0x22, 0xFF, 0xDD, 0x00, 0x04, 0x00, 0x01, 0xFF,
+    0xDA, 0x00, 0x0C, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3F, 0x00, 0x8E, 0x99, 0x33,
+    0x05, 0x58, 0x67, 0x4C, 0x09, 0x1D, 0xF4, 0xFB, 0x0E, 0x42, 0x43, 0x3B, 0x68, 0x5B, 0x84, 0x54,
+    0x59, 0xDC, 0x45, 0x25, 0x58, 0x28, 0x5E, 0xFE, 0x54, 0xD5, 0x4D, 0xCF, 0x92, 0x00, 0x53, 0x85,
+    0x3A, 0x02, 0xA5, 0x4C, 0xFA, 0x8E, 0x94, 0xFA, 0x04, 0x77, 0xC8, 0x69, 0xFB, 0x54, 0xF2, 0xF9,
+    0xDF, 0xF7, 0xE2, 0xEB, 0x9F, 0x70, 0x86, 0xB0, 0x5C, 0xCD, 0x88, 0x66, 0x0B, 0xE6, 0xC8, 0xC5,
+    0xD9, 0x4A, 0xF2, 0xF3, 0x44, 0x57, 0x81, 0x38, 0x4C, 0x2D, 0xC4, 0x53, 0x7A, 0xB3, 0xD6, 0xC6,
+    0x21, 0x8E, 0x35, 0x01, 0x4A, 0x00, 0x71, 0x11, 0x01, 0x21, 0x80, 0xC1, 0xCB, 0x96, 0xBA, 0xE3,
+    0x9C, 0x81, 0x58, 0xD4, 0xA1, 0x9A, 0xB9, 0x81, 0x25, 0x48, 0xCB, 0x36, 0x84, 0x23, 0x34, 0x47,
+    0x1C, 0x41, 0x46, 0x1E, 0xE5, 0x32, 0xF0, 0xE0, 0x48, 0xEA, 0x39, 0x40, 0xA5, 0xA0, 0xA4, 0xB8,
+    0x95, 0x22, 0xE0, 0xA6, 0x28, 0xA4, 0x62, 0x94, 0xB4, 0x68, 0x24, 0x50, 0x04, 0x00, 0x11, 0x6D,
+    0xA8, 0x17, 0x5B, 0xA4, 0xF9, 0x47, 0xFF, 0xD0, 0xA3, 0x4E, 0xE9, 0xF9, 0x91, 0x65, 0xF7, 0x2F,
+    0x8E, 0x2B, 0xFD, 0xBE, 0xC3, 0x19, 0x80, 0xC6, 0xA0, 0xB3, 0x9E, 0x4B, 0x65, 0xEE, 0x5C, 0xCD,
+    0xCE, 0xD6, 0xCB, 0xB4, 0x14, 0x55, 0xE4, 0x51, 0xB4, 0xCD, 0x14, 0x4C, 0x8A, 0x43, 0x5D, 0x9D,
+    0x35, 0xDC, 0x14, 0x10, 0x4D, 0x50, 0x50, 0xA0, 0x06, 0xA5, 0x45, 0x04, 0xD7, 0x45, 0x31, 0x28,
+    0x90, 0x80, 0x05, 0x35, 0xD2, 0x8E, 0x18, 0x47, 0xB6, 0xA3, 0xA6, 0x9C, 0xE4, 0x47, 0xFF, 0xD1,
+    0x94, 0xEC, 0xEC, 0x3A, 0x37, 0x78, 0xBE, 0xFB, 0xAC, 0x5D, 0x4A, 0xF1, 0x9B, 0x36, 0x76, 0xBB,
+    0xDE, 0x27, 0xDC, 0x6D, 0xEB, 0x51, 0xED, 0xDA, 0xDA, 0xDC, 0xAB, 0x43, 0x57, 0x5D, 0x3A, 0x17,
+    0x4A, 0x85, 0xDB, 0xD0, 0x7A, 0x91, 0xE0, 0x3F, 0x66, 0x71, 0xDD, 0xE7, 0xEA, 0x6E, 0x6C, 0x5B,
+    0xFC, 0xED, 0xD7, 0xF4, 0xAB, 0xDF, 0x86, 0x18, 0x09, 0x9E, 0x4E, 0x97, 0x6D, 0xED, 0xF9, 0x47,
+    0xFF, 0xD2, 0x93, 0x3E, 0x5B, 0x93, 0xA4, 0xB2, 0x66, 0x8A, 0x1D, 0xE1, 0x60, 0x04, 0x9E, 0x03,
+    0x8C, 0x19, 0xB9, 0x90, 0xDD, 0x83, 0x40, 0x86, 0xF7, 0x11, 0x48, 0x46, 0xA2, 0x5C, 0xBB, 0xBA,
+    0xAE, 0xAD, 0x0B, 0x4D, 0x14, 0xE8, 0x6A, 0xAA, 0x06, 0x18, 0x60, 0x26, 0x79, 0x3A, 0x3C, 0x6D,
+    0x9F, 0xFF, 0xD9,
+};
+
+static const uint16_t reference_jpeg_pixels[REFERENCE_JPEG_SIZE * REFERENCE_JPEG_SIZE] = {
+    0xCDBE, 0xCD9D, 0xCD7D, 0x494D, 0x490C, 0x48EC, 0xDD5D, 0xDD5D, 0xE55D, 0x50CC, 0x58CC, 0x58CC,
+    0xE51D, 0xED1D, 0xED1D, 0x60AC, 0x60AC, 0x60AC, 0xED1E, 0xED1E, 0xED1E, 0x608C, 0x60AC, 0x58AC,
+    0xCDBE, 0xCDBE, 0xCD9E, 0x410C, 0x410C, 0x48EC, 0xE59E, 0xDD3D, 0xE55D, 0x50CC, 0x58CC, 0x58CC,
+    0xED3D, 0xED1D, 0xED1E, 0x60AC, 0x60AC, 0x60AC, 0xED1E, 0xED1D, 0xED1E, 0x60AC, 0x60AC, 0x60AC,
+    0xCDDE, 0xC59D, 0xCDBD, 0x410B, 0x492C, 0x490C, 0xDD5D, 0xDD5D, 0xE55D, 0x50CC, 0x58EC, 0x58CC,
+    0xED3D, 0xED3D, 0xED3D, 0x60AC, 0x60AC, 0x60AC, 0xED1E, 0xED1D, 0xED1E, 0x60AC, 0x60CC, 0x60AC,
+    0xC59D, 0xC57C, 0xD5FE, 0x414C, 0x410B, 0x48EB, 0xE59E, 0xDD7D, 0xE55D, 0x50EC, 0x58EC, 0x58CC,
+    0xED3D, 0xED3D, 0xED3D, 0x60CC, 0x60AC, 0x60AC, 0xF53D, 0xED1D, 0xF53D, 0x60AC, 0x60CC, 0x60CC,
+    0x1027, 0x1827, 0xCD9D, 0x412B, 0x492C, 0x490B, 0xDD7D, 0xDD7D, 0xE55D, 0x50EB, 0x58EC, 0x58EB,
+    0xED3D, 0xED3D, 0xED3D, 0x60CB, 0x60CB, 0x60CB, 0xF53D, 0xED3D, 0xF53D, 0x60AB, 0x60CB, 0x60CB,
+    0xC59C, 0x1026, 0x1826, 0x1806, 0x494B, 0x492B, 0xDD7D, 0xDD5C, 0xE57D, 0x50EB, 0x58EB, 0x58EB,
+    0xED3C, 0xED3C, 0xED3D, 0x60CB, 0x60CB, 0x60CB, 0xF53C, 0xED3C, 0xF53C, 0x60CB, 0x60CB, 0x60CB,
+    0xCE1D, 0xC59B, 0xD5FD, 0x1826, 0x1805, 0x2006, 0xDD9C, 0xE59D, 0xE57C, 0x510B, 0x590B, 0x58EB,
+    0xED5C, 0xED5C, 0xED5C, 0x60CB, 0x60CB, 0x60CB, 0xED3C, 0xED3C, 0xED3C, 0x60CB, 0x60CB, 0x60CB,
+    0xC5DB, 0xCE1C, 0xCDDC, 0x414A, 0x496B, 0x2005, 0x2005, 0x2805, 0xE59C, 0x510A, 0x590A, 0x590A,
+    0xED7C, 0xED5C, 0xED5C, 0x60EA, 0x60EA, 0x60EA, 0xED5C, 0xED5C, 0xED5C, 0x60CA, 0x60EA, 0x60EA,
+    0xC5FB, 0xC5FB, 0xD61C, 0x3949, 0x414A, 0x4949, 0xDDDC, 0x2804, 0x2805, 0x3005, 0x5109, 0x5109,
+    0xED7B, 0xED5B, 0xED7B, 0x610A, 0x60EA, 0x610A, 0xED5B, 0xED3B, 0xF57C, 0x60EA, 0x60EA, 0x610A,
+    0xCE1B, 0xC5FA, 0xCDFA, 0x4189, 0x4989, 0x4148, 0xDDDB, 0xDD9A, 0xEDFB, 0x2804, 0x2804, 0x3004,
+    0xEDBB, 0xE57A, 0xED7A, 0x58C8, 0x58E9, 0x60E9, 0xED5A, 0xF5BC, 0xED5B, 0x58C8, 0x60E9, 0x58E9,
+    0xCE3A, 0xCE1A, 0xD65B, 0x3968, 0x49A9, 0x4989, 0xD599, 0xE5FB, 0xDD99, 0x5969, 0x5108, 0x3003,
+    0x3004, 0x3003, 0xF5BB, 0x6129, 0x6108, 0x6109, 0xF59B, 0xED59, 0xF59B, 0x6129, 0x6109, 0x6149,
+    0xC619, 0xCE19, 0xCE19, 0x3987, 0x4188, 0x4967, 0xDDFA, 0xDDD9, 0xDDD9, 0x5988, 0x5148, 0x5127,
+    0xE599, 0x3823, 0x3002, 0x3803, 0x6969, 0x58E7, 0xED99, 0xED9A, 0xED79, 0x6128, 0x5907, 0x6108,
+    0xCE59, 0xCE79, 0xCE19, 0x4A08, 0xD5F8, 0xD5D8, 0x51A8, 0x4967, 0xE5F9, 0x4906, 0x5968, 0x6188,
+    0x5947, 0x6147, 0x5927, 0x3823, 0x3802, 0x3803, 0xED99, 0xFE1B, 0x5927, 0xF5B9, 0xEDB9, 0xEDB9,
+    0xC638, 0xCE58, 0xCE18, 0x3986, 0xD618, 0xDE59, 0x51C7, 0x5186, 0xE5F8, 0x59A8, 0x5166, 0x5146,
+    0x5946, 0x6187, 0x6187, 0xEDB8, 0x5926, 0x3822, 0x3802, 0x3001, 0x6147, 0xED98, 0xF5B9, 0xF5B8,
+    0xCE78, 0xC637, 0xD678, 0x41C6, 0xDE59, 0xD5F7, 0x5186, 0x5186, 0xDDF8, 0x5146, 0x5986, 0x59A7,
+    0x6187, 0x5926, 0x6187, 0xEDB7, 0x5946, 0x69A7, 0xEDB8, 0x3001, 0x3842, 0x3821, 0xEDB8, 0xEDB7,
+    0xC637, 0xD6B8, 0xCE37, 0x41E6, 0xD637, 0xDE37, 0x51C6, 0x51A6, 0xE618, 0x59C6, 0x5186, 0x59A6,
+    0x5145, 0x6186, 0x6166, 0xEDD7, 0x6186, 0x5945, 0xEDB7, 0xF5F7, 0x6165, 0x3020, 0x3821, 0x3821,
+    0x3A25, 0x3A05, 0x4205, 0xD677, 0x4A05, 0x49E5, 0xDE37, 0xDE36, 0x51C5, 0xE616, 0xE637, 0xE5F6,
+    0xE5F6, 0xEE17, 0xEDF6, 0x6185, 0xF617, 0xEDD6, 0x6165, 0x6185, 0xEDF7, 0x6185, 0x6185, 0x3840,
+    0x3A25, 0x4265, 0x4204, 0xCE55, 0x49E4, 0x4A05, 0xDE36, 0xDE56, 0x51E5, 0xE636, 0xE616, 0xE636,
+    0xEE16, 0xE616, 0xEE16, 0x61A5, 0xEDF6, 0xF616, 0x6184, 0x61A5, 0xEDD5, 0x69C5, 0x61A5, 0x5984,
+    0x3A24, 0x3A04, 0x4245, 0xD6B6, 0x4A04, 0x49E4, 0xE696, 0xDE56, 0x51C4, 0xE636, 0xE636, 0xE636,
+    0xEE16, 0xEE36, 0xEE16, 0x5984, 0xF616, 0xEE16, 0x69C5, 0x61A4, 0xF616, 0x61C5, 0x5984, 0x69E5,
+    0x3A44, 0x4244, 0x4224, 0xD695, 0x4A24, 0x49C3, 0xE696, 0xDE35, 0x5A04, 0xE635, 0xE676, 0xE635,
+    0xE635, 0xEE56, 0xEE15, 0x61E4, 0xF615, 0xF615, 0x61A3, 0x61A4, 0xF615, 0x5983, 0x61C4, 0x61A4,
+    0xCED5, 0xCEB4, 0xCEB5, 0x4243, 0xD695, 0xE6B6, 0x49C2, 0x5A24, 0xDE34, 0x5A03, 0x51C3, 0x5A04,
+    0x61E4, 0x59C3, 0x61E3, 0xEE14, 0x61C3, 0x61E4, 0xEE35, 0xEE14, 0x69E4, 0xF655, 0xE5F4, 0xF635,
+    0xCED4, 0xCED5, 0xCE94, 0x4222, 0xD694, 0xDE94, 0x49E2, 0x5223, 0xE695, 0x5203, 0x51E3, 0x59E3,
+    0x59E3, 0x59C3, 0x59C3, 0xF655, 0x59A2, 0x61E3, 0xEE14, 0xEE34, 0x61C3, 0xEE14, 0xF655, 0xF655,
+    0xCED4, 0xC693, 0xD6D4, 0x4A63, 0xDEB4, 0xD694, 0x5223, 0x5202, 0xDE54, 0x5203, 0x5A03, 0x59E2,
+    0x59E2, 0x61E3, 0x61E3, 0xEE34, 0x61E3, 0x61C2, 0xF675, 0xEE54, 0x61E3, 0xEE13, 0xEE54, 0xEE34,
+    0xCED4, 0xCEF4, 0xCED4, 0x4242, 0xD694, 0xDE94, 0x4A22, 0x5223, 0xE674, 0x5A03, 0x51E2, 0x5A03,
+    0x5A03, 0x59C2, 0x61E3, 0xEE54, 0x61C2, 0x61C2, 0xEE54, 0xEE34, 0x61C2, 0xF675, 0xEE13, 0xF674,
+};
+
+// The reference JPEG drawn at 5, 10 matches the libjpeg output within one step per channel, over partial MCUs on the
+// right and bottom and across its restart markers.
+static void check_jpeg(void)
+{
+    esp_lcd_panel_handle_t panel_handle = setup_panel(16);
+    memory_stream_t stream = { .data = reference_jpeg, .size = sizeof(reference_jpeg) };
+    jpeg_info_t info;
+
+    CHECK(draw_jpeg(panel_handle, read_memory_stream, &stream, 5, 10, JPEG_SCALE_1, &info) == DRAW_SUCCESS, "The reference JPEG was not drawn.");
+    CHECK( (info.width == REFERENCE_JPEG_SIZE) && (info.height == REFERENCE_JPEG_SIZE) && (info.components == 3) &&
+        (info.h_sampling == 2) && (info.v_sampling == 2), "The reference JPEG was read as %dx%d, %d components, %dx%d sampling.",
+        info.width, info.height, info.components, info.h_sampling, info.v_sampling);
+
+    const uint16_t *memory = get_stand_in_memory();
+    int wrong_pixels = 0;
+
+    for (int y = 0; y < REFERENCE_JPEG_SIZE; ++y)
+    {
+        for (int x = 0; x < REFERENCE_JPEG_SIZE; ++x)
+        {
+            uint16_t shown = COLOR_SWAP(memory[(10 + y + SCREEN_HEIGHT_PIXEL_MISALIGNMENT) * STAND_IN_MEMORY_WIDTH + 5 + x + SCREEN_WIDTH_PIXEL_MISALIGNMENT]);
+            uint16_t expected = reference_jpeg_pixels[y * REFERENCE_JPEG_SIZE + x];
+
+            wrong_pixels += (abs((shown >> 11) - (expected >> 11)) > 1) || (abs(((shown >> 5) & 63) - ((expected >> 5) & 63)) > 1) ||
+                (abs((shown & 31) - (expected & 31)) > 1);
+        }
+    }
+
+    CHECK(wrong_pixels == 0, "%d pixels of the reference JPEG are more than a step off.", wrong_pixels);
+}
+
+// Popup over a region: saved from what the screen shows, drawn over, then restored to the same pixels. Flat regions are
+// stored as runs, noise falls back to pixels. Released snapshots free their space once the ones after them are gone.
+static void check_snapshots(void)
+{
+    esp_lcd_panel_handle_t panel_handle = setup_panel(16);
+    static compositor_t compositor;
+    static uint8_t storage[48 * 1024];
+    static uint16_t noise[60 * 40];
+    snapshot_pool_t pool;
+    region_snapshot_t flat;
+    region_snapshot_t noisy;
+    region_snapshot_t nested[3];
+    pool_stats_t pool_before;
+    pool_stats_t pool_after;
+
+    get_pool_stats(&pool_before);
+
+    // A UI like screen, flat areas of a few colors.
+    compositor_init(&compositor, COLOR_SWAP(LCD_BLUE));
+    draw_t bounds = { .scale_x = 1, .scale_y = 1, .draw_start_x = 10, .draw_start_y = 20, .image_size_x = 80, .image_size_y = 50 };
+    add_layer_rect(&compositor, LAYER_CONTENT, bounds, COLOR_SWAP(LCD_RED));
+    bounds = (draw_t){ .scale_x = 1, .scale_y = 1, .draw_start_x = 40, .draw_start_y = 60, .image_size_x = 70, .image_size_y = 90 };
+    add_layer_rect(&compositor, LAYER_CONTENT, bounds, COLOR_SWAP(LCD_GREEN));
+    compose_damage(panel_handle, &compositor);
+    copy_screen();
+
+    pixel_source_t compositor_source = { .read_span = read_compositor_span, .source_ctx = &compositor };
+    draw_t region = { .scale_x = 1, .scale_y = 1, .draw_start_x = 0, .draw_start_y = 10, .image_size_x = 120, .image_size_y = 100 };
+
+    snapshot_pool_init(&pool, storage, sizeof(storage));
+    CHECK(save_region(&pool, &flat, region, &compositor_source) == DRAW_SUCCESS, "The flat region was not saved.");
+    CHECK(flat.compressed && (flat.stored_bytes < 120 * 100 * sizeof(uint16_t) / 4), "The flat region took %lu bytes.",
+        (unsigned long)flat.stored_bytes);
+
+    fill_rect(panel_handle, region, LCD_WHITE);
+    CHECK(restore_region(panel_handle, &pool, &flat) == DRAW_SUCCESS, "The flat region was not restored.");
+    CHECK(screen_matches_copy(), "The restored flat region differs.");
+    CHECK( (pool.used == 0) && (pool.live_snapshots == 0), "Restoring left %lu bytes in use.", (unsigned long)pool.used);
+
+    // Noise does not compress.
+    for (int i = 0; i < 60 * 40; ++i)
+    {
+        noise[i] = (uint16_t)(i * 2654435761UL >> 13);
+    }
+    draw_t noise_window = { .scale_x = 1, .scale_y = 1, .draw_start_x = 30, .draw_start_y = 150, .image_size_x = 60, .image_size_y = 40 };
+    draw_bgr_image(panel_handle, noise_window, noise);
+    copy_screen();
+
+    image_source_t frame = { .image_buffer = noise, .draw_params = noise_window };
+    pixel_source_t frame_source = { .read_span = read_image_span, .source_ctx = &frame };
+
+    CHECK(save_region(&pool, &noisy, noise_window, &frame_source) == DRAW_SUCCESS, "The noise was not saved.");
+    CHECK(!noisy.compressed && (noisy.stored_bytes == 60 * 40 * sizeof(uint16_t)), "The noise took %lu bytes, %s.",
+        (unsigned long)noisy.stored_bytes, noisy.compressed ? "compressed" : "raw");
+
+    fill_rect(panel_handle, noise_window, LCD_WHITE);
+    CHECK(restore_region(panel_handle, &pool, &noisy) == DRAW_SUCCESS, "The noise was not restored.");
+    CHECK(screen_matches_copy(), "The restored noise differs.");
+
+    // Nested popups released out of order.
+    for (int i = 0; i < 3; ++i)
+    {
+        CHECK(save_region(&pool, &nested[i], noise_window, &frame_source) == DRAW_SUCCESS, "Nested region %d was not saved.", i);
+    }
+    uint32_t first_end = nested[1].offset;
+
+    release_region(&pool, &nested[1]);
+    CHECK(pool.used == nested[2].offset + nested[2].stored_bytes, "Releasing the middle snapshot moved the end.");
+    release_region(&pool, &nested[2]);
+    CHECK(pool.used == first_end, "Releasing the top snapshot left the end at %lu, not %lu.", (unsigned long)pool.used, (unsigned long)first_end);
+    release_region(&pool, &nested[0]);
+    CHECK( (pool.used == 0) && (pool.bytes_in_use == 0), "Releasing all snapshots left %lu bytes in use.", (unsigned long)pool.bytes_in_use);
+
+    get_pool_stats(&pool_after);
+    CHECK(pool_after.in_use == pool_before.in_use, "%d pool blocks not returned.", pool_after.in_use - pool_before.in_use);
+}
+
+
+// Frame render callback that notes when and as which slot it ran, then keeps the frame busy for busy_us.
+typedef struct {
+    int64_t start_us[110];
+    uint32_t frame_number[110];
+    int frames;
+    int64_t busy_us;
+} frame_log_t;
+
+static void log_frame(esp_lcd_panel_handle_t panel_handle, uint32_t frame_number, void *user_ctx)
+{
+    frame_log_t *log = (frame_log_t *)user_ctx;
+    int64_t start_us = esp_timer_get_time();
+
+    log->start_us[log->frames] = start_us;
+    log->frame_number[log->frames] = frame_number;
+    log->frames += 1;
+
+    while (esp_timer_get_time() - start_us < log->busy_us)
+    {
+    }
+}
+
+// Frames start on their slot and never before it, also when the wait left over after the whole ticks is below one. A
+// frame 2.5 slots long drops the two slots it overran, and the frame after it starts on the next slot boundary. The
+// p99 frame time is the second longest of 100 frames.
+static void check_frame_pacing(void)
+{
+    esp_lcd_panel_handle_t panel_handle = setup_panel(16);
+    static frame_scheduler_t scheduler;
+    static frame_log_t log;
+    frame_stats_t stats;
+
+    // 90 fps is a period of 11111 us, not a whole amount of 1 ms ticks.
+    const int64_t period_us = 1000000 / 90;
+    CHECK(frame_scheduler_init(&scheduler, panel_handle, 90) == FRAME_SUCCESS, "The frame scheduler was not set up.");
+    CHECK(add_render_callback(&scheduler, log_frame, &log) == FRAME_SUCCESS, "The render callback was not added.");
+
+    // Slot n is due n periods after the first frame started.
+    log.busy_us = 200;
+    run_frame(&scheduler);
+    int64_t first_slot_us = scheduler.frame_start_us;
+
+    for (int i = 0; i < 9; ++i)
+    {
+        run_frame(&scheduler);
+    }
+
+    // Then one frame over budget.
+    log.busy_us = period_us * 5 / 2;
+    run_frame(&scheduler);
+    log.busy_us = 200;
+    run_frame(&scheduler);
+
+    get_frame_stats(&scheduler, &stats);
+    CHECK(stats.dropped == 2, "A frame of 2.5 slots dropped %lu slots.", (unsigned long)stats.dropped);
+    CHECK(log.frame_number[log.frames - 1] == log.frame_number[log.frames - 2] + 3, "The frame after the slow one is slot %lu, not %lu.",
+        (unsigned long)log.frame_number[log.frames - 1], (unsigned long)log.frame_number[log.frames - 2] + 3);
+
+    int early_frames = 0;
+    for (int i = 0; i < log.frames; ++i)
+    {
+        early_frames += log.start_us[i] < first_slot_us + log.frame_number[i] * period_us;
+    }
+    CHECK(early_frames == 0, "%d of %d frames started before their slot.", early_frames, log.frames);
+
+    // 98 short frames and two long ones, in budget.
+    reset_frame_stats(&scheduler);
+    log.frames = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        log.busy_us = (i == 30) || (i == 70) ? 5000 : 200;
+        run_frame(&scheduler);
+    }
+
+    get_frame_stats(&scheduler, &stats);
+    CHECK( (stats.frames == 100) && (stats.dropped == 0), "%lu frames, %lu dropped.", (unsigned long)stats.frames, (unsigned long)stats.dropped);
+    CHECK( (stats.p99_us >= 5000) && (stats.p99_us < 8000), "The p99 frame time is %lld us.", (long long)stats.p99_us);
+    CHECK( (stats.min_us >= 200) && (stats.min_us < 5000), "The shortest frame took %lld us.", (long long)stats.min_us);
+    CHECK(stats.max_us >= 5000, "The longest frame took %lld us.", (long long)stats.max_us);
+}
+
+// Every kind of draw call, with buffers of the caller only: fills, plain, scaled and converted images, letters and
+// numbers, a batch, async draws and the hardware scroll.
+static void draw_benchmark_scene(esp_lcd_panel_handle_t panel_handle)
+{
+    static uint16_t letter_font[LETTER_FONT_PIXELS];
+    static uint16_t number_font[NUMBER_FONT_PIXELS];
+    static uint16_t image[48 * 32];
+    static uint8_t rgb888_image[24 * 24 * 3];
+    static uint16_t rgb565_image[24 * 24];
+    glyph_t letters = { 0 };
+    glyph_t numbers = { 0 };
+    draw_fence_t fence;
+
+    for (int i = 0; i < 48 * 32; ++i)
+    {
+        image[i] = COLOR_SWAP((uint16_t)(i * 97));
+    }
+    for (int i = 0; i < 24 * 24; ++i)
+    {
+        rgb565_image[i] = (uint16_t)(i * 31);
+        rgb888_image[i * 3] = i;
+        rgb888_image[i * 3 + 1] = i * 3;
+        rgb888_image[i * 3 + 2] = 255 - i;
+    }
+
+    fill_display(panel_handle, LCD_BLUE);
+
+    draw_t rect = { .scale_x = 1, .scale_y = 1, .draw_start_x = 10, .draw_start_y = 10, .image_size_x = 60, .image_size_y = 40 };
+    fill_rect(panel_handle, rect, LCD_RED);
+
+    draw_t window = { .scale_x = 1, .scale_y = 1, .draw_start_x = 70, .draw_start_y = 10, .image_size_x = 48, .image_size_y = 32 };
+    draw_bgr_image(panel_handle, window, image);
+    window.draw_start_y = 50;
+    window.scale_x = 2;
+    window.scale_y = 2;
+    window.image_size_x = 24;
+    window.image_size_y = 16;
+    draw_bgr_image(panel_handle, window, image);
+
+    image_t converted = { .format = PIXEL_FORMAT_RGB565, .width = 24, .height = 24, .pixels = rgb565_image };
+    draw_image(panel_handle, 10, 60, &converted);
+    converted.format = PIXEL_FORMAT_RGB888;
+    converted.pixels = rgb888_image;
+    draw_image(panel_handle, 40, 60, &converted);
+
+    load_bitmap_letter_font(&letters, letter_font, LCD_WHITE, LCD_BLACK);
+    load_bitmap_numbers_font(&numbers, number_font, LCD_GREEN, LCD_BLACK);
+    letters.glyph_start_x = 5;
+    letters.glyph_start_y = 100;
+    letters.glyph_spacing = 1;
+    letters.glyph_scale = 2;
+    CHECK(draw_glyphs(panel_handle, letters, letter_font, "benchmark", 9) == DRAW_SUCCESS, "The benchmark text was not drawn.");
+
+    numbers.glyph_start_x = 5;
+    numbers.glyph_start_y = 120;
+    numbers.glyph_spacing = 1;
+    numbers.glyph_scale = 1;
+    begin_batch(1, LCD_BLACK);
+    for (int line = 0; line < 4; ++line)
+    {
+        CHECK(draw_number(panel_handle, numbers, number_font, -1234567 * (line + 1)) == DRAW_SUCCESS, "The benchmark numbers were not drawn.");
+        numbers.glyph_start_y += 6;
+    }
+    end_batch();
+
+    for (int i = 0; i < 8; ++i)
+    {
+        draw_t async_rect = { .scale_x = 1, .scale_y = 1, .draw_start_x = 10 * i, .draw_start_y = 160, .image_size_x = 10, .image_size_y = 20 };
+        fill_rect_async(panel_handle, async_rect, i * 0x1111, &fence);
+    }
+    window = (draw_t){ .scale_x = 1, .scale_y = 1, .draw_start_x = 80, .draw_start_y = 190, .image_size_x = 48, .image_size_y = 32 };
+    draw_bgr_image_async(panel_handle, window, image, &fence);
+    wait_for_fence(fence);
+
+    set_vertical_scroll(0, SCREEN_HEIGHT, 8);
+    set_vertical_scroll(0, SCREEN_HEIGHT, 0);
+    wait_for_draws();
+}
+
+
+#ifdef GRAPHICS_RECORDER
+static int write_to_file(void *write_ctx, const uint8_t *data, int size)
+{
+    return fwrite(data, 1, size, (FILE *)write_ctx);
+}
+
+
+// Writes a recording of the benchmark scene.
+static int record_benchmark_scene(const char *path)
+{
+    esp_lcd_panel_handle_t panel_handle = setup_panel(16);
+    FILE *file = fopen(path, "wb");
+
+    if (file == NULL)
+    {
+        printf("Cannot create %s.\n", path);
+        return 1;
+    }
+
+    draw_benchmark_scene(panel_handle);
+    int result = dump_draw_record(write_to_file, file);
+    fclose(file);
+
+    return result;
+}
+#endif
+
+
+// The benchmark scene in both bus modes. A GRAPHICS_NO_HEAP build must not have called the allocator at all.
+static void check_benchmark_allocations(void)
+{
+    draw_benchmark_scene(setup_panel(16));
+    draw_benchmark_scene(setup_panel(12));
+
+#ifdef GRAPHICS_NO_HEAP
+    CHECK(get_stand_in_allocations() == 0, "The GRAPHICS_NO_HEAP build allocated %lu times.", (unsigned long)get_stand_in_allocations());
+#endif
+}
+
+
+int main(int argc, char **argv)
+{
+    // Only warnings and errors, so the errors of a failing check stand out.
+    esp_log_level_set("*", ESP_LOG_WARN);
+
+#ifdef GRAPHICS_RECORDER
+    if ( (argc == 3) && (strcmp(argv[1], "--record") == 0) )
+    {
+        return record_benchmark_scene(argv[2]);
+    }
+#endif
+
+    check_rgb444();
+    check_pixel_formats();
+    check_blit_opaque_runs();
+    check_aa_text();
+    check_font_blob_bounds();
+    check_number_text();
+    check_batched_text();
+    check_async_fills();
+    check_fence_callbacks();
+    check_async_in_flight();
+    check_display_settings();
+    check_damage_merging();
+    check_tilemap();
+    check_sprites();
+    check_frame_differ();
+    check_chart();
+    check_image_stream();
+    check_jpeg();
+    check_snapshots();
+    check_frame_pacing();
+    check_benchmark_allocations();
+
+    if (failures > 0)
+    {
+        printf("%d checks failed.\n", failures);
+        return 1;
+    }
+
+    printf("All checks passed.\n");
+    return 0;
+}
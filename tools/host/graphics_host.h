@@ -0,0 +1,219 @@
+#ifndef GRAPHICS_HOST_H
+#define GRAPHICS_HOST_H
+
+// Host builds of graphics.c, define GRAPHICS_HOST_BUILD and add tools/host to the include path. The parts of ESP-IDF
+// the library uses are stood in for by tools/host/stand_in_panel.c, which keeps the panel memory in a buffer and
+// finishes every transfer after the time its bytes take at the pixel clock. Nothing here is meant for anything but
+// tools and tests.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+// esp_system.h, esp_log.h, esp_attr.h and esp_timer.h.
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERROR_CHECK(x) do { esp_err_t error_ = (x); if (error_ != ESP_OK) abort(); } while (0)
+
+// One log level for all tags, Ex: checks turn logging off around calls that are meant to fail.
+typedef enum {
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE,
+} esp_log_level_t;
+
+extern esp_log_level_t stand_in_log_level;
+void esp_log_level_set(const char *tag, esp_log_level_t level);
+
+#define STAND_IN_LOG(level, letter, tag, format, ...) \
+    do { \
+        if (stand_in_log_level >= (level)) \
+        { \
+            fprintf(stderr, letter " %s: " format "\n", tag, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+#define ESP_LOGE(tag, format, ...) STAND_IN_LOG(ESP_LOG_ERROR, "E", tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) STAND_IN_LOG(ESP_LOG_WARN, "W", tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) STAND_IN_LOG(ESP_LOG_INFO, "I", tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) ((void)0)
+
+#define DMA_ATTR
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+int64_t esp_timer_get_time(void);
+
+// FreeRTOS, single task on a single core: critical sections do nothing and taking a semaphore waits for a transfer.
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+#define pdTRUE 1
+#define pdFALSE 0
+#define portMAX_DELAY 0xFFFFFFFFUL
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+typedef struct {
+    int unused;
+} portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED { 0 }
+#define portENTER_CRITICAL(lock) ((void)(lock))
+#define portEXIT_CRITICAL(lock) ((void)(lock))
+
+typedef struct {
+    int count;
+} StaticSemaphore_t;
+typedef StaticSemaphore_t *SemaphoreHandle_t;
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *buffer);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks);
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t *high_task_woken);
+void vTaskDelay(TickType_t ticks);
+
+// Every host thread is a task of its own.
+typedef void *TaskHandle_t;
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+
+#define portNUM_PROCESSORS 1
+#define xPortGetCoreID() 0
+
+// esp_heap_caps.h, driver/gpio.h and driver/spi_master.h.
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+void *heap_caps_malloc(size_t size, uint32_t caps);
+void heap_caps_free(void *memory);
+
+// Allocations made through these headers are counted, Ex: a GRAPHICS_NO_HEAP build must not make any. Tools undefine
+// malloc, calloc, realloc and free after including graphics.h, so only the library is counted.
+void *stand_in_malloc(size_t size);
+void *stand_in_calloc(size_t amount, size_t size);
+void *stand_in_realloc(void *memory, size_t size);
+void stand_in_free(void *memory);
+uint32_t get_stand_in_allocations(void);
+
+#define malloc(size) stand_in_malloc(size)
+#define calloc(amount, size) stand_in_calloc(amount, size)
+#define realloc(memory, size) stand_in_realloc(memory, size)
+#define free(memory) stand_in_free(memory)
+
+typedef enum {
+    GPIO_MODE_OUTPUT = 2,
+} gpio_mode_t;
+
+typedef struct {
+    uint64_t pin_bit_mask;
+    gpio_mode_t mode;
+} gpio_config_t;
+
+esp_err_t gpio_config(const gpio_config_t *config);
+esp_err_t gpio_set_level(int pin, uint32_t level);
+
+typedef enum {
+    SPI_DMA_DISABLED = 0,
+    SPI_DMA_CH_AUTO = 3,
+} spi_dma_chan_t;
+
+typedef int spi_host_device_t;
+
+typedef struct {
+    int mosi_io_num;
+    int miso_io_num;
+    int sclk_io_num;
+    int quadwp_io_num;
+    int quadhd_io_num;
+    int max_transfer_sz;
+} spi_bus_config_t;
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t *config, spi_dma_chan_t dma_channel);
+
+// soc/soc_caps.h, the stand-in only has an SPI bus.
+#define SOC_LCD_I80_SUPPORTED 0
+
+// esp_lcd.
+typedef struct stand_in_panel_t *esp_lcd_panel_handle_t;
+typedef struct stand_in_panel_t *esp_lcd_panel_io_handle_t;
+typedef int esp_lcd_spi_bus_handle_t;
+
+typedef enum {
+    LCD_RGB_ENDIAN_RGB,
+    LCD_RGB_ENDIAN_BGR,
+} lcd_rgb_endian_t;
+
+typedef struct {
+    int unused;
+} esp_lcd_panel_io_event_data_t;
+
+typedef bool (*esp_lcd_panel_io_color_trans_done_cb_t)(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t *event_data, void *user_ctx);
+
+typedef struct {
+    int cs_gpio_num;
+    int dc_gpio_num;
+    int spi_mode;
+    unsigned int pclk_hz;
+    size_t trans_queue_depth;
+    esp_lcd_panel_io_color_trans_done_cb_t on_color_trans_done;
+    void *user_ctx;
+    int lcd_cmd_bits;
+    int lcd_param_bits;
+} esp_lcd_panel_io_spi_config_t;
+
+typedef struct {
+    int reset_gpio_num;
+    lcd_rgb_endian_t rgb_endian;
+    unsigned int bits_per_pixel;
+} esp_lcd_panel_dev_config_t;
+
+#define LCD_CMD_CASET 0x2A
+#define LCD_CMD_RASET 0x2B
+#define LCD_CMD_RAMWR 0x2C
+#define LCD_CMD_VSCRDEF 0x33
+#define LCD_CMD_MADCTL 0x36
+#define LCD_CMD_VSCSAD 0x37
+#define LCD_CMD_COLMOD 0x3A
+
+esp_err_t esp_lcd_new_panel_io_spi(esp_lcd_spi_bus_handle_t bus, const esp_lcd_panel_io_spi_config_t *config, esp_lcd_panel_io_handle_t *io);
+esp_err_t esp_lcd_panel_io_tx_param(esp_lcd_panel_io_handle_t io, int command, const void *parameters, size_t size);
+esp_err_t esp_lcd_panel_io_tx_color(esp_lcd_panel_io_handle_t io, int command, const void *color, size_t size);
+esp_err_t esp_lcd_new_panel_st7789(esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *config, esp_lcd_panel_handle_t *panel);
+esp_err_t esp_lcd_panel_reset(esp_lcd_panel_handle_t panel);
+esp_err_t esp_lcd_panel_init(esp_lcd_panel_handle_t panel);
+esp_err_t esp_lcd_panel_disp_on_off(esp_lcd_panel_handle_t panel, bool on);
+esp_err_t esp_lcd_panel_invert_color(esp_lcd_panel_handle_t panel, bool invert);
+esp_err_t esp_lcd_panel_draw_bitmap(esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end, const void *color);
+
+
+// Stand-in panel memory, STAND_IN_MEMORY_WIDTH * STAND_IN_MEMORY_HEIGHT pixels in the byte order they were sent, which
+// is BGR565 for the library. 12 bit pixels are widened back to 16 bits. Screen pixel x, y is at
+// x + SCREEN_WIDTH_PIXEL_MISALIGNMENT, y + SCREEN_HEIGHT_PIXEL_MISALIGNMENT.
+#define STAND_IN_MEMORY_WIDTH 320
+#define STAND_IN_MEMORY_HEIGHT 320
+
+const uint16_t *get_stand_in_memory(void);
+
+// Frame memory line the panel shows on a display line, moved by the vertical scroll set with VSCRDEF and VSCSAD. The
+// scroll area shows its lines from the VSCSAD line on, wrapping around to the top of the area.
+int get_stand_in_shown_line(int display_line);
+
+// Queue of the stand-in panel since the display was set up. A transfer queued while depth transfers are still being
+// sent waits for the oldest, like the SPI driver does, and counts as a full queue wait.
+typedef struct {
+    int depth;
+    int high_water;             // Most transfers queued at the same time.
+    uint32_t full_queue_waits;
+} stand_in_queue_stats_t;
+
+void get_stand_in_queue_stats(stand_in_queue_stats_t *stats);
+
+// Reports the transfers done by now. Transfers are otherwise only reported done when the library queues or waits, so
+// code polling for them calls this in between, where the transfer done interrupt would have run.
+void finish_stand_in_transfers(void);
+
+#endif
@@ -0,0 +1,31 @@
+#!/bin/sh
+# Builds the library for the host with the shims in tools/host and runs its checks. Needs a C compiler as cc,
+# or set CC. Exits with an error if anything fails.
+set -e
+
+cd "$(dirname "$0")/../.."
+CC=${CC:-cc}
+out=${TMPDIR:-/tmp}/graphics_checks
+mkdir -p "$out"
+
+# Warnings fail the build, the library must compile cleanly.
+flags="-std=gnu11 -O1 -Wall -Werror -DGRAPHICS_HOST_BUILD -DGRAPHICS_BOARD=0 -Icode -Itools/host"
+sources="code/graphics.c code/graphics_blit.c code/graphics_chart.c code/graphics_diff.c code/graphics_font.c code/graphics_font_data.c code/graphics_frame.c code/graphics_jpeg.c code/graphics_layer.c code/graphics_snapshot.c code/graphics_sprite.c code/graphics_stream.c code/graphics_tilemap.c code/graphics_widget.c tools/host/stand_in_panel.c"
+
+$CC $flags -DGRAPHICS_RECORDER tools/host/check_graphics.c $sources -o "$out/check_graphics" -lm
+"$out/check_graphics"
+
+# Without a heap: the checks again, then the recorded benchmark scene replayed. Both fail on any allocator call.
+$CC $flags -DGRAPHICS_NO_HEAP tools/host/check_graphics.c $sources -o "$out/check_graphics_no_heap" -lm
+"$out/check_graphics_no_heap"
+
+$CC $flags -DGRAPHICS_RECORDER -DGRAPHICS_NO_HEAP tools/replay_draws.c code/graphics.c tools/host/stand_in_panel.c -o "$out/replay_draws_no_heap"
+"$out/check_graphics" --record "$out/benchmark.bin"
+"$out/replay_draws_no_heap" "$out/benchmark.bin" > "$out/benchmark_replay.txt" 2>&1 || { cat "$out/benchmark_replay.txt"; exit 1; }
+echo "Benchmark replayed without allocations."
+
+# The JPEG benchmark is only built, it needs a file to decode. The SPI model uses the library's headers and runs a
+# batched 12 bit scenario.
+$CC $flags tools/jpeg_bench.c code/graphics_jpeg.c code/graphics_stream.c code/graphics.c tools/host/stand_in_panel.c -o "$out/jpeg_bench"
+$CC $flags tools/spi_model.c -o "$out/spi_model"
+"$out/spi_model" --bits 12 --batch 4 --frames 2 dashboard > "$out/spi_model.txt" || { cat "$out/spi_model.txt"; exit 1; }
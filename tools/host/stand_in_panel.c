@@ -0,0 +1,466 @@
+// Stand-in for the parts of ESP-IDF graphics.c uses, see graphics_host.h. Transfers are written into the panel memory
+// right away, but reported done only once the pixel clock could have sent them, one after the other like the SPI
+// queue does. Waiting on the done semaphore sleeps until the oldest transfer is done. Like esp_lcd, color transfers
+// longer than the max transfer size of the bus are queued in several transactions.
+
+#include "graphics_host.h"
+
+#include <string.h>
+#include <time.h>
+
+
+// Transfers queued at most, the largest queue depth of graphics.h.
+#define STAND_IN_MAX_QUEUED 64
+
+struct stand_in_panel_t {
+    esp_lcd_panel_io_color_trans_done_cb_t on_color_trans_done;
+    void *user_ctx;
+
+    // Memory write window, ends included, and where the next pixel goes.
+    int x_start;
+    int x_end;
+    int y_start;
+    int y_end;
+    int x;
+    int y;
+    int packed;                 // COLMOD set 12 bit pixels.
+
+    // Vertical scroll of VSCRDEF and VSCSAD: fixed lines on top, lines in the scroll area and the first one shown.
+    int top_fixed_lines;
+    int scroll_lines;
+    int scroll_start;
+
+    // Times the queued transactions are done at, oldest first. Only the last one of a color transfer reports it done.
+    unsigned int pixel_clock_hz;
+    int queue_depth;
+    size_t max_transfer_size;
+    int64_t done_us[STAND_IN_MAX_QUEUED];
+    int last_of_transfer[STAND_IN_MAX_QUEUED];
+    int queued_first;
+    int queued_amount;
+    int queued_high_water;
+    uint32_t full_queue_waits;
+};
+
+static struct stand_in_panel_t stand_in_panel;
+static size_t stand_in_bus_max_transfer_size = 0;
+static uint16_t stand_in_memory[STAND_IN_MEMORY_WIDTH * STAND_IN_MEMORY_HEIGHT];
+
+
+const uint16_t *get_stand_in_memory(void)
+{
+    return stand_in_memory;
+}
+
+
+int get_stand_in_shown_line(int display_line)
+{
+    const struct stand_in_panel_t *panel = &stand_in_panel;
+    int scroll_line = display_line - panel->top_fixed_lines;
+
+    if ( (panel->scroll_lines == 0) || (scroll_line < 0) || (scroll_line >= panel->scroll_lines) )
+    {
+        return display_line;
+    }
+
+    return panel->top_fixed_lines + (scroll_line + panel->scroll_start - panel->top_fixed_lines) % panel->scroll_lines;
+}
+
+
+void get_stand_in_queue_stats(stand_in_queue_stats_t *stats)
+{
+    stats->depth = stand_in_panel.queue_depth;
+    stats->high_water = stand_in_panel.queued_high_water;
+    stats->full_queue_waits = stand_in_panel.full_queue_waits;
+}
+
+
+esp_log_level_t stand_in_log_level = ESP_LOG_INFO;
+
+void esp_log_level_set(const char *tag, esp_log_level_t level)
+{
+    stand_in_log_level = level;
+}
+
+
+int64_t esp_timer_get_time(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+
+static void sleep_until(int64_t time_us)
+{
+    struct timespec until = { .tv_sec = time_us / 1000000, .tv_nsec = (time_us % 1000000) * 1000 };
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &until, NULL) != 0)
+    {
+    }
+}
+
+
+static void color_done(struct stand_in_panel_t *panel)
+{
+    if (panel->on_color_trans_done != NULL)
+    {
+        panel->on_color_trans_done(panel, NULL, panel->user_ctx);
+    }
+}
+
+
+// Reports the oldest queued transfer done, after sleeping until it is if wait is set. Returns 0 if it is not done.
+static int finish_oldest(struct stand_in_panel_t *panel, int wait)
+{
+    if (panel->queued_amount == 0)
+    {
+        return 0;
+    }
+
+    int64_t done_us = panel->done_us[panel->queued_first];
+    if (done_us > esp_timer_get_time())
+    {
+        if (!wait)
+        {
+            return 0;
+        }
+        sleep_until(done_us);
+    }
+
+    int last_of_transfer = panel->last_of_transfer[panel->queued_first];
+    panel->queued_first = (panel->queued_first + 1) % STAND_IN_MAX_QUEUED;
+    panel->queued_amount -= 1;
+    if (last_of_transfer)
+    {
+        color_done(panel);
+    }
+
+    return 1;
+}
+
+
+void finish_stand_in_transfers(void)
+{
+    while (finish_oldest(&stand_in_panel, 0))
+    {
+    }
+}
+
+
+SemaphoreHandle_t xSemaphoreCreateBinaryStatic(StaticSemaphore_t *buffer)
+{
+    buffer->count = 0;
+    return buffer;
+}
+
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks)
+{
+    // The only semaphore waited on is given when a transfer is done, so waiting means the oldest one is finished.
+    if (semaphore->count == 0)
+    {
+        finish_oldest(&stand_in_panel, 1);
+    }
+
+    if (semaphore->count > 0)
+    {
+        semaphore->count -= 1;
+    }
+
+    return pdTRUE;
+}
+
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t *high_task_woken)
+{
+    semaphore->count = 1;
+    *high_task_woken = pdFALSE;
+
+    return pdTRUE;
+}
+
+
+// Like FreeRTOS, wakes on the ticks'th tick interrupt from now, which is less than ticks whole periods away.
+void vTaskDelay(TickType_t ticks)
+{
+    int64_t tick_us = portTICK_PERIOD_MS * 1000;
+
+    sleep_until((esp_timer_get_time() / tick_us + ticks) * tick_us);
+}
+
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    static __thread char task;
+
+    return &task;
+}
+
+
+// The allocator of the host, counted.
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+
+static uint32_t stand_in_allocations = 0;
+
+
+void *stand_in_malloc(size_t size)
+{
+    stand_in_allocations += 1;
+    return malloc(size);
+}
+
+
+void *stand_in_calloc(size_t amount, size_t size)
+{
+    stand_in_allocations += 1;
+    return calloc(amount, size);
+}
+
+
+void *stand_in_realloc(void *memory, size_t size)
+{
+    stand_in_allocations += 1;
+    return realloc(memory, size);
+}
+
+
+void stand_in_free(void *memory)
+{
+    free(memory);
+}
+
+
+uint32_t get_stand_in_allocations(void)
+{
+    return stand_in_allocations;
+}
+
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    return stand_in_malloc(size);
+}
+
+
+void heap_caps_free(void *memory)
+{
+    free(memory);
+}
+
+
+esp_err_t gpio_config(const gpio_config_t *config)
+{
+    return ESP_OK;
+}
+
+
+esp_err_t gpio_set_level(int pin, uint32_t level)
+{
+    return ESP_OK;
+}
+
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t *config, spi_dma_chan_t dma_channel)
+{
+    stand_in_bus_max_transfer_size = config->max_transfer_sz;
+    return ESP_OK;
+}
+
+
+esp_err_t esp_lcd_new_panel_io_spi(esp_lcd_spi_bus_handle_t bus, const esp_lcd_panel_io_spi_config_t *config, esp_lcd_panel_io_handle_t *io)
+{
+    memset(&stand_in_panel, 0, sizeof(stand_in_panel));
+    stand_in_panel.on_color_trans_done = config->on_color_trans_done;
+    stand_in_panel.user_ctx = config->user_ctx;
+    stand_in_panel.pixel_clock_hz = config->pclk_hz;
+    stand_in_panel.max_transfer_size = stand_in_bus_max_transfer_size > 0 ? stand_in_bus_max_transfer_size : 4092;
+    stand_in_panel.queue_depth = config->trans_queue_depth < STAND_IN_MAX_QUEUED ? config->trans_queue_depth : STAND_IN_MAX_QUEUED;
+    if (stand_in_panel.queue_depth < 1)
+    {
+        stand_in_panel.queue_depth = 1;
+    }
+    *io = &stand_in_panel;
+
+    return ESP_OK;
+}
+
+
+esp_err_t esp_lcd_new_panel_st7789(esp_lcd_panel_io_handle_t io, const esp_lcd_panel_dev_config_t *config, esp_lcd_panel_handle_t *panel)
+{
+    *panel = io;
+    return ESP_OK;
+}
+
+
+esp_err_t esp_lcd_panel_reset(esp_lcd_panel_handle_t panel)
+{
+    memset(stand_in_memory, 0, sizeof(stand_in_memory));
+    return ESP_OK;
+}
+
+
+esp_err_t esp_lcd_panel_init(esp_lcd_panel_handle_t panel)
+{
+    return ESP_OK;
+}
+
+
+esp_err_t esp_lcd_panel_disp_on_off(esp_lcd_panel_handle_t panel, bool on)
+{
+    return ESP_OK;
+}
+
+
+esp_err_t esp_lcd_panel_invert_color(esp_lcd_panel_handle_t panel, bool invert)
+{
+    return ESP_OK;
+}
+
+
+// Writes a pixel at the memory write position and moves it on, wrapping inside the window like the ST7789 does.
+static void write_pixel(struct stand_in_panel_t *panel, uint16_t pixel)
+{
+    if ( (panel->x < STAND_IN_MEMORY_WIDTH) && (panel->y < STAND_IN_MEMORY_HEIGHT) )
+    {
+        stand_in_memory[panel->y * STAND_IN_MEMORY_WIDTH + panel->x] = pixel;
+    }
+
+    if (++panel->x > panel->x_end)
+    {
+        panel->x = panel->x_start;
+        if (++panel->y > panel->y_end)
+        {
+            panel->y = panel->y_start;
+        }
+    }
+}
+
+
+esp_err_t esp_lcd_panel_io_tx_param(esp_lcd_panel_io_handle_t io, int command, const void *parameters, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t *)parameters;
+
+    // Parameters are polled writes, which wait for the queue to drain first.
+    while (finish_oldest(io, 1))
+    {
+    }
+
+    if ( (command == LCD_CMD_CASET) && (size == 4) )
+    {
+        io->x_start = (bytes[0] << 8) | bytes[1];
+        io->x_end = (bytes[2] << 8) | bytes[3];
+    }
+    else if ( (command == LCD_CMD_RASET) && (size == 4) )
+    {
+        io->y_start = (bytes[0] << 8) | bytes[1];
+        io->y_end = (bytes[2] << 8) | bytes[3];
+    }
+    else if ( (command == LCD_CMD_VSCRDEF) && (size == 6) )
+    {
+        io->top_fixed_lines = (bytes[0] << 8) | bytes[1];
+        io->scroll_lines = (bytes[2] << 8) | bytes[3];
+    }
+    else if ( (command == LCD_CMD_VSCSAD) && (size == 2) )
+    {
+        io->scroll_start = (bytes[0] << 8) | bytes[1];
+    }
+    else if ( (command == LCD_CMD_COLMOD) && (size == 1) )
+    {
+        io->packed = (bytes[0] & 0x07) == 0x03;
+    }
+
+    return ESP_OK;
+}
+
+
+esp_err_t esp_lcd_panel_io_tx_color(esp_lcd_panel_io_handle_t io, int command, const void *color, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t *)color;
+
+    // Reports what is done by now.
+    while (finish_oldest(io, 0))
+    {
+    }
+
+    if (command == LCD_CMD_RAMWR)
+    {
+        io->x = io->x_start;
+        io->y = io->y_start;
+    }
+
+    if (io->packed)
+    {
+        // Two RGB444 pixels in three bytes, widened to BGR565 by repeating the top bits.
+        for (size_t pixel = 0; pixel < size * 2 / 3; ++pixel)
+        {
+            const uint8_t *pair = bytes + (pixel / 2) * 3;
+            uint32_t rgb444 = pixel % 2 == 0 ? (pair[0] << 4) | (pair[1] >> 4) : ((pair[1] & 0x0F) << 8) | pair[2];
+            uint32_t red = rgb444 >> 8;
+            uint32_t green = (rgb444 >> 4) & 0x0F;
+            uint32_t blue = rgb444 & 0x0F;
+            uint32_t rgb565 = (((red << 1) | (red >> 3)) << 11) | (((green << 2) | (green >> 2)) << 5) | ((blue << 1) | (blue >> 3));
+
+            write_pixel(io, (uint16_t)((rgb565 >> 8) | (rgb565 << 8)));
+        }
+    }
+    else
+    {
+        for (size_t pixel = 0; pixel < size / 2; ++pixel)
+        {
+            uint16_t value;
+            memcpy(&value, bytes + pixel * 2, sizeof(value));
+            write_pixel(io, value);
+        }
+    }
+
+    // Queued in transactions of at most the max transfer size, each waiting for room when the queue is full. They are
+    // sent after the transactions queued before them, the first with a byte of command.
+    size_t sent = 0;
+    do
+    {
+        size_t chunk = size - sent < io->max_transfer_size ? size - sent : io->max_transfer_size;
+
+        if (io->queued_amount >= io->queue_depth)
+        {
+            io->full_queue_waits += 1;
+            finish_oldest(io, 1);
+        }
+
+        int64_t start_us = esp_timer_get_time();
+        if ( (io->queued_amount > 0) && (io->done_us[(io->queued_first + io->queued_amount - 1) % STAND_IN_MAX_QUEUED] > start_us) )
+        {
+            start_us = io->done_us[(io->queued_first + io->queued_amount - 1) % STAND_IN_MAX_QUEUED];
+        }
+
+        int64_t send_us = io->pixel_clock_hz > 0 ? (int64_t)(chunk + (sent == 0)) * 8 * 1000000 / io->pixel_clock_hz : 0;
+        int slot = (io->queued_first + io->queued_amount) % STAND_IN_MAX_QUEUED;
+        io->done_us[slot] = start_us + send_us;
+        io->last_of_transfer[slot] = sent + chunk >= size;
+        io->queued_amount += 1;
+        if (io->queued_amount > io->queued_high_water)
+        {
+            io->queued_high_water = io->queued_amount;
+        }
+
+        sent += chunk;
+    } while (sent < size);
+
+    return ESP_OK;
+}
+
+
+esp_err_t esp_lcd_panel_draw_bitmap(esp_lcd_panel_handle_t panel, int x_start, int y_start, int x_end, int y_end, const void *color)
+{
+    uint8_t column[4] = { x_start >> 8, x_start & 0xFF, (x_end - 1) >> 8, (x_end - 1) & 0xFF };
+    uint8_t row[4] = { y_start >> 8, y_start & 0xFF, (y_end - 1) >> 8, (y_end - 1) & 0xFF };
+
+    esp_lcd_panel_io_tx_param(panel, LCD_CMD_CASET, column, 4);
+    esp_lcd_panel_io_tx_param(panel, LCD_CMD_RASET, row, 4);
+
+    return esp_lcd_panel_io_tx_color(panel, LCD_CMD_RAMWR, color, (x_end - x_start) * (y_end - y_start) * 2);
+}
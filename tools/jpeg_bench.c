@@ -0,0 +1,150 @@
+// Host benchmark of the JPEG decoder in code/graphics_jpeg.c, built with the host shims of tools/host. Bands go to
+// memory, not to the stand-in panel.
+//
+//   cc -O2 -DGRAPHICS_HOST_BUILD -DGRAPHICS_BOARD=0 -Icode -Itools/host
+//       tools/jpeg_bench.c code/graphics_jpeg.c code/graphics_stream.c code/graphics.c tools/host/stand_in_panel.c -o jpeg_bench
+//   ./jpeg_bench photo.jpg [scale 1/2/4/8] [iterations] [output.ppm]
+//
+// The file is decoded from memory the given amount of times and the output of the last run can be written as
+// a PPM, converted back from BGR565, to check it against another decoder.
+
+#ifndef GRAPHICS_HOST_BUILD
+#error "jpeg_bench needs GRAPHICS_HOST_BUILD, build it with the cc line above."
+#endif
+
+#include "graphics_jpeg.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// The benchmark's own buffers are not counted as allocations of the library.
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+
+
+typedef struct {
+    uint16_t *band;
+    uint16_t *image;            // NULL when not writing an output file.
+    int width;
+} bench_output_t;
+
+
+static uint16_t *get_band(void *band_ctx)
+{
+    return ((bench_output_t *)band_ctx)->band;
+}
+
+
+static int put_band(void *band_ctx, uint16_t *pixels, unsigned short y, unsigned short width, unsigned short lines)
+{
+    bench_output_t *output = (bench_output_t *)band_ctx;
+
+    if (output->image != NULL)
+    {
+        memcpy(output->image + y * output->width, pixels, width * lines * sizeof(uint16_t));
+    }
+
+    return DRAW_SUCCESS;
+}
+
+
+static double seconds(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s photo.jpg [scale 1/2/4/8] [iterations] [output.ppm]\n", argv[0]);
+        return 1;
+    }
+
+    int scale = argc > 2 ? atoi(argv[2]) : 1;
+    int iterations = argc > 3 ? atoi(argv[3]) : 100;
+    const char *output_path = argc > 4 ? argv[4] : NULL;
+
+    FILE *file = fopen(argv[1], "rb");
+    if (file == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t *data = malloc(size);
+    if ( (data == NULL) || (fread(data, 1, size, file) != (size_t)size) )
+    {
+        fprintf(stderr, "Cannot read %s.\n", argv[1]);
+        return 1;
+    }
+    fclose(file);
+
+    // Header only pass for the size, get_band stops it before any MCU is decoded.
+    memory_stream_t input = { .data = data, .size = size };
+    bench_output_t output = { 0 };
+    jpeg_output_t jpeg_output = {
+        .get_band = get_band,
+        .put_band = put_band,
+        .band_ctx = &output,
+        .max_width = 0xFFFF,
+        .max_height = 0xFFFF,
+    };
+    jpeg_info_t info = { 0 };
+
+    decode_jpeg(read_memory_stream, &input, scale, &jpeg_output, &info);
+    if (info.width == 0)
+    {
+        return 1;
+    }
+
+    output.width = (info.width + scale - 1) / scale;
+    int height = (info.height + scale - 1) / scale;
+    output.band = malloc(output.width * JPEG_MAX_MCU_SIZE * sizeof(uint16_t));
+    output.image = output_path != NULL ? calloc(output.width * height, sizeof(uint16_t)) : NULL;
+
+    double start = seconds();
+    int result = DRAW_SUCCESS;
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        input.position = 0;
+        result |= decode_jpeg(read_memory_stream, &input, scale, &jpeg_output, NULL);
+    }
+
+    double elapsed = seconds() - start;
+
+    printf("%s: %dx%d, %d components, %dx%d sampling, scale 1/%d\n", argv[1], info.width, info.height,
+        info.components, info.h_sampling, info.v_sampling, scale);
+    printf("%.1f us per image, %.2f megapixels per second decoded, %.2f MB per second of JPEG data\n",
+        elapsed * 1e6 / iterations, (double)info.width * info.height * iterations / elapsed / 1e6,
+        (double)size * iterations / elapsed / 1e6);
+
+    if (output.image != NULL)
+    {
+        FILE *ppm = fopen(output_path, "wb");
+        fprintf(ppm, "P6\n%d %d\n255\n", output.width, height);
+
+        for (int i = 0; i < output.width * height; ++i)
+        {
+            uint16_t color = COLOR_SWAP(output.image[i]);
+            uint8_t rgb[3] = { (color >> 11) << 3, ((color >> 5) & 63) << 2, (color & 31) << 3 };
+            fwrite(rgb, 1, 3, ppm);
+        }
+
+        fclose(ppm);
+    }
+
+    return result;
+}
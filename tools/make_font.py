@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+"""Converts a TrueType font into an anti-aliased font for graphics_font.h, as a C table or a binary font blob.
+
+Needs Pillow (pip install pillow). Examples:
+
+    python3 make_font.py DejaVuSans.ttf 16 4 font_sans_16 --ranges 32-126,160-255 > font_sans_16.c
+    python3 make_font.py DejaVuSans.ttf 16 4 sans_16 --ranges 32-126,160-255 --blob sans_16.aaf
+
+Every glyph is rendered at the native pixel size, cropped to its ink, and stored as 2 or 4 bit coverage values,
+packed most significant bits first with every glyph line starting on a new byte.
+
+Binary font blob layout, all little endian:
+
+    0   "AAF1"
+    4   uint8 bpp, uint8 line height, uint8 baseline, uint8 reserved
+    8   uint16 range amount, uint16 glyph amount
+    12  uint32 range table offset, uint32 glyph table offset, uint32 bitmap offset, uint32 bitmap size
+    28  reserved up to 32
+
+    range table: uint32 first code point, uint16 length, uint16 first glyph, sorted by code point
+    glyph table: uint32 bitmap offset, uint8 width, uint8 height, int8 x offset, int8 y offset, uint8 advance, 3 reserved
+"""
+import argparse
+import struct
+import sys
+
+from PIL import Image, ImageDraw, ImageFont
+
+
+def render_glyph(font, char, levels):
+    ascent, descent = font.getmetrics()
+    advance = int(round(font.getlength(char)))
+    pad = ascent
+
+    canvas = Image.new("L", (advance + 2 * pad, ascent + descent + pad), 0)
+    ImageDraw.Draw(canvas).text((pad, 0), char, font=font, fill=255)
+
+    bbox = canvas.getbbox()
+    if bbox is None:
+        return {"width": 0, "height": 0, "x_offset": 0, "y_offset": 0, "advance": advance, "rows": []}
+
+    left, top, right, bottom = bbox
+    rows = []
+    for y in range(top, bottom):
+        rows.append([(canvas.getpixel((x, y)) * (levels - 1) + 127) // 255 for x in range(left, right)])
+
+    return {"width": right - left, "height": bottom - top, "x_offset": left - pad, "y_offset": top, "advance": advance, "rows": rows}
+
+
+def pack_rows(rows, bpp):
+    data = []
+    per_byte = 8 // bpp
+    for row in rows:
+        for i in range(0, len(row), per_byte):
+            byte = 0
+            for j in range(per_byte):
+                value = row[i + j] if i + j < len(row) else 0
+                byte |= value << (8 - bpp * (j + 1))
+            data.append(byte)
+    return data
+
+
+def parse_ranges(text):
+    ranges = []
+    for part in text.split(","):
+        first, _, last = part.partition("-")
+        first = int(first, 0)
+        last = int(last, 0) if last else first
+        ranges.append((first, last))
+
+    ranges.sort()
+    for (first, last), (next_first, _) in zip(ranges, ranges[1:]):
+        if next_first <= last:
+            raise SystemExit("ranges overlap: %d-%d and %d" % (first, last, next_first))
+    return ranges
+
+
+def char_comment(code):
+    if 32 <= code < 127:
+        return repr(chr(code))
+    return "U+%04X" % code
+
+
+def write_c(out, args, ranges, codes, glyphs, bitmap, ascent, descent):
+    out.write("// %s %dpx, %d bpp, characters %s. Generated by tools/make_font.py.\n" % (
+        args.ttf.split("/")[-1], args.size, args.bpp, args.ranges))
+    out.write("static const uint8_t %s_bitmap[] = \n{\n" % args.name)
+    for i in range(0, len(bitmap), 16):
+        out.write("    " + ",".join("0x%02X" % b for b in bitmap[i:i + 16]) + ",\n")
+    out.write("};\n\n")
+
+    out.write("static const aa_glyph_t %s_glyphs[] = \n{\n" % args.name)
+    for code, glyph in zip(codes, glyphs):
+        out.write("    { %5d, %2d, %2d, %3d, %3d, %2d },   // %s\n" % (
+            glyph["offset"], glyph["width"], glyph["height"], glyph["x_offset"], glyph["y_offset"], glyph["advance"],
+            char_comment(code)))
+    out.write("};\n\n")
+
+    out.write("static const aa_range_t %s_ranges[] = \n{\n" % args.name)
+    first_glyph = 0
+    for first, last in ranges:
+        out.write("    { %d, %d, %d },\n" % (first, last - first + 1, first_glyph))
+        first_glyph += last - first + 1
+    out.write("};\n\n")
+
+    out.write("const aa_font_t %s = {\n" % args.name)
+    out.write("    .bpp = %d,\n" % args.bpp)
+    out.write("    .line_height = %d,\n" % (ascent + descent))
+    out.write("    .baseline = %d,\n" % ascent)
+    out.write("    .first_char = %d,\n" % ranges[0][0])
+    out.write("    .glyph_amount = %d,\n" % len(glyphs))
+    out.write("    .glyphs = %s_glyphs,\n" % args.name)
+    out.write("    .bitmap = %s_bitmap,\n" % args.name)
+    out.write("    .ranges = %s_ranges,\n" % args.name)
+    out.write("    .range_amount = %d,\n" % len(ranges))
+    out.write("};\n")
+
+
+def write_blob(path, args, ranges, glyphs, bitmap, ascent, descent):
+    range_table = b""
+    first_glyph = 0
+    for first, last in ranges:
+        range_table += struct.pack("<IHH", first, last - first + 1, first_glyph)
+        first_glyph += last - first + 1
+
+    glyph_table = b""
+    for glyph in glyphs:
+        glyph_table += struct.pack("<IBBbbB3x", glyph["offset"], glyph["width"], glyph["height"],
+                                   glyph["x_offset"], glyph["y_offset"], glyph["advance"])
+
+    range_offset = 32
+    glyph_offset = range_offset + len(range_table)
+    bitmap_offset = glyph_offset + len(glyph_table)
+
+    header = b"AAF1" + struct.pack("<BBBxHHIIII", args.bpp, ascent + descent, ascent, len(ranges), len(glyphs),
+                                   range_offset, glyph_offset, bitmap_offset, len(bitmap))
+    header += b"\0" * (32 - len(header))
+
+    with open(path, "wb") as blob:
+        blob.write(header + range_table + glyph_table + bytes(bitmap))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("ttf")
+    parser.add_argument("size", type=int, help="pixel size")
+    parser.add_argument("bpp", type=int, choices=(2, 4))
+    parser.add_argument("name", help="C name of the aa_font_t")
+    parser.add_argument("--ranges", default="32-126", help="code point ranges, Ex: 32-126,160-255")
+    parser.add_argument("--blob", help="write a binary font blob to this file instead of a C table")
+    args = parser.parse_args()
+
+    font = ImageFont.truetype(args.ttf, args.size)
+    ascent, descent = font.getmetrics()
+    levels = 1 << args.bpp
+    ranges = parse_ranges(args.ranges)
+
+    codes = [code for first, last in ranges for code in range(first, last + 1)]
+    glyphs = []
+    bitmap = []
+    for code in codes:
+        glyph = render_glyph(font, chr(code), levels)
+        glyph["offset"] = len(bitmap)
+        bitmap += pack_rows(glyph["rows"], args.bpp)
+        glyphs.append(glyph)
+
+    if args.blob:
+        write_blob(args.blob, args, ranges, glyphs, bitmap, ascent, descent)
+    else:
+        write_c(sys.stdout, args, ranges, codes, glyphs, bitmap, ascent, descent)
+
+
+if __name__ == "__main__":
+    main()
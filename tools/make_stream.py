@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+"""Converts an image into an image stream for draw_image_stream() in graphics_stream.h.
+
+Needs Pillow (pip install pillow). Examples:
+
+    python3 make_stream.py photo.png photo.lcds --encoding qoi
+    python3 make_stream.py long_map.png map.lcds --encoding rle --window-height 240
+
+Stream layout, all little endian:
+
+    0   "LCDS"
+    4   uint8 version (1), uint8 encoding (0 raw, 1 RLE, 2 QOI)
+    6   uint16 x, uint16 y, uint16 window width, uint16 window height, uint16 reserved
+    16  uint32 lines, 0 for a stream that is read until it ends
+    20  pixel data
+
+Lines are drawn top to bottom in the window and wrap back to its top, so images taller than the window scroll
+through it. Raw pixels are BGR565 as sent to the LCD, 2 bytes each. RLE packets start with a count byte n:
+n < 128 is followed by n + 1 raw pixels, n >= 128 by a single pixel repeated n - 127 times.
+QOI data is the chunk stream of a QOI image without its header and end marker.
+"""
+import argparse
+import struct
+
+from PIL import Image
+
+
+def to_bgr565_bytes(red, green, blue):
+    # BGR565 in memory is RGB565 with its bytes swapped, so on the wire it is big endian RGB565.
+    return struct.pack(">H", ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3))
+
+
+def encode_raw(pixels):
+    return b"".join(to_bgr565_bytes(*pixel) for pixel in pixels)
+
+
+def encode_rle(pixels):
+    words = [to_bgr565_bytes(*pixel) for pixel in pixels]
+    out = bytearray()
+    i = 0
+    while i < len(words):
+        run = 1
+        while i + run < len(words) and run < 128 and words[i + run] == words[i]:
+            run += 1
+
+        if run >= 2:
+            out += bytes([run + 127]) + words[i]
+            i += run
+            continue
+
+        # Literals up to the next run of at least 2 pixels.
+        start = i
+        while i < len(words) and i - start < 128 and not (i + 1 < len(words) and words[i + 1] == words[i]):
+            i += 1
+        if i == start:
+            i += 1
+        out += bytes([i - start - 1]) + b"".join(words[start:i])
+    return bytes(out)
+
+
+def encode_qoi(pixels):
+    index = [(0, 0, 0, 0)] * 64
+    previous = (0, 0, 0, 255)
+    run = 0
+    out = bytearray()
+
+    for red, green, blue in pixels:
+        pixel = (red, green, blue, 255)
+
+        if pixel == previous:
+            run += 1
+            if run == 62:
+                out.append(0xC0 | (run - 1))
+                run = 0
+            continue
+
+        if run > 0:
+            out.append(0xC0 | (run - 1))
+            run = 0
+
+        position = (red * 3 + green * 5 + blue * 7 + 255 * 11) % 64
+        if index[position] == pixel:
+            out.append(position)
+        else:
+            index[position] = pixel
+            dr = (red - previous[0] + 128) % 256 - 128
+            dg = (green - previous[1] + 128) % 256 - 128
+            db = (blue - previous[2] + 128) % 256 - 128
+            drg = dr - dg
+            dbg = db - dg
+
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= drg <= 7 and -8 <= dbg <= 7:
+                out += bytes([0x80 | (dg + 32), ((drg + 8) << 4) | (dbg + 8)])
+            else:
+                out += bytes([0xFE, red, green, blue])
+
+        previous = pixel
+
+    if run > 0:
+        out.append(0xC0 | (run - 1))
+    return bytes(out)
+
+
+ENCODINGS = {"raw": (0, encode_raw), "rle": (1, encode_rle), "qoi": (2, encode_qoi)}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("image")
+    parser.add_argument("stream")
+    parser.add_argument("--encoding", choices=ENCODINGS, default="rle")
+    parser.add_argument("--x", type=int, default=0)
+    parser.add_argument("--y", type=int, default=0)
+    parser.add_argument("--window-height", type=int, help="window height, the image height by default")
+    parser.add_argument("--endless", action="store_true", help="write 0 lines, the stream is read until it ends")
+    args = parser.parse_args()
+
+    image = Image.open(args.image).convert("RGB")
+    width, height = image.size
+    window_height = args.window_height or height
+    encoding, encode = ENCODINGS[args.encoding]
+
+    header = b"LCDS" + struct.pack("<BBHHHHHI", 1, encoding, args.x, args.y, width, window_height, 0,
+                                   0 if args.endless else height)
+
+    with open(args.stream, "wb") as stream:
+        data = image.tobytes()
+        stream.write(header + encode(list(zip(data[0::3], data[1::3], data[2::3]))))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,614 @@
+// Replays a recording of dump_draw_record() through the library on the host, to reproduce and profile draw traffic
+// without the board.
+//
+//   cc -O2 -DGRAPHICS_HOST_BUILD -DGRAPHICS_RECORDER -DGRAPHICS_BOARD=0 -Icode -Itools/host
+//       tools/replay_draws.c code/graphics.c tools/host/stand_in_panel.c -o replay_draws
+//   ./replay_draws recording.bin [--asset image.raw]... [--ppm screen.ppm] [--trace trace.json]
+//
+// Every recorded call is made again with its recorded arguments on a stand-in panel of the recorded size, bits per
+// pixel and pixel clock, see tools/host/graphics_host.h. Fonts are loaded again into buffers of the replayer, and
+// images drawn out of a loaded font are drawn out of the replayed one. Other image payloads are only known by address
+// and hash unless they were small enough to be copied into the recording: give their pixels, in the format drawn, as
+// --asset files to have them matched by hash. Payloads that stay unknown are drawn as a checker pattern and counted.
+//
+// Prints the recorded calls per type with their time on the device, then what the replay sent: windows, command and
+// pixel bytes and the time those bytes take at the recorded pixel clock. --ppm writes the resulting screen. The
+// stand-in panel takes as long as the pixel clock would to send, so built with -DGRAPHICS_TRACE as well, --trace
+// writes a Chrome trace of the replay with the waits and transfers in flight, to open in Perfetto.
+//
+// Built with -DGRAPHICS_NO_HEAP, the replay fails if the library calls the allocator at all.
+//
+// Recordings are read in the byte order of the host, which is the one of the ESP32 on x86 and ARM hosts.
+
+#if !defined(GRAPHICS_HOST_BUILD) || !defined(GRAPHICS_RECORDER)
+#error "replay_draws needs GRAPHICS_HOST_BUILD and GRAPHICS_RECORDER, build it with the cc line above."
+#endif
+
+#include "graphics.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The replayer's own buffers are not counted as allocations of the library.
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+
+
+#define REPLAY_MAX_ASSETS 32
+#define REPLAY_MAX_FONTS 8
+
+
+typedef struct {
+    const char *path;
+    uint8_t *data;
+    uint32_t size;
+    uint32_t hash;
+} asset_t;
+
+// Font loaded by the recording, and where the replay keeps it.
+typedef struct {
+    uint32_t address;
+    uint32_t pixels;
+    uint16_t *font;
+} replay_font_t;
+
+typedef struct {
+    asset_t assets[REPLAY_MAX_ASSETS];
+    int asset_amount;
+
+    replay_font_t fonts[REPLAY_MAX_FONTS];
+    int font_amount;
+
+    // Placeholders and copies handed to queued draws, freed once everything is drawn.
+    void **buffers;
+    int buffer_amount;
+
+    uint32_t calls[RECORD_CALL_AMOUNT];
+    uint64_t call_us[RECORD_CALL_AMOUNT];
+    uint32_t max_call_us[RECORD_CALL_AMOUNT];
+    uint32_t failed;
+    uint32_t unresolved;
+} replay_t;
+
+
+static const char *call_names[RECORD_CALL_AMOUNT] = {
+    "fill_rect",
+    "fill_rect_async",
+    "draw_bgr_image",
+    "queue_bgr_image",
+    "draw_bgr_image_async",
+    "draw_image",
+    "wait_for_draws",
+    "begin_batch",
+    "end_batch",
+    "load_bitmap_letter_font",
+    "load_bitmap_numbers_font",
+    "draw_glyphs",
+    "draw_number",
+    "set_vertical_scroll",
+};
+
+
+static uint8_t *read_file(const char *path, uint32_t *size)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Cannot open %s.\n", path);
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    uint8_t *data = malloc(length > 0 ? length : 1);
+    if ( (data == NULL) || (fread(data, 1, length, file) != (size_t)length) )
+    {
+        fprintf(stderr, "Cannot read %s.\n", path);
+        free(data);
+        fclose(file);
+        return NULL;
+    }
+
+    fclose(file);
+    *size = length;
+
+    return data;
+}
+
+
+static void *keep_buffer(replay_t *replay, uint32_t size)
+{
+    void **buffers = realloc(replay->buffers, (replay->buffer_amount + 1) * sizeof(void *));
+    void *buffer = malloc(size > 0 ? size : 1);
+
+    if ( (buffers == NULL) || (buffer == NULL) )
+    {
+        fprintf(stderr, "Out of memory.\n");
+        exit(1);
+    }
+
+    replay->buffers = buffers;
+    replay->buffers[replay->buffer_amount++] = buffer;
+
+    return buffer;
+}
+
+
+static replay_font_t *find_font(replay_t *replay, uint32_t address)
+{
+    for (int i = 0; i < replay->font_amount; ++i)
+    {
+        if ( (address >= replay->fonts[i].address) && (address < replay->fonts[i].address + replay->fonts[i].pixels * sizeof(uint16_t)) )
+        {
+            return &replay->fonts[i];
+        }
+    }
+
+    return NULL;
+}
+
+
+// Font a recorded font address stands for, loaded again whenever the recording loads it.
+static uint16_t *load_font(replay_t *replay, uint32_t address, int letters, uint16_t color, uint16_t background_color)
+{
+    uint32_t pixels = letters ? LETTER_FONT_PIXELS : NUMBER_FONT_PIXELS;
+    replay_font_t *font = NULL;
+
+    for (int i = 0; i < replay->font_amount; ++i)
+    {
+        if (replay->fonts[i].address == address)
+        {
+            font = &replay->fonts[i];
+        }
+    }
+
+    if ( (font == NULL) && (replay->font_amount < REPLAY_MAX_FONTS) )
+    {
+        font = &replay->fonts[replay->font_amount++];
+        font->address = address;
+        font->font = keep_buffer(replay, LETTER_FONT_PIXELS * sizeof(uint16_t));
+    }
+
+    if (font == NULL)
+    {
+        fprintf(stderr, "More than %d fonts, font at 0x%08x is left out.\n", REPLAY_MAX_FONTS, (unsigned int)address);
+        return NULL;
+    }
+
+    font->pixels = pixels;
+
+    glyph_t unused;
+    if (letters)
+    {
+        load_bitmap_letter_font(&unused, font->font, color, background_color);
+    }
+    else
+    {
+        load_bitmap_numbers_font(&unused, font->font, color, background_color);
+    }
+
+    return font->font;
+}
+
+
+// Font of a glyph draw, a white on black one of the kind the glyph amount suggests if the recording lost its load.
+static uint16_t *resolve_font(replay_t *replay, uint32_t address, const glyph_t *glyph_params)
+{
+    replay_font_t *font = find_font(replay, address);
+
+    if (font != NULL)
+    {
+        return font->font + (address - font->address) / sizeof(uint16_t);
+    }
+
+    replay->unresolved += 1;
+    return load_font(replay, address, glyph_params->glyph_amount != 18, LCD_WHITE, LCD_BLACK);
+}
+
+
+// Pixels of an image payload: copied inline, out of a replayed font, a matching asset or else a checker pattern.
+static const void *resolve_image(replay_t *replay, const draw_record_t *record, const uint8_t *inline_payload, uint32_t size)
+{
+    if (record->inline_bytes == size)
+    {
+        void *copy = keep_buffer(replay, size);
+        memcpy(copy, inline_payload, size);
+        return copy;
+    }
+
+    replay_font_t *font = find_font(replay, record->payload);
+    if ( (font != NULL) && (record->payload + size <= font->address + font->pixels * sizeof(uint16_t)) )
+    {
+        return font->font + (record->payload - font->address) / sizeof(uint16_t);
+    }
+
+    for (int i = 0; i < replay->asset_amount; ++i)
+    {
+        if ( (replay->assets[i].size == size) && (replay->assets[i].hash == record->payload_hash) )
+        {
+            return replay->assets[i].data;
+        }
+    }
+
+    // Stripes of 0xF8 and 0 bytes, so placeholders stand out in any pixel format.
+    uint8_t *checker = keep_buffer(replay, size);
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        checker[i] = ((i / 8) + (i / 512)) % 2 == 0 ? 0xF8 : 0x00;
+    }
+
+    replay->unresolved += 1;
+    return checker;
+}
+
+
+static int replay_record(esp_lcd_panel_handle_t panel, replay_t *replay, const draw_record_t *record, const uint8_t *inline_payload)
+{
+    const uint16_t *args = record->args;
+    draw_t draw = { .scale_x = 1, .scale_y = 1, .draw_start_x = args[0], .draw_start_y = args[1],
+        .image_size_x = args[2], .image_size_y = args[3] };
+    glyph_t glyph_params = { .glyph_start_x = args[0], .glyph_start_y = args[1], .glyph_amount = args[2],
+        .glyph_size_x = args[3], .glyph_size_y = args[4], .glyph_spacing = args[5], .glyph_scale = args[6],
+        .ASCII_offset = (short)args[7] };
+    uint32_t image_bytes = (uint32_t)args[2] * args[3] * sizeof(uint16_t);
+    draw_fence_t fence;
+
+    switch (record->call)
+    {
+        case RECORD_FILL_RECT:
+            return fill_rect(panel, draw, args[4]);
+
+        case RECORD_FILL_RECT_ASYNC:
+            return fill_rect_async(panel, draw, args[4], &fence);
+
+        case RECORD_DRAW_BGR_IMAGE:
+        case RECORD_QUEUE_BGR_IMAGE:
+        case RECORD_DRAW_BGR_IMAGE_ASYNC:
+        {
+            draw.scale_x = args[4];
+            draw.scale_y = args[5];
+            const uint16_t *pixels = resolve_image(replay, record, inline_payload, image_bytes);
+
+            if (record->call == RECORD_DRAW_BGR_IMAGE)
+            {
+                return draw_bgr_image(panel, draw, pixels);
+            }
+            if (record->call == RECORD_QUEUE_BGR_IMAGE)
+            {
+                return queue_bgr_image(panel, draw, pixels);
+            }
+            return draw_bgr_image_async(panel, draw, pixels, &fence);
+        }
+
+        case RECORD_DRAW_IMAGE:
+        {
+            image_t image = { .format = args[4], .width = args[2], .height = args[3] };
+            uint32_t bytes = (uint32_t)image.width * image.height * (image.format == PIXEL_FORMAT_RGB888 ? 3 : 2);
+
+            image.pixels = resolve_image(replay, record, inline_payload, bytes);
+            return draw_image(panel, args[0], args[1], &image);
+        }
+
+        case RECORD_WAIT_FOR_DRAWS:
+            wait_for_draws();
+            return DRAW_SUCCESS;
+
+        case RECORD_BEGIN_BATCH:
+            return begin_batch(args[0], args[1]);
+
+        case RECORD_END_BATCH:
+            return end_batch();
+
+        case RECORD_LOAD_LETTER_FONT:
+        case RECORD_LOAD_NUMBER_FONT:
+            return load_font(replay, record->payload, record->call == RECORD_LOAD_LETTER_FONT, args[0], args[1]) == NULL ?
+                DRAW_FAILURE : DRAW_SUCCESS;
+
+        case RECORD_DRAW_GLYPHS:
+        {
+            // Text beyond RECORDER_INLINE_BYTES was not recorded, it is drawn as far as it is known.
+            if (args[8] > record->inline_bytes)
+            {
+                replay->unresolved += 1;
+            }
+
+            char *text = keep_buffer(replay, record->inline_bytes);
+            memcpy(text, inline_payload, record->inline_bytes);
+
+            return draw_glyphs(panel, glyph_params, resolve_font(replay, record->payload, &glyph_params), text, record->inline_bytes);
+        }
+
+        case RECORD_DRAW_NUMBER:
+            return draw_number(panel, glyph_params, resolve_font(replay, record->payload, &glyph_params),
+                (int)((uint32_t)args[8] | ((uint32_t)args[9] << 16)));
+
+        case RECORD_SET_VERTICAL_SCROLL:
+            return set_vertical_scroll(args[0], args[1], args[2]);
+
+        default:
+            fprintf(stderr, "Unknown call %d in the recording.\n", record->call);
+            return DRAW_FAILURE;
+    }
+}
+
+
+#ifdef GRAPHICS_TRACE
+static int write_to_file(void *write_ctx, const uint8_t *data, int size)
+{
+    return fwrite(data, 1, size, (FILE *)write_ctx);
+}
+
+
+static int write_trace(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Cannot create %s.\n", path);
+        return DRAW_FAILURE;
+    }
+
+    int result = dump_draw_trace(write_to_file, file);
+    fclose(file);
+
+    return result;
+}
+#endif
+
+
+static int write_ppm(const char *path)
+{
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Cannot create %s.\n", path);
+        return DRAW_FAILURE;
+    }
+
+    const uint16_t *memory = get_stand_in_memory();
+    fprintf(file, "P6\n%d %d\n255\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    for (int y = 0; y < SCREEN_HEIGHT; ++y)
+    {
+        for (int x = 0; x < SCREEN_WIDTH; ++x)
+        {
+            uint16_t BGR_color = memory[(y + SCREEN_HEIGHT_PIXEL_MISALIGNMENT) * STAND_IN_MEMORY_WIDTH + x + SCREEN_WIDTH_PIXEL_MISALIGNMENT];
+            uint16_t RGB_color = COLOR_SWAP(BGR_color);
+            uint8_t rgb[3] = {
+                ((RGB_color >> 11) & 0x1F) * 255 / 31,
+                ((RGB_color >> 5) & 0x3F) * 255 / 63,
+                (RGB_color & 0x1F) * 255 / 31,
+            };
+
+            fwrite(rgb, 1, sizeof(rgb), file);
+        }
+    }
+
+    fclose(file);
+
+    return DRAW_SUCCESS;
+}
+
+
+int main(int argc, char **argv)
+{
+    static replay_t replay;
+    const char *recording_path = NULL;
+    const char *ppm_path = NULL;
+    const char *trace_path = NULL;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if ( (strcmp(argv[i], "--asset") == 0) && (i + 1 < argc) )
+        {
+            if (replay.asset_amount == REPLAY_MAX_ASSETS)
+            {
+                fprintf(stderr, "At most %d assets.\n", REPLAY_MAX_ASSETS);
+                return 1;
+            }
+
+            asset_t *asset = &replay.assets[replay.asset_amount++];
+            asset->path = argv[++i];
+            asset->data = read_file(asset->path, &asset->size);
+            if (asset->data == NULL)
+            {
+                return 1;
+            }
+            asset->hash = hash_record_payload(asset->data, asset->size);
+        }
+        else if ( (strcmp(argv[i], "--ppm") == 0) && (i + 1 < argc) )
+        {
+            ppm_path = argv[++i];
+        }
+        else if ( (strcmp(argv[i], "--trace") == 0) && (i + 1 < argc) )
+        {
+            trace_path = argv[++i];
+        }
+        else if ( (argv[i][0] != '-') && (recording_path == NULL) )
+        {
+            recording_path = argv[i];
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s recording.bin [--asset image.raw]... [--ppm screen.ppm] [--trace trace.json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (recording_path == NULL)
+    {
+        fprintf(stderr, "Usage: %s recording.bin [--asset image.raw]... [--ppm screen.ppm] [--trace trace.json]\n", argv[0]);
+        return 1;
+    }
+
+    uint32_t size;
+    uint8_t *recording = read_file(recording_path, &size);
+    if (recording == NULL)
+    {
+        return 1;
+    }
+
+    draw_record_header_t header;
+    if (size < sizeof(header))
+    {
+        fprintf(stderr, "%s is too short for a recording.\n", recording_path);
+        return 1;
+    }
+    memcpy(&header, recording, sizeof(header));
+
+    if ( (header.magic != RECORDER_MAGIC) || (header.version != RECORDER_VERSION) || (header.record_size != sizeof(draw_record_t)) )
+    {
+        fprintf(stderr, "%s is not a version %d recording.\n", recording_path, RECORDER_VERSION);
+        return 1;
+    }
+
+    if (header.record_bytes > size - sizeof(header))
+    {
+        fprintf(stderr, "%s is cut short, %lu of %lu record bytes.\n", recording_path, (unsigned long)(size - sizeof(header)),
+            (unsigned long)header.record_bytes);
+        header.record_bytes = size - sizeof(header);
+    }
+
+    // A known board keeps its offsets, any other size is placed at the top left of the frame memory.
+    panel_descriptor_t panel_descriptor = panel_t_display;
+    if ( (header.screen_width == panel_t_display_s3.width) && (header.screen_height == panel_t_display_s3.height) )
+    {
+        panel_descriptor = panel_t_display_s3;
+    }
+    else if ( (header.screen_width != panel_t_display.width) || (header.screen_height != panel_t_display.height) )
+    {
+        panel_descriptor.name = "Recorded";
+        panel_descriptor.width = header.screen_width;
+        panel_descriptor.height = header.screen_height;
+        panel_descriptor.x_offset = 0;
+        panel_descriptor.y_offset = 0;
+    }
+
+    display_config_t config = panel_descriptor.default_config;
+    config.pixel_clock_hz = header.pixel_clock_hz != 0 ? header.pixel_clock_hz : config.pixel_clock_hz;
+    config.bits_per_pixel = header.bits_per_pixel != 0 ? header.bits_per_pixel : config.bits_per_pixel;
+
+    esp_lcd_panel_handle_t panel;
+    if ( (select_panel(&panel_descriptor) != DRAW_SUCCESS) || (setup_display_with_config(&panel, &config) != DRAW_SUCCESS) )
+    {
+        fprintf(stderr, "Cannot set up a %dx%d panel at %d bits per pixel.\n", header.screen_width, header.screen_height,
+            config.bits_per_pixel);
+        return 1;
+    }
+
+    transfer_stats_t setup_stats;
+    get_transfer_stats(&setup_stats);
+
+    const uint8_t *next = recording + sizeof(header);
+    const uint8_t *end = next + header.record_bytes;
+    uint32_t first_us = 0;
+    uint32_t last_us = 0;
+    uint32_t replayed = 0;
+
+    while (next + sizeof(draw_record_t) <= end)
+    {
+        draw_record_t record;
+        memcpy(&record, next, sizeof(record));
+
+        if ( (record.length < sizeof(record)) || (record.length > end - next) || (record.inline_bytes > record.length - sizeof(record)) )
+        {
+            fprintf(stderr, "Record %lu is damaged, the rest is left out.\n", (unsigned long)replayed);
+            break;
+        }
+
+        if (replayed == 0)
+        {
+            first_us = record.start_us;
+        }
+        last_us = record.start_us + record.duration_us;
+
+        if (record.call < RECORD_CALL_AMOUNT)
+        {
+            replay.calls[record.call] += 1;
+            replay.call_us[record.call] += record.duration_us;
+            if (record.duration_us > replay.max_call_us[record.call])
+            {
+                replay.max_call_us[record.call] = record.duration_us;
+            }
+        }
+
+        if (replay_record(panel, &replay, &record, next + sizeof(record)) != DRAW_SUCCESS)
+        {
+            replay.failed += 1;
+        }
+
+        replayed += 1;
+        next += record.length;
+    }
+
+    wait_for_draws();
+
+    transfer_stats_t stats;
+    get_transfer_stats(&stats);
+
+    uint64_t command_bytes = stats.command_bytes - setup_stats.command_bytes;
+    uint64_t pixel_bytes = stats.pixel_bytes - setup_stats.pixel_bytes;
+    double bus_ms = (command_bytes + pixel_bytes) * 8.0 * 1000.0 / config.pixel_clock_hz;
+
+    printf("Recording: %lu calls over %.3f ms on a %dx%d panel, %d bits at %.2f MHz, %lu dropped.\n\n",
+        (unsigned long)replayed, (last_us - first_us) / 1000.0, header.screen_width, header.screen_height, config.bits_per_pixel,
+        config.pixel_clock_hz / 1e6, (unsigned long)header.dropped);
+
+    printf("%-26s %8s %12s %10s %10s\n", "Call", "Count", "Device ms", "Mean us", "Max us");
+    for (int i = 0; i < RECORD_CALL_AMOUNT; ++i)
+    {
+        if (replay.calls[i] > 0)
+        {
+            printf("%-26s %8lu %12.3f %10.1f %10lu\n", call_names[i], (unsigned long)replay.calls[i], replay.call_us[i] / 1000.0,
+                (double)replay.call_us[i] / replay.calls[i], (unsigned long)replay.max_call_us[i]);
+        }
+    }
+
+    printf("\nReplayed: %lu windows, %llu command bytes, %llu pixel bytes, %lu draws merged, %.3f ms on the bus.\n",
+        (unsigned long)(stats.transfers - setup_stats.transfers), (unsigned long long)command_bytes,
+        (unsigned long long)pixel_bytes, (unsigned long)(stats.merged_draws - setup_stats.merged_draws), bus_ms);
+    printf("Failed calls: %lu, unresolved payloads: %lu.\n", (unsigned long)replay.failed, (unsigned long)replay.unresolved);
+
+    // A GRAPHICS_NO_HEAP build must replay without the library allocating anything, setup included.
+    printf("Allocator calls of the library: %lu.\n", (unsigned long)get_stand_in_allocations());
+
+    int result = 0;
+#ifdef GRAPHICS_NO_HEAP
+    if (get_stand_in_allocations() > 0)
+    {
+        fprintf(stderr, "The GRAPHICS_NO_HEAP build allocated memory.\n");
+        result = 1;
+    }
+#endif
+    if ( (ppm_path != NULL) && (write_ppm(ppm_path) != DRAW_SUCCESS) )
+    {
+        result = 1;
+    }
+    if (trace_path != NULL)
+    {
+#ifdef GRAPHICS_TRACE
+        result |= write_trace(trace_path) != DRAW_SUCCESS;
+#else
+        fprintf(stderr, "--trace needs a build with -DGRAPHICS_TRACE.\n");
+        result = 1;
+#endif
+    }
+
+    for (int i = 0; i < replay.buffer_amount; ++i)
+    {
+        free(replay.buffers[i]);
+    }
+    free(replay.buffers);
+    for (int i = 0; i < replay.asset_amount; ++i)
+    {
+        free(replay.assets[i].data);
+    }
+    free(recording);
+
+    return result;
+}
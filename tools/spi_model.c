@@ -0,0 +1,962 @@
+// Host timing model of the library's SPI traffic, to size screens and update rates before flashing anything.
+//
+//   cc -O2 -DGRAPHICS_HOST_BUILD -Icode -Itools/host tools/spi_model.c -o spi_model
+//   ./spi_model [options] scenario.txt | fill | image | text | dashboard
+//
+// A scenario is a list of draw calls per frame. Each call is broken into windows the way graphics.c sends them,
+// and every window into the esp_lcd transactions that carry it: CASET and RASET as polled parameter writes, then
+// the memory write command and the pixels in queued chunks of at most the max transfer size. Polled writes first
+// wait for the queue to drain, which is where small windows lose most of their time.
+//
+// The limits and the pool block and 12 bit chunk sizes are the ones of graphics.h, only the library's headers are
+// used. --lines and --screen take the place of PARALLEL_LINES and SCREEN_MAX_WIDTH in its size formulas.
+//
+// Scenario files, one call per line, # starts a comment:
+//   frame                   Starts a frame, the frame ends when everything in it is on the panel.
+//   fill X Y W H            fill_rect(), a band is filled once and sent for every band of the rectangle.
+//   image X Y W H           draw_bgr_image(), sent straight from the caller's buffer and waited for.
+//   queue X Y W H           queue_bgr_image(), sent straight from the caller's buffer without waiting.
+//   render X Y W H          Pixels computed into rotating pool blocks, Ex: anti-aliased text, sprites, widgets.
+//   wait                    wait_for_draws().
+//   batch GAP / end_batch   begin_batch() and end_batch().
+//
+// Options, the defaults are the ones in graphics.h:
+//   --clock MHZ             LCD_PIXEL_CLOCK_HZ, default 20.
+//   --lines N               PARALLEL_LINES, default 16, pool blocks and 12 bit chunks hold SCREEN_MAX_WIDTH * N pixels.
+//   --depth N               LCD_TRANS_QUEUE_DEPTH, the transaction queue depth, default 10.
+//   --max-transfer BYTES    Largest single transaction, default a full screen.
+//   --bits 16|12            Bits per pixel on the bus, default 16.
+//   --batch GAP             Draw every frame inside begin_batch(GAP), end_batch().
+//   --screen WxH            Default 135x240, the T-Display. Pool blocks are as wide as the screen, like
+//                           SCREEN_MAX_WIDTH of a single board build.
+//   --frames N              Frames of a built in scenario, default 10.
+//   --sweep                 Compares pixel clocks and band heights instead of printing the frames.
+//
+// Costs, estimates for an ESP32 at 240 MHz. Calibrate them against get_transfer_stats() on the real board:
+//   --poll-us US            CPU time of a polled parameter write besides its bits, default 8.
+//   --queue-us US           CPU time to queue a transaction, default 12.
+//   --gap-us US             Bus idle time between queued transactions, default 4.
+//   --fill-ns NS            CPU time per pixel filling a band, default 5.
+//   --render-ns NS          CPU time per pixel rendering, default 60.
+//   --copy-ns NS            CPU time per pixel copied into a batch, default 3.
+//   --pack-ns NS            CPU time per pixel packing RGB444, default 10.
+
+#include "graphics.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The model's own buffers go to the allocator of the host.
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+
+// POOL_BLOCK_PIXELS and LCD_PACK_BUFFER_PIXELS of graphics.h, for the band height and pool block width of the
+// configuration. They expand where a model_t *model is at hand.
+enum { DEFAULT_PARALLEL_LINES = PARALLEL_LINES };
+#undef PARALLEL_LINES
+#undef SCREEN_MAX_WIDTH
+#define PARALLEL_LINES (model->config->parallel_lines)
+#define SCREEN_MAX_WIDTH (model->config->screen_width)
+
+#define MODEL_MAX_FRAMES 1024
+
+
+typedef struct {
+    double pixel_clock_hz;
+    int parallel_lines;
+    int queue_depth;
+    int max_transfer_bytes;
+    int bits_per_pixel;
+    int batch_gap;              // -1 for no batch around every frame.
+    int screen_width;
+    int screen_height;
+
+    double poll_us;
+    double queue_us;
+    double gap_us;
+    double fill_ns;
+    double render_ns;
+    double copy_ns;
+    double pack_ns;
+} model_config_t;
+
+typedef struct {
+    int x;
+    int y;
+    int width;
+    int height;
+} window_t;
+
+// What a frame cost.
+typedef struct {
+    double frame_us;            // From the first call until everything is on the panel.
+    double bus_us;              // Time the bus was sending bits.
+    double cpu_us;              // CPU time spent computing pixels and setting up transactions.
+    double wait_us;             // CPU time spent waiting for the bus.
+    uint32_t windows;
+    uint32_t transactions;
+    uint64_t command_bytes;
+    uint64_t pixel_bytes;
+} frame_cost_t;
+
+// A window collected in a batch and where its pixels start in the batch block.
+typedef struct {
+    window_t window;
+    int offset;
+} batch_window_t;
+
+typedef struct {
+    const model_config_t *config;
+
+    // Timelines in microseconds.
+    double cpu;
+    double bus_free;
+    double in_flight[LCD_MAX_TRANS_QUEUE_DEPTH];
+    int in_flight_first;
+    int in_flight_amount;
+    double transfer_done[2];    // When the last two transfers are on the panel, the newest first.
+
+    // Open batch.
+    int batch_open;
+    int batch_gap;
+    batch_window_t batch_windows[BATCH_MAX_WINDOWS];
+    int batch_window_amount;
+    int batch_pixels_used;
+
+    frame_cost_t frame;
+    double frame_start;
+} model_t;
+
+// Draw call of a scenario.
+typedef enum {
+    CALL_FRAME,
+    CALL_FILL,
+    CALL_IMAGE,
+    CALL_QUEUE,
+    CALL_RENDER,
+    CALL_WAIT,
+    CALL_BATCH,
+    CALL_END_BATCH,
+} call_type_t;
+
+typedef struct {
+    call_type_t type;
+    window_t window;            // The gap of CALL_BATCH is kept in x.
+} call_t;
+
+typedef struct {
+    call_t *calls;
+    int call_amount;
+    int capacity;
+} scenario_t;
+
+
+// Bus time of some bytes, in microseconds.
+static double bits_us(const model_t *model, double bytes)
+{
+    return bytes * 8.0 * 1e6 / model->config->pixel_clock_hz;
+}
+
+
+// Drops the queued transactions the bus has finished by now.
+static void retire_transactions(model_t *model)
+{
+    while ( (model->in_flight_amount > 0) && (model->in_flight[model->in_flight_first] <= model->cpu) )
+    {
+        model->in_flight_first = (model->in_flight_first + 1) % LCD_MAX_TRANS_QUEUE_DEPTH;
+        model->in_flight_amount -= 1;
+    }
+}
+
+
+// The CPU blocks until the bus is idle.
+static void drain(model_t *model)
+{
+    if (model->bus_free > model->cpu)
+    {
+        model->frame.wait_us += model->bus_free - model->cpu;
+        model->cpu = model->bus_free;
+    }
+
+    model->in_flight_amount = 0;
+}
+
+
+// A polled write of a command and its parameters, it waits for the queue and for itself.
+static void polled_write(model_t *model, int bytes)
+{
+    drain(model);
+
+    double send_us = bits_us(model, bytes);
+    model->cpu += model->config->poll_us + send_us;
+    model->bus_free = model->cpu;
+
+    model->frame.cpu_us += model->config->poll_us;
+    model->frame.wait_us += send_us;
+    model->frame.bus_us += send_us;
+    model->frame.transactions += 1;
+    model->frame.command_bytes += bytes;
+}
+
+
+// A queued transaction of pixel bytes, the CPU only blocks while the queue is full.
+static void queued_write(model_t *model, int bytes)
+{
+    retire_transactions(model);
+
+    if (model->in_flight_amount == model->config->queue_depth)
+    {
+        double oldest = model->in_flight[model->in_flight_first];
+
+        model->frame.wait_us += oldest - model->cpu;
+        model->cpu = oldest;
+        retire_transactions(model);
+    }
+
+    model->cpu += model->config->queue_us;
+    model->frame.cpu_us += model->config->queue_us;
+
+    double start = model->bus_free > model->cpu ? model->bus_free : model->cpu;
+    double send_us = bits_us(model, bytes);
+    model->bus_free = start + model->config->gap_us + send_us;
+
+    int slot = (model->in_flight_first + model->in_flight_amount) % LCD_MAX_TRANS_QUEUE_DEPTH;
+    model->in_flight[slot] = model->bus_free;
+    model->in_flight_amount += 1;
+
+    model->frame.bus_us += send_us;
+    model->frame.transactions += 1;
+    model->frame.pixel_bytes += bytes;
+}
+
+
+// esp_lcd_panel_io_tx_color(), the command is a polled write and the pixels are queued in chunks. The library counts
+// every call as one transfer.
+static void tx_color(model_t *model, int bytes)
+{
+    polled_write(model, 1);
+
+    for (int offset = 0; offset < bytes; offset += model->config->max_transfer_bytes)
+    {
+        int chunk = bytes - offset < model->config->max_transfer_bytes ? bytes - offset : model->config->max_transfer_bytes;
+        queued_write(model, chunk);
+    }
+
+    model->transfer_done[1] = model->transfer_done[0];
+    model->transfer_done[0] = model->bus_free;
+}
+
+
+// wait_for_in_flight(1) in graphics.c, the CPU blocks until at most the newest transfer is left.
+static void wait_for_older_transfers(model_t *model)
+{
+    if (model->transfer_done[1] > model->cpu)
+    {
+        model->frame.wait_us += model->transfer_done[1] - model->cpu;
+        model->cpu = model->transfer_done[1];
+    }
+}
+
+
+static void cpu_work(model_t *model, double ns_per_pixel, int pixels)
+{
+    double work_us = ns_per_pixel * pixels / 1000.0;
+
+    model->cpu += work_us;
+    model->frame.cpu_us += work_us;
+}
+
+
+// send_window() in graphics.c.
+static void send_window(model_t *model, window_t window)
+{
+    int pixels = window.width * window.height;
+
+    polled_write(model, 5);
+    polled_write(model, 5);
+    model->frame.windows += 1;
+
+    if (model->config->bits_per_pixel == 12)
+    {
+        // submit_window_rgb444(): packed in chunks of LCD_PACK_BUFFER_PIXELS into two buffers used in turn, each chunk
+        // sent with its own memory write command.
+        for (int offset = 0; offset < pixels; offset += LCD_PACK_BUFFER_PIXELS)
+        {
+            int chunk_pixels = pixels - offset < LCD_PACK_BUFFER_PIXELS ? pixels - offset : LCD_PACK_BUFFER_PIXELS;
+
+            wait_for_older_transfers(model);
+            cpu_work(model, model->config->pack_ns, chunk_pixels);
+            tx_color(model, (chunk_pixels * 3 + 1) / 2);
+        }
+    }
+    else
+    {
+        tx_color(model, pixels * 2);
+    }
+}
+
+
+static void flush_batch(model_t *model)
+{
+    for (int i = 0; i < model->batch_window_amount; ++i)
+    {
+        send_window(model, model->batch_windows[i].window);
+    }
+
+    if (model->batch_window_amount > 0)
+    {
+        drain(model);
+    }
+
+    model->batch_window_amount = 0;
+    model->batch_pixels_used = 0;
+}
+
+
+// merge_batch_window() in graphics.c: the draw is merged into the last collected window if they share lines or columns,
+// the gap between them is small enough and filling it does not paint over a window collected earlier.
+static int merge_batch_window(model_t *model, window_t window, int pixels)
+{
+    batch_window_t *last = &model->batch_windows[model->batch_window_amount - 1];
+    window_t merged = last->window;
+    window_t gap = last->window;
+    int horizontal;
+
+    int last_x_end = last->window.x + last->window.width;
+    int last_y_end = last->window.y + last->window.height;
+    int x_end = window.x + window.width;
+    int y_end = window.y + window.height;
+
+    if ( (window.y == last->window.y) && (window.height == last->window.height) )
+    {
+        horizontal = 1;
+        merged.x = window.x < last->window.x ? window.x : last->window.x;
+        merged.width = (x_end > last_x_end ? x_end : last_x_end) - merged.x;
+
+        gap.x = window.x >= last_x_end ? last_x_end : x_end;
+        gap.width = window.x >= last_x_end ? window.x - last_x_end : (last->window.x >= x_end ? last->window.x - x_end : 0);
+    }
+    else if ( (window.x == last->window.x) && (window.width == last->window.width) )
+    {
+        horizontal = 0;
+        merged.y = window.y < last->window.y ? window.y : last->window.y;
+        merged.height = (y_end > last_y_end ? y_end : last_y_end) - merged.y;
+
+        gap.y = window.y >= last_y_end ? last_y_end : y_end;
+        gap.height = window.y >= last_y_end ? window.y - last_y_end : (last->window.y >= y_end ? last->window.y - y_end : 0);
+    }
+    else
+    {
+        return 0;
+    }
+
+    int gap_size = horizontal ? gap.width : gap.height;
+    if ( (gap_size > model->batch_gap) || (last->offset + merged.width * merged.height > POOL_BLOCK_PIXELS) )
+    {
+        return 0;
+    }
+
+    for (int i = 0; (i < model->batch_window_amount - 1) && (gap_size > 0); ++i)
+    {
+        const window_t *other = &model->batch_windows[i].window;
+
+        if ( (gap.x < other->x + other->width) && (other->x < gap.x + gap.width) &&
+            (gap.y < other->y + other->height) && (other->y < gap.y + gap.height) )
+        {
+            return 0;
+        }
+    }
+
+    // The last window's lines are moved into place, the gap is filled, then the draw is copied over them.
+    cpu_work(model, model->config->copy_ns, last->window.width * last->window.height + gap.width * gap.height + pixels);
+
+    last->window = merged;
+    model->batch_pixels_used = last->offset + merged.width * merged.height;
+
+    return 1;
+}
+
+
+// submit_window() in graphics.c.
+static void submit_window(model_t *model, window_t window)
+{
+    int pixels = window.width * window.height;
+
+    if (!model->batch_open)
+    {
+        send_window(model, window);
+        return;
+    }
+
+    if ( (model->batch_window_amount > 0) && merge_batch_window(model, window, pixels) )
+    {
+        return;
+    }
+
+    if ( (model->batch_pixels_used + pixels > POOL_BLOCK_PIXELS) || (model->batch_window_amount == BATCH_MAX_WINDOWS) )
+    {
+        flush_batch(model);
+    }
+
+    if (pixels > POOL_BLOCK_PIXELS)
+    {
+        send_window(model, window);
+        return;
+    }
+
+    cpu_work(model, model->config->copy_ns, pixels);
+    model->batch_windows[model->batch_window_amount].window = window;
+    model->batch_windows[model->batch_window_amount].offset = model->batch_pixels_used;
+    model->batch_window_amount += 1;
+    model->batch_pixels_used += pixels;
+}
+
+
+// Splits a draw into bands of at most a pool block, computing each one first.
+static void draw_bands(model_t *model, window_t window, double ns_per_pixel, int rotate_blocks)
+{
+    int band_lines = POOL_BLOCK_PIXELS / window.width;
+    int next_block = 0;
+    window_t band = window;
+
+    if (band_lines > window.height)
+    {
+        band_lines = window.height;
+    }
+
+    // A fill computes a single band and sends it for every band.
+    if (!rotate_blocks)
+    {
+        cpu_work(model, ns_per_pixel, window.width * band_lines);
+    }
+
+    for (int line = 0; line < window.height; line += band_lines)
+    {
+        band.y = window.y + line;
+        band.height = window.height - line < band_lines ? window.height - line : band_lines;
+
+        if (rotate_blocks)
+        {
+            if (next_block == POOL_BLOCK_AMOUNT)
+            {
+                drain(model);
+                next_block = 0;
+            }
+
+            cpu_work(model, ns_per_pixel, band.width * band.height);
+            next_block += 1;
+        }
+
+        submit_window(model, band);
+    }
+
+    drain(model);
+}
+
+
+static void run_call(model_t *model, const call_t *call)
+{
+    switch (call->type)
+    {
+        case CALL_FILL:
+            draw_bands(model, call->window, model->config->fill_ns, 0);
+            break;
+
+        case CALL_RENDER:
+            draw_bands(model, call->window, model->config->render_ns, 1);
+            break;
+
+        case CALL_IMAGE:
+            submit_window(model, call->window);
+            drain(model);
+            break;
+
+        case CALL_QUEUE:
+            submit_window(model, call->window);
+            break;
+
+        case CALL_WAIT:
+            drain(model);
+            break;
+
+        case CALL_BATCH:
+            model->batch_open = 1;
+            model->batch_gap = call->window.x;
+            break;
+
+        case CALL_END_BATCH:
+            flush_batch(model);
+            model->batch_open = 0;
+            break;
+
+        case CALL_FRAME:
+            break;
+    }
+}
+
+
+static void begin_frame(model_t *model)
+{
+    memset(&model->frame, 0, sizeof(frame_cost_t));
+    model->frame_start = model->cpu;
+
+    if (model->config->batch_gap >= 0)
+    {
+        model->batch_open = 1;
+        model->batch_gap = model->config->batch_gap;
+    }
+}
+
+
+static frame_cost_t end_frame(model_t *model)
+{
+    if (model->batch_open)
+    {
+        flush_batch(model);
+        model->batch_open = 0;
+    }
+
+    drain(model);
+    model->frame.frame_us = model->cpu - model->frame_start;
+
+    return model->frame;
+}
+
+
+// Runs a scenario, returns the amount of frames and their costs in frames.
+static int run_scenario(const model_config_t *config, const scenario_t *scenario, frame_cost_t *frames)
+{
+    model_t model;
+    int frame_amount = 0;
+
+    memset(&model, 0, sizeof(model_t));
+    model.config = config;
+
+    for (int i = 0; i < scenario->call_amount; ++i)
+    {
+        if (scenario->calls[i].type == CALL_FRAME)
+        {
+            if ( (i > 0) && (frame_amount < MODEL_MAX_FRAMES) )
+            {
+                frames[frame_amount++] = end_frame(&model);
+            }
+            begin_frame(&model);
+            continue;
+        }
+
+        // Calls before the first frame line form a frame of their own.
+        if (i == 0)
+        {
+            begin_frame(&model);
+        }
+
+        run_call(&model, &scenario->calls[i]);
+    }
+
+    if ( (scenario->call_amount > 0) && (frame_amount < MODEL_MAX_FRAMES) )
+    {
+        frames[frame_amount++] = end_frame(&model);
+    }
+
+    return frame_amount;
+}
+
+
+static void add_call(scenario_t *scenario, call_type_t type, int x, int y, int width, int height)
+{
+    if (scenario->call_amount == scenario->capacity)
+    {
+        scenario->capacity = scenario->capacity ? scenario->capacity * 2 : 256;
+        scenario->calls = realloc(scenario->calls, scenario->capacity * sizeof(call_t));
+        if (scenario->calls == NULL)
+        {
+            fprintf(stderr, "Out of memory.\n");
+            exit(1);
+        }
+    }
+
+    call_t *call = &scenario->calls[scenario->call_amount++];
+    call->type = type;
+    call->window.x = x;
+    call->window.y = y;
+    call->window.width = width;
+    call->window.height = height;
+}
+
+
+static int load_scenario(const char *path, const model_config_t *config, scenario_t *scenario)
+{
+    static const struct {
+        const char *name;
+        call_type_t type;
+        int arguments;
+    } keywords[] = {
+        { "frame", CALL_FRAME, 0 },
+        { "fill", CALL_FILL, 4 },
+        { "image", CALL_IMAGE, 4 },
+        { "queue", CALL_QUEUE, 4 },
+        { "render", CALL_RENDER, 4 },
+        { "wait", CALL_WAIT, 0 },
+        { "batch", CALL_BATCH, 1 },
+        { "end_batch", CALL_END_BATCH, 0 },
+    };
+
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Cannot open %s.\n", path);
+        return 1;
+    }
+
+    char line[256];
+    int line_number = 0;
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        char name[32];
+        int values[4] = { 0 };
+        line_number += 1;
+
+        char *comment = strchr(line, '#');
+        if (comment != NULL)
+        {
+            *comment = 0;
+        }
+
+        int fields = sscanf(line, "%31s %d %d %d %d", name, &values[0], &values[1], &values[2], &values[3]);
+        if (fields <= 0)
+        {
+            continue;
+        }
+
+        int keyword = 0;
+        int keyword_amount = sizeof(keywords) / sizeof(keywords[0]);
+        while ( (keyword < keyword_amount) && (strcmp(name, keywords[keyword].name) != 0) )
+        {
+            keyword += 1;
+        }
+
+        if ( (keyword == keyword_amount) || (fields - 1 != keywords[keyword].arguments) )
+        {
+            fprintf(stderr, "%s:%d: expected a call and its arguments.\n", path, line_number);
+            fclose(file);
+            return 1;
+        }
+
+        if ( (keywords[keyword].arguments == 4) &&
+            ( (values[0] < 0) || (values[1] < 0) || (values[2] <= 0) || (values[3] <= 0) ||
+            (values[0] + values[2] > config->screen_width) || (values[1] + values[3] > config->screen_height) ) )
+        {
+            fprintf(stderr, "%s:%d: window is empty or outside the screen.\n", path, line_number);
+            fclose(file);
+            return 1;
+        }
+
+        add_call(scenario, keywords[keyword].type, values[0], values[1], values[2], values[3]);
+    }
+
+    fclose(file);
+    return 0;
+}
+
+
+// Built in scenarios, frame_amount frames each.
+static int build_scenario(const char *name, const model_config_t *config, int frame_amount, scenario_t *scenario)
+{
+    int width = config->screen_width;
+    int height = config->screen_height;
+
+    for (int frame = 0; frame < frame_amount; ++frame)
+    {
+        add_call(scenario, CALL_FRAME, 0, 0, 0, 0);
+
+        if (strcmp(name, "fill") == 0)
+        {
+            add_call(scenario, CALL_FILL, 0, 0, width, height);
+        }
+        else if (strcmp(name, "image") == 0)
+        {
+            add_call(scenario, CALL_IMAGE, 0, 0, width, height);
+        }
+        else if (strcmp(name, "text") == 0)
+        {
+            // Lines of 16 pixel text, rendered a line at a time.
+            for (int y = 0; y + 18 <= height; y += 18)
+            {
+                add_call(scenario, CALL_RENDER, 0, y, width, 16);
+            }
+        }
+        else if (strcmp(name, "dashboard") == 0)
+        {
+            // Four numbers, three bars moving by a few pixels, a gauge and a chart column of single pixel fills.
+            for (int i = 0; i < 4; ++i)
+            {
+                add_call(scenario, CALL_RENDER, 4, 4 + i * 28, 60, 24);
+            }
+            for (int i = 0; i < 3; ++i)
+            {
+                add_call(scenario, CALL_FILL, 70 + (frame + i) % 8, 8 + i * 16, 4, 10);
+            }
+            add_call(scenario, CALL_RENDER, width - 64, 60, 60, 60);
+            for (int y = 0; y < 40; ++y)
+            {
+                add_call(scenario, CALL_FILL, frame % width, height - 80 + y * 2, 1, 1);
+            }
+        }
+        else
+        {
+            fprintf(stderr, "Unknown scenario %s.\n", name);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+
+static void print_frames(const model_config_t *config, const frame_cost_t *frames, int frame_amount)
+{
+    frame_cost_t total = { 0 };
+    double worst_us = 0;
+
+    printf("frame  windows  transactions  command B  pixel B   bus us    cpu us   wait us  frame us     fps\n");
+
+    for (int i = 0; i < frame_amount; ++i)
+    {
+        const frame_cost_t *frame = &frames[i];
+
+        // Long runs only show their first frames, the totals cover all of them.
+        if (i < 20)
+        {
+            printf("%5d  %7lu  %12lu  %9llu  %7llu  %7.0f  %8.0f  %8.0f  %8.0f  %6.1f\n", i, (unsigned long)frame->windows,
+                (unsigned long)frame->transactions, (unsigned long long)frame->command_bytes, (unsigned long long)frame->pixel_bytes,
+                frame->bus_us, frame->cpu_us, frame->wait_us, frame->frame_us, 1e6 / frame->frame_us);
+        }
+
+        total.frame_us += frame->frame_us;
+        total.bus_us += frame->bus_us;
+        total.cpu_us += frame->cpu_us;
+        total.wait_us += frame->wait_us;
+        if (frame->frame_us > worst_us)
+        {
+            worst_us = frame->frame_us;
+        }
+    }
+
+    printf("\n%d frames at %.0f MHz, %d lines per band, queue depth %d, %d bits per pixel", frame_amount,
+        config->pixel_clock_hz / 1e6, config->parallel_lines, config->queue_depth, config->bits_per_pixel);
+    if (config->batch_gap >= 0)
+    {
+        printf(", batched with gap %d", config->batch_gap);
+    }
+    printf("\naverage frame %.0f us (%.1f fps), worst %.0f us (%.1f fps)\n", total.frame_us / frame_amount,
+        1e6 * frame_amount / total.frame_us, worst_us, 1e6 / worst_us);
+    printf("bus busy %.0f%%, cpu busy %.0f%%, cpu waiting %.0f%%\n", 100 * total.bus_us / total.frame_us,
+        100 * total.cpu_us / total.frame_us, 100 * total.wait_us / total.frame_us);
+}
+
+
+// Average frames per second over pixel clocks and band heights, without and with batching.
+static void print_sweep(const model_config_t *config, const scenario_t *scenario, frame_cost_t *frames)
+{
+    static const int clocks_mhz[] = { 10, 20, 40, 80 };
+    static const int lines[] = { 8, 16, 32, 64 };
+    static const int batch_gaps[] = { -1, 0, 4 };
+
+    printf("average fps          ");
+    for (int l = 0; l < 4; ++l)
+    {
+        printf("  lines %-3d", lines[l]);
+    }
+    printf("\n");
+
+    for (int c = 0; c < 4; ++c)
+    {
+        for (int b = 0; b < 3; ++b)
+        {
+            model_config_t sweep_config = *config;
+            sweep_config.pixel_clock_hz = clocks_mhz[c] * 1e6;
+            sweep_config.batch_gap = batch_gaps[b];
+
+            if (batch_gaps[b] < 0)
+            {
+                printf("%2d MHz               ", clocks_mhz[c]);
+            }
+            else
+            {
+                printf("%2d MHz, batch gap %-2d ", clocks_mhz[c], batch_gaps[b]);
+            }
+
+            for (int l = 0; l < 4; ++l)
+            {
+                sweep_config.parallel_lines = lines[l];
+
+                int frame_amount = run_scenario(&sweep_config, scenario, frames);
+                double total_us = 0;
+                for (int i = 0; i < frame_amount; ++i)
+                {
+                    total_us += frames[i].frame_us;
+                }
+
+                printf("  %9.1f", 1e6 * frame_amount / total_us);
+            }
+            printf("\n");
+        }
+    }
+}
+
+
+int main(int argc, char **argv)
+{
+    model_config_t config = {
+        .pixel_clock_hz = LCD_PIXEL_CLOCK_HZ,
+        .parallel_lines = DEFAULT_PARALLEL_LINES,
+        .queue_depth = LCD_TRANS_QUEUE_DEPTH,
+        .max_transfer_bytes = 0,
+        .bits_per_pixel = 16,
+        .batch_gap = -1,
+        .screen_width = T_DISPLAY_WIDTH,
+        .screen_height = T_DISPLAY_HEIGHT,
+        .poll_us = 8,
+        .queue_us = 12,
+        .gap_us = 4,
+        .fill_ns = 5,
+        .render_ns = 60,
+        .copy_ns = 3,
+        .pack_ns = 10,
+    };
+
+    // Options setting a field of the configuration.
+    static const struct {
+        const char *name;
+        size_t offset;
+        int is_int;
+        double scale;
+    } options[] = {
+        { "--clock", offsetof(model_config_t, pixel_clock_hz), 0, 1e6 },
+        { "--lines", offsetof(model_config_t, parallel_lines), 1, 1 },
+        { "--depth", offsetof(model_config_t, queue_depth), 1, 1 },
+        { "--max-transfer", offsetof(model_config_t, max_transfer_bytes), 1, 1 },
+        { "--bits", offsetof(model_config_t, bits_per_pixel), 1, 1 },
+        { "--batch", offsetof(model_config_t, batch_gap), 1, 1 },
+        { "--poll-us", offsetof(model_config_t, poll_us), 0, 1 },
+        { "--queue-us", offsetof(model_config_t, queue_us), 0, 1 },
+        { "--gap-us", offsetof(model_config_t, gap_us), 0, 1 },
+        { "--fill-ns", offsetof(model_config_t, fill_ns), 0, 1 },
+        { "--render-ns", offsetof(model_config_t, render_ns), 0, 1 },
+        { "--copy-ns", offsetof(model_config_t, copy_ns), 0, 1 },
+        { "--pack-ns", offsetof(model_config_t, pack_ns), 0, 1 },
+    };
+
+    const char *scenario_name = NULL;
+    int frame_amount = 10;
+    int sweep = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        int takes_value = 1;
+
+        if (strcmp(argv[i], "--sweep") == 0)
+        {
+            sweep = 1;
+            takes_value = 0;
+        }
+        else if (argv[i][0] != '-')
+        {
+            scenario_name = argv[i];
+            takes_value = 0;
+        }
+        else if (value == NULL)
+        {
+            fprintf(stderr, "%s needs a value.\n", argv[i]);
+            return 1;
+        }
+        else if (strcmp(argv[i], "--screen") == 0)
+        {
+            sscanf(value, "%dx%d", &config.screen_width, &config.screen_height);
+        }
+        else if (strcmp(argv[i], "--frames") == 0)
+        {
+            frame_amount = atoi(value);
+        }
+        else
+        {
+            int option = 0;
+            int option_amount = sizeof(options) / sizeof(options[0]);
+            while ( (option < option_amount) && (strcmp(argv[i], options[option].name) != 0) )
+            {
+                option += 1;
+            }
+
+            if (option == option_amount)
+            {
+                fprintf(stderr, "Unknown option %s.\n", argv[i]);
+                return 1;
+            }
+
+            uint8_t *field = (uint8_t *)&config + options[option].offset;
+            if (options[option].is_int)
+            {
+                *(int *)field = atoi(value);
+            }
+            else
+            {
+                *(double *)field = atof(value) * options[option].scale;
+            }
+        }
+
+        i += takes_value;
+    }
+
+    if (config.max_transfer_bytes <= 0)
+    {
+        config.max_transfer_bytes = config.screen_width * config.screen_height * 2;
+    }
+
+    if ( (scenario_name == NULL) || (config.pixel_clock_hz <= 0) || (config.parallel_lines <= 0) ||
+        (config.queue_depth < 1) || (config.queue_depth > LCD_MAX_TRANS_QUEUE_DEPTH) ||
+        ( (config.bits_per_pixel != 16) && (config.bits_per_pixel != 12) ) || (config.screen_width <= 0) ||
+        (config.screen_height <= 0) || (frame_amount <= 0) )
+    {
+        fprintf(stderr, "usage: %s [options] scenario.txt | fill | image | text | dashboard, see the top of spi_model.c\n", argv[0]);
+        return 1;
+    }
+
+    scenario_t scenario = { 0 };
+    int failed;
+
+    if (strchr(scenario_name, '.') != NULL)
+    {
+        failed = load_scenario(scenario_name, &config, &scenario);
+    }
+    else
+    {
+        failed = build_scenario(scenario_name, &config, frame_amount > MODEL_MAX_FRAMES ? MODEL_MAX_FRAMES : frame_amount, &scenario);
+    }
+
+    if (failed || (scenario.call_amount == 0))
+    {
+        free(scenario.calls);
+        return 1;
+    }
+
+    static frame_cost_t frames[MODEL_MAX_FRAMES];
+
+    if (sweep)
+    {
+        print_sweep(&config, &scenario, frames);
+    }
+    else
+    {
+        print_frames(&config, frames, run_scenario(&config, &scenario, frames));
+    }
+
+    free(scenario.calls);
+    return 0;
+}